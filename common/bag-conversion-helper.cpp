@@ -10,7 +10,8 @@ namespace rs2
 {
     bool bag_conversion_helper::show_dialog_if_needed(const std::string& file)
     {
-        if (ends_with(rsutils::string::to_lower(file), ".db3"))
+        auto const lower = rsutils::string::to_lower(file);
+        if (ends_with(lower, ".db3") || ends_with(lower, ".mcap"))
             return false;
 #ifndef BUILD_ROSBAG2
         return false;  // No conversion available — load .bag directly
@@ -129,6 +129,16 @@ extern "C" {
     */
     void rs2_config_enable_record_to_file(rs2_config* config, const char* file, rs2_error ** error);
 
+    /**
+    * Set an allocator for the frames of every sensor the pipeline starts (see rs2_set_frame_allocator_cpp)
+    *
+    * \param[in] config    A pointer to an instance of a config
+    * \param[in] allocator allocator object created from c++ application, or null to use internal allocation. ownership over the allocator object is moved into the config
+    * \param[in] alignment required alignment of the allocated memory, in bytes; 0 if none is needed
+    * \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    */
+    void rs2_config_set_frame_allocator_cpp(rs2_config* config, rs2_frame_allocator* allocator, int alignment, rs2_error ** error);
+
 
     /**
     * Disable a device stream explicitly, to remove any requests on this stream type.
@@ -175,6 +175,15 @@ typedef enum rs2_calib_target_type
 } rs2_calib_target_type;
 const char* rs2_calib_target_type_to_string(rs2_calib_target_type type);
 
+/** \brief One of the samples in a batched motion frame (see RS2_OPTION_MOTION_BATCH_WINDOW) */
+typedef struct rs2_motion_sample
+{
+    rs2_vector data;                  /**< As a motion frame's: m/s^2 for accel, rad/s for gyro */
+    float reserved;
+    double timestamp;                 /**< In ms, in the frame's timestamp domain */
+    unsigned long long frame_number;
+} rs2_motion_sample;
+
 /**
 * retrieve metadata from frame handle
 * \param[in] frame      handle returned from a callback
@@ -193,6 +202,17 @@ rs2_metadata_type rs2_get_frame_metadata(const rs2_frame* frame, rs2_frame_metad
 */
 int rs2_supports_frame_metadata(const rs2_frame* frame, rs2_frame_metadata_value frame_metadata, rs2_error** error);
 
+/**
+* retrieve all the metadata a frame supports in one call, instead of one call per value
+* \param[in] frame         handle returned from a callback
+* \param[out] values       receives the value of each metadata, indexed by rs2_frame_metadata_value (0 if not supported)
+* \param[out] supported    receives, for each metadata, non-zero if the frame supports it
+* \param[in] count         the number of entries in each array, normally RS2_FRAME_METADATA_COUNT
+* \param[out] error        if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                  the number of supported metadata
+*/
+int rs2_get_frame_metadata_all(const rs2_frame* frame, rs2_metadata_type* values, int* supported, int count, rs2_error** error);
+
 /**
 * retrieve timestamp domain from frame handle. timestamps can only be comparable if they are in common domain
 * (for example, depth timestamp might come from system time while color timestamp might come from the device)
@@ -282,6 +302,27 @@ int rs2_get_frame_stride_in_bytes(const rs2_frame* frame, rs2_error** error);
 */
 int rs2_get_frame_bits_per_pixel(const rs2_frame* frame, rs2_error** error);
 
+/**
+* retrieve the DMABUF file descriptor of a frame whose data is a capture buffer shared with the driver (see
+* RS2_OPTION_ZERO_COPY), so it can be passed to other processes or devices without copying.
+* The descriptor is owned by the frame and stays valid only while the frame is held; dup() it to keep it longer.
+* Frames are extendable to RS2_EXTENSION_DMABUF_FRAME only when such a descriptor is available.
+* \param[in] frame      handle returned from a callback
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return               file descriptor of the frame data
+*/
+int rs2_get_frame_dmabuf_fd(const rs2_frame* frame, rs2_error** error);
+
+/**
+* retrieve the samples of a batched motion frame (see RS2_OPTION_MOTION_BATCH_WINDOW), oldest first. The frame's own
+* timestamp and frame number are those of the first sample, and its motion data is the first sample's data.
+* \param[in] frame      handle returned from a callback
+* \param[out] count     receives the number of samples; 0 if the frame is not a batch
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return               the samples, valid while the frame is held; null if the frame is not a batch
+*/
+const rs2_motion_sample* rs2_get_motion_samples(const rs2_frame* frame, int* count, rs2_error** error);
+
 /**
 * create additional reference to a frame without duplicating frame data
 * \param[in] frame      handle returned from a callback
@@ -138,6 +138,9 @@ extern "C" {
         RS2_OPTION_DISPARITY_SHIFT, /**< Embedded filter: stereo disparity shift (pre-stream only) */
         RS2_OPTION_THRESHOLD, /**< Embedded filter: merge threshold in mm (pre-stream only) */
         RS2_OPTION_DOWNSCALE_RATIO, /**< Embedded filter: secondary-frame downscale ratio (pre-stream only) */
+        RS2_OPTION_ZERO_COPY, /**< Hand backend frame buffers to frames directly instead of copying them: 0 - copy, 1 - zero-copy (copy while the user holds too many frames), 2 - zero-copy (drop while the user holds too many frames). Takes effect on the next stream start */
+        RS2_OPTION_PROCESSING_THREADS, /**< Number of threads a processing block may split each frame between: 1 - process on the calling thread only, 0 - one thread per core */
+        RS2_OPTION_MOTION_BATCH_WINDOW, /**< Deliver motion samples in batches, one frame per batch, instead of a frame per sample: how long (in ms) to keep adding samples before delivering them; 0 - off. Takes effect on the next stream start */
         RS2_OPTION_COUNT /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
     } rs2_option;
 
@@ -35,6 +35,15 @@ rs2_processing_block* rs2_create_colorizer(rs2_error** error);
 */
 rs2_processing_block* rs2_create_sync_processing_block(rs2_error** error);
 
+/**
+* Creates Sync processing block that matches frames exactly as rs2_create_sync_processing_block() does, but without
+* making the streams wait for each other: each stream queues its frames without locking, and whichever thread finds
+* the matcher free dispatches all pending frames in order of arrival
+* Frames of any one stream must not be passed to the block from more than one thread at a time
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+rs2_processing_block* rs2_create_lock_free_sync_processing_block(rs2_error** error);
+
 /**
 * Creates Point-Cloud processing block. This block accepts depth frames and outputs Points frames
 * In addition, given non-depth frame, the block will align texture coordinate to the non-depth stream
@@ -277,6 +286,18 @@ rs2_processing_block* rs2_create_disparity_transform_block(unsigned char transfo
 */
 rs2_processing_block* rs2_create_hole_filling_filter_block(rs2_error** error);
 
+/**
+* Creates Depth post-processing pipeline block. The block runs the decimation, depth to disparity, spatial, temporal
+* and disparity to depth chain in a single pass over each frame, producing the very same output as the chained blocks
+* but going through memory fewer times. The stages are existing blocks, whose options the pipeline follows.
+* \param[in] decimation  decimation filter block, or null to leave decimation out
+* \param[in] spatial     spatial filter block, or null to leave spatial filtering out
+* \param[in] temporal    temporal filter block, or null to leave temporal filtering out
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+rs2_processing_block* rs2_create_depth_pipeline_block(rs2_processing_block* decimation, rs2_processing_block* spatial,
+                                                      rs2_processing_block* temporal, rs2_error** error);
+
 /**
 * Creates a rates printer block. The printer prints the actual FPS of the invoked frame stream.
 * The block ignores reapiting frames and calculats the FPS only if the frame number of the relevant frame was changed.
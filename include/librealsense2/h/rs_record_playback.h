@@ -29,6 +29,46 @@ const char* rs2_playback_status_to_string(rs2_playback_status status);
 
 typedef void (*rs2_playback_status_changed_callback_ptr)(rs2_playback_status);
 
+/** \brief What a recorder does with a new frame when the frames waiting to be written already take up its whole memory budget */
+typedef enum rs2_record_overflow_policy
+{
+    RS2_RECORD_OVERFLOW_DROP_NEWEST, /**< The new frame is dropped. This is the default */
+    RS2_RECORD_OVERFLOW_DROP_OLDEST, /**< The oldest frames waiting to be written are dropped to make room for the new one */
+    RS2_RECORD_OVERFLOW_BLOCK,       /**< The sensor waits until enough frames were written. Nothing is dropped, but the sensor may lose frames of its own while waiting */
+    RS2_RECORD_OVERFLOW_COUNT
+} rs2_record_overflow_policy;
+
+const char* rs2_record_overflow_policy_to_string(rs2_record_overflow_policy policy);
+
+/** \brief How a recorder compresses the frames of a stream */
+typedef enum rs2_record_stream_codec
+{
+    RS2_RECORD_STREAM_CODEC_DEFAULT,        /**< Same as any other data: compressed by the file format if the recorder compresses, raw otherwise */
+    RS2_RECORD_STREAM_CODEC_DEPTH_LOSSLESS, /**< Z16 depth is encoded losslessly with a depth-specific codec, whether or not the recorder compresses. Usually a third of the size or less, for about the speed of the default */
+    RS2_RECORD_STREAM_CODEC_COUNT
+} rs2_record_stream_codec;
+
+const char* rs2_record_stream_codec_to_string(rs2_record_stream_codec codec);
+
+/** \brief Counters describing how well a recorder keeps up with its sensors */
+typedef struct rs2_record_statistics
+{
+    unsigned long long frames_received;  /**< Frames the sensors handed to the recorder */
+    unsigned long long frames_written;   /**< Frames written to the file */
+    unsigned long long frames_dropped;   /**< Frames dropped by the overflow policy */
+    unsigned long long queued_bytes;     /**< Frame data currently waiting to be written */
+    unsigned long long max_queued_bytes; /**< The most frame data that was waiting to be written at once */
+    unsigned long long blocked_ns;       /**< Total time sensors waited for room, with RS2_RECORD_OVERFLOW_BLOCK */
+} rs2_record_statistics;
+
+/** \brief What a playback file holds of one stream, as returned by rs2_playback_get_stream_range(). */
+typedef struct rs2_playback_stream_range
+{
+    unsigned long long frame_count;    /**< Frames of the stream in the file */
+    unsigned long long first_frame_ns; /**< File time of the first frame, in nanoseconds */
+    unsigned long long last_frame_ns;  /**< File time of the last frame, in nanoseconds */
+} rs2_playback_stream_range;
+
 /**
  * Creates a recording device to record the given device and save it to the given file
  * \param[in]  device    The device to record
@@ -71,6 +111,36 @@ void rs2_record_device_resume(const rs2_device* device, rs2_error** error);
 */
 const char* rs2_record_device_filename(const rs2_device* device, rs2_error** error);
 
+/**
+* Limits how much frame data a recorder may hold while waiting to write it to file, and sets what happens to frames
+* that do not fit. Frames are written on a separate thread; when the file cannot keep up, the frames waiting to be
+* written would otherwise grow without bound.
+* \param[in]  device     A recording device
+* \param[in]  max_bytes  The most frame data to hold (a single frame is always let through, even if larger)
+* \param[in]  policy     What to do with a frame that does not fit
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_record_device_set_queue_limit(const rs2_device* device, unsigned long long max_bytes, rs2_record_overflow_policy policy, rs2_error** error);
+
+/**
+* Sets how a recorder compresses the frames of one stream, from the next frame on. Only recordings to .db3 or .mcap
+* files support codecs other than the default.
+* \param[in]  device     A recording device
+* \param[in]  stream     The stream type
+* \param[in]  index      The stream index
+* \param[in]  codec      How to compress its frames; RS2_RECORD_STREAM_CODEC_DEPTH_LOSSLESS applies to Z16 frames only, others are recorded as by default
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_record_device_set_stream_codec(const rs2_device* device, rs2_stream stream, int index, rs2_record_stream_codec codec, rs2_error** error);
+
+/**
+* Gets the recorder's frame counters, e.g., to tell whether frames are being dropped
+* \param[in]  device     A recording device
+* \param[out] statistics Receives the counters
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_record_device_get_statistics(const rs2_device* device, rs2_record_statistics* statistics, rs2_error** error);
+
 /**
 * Creates a playback device to play the content of the given file
 * \param[in]  file      Path to the file to play
@@ -111,6 +181,18 @@ void rs2_playback_seek(const rs2_device* device, long long int time, rs2_error**
  */
 unsigned long long int rs2_playback_get_position(const rs2_device* device, rs2_error** error);
 
+/**
+ * Gets how many frames of a stream the file holds, and the file times of the first and last of them, without
+ * reading through the file
+ * \param[in]  device    A playback device
+ * \param[in]  stream    Stream type
+ * \param[in]  index     Stream index
+ * \param[out] range     Frame count and time range of the stream; zeroed if the stream is not in the file
+ * \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ * \return Non-zero if the stream is in the file
+ */
+int rs2_playback_get_stream_range(const rs2_device* device, rs2_stream stream, int index, rs2_playback_stream_range* range, rs2_error** error);
+
 /**
  * Pauses the playback
  * Calling pause() in "Paused" status does nothing
@@ -122,6 +122,14 @@ typedef struct rs2_combined_motion
     struct { double x, y, z; } linear_acceleration;
 } rs2_combined_motion;
 
+/** \brief How well frame data buffers are being recycled, since the sensor was created (see rs2_get_frame_buffer_pool_stats) */
+typedef struct rs2_frame_buffer_pool_stats
+{
+    unsigned long long hits;      /**< Frames whose data went into a buffer from the pool */
+    unsigned long long misses;    /**< Frames whose data had to be allocated */
+    unsigned long long evictions; /**< Buffers freed instead of being kept for reuse: stale, or no room left in the pool */
+} rs2_frame_buffer_pool_stats;
+
 /**
 * Deletes sensors list, any sensors created from this list will remain unaffected
 * \param[in] info_list list to delete
@@ -300,6 +308,41 @@ void rs2_set_notifications_callback(const rs2_sensor* sensor, rs2_notification_c
 */
 void rs2_set_notifications_callback_cpp(const rs2_sensor* sensor, rs2_notifications_callback* callback, rs2_error** error);
 
+/**
+* set an allocator for the memory that frames of specified sensor are written into, instead of librealsense allocating
+* it internally. This lets the application place frames directly where it needs them (e.g., huge pages or a
+* shared-memory ring) without copying them.
+* The allocator is used for video (including depth) frames, both raw and after format conversion; other frame types
+* are still allocated internally. If the allocator returns null, the frame falls back to internal memory.
+* Memory is freed through the allocator once the frame is released, even if that happens after the sensor stops.
+* \param[in] sensor    RealSense sensor
+* \param[in] allocate  function pointer returning at least 'size' bytes aligned to 'alignment', or null to reset to internal allocation
+* \param[in] free      function pointer to release memory returned by 'allocate'
+* \param[in] alignment required alignment of the returned memory, in bytes; 0 if none is needed
+* \param[in] user      auxiliary data the user wishes to receive together with every allocate/free call
+* \param[out] error    if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_frame_allocator(const rs2_sensor* sensor, rs2_frame_allocate_ptr allocate, rs2_frame_free_ptr free, int alignment, void* user, rs2_error** error);
+
+/**
+* set an allocator for the memory that frames of specified sensor are written into (see rs2_set_frame_allocator)
+* \param[in] sensor    RealSense sensor
+* \param[in] allocator allocator object created from c++ application, or null to reset to internal allocation. ownership over the allocator object is moved into the sensor and the frames it allocates
+* \param[in] alignment required alignment of the allocated memory, in bytes; 0 if none is needed
+* \param[out] error    if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_frame_allocator_cpp(const rs2_sensor* sensor, rs2_frame_allocator* allocator, int alignment, rs2_error** error);
+
+/**
+* retrieve the counters of the pool that frame data buffers of specified sensor are recycled through, including those
+* of the blocks converting its streams. Counters add up over the life of the sensor, across stop and start. Frames
+* written into memory from a frame allocator (see rs2_set_frame_allocator) do not go through the pool.
+* \param[in] sensor    RealSense sensor
+* \param[out] stats    the counters
+* \param[out] error    if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_get_frame_buffer_pool_stats(const rs2_sensor* sensor, rs2_frame_buffer_pool_stats* stats, rs2_error** error);
+
 /**
 * retrieve description from notification handle
 * \param[in] notification      handle returned from a callback
@@ -218,6 +218,8 @@ typedef enum rs2_extension
     RS2_EXTENSION_INFERENCE_SENSOR,
     RS2_EXTENSION_OBJECT_DETECTION_SENSOR,
     RS2_EXTENSION_INFERENCE_PROFILE,
+    RS2_EXTENSION_DMABUF_FRAME,
+    RS2_EXTENSION_DEPTH_PIPELINE,
     RS2_EXTENSION_COUNT
 } rs2_extension;
 const char* rs2_extension_type_to_string(rs2_extension type);
@@ -326,6 +328,7 @@ typedef struct rs2_options_changed_callback rs2_options_changed_callback;
 typedef struct rs2_devices_changed_callback rs2_devices_changed_callback;
 typedef struct rs2_notification rs2_notification;
 typedef struct rs2_notifications_callback rs2_notifications_callback;
+typedef struct rs2_frame_allocator rs2_frame_allocator;
 typedef struct rs2_firmware_log_message rs2_firmware_log_message;
 typedef struct rs2_firmware_log_parsed_message rs2_firmware_log_parsed_message;
 typedef struct rs2_firmware_log_parser rs2_firmware_log_parser;
@@ -338,6 +341,8 @@ typedef void (*rs2_frame_callback_ptr)(rs2_frame*, void*);
 typedef void (*rs2_frame_processor_callback_ptr)(rs2_frame*, rs2_source*, void*);
 typedef void (*rs2_update_progress_callback_ptr)(const float, void*);
 typedef void (*rs2_options_changed_callback_ptr)(const rs2_options_list *);
+typedef void* (*rs2_frame_allocate_ptr)(int size, int alignment, void* user);
+typedef void (*rs2_frame_free_ptr)(void* data, int size, void* user);
 
 typedef double      rs2_time_t;     /**< Timestamp format. units are milliseconds */
 typedef long long   rs2_metadata_type; /**< Metadata attribute type is defined as 64 bit signed integer*/
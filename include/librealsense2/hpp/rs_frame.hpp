@@ -6,6 +6,8 @@
 
 #include "rs_types.hpp"
 
+#include <map>
+
 namespace rs2
 {
     class frame_source;
@@ -540,6 +542,24 @@ namespace rs2
             return r != 0;
         }
 
+        /** retrieve all the metadata the frame supports at once, which is cheaper than querying them one by one
+        * \return            the value of each supported frame_metadata
+        */
+        std::map<rs2_frame_metadata_value, rs2_metadata_type> get_frame_metadata_all() const
+        {
+            rs2_metadata_type values[RS2_FRAME_METADATA_COUNT];
+            int supported[RS2_FRAME_METADATA_COUNT];
+            rs2_error* e = nullptr;
+            rs2_get_frame_metadata_all(frame_ref, values, supported, RS2_FRAME_METADATA_COUNT, &e);
+            error::handle(e);
+
+            std::map<rs2_frame_metadata_value, rs2_metadata_type> all;
+            for (int i = 0; i < RS2_FRAME_METADATA_COUNT; ++i)
+                if (supported[i])
+                    all[rs2_frame_metadata_value(i)] = values[i];
+            return all;
+        }
+
         /**
         * retrieve frame number (from frame handle)
         * \return               the frame number of the frame, in milliseconds since the device was started
@@ -1045,6 +1065,61 @@ namespace rs2
         {
             return *reinterpret_cast< rs2_combined_motion const * >( get_data() );
         }
+        /**
+         * Frames batched by RS2_OPTION_MOTION_BATCH_WINDOW carry several samples; get_motion_data() returns the first.
+         * \return int - the number of samples in a batched frame, or 0 if the frame is not a batch
+         */
+        int get_sample_count() const
+        {
+            rs2_error* e = nullptr;
+            int count = 0;
+            rs2_get_motion_samples(get(), &count, &e);
+            error::handle(e);
+            return count;
+        }
+        /**
+         * Retrieve the samples of a batched frame, oldest first; see get_sample_count().
+         * \return const rs2_motion_sample* - valid while the frame is held; null if the frame is not a batch
+         */
+        const rs2_motion_sample* get_samples() const
+        {
+            rs2_error* e = nullptr;
+            int count = 0;
+            auto samples = rs2_get_motion_samples(get(), &count, &e);
+            error::handle(e);
+            return samples;
+        }
+    };
+
+    class dmabuf_frame : public frame
+    {
+    public:
+        /**
+        * Extends the frame class for frames whose data is a capture buffer shared with the driver as a DMABUF
+        * (see RS2_OPTION_ZERO_COPY)
+        * \param[in] frame - existing frame instance
+        */
+        dmabuf_frame(const frame& f)
+            : frame(f)
+        {
+            rs2_error* e = nullptr;
+            if (!f || (rs2_is_frame_extendable_to(f.get(), RS2_EXTENSION_DMABUF_FRAME, &e) == 0 && !e))
+            {
+                reset();
+            }
+            error::handle(e);
+        }
+        /**
+        * Retrieve the DMABUF file descriptor of the frame data; it is valid only while the frame is held
+        * \return int - file descriptor
+        */
+        int get_fd() const
+        {
+            rs2_error* e = nullptr;
+            auto r = rs2_get_frame_dmabuf_fd(get(), &e);
+            error::handle(e);
+            return r;
+        }
     };
 
     class pose_frame : public frame
@@ -267,6 +267,23 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * Set an allocator for the memory that frames of every sensor the pipeline starts are written into.
+        * See \c sensor::set_frame_allocator().
+        *
+        * \param[in] allocate   callable accepting (int size, int alignment) and returning at least 'size' suitably aligned bytes
+        * \param[in] free       callable accepting (void* data, int size), releasing memory returned by 'allocate'
+        * \param[in] alignment  required alignment of the memory, in bytes; 0 if none is needed
+        */
+        template<class A, class F>
+        void set_frame_allocator(A allocate, F free, int alignment = 0)
+        {
+            rs2_error* e = nullptr;
+            rs2_config_set_frame_allocator_cpp(_config.get(),
+                new frame_allocator<A, F>(std::move(allocate), std::move(free)), alignment, &e);
+            error::handle(e);
+        }
+
         /**
         * Disable a device stream explicitly, to remove any requests on this stream profile.
         * The stream can still be enabled due to pipeline computer vision module request. This call removes any filter on the
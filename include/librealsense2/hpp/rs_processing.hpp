@@ -680,15 +680,16 @@ namespace rs2
     public:
         /**
         * Real asynchronous syncer within syncer class
+        * \param[in] lock_free    Queue each stream's frames without locking (see rs2_create_lock_free_sync_processing_block)
         */
-        asynchronous_syncer() : processing_block(init()) {}
+        asynchronous_syncer(bool lock_free = false) : processing_block(init(lock_free)) {}
 
     private:
-        std::shared_ptr<rs2_processing_block> init()
+        std::shared_ptr<rs2_processing_block> init(bool lock_free)
         {
             rs2_error* e = nullptr;
             auto block = std::shared_ptr<rs2_processing_block>(
-                rs2_create_sync_processing_block(&e),
+                lock_free ? rs2_create_lock_free_sync_processing_block(&e) : rs2_create_sync_processing_block(&e),
                 rs2_delete_processing_block);
 
             error::handle(e);
@@ -701,9 +702,11 @@ namespace rs2
     public:
         /**
         * Sync instance to align frames from different streams
+        * \param[in] queue_size   Number of framesets kept for wait_for_frames() / poll_for_frames()
+        * \param[in] lock_free    Queue each stream's frames without locking; the framesets are the same
         */
-        syncer(int queue_size = 1)
-            :_results(queue_size)
+        syncer(int queue_size = 1, bool lock_free = false)
+            :_sync(lock_free), _results(queue_size)
         {
             _sync.start(_results);
         }
@@ -1195,6 +1198,48 @@ namespace rs2
         }
     };
 
+    class depth_pipeline : public filter
+    {
+    public:
+        /**
+        * Create depth post-processing pipeline
+        * The pipeline runs decimation, depth to disparity, spatial, temporal and disparity to depth in a single
+        * pass over each frame. Its output is that of the chained blocks; the stages keep their own options.
+        * \param[in] decimation - decimation stage, or nullptr to leave it out
+        * \param[in] spatial    - spatial filtering stage, or nullptr to leave it out
+        * \param[in] temporal   - temporal filtering stage, or nullptr to leave it out
+        */
+        depth_pipeline(const decimation_filter* decimation, const spatial_filter* spatial, const temporal_filter* temporal)
+            : filter(init(decimation, spatial, temporal), 1) {}
+
+        depth_pipeline(filter f) :filter(f)
+        {
+            rs2_error* e = nullptr;
+            if (!rs2_is_processing_block_extendable_to(f.get(), RS2_EXTENSION_DEPTH_PIPELINE, &e) && !e)
+            {
+                _block.reset();
+            }
+            error::handle(e);
+        }
+    private:
+        friend class context;
+
+        static std::shared_ptr<rs2_processing_block> init(const decimation_filter* decimation,
+                                                          const spatial_filter* spatial,
+                                                          const temporal_filter* temporal)
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_depth_pipeline_block(decimation ? decimation->get() : nullptr,
+                                                spatial ? spatial->get() : nullptr,
+                                                temporal ? temporal->get() : nullptr, &e),
+                rs2_delete_processing_block);
+            error::handle(e);
+
+            return block;
+        }
+    };
+
     class rates_printer : public filter
     {
     public:
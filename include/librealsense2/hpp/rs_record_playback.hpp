@@ -85,6 +85,21 @@ namespace rs2
             return duration;
         }
 
+        /**
+        * Retrieves how many frames of a stream the file holds, and the file times of the first and last of them
+        * \param[in] stream  Stream type
+        * \param[in] index   Stream index
+        * \return Frame count and time range of the stream; all zero if the stream is not in the file
+        */
+        rs2_playback_stream_range get_stream_range(rs2_stream stream, int index = 0) const
+        {
+            rs2_error* e = nullptr;
+            rs2_playback_stream_range range;
+            rs2_playback_get_stream_range(_dev.get(), stream, index, &range, &e);
+            error::handle(e);
+            return range;
+        }
+
         /**
         * Sets the playback to a specified time point of the played data
         * \param[in] time  The time point to which playback should seek, expressed in units of nanoseconds (zero value = start)
@@ -266,6 +281,44 @@ namespace rs2
             error::handle(e);
             return filename;
         }
+
+        /**
+        * Limits how much frame data the recorder may hold while waiting to write it to file
+        * \param[in]  max_bytes  The most frame data to hold
+        * \param[in]  policy     What to do with frames that do not fit
+        */
+        void set_queue_limit(unsigned long long max_bytes, rs2_record_overflow_policy policy)
+        {
+            rs2_error* e = nullptr;
+            rs2_record_device_set_queue_limit(_dev.get(), max_bytes, policy, &e);
+            error::handle(e);
+        }
+
+        /**
+        * Gets the recorder's frame counters
+        * \return How many frames were received, written and dropped, and how much data is waiting to be written
+        */
+        rs2_record_statistics get_statistics() const
+        {
+            rs2_error* e = nullptr;
+            rs2_record_statistics statistics;
+            rs2_record_device_get_statistics(_dev.get(), &statistics, &e);
+            error::handle(e);
+            return statistics;
+        }
+
+        /**
+        * Sets how the recorder compresses the frames of one stream, from the next frame on
+        * \param[in]  stream  The stream type
+        * \param[in]  index   The stream index
+        * \param[in]  codec   How to compress its frames
+        */
+        void set_stream_codec(rs2_stream stream, int index, rs2_record_stream_codec codec)
+        {
+            rs2_error* e = nullptr;
+            rs2_record_device_set_stream_codec(_dev.get(), stream, index, codec, &e);
+            error::handle(e);
+        }
     protected:
         explicit recorder(std::shared_ptr<rs2_device> dev) : device(dev)
         {
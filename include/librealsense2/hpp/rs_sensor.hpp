@@ -99,6 +99,27 @@ namespace rs2
         void release() override { delete this; }
     };
 
+    template<class A, class F>
+    class frame_allocator : public rs2_frame_allocator
+    {
+        A allocate_function;
+        F free_function;
+    public:
+        explicit frame_allocator(A allocate, F free) : allocate_function(allocate), free_function(free) {}
+
+        void* allocate(int size, int alignment) override
+        {
+            return allocate_function(size, alignment);
+        }
+
+        void free(void* data, int size) override
+        {
+            free_function(data, size);
+        }
+
+        void release() override { delete this; }
+    };
+
 
     class sensor : public options
     {
@@ -213,6 +234,44 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * set an allocator for the memory that frames of this sensor are written into, instead of internal memory
+        * \param[in] allocate   callable accepting (int size, int alignment) and returning at least 'size' suitably aligned bytes, or nullptr to use internal memory for this frame
+        * \param[in] free       callable accepting (void* data, int size), releasing memory returned by 'allocate'
+        * \param[in] alignment  required alignment of the memory, in bytes; 0 if none is needed
+        */
+        template<class A, class F>
+        void set_frame_allocator(A allocate, F free, int alignment = 0) const
+        {
+            rs2_error* e = nullptr;
+            rs2_set_frame_allocator_cpp(_sensor.get(),
+                new frame_allocator<A, F>(std::move(allocate), std::move(free)), alignment, &e);
+            error::handle(e);
+        }
+
+        /**
+        * go back to allocating frames of this sensor internally
+        */
+        void reset_frame_allocator() const
+        {
+            rs2_error* e = nullptr;
+            rs2_set_frame_allocator_cpp(_sensor.get(), nullptr, 0, &e);
+            error::handle(e);
+        }
+
+        /**
+        * retrieve how frame data buffers of this sensor have been recycled so far (see rs2_get_frame_buffer_pool_stats)
+        * \return   the pool's hit, miss and eviction counters
+        */
+        rs2_frame_buffer_pool_stats get_frame_buffer_pool_stats() const
+        {
+            rs2_error* e = nullptr;
+            rs2_frame_buffer_pool_stats stats = {};
+            rs2_get_frame_buffer_pool_stats(_sensor.get(), &stats, &e);
+            error::handle(e);
+            return stats;
+        }
+
         /**
         * Retrieves the list of stream profiles supported by the sensor.
         * \return   list of stream profiles that given sensor can provide
@@ -52,6 +52,15 @@ struct rs2_notifications_callback
 };
 typedef std::shared_ptr<rs2_notifications_callback> rs2_notifications_callback_sptr;
 
+struct rs2_frame_allocator
+{
+    virtual void*                           allocate(int size, int alignment) = 0;
+    virtual void                            free(void* data, int size) = 0;
+    virtual void                            release() = 0;
+    virtual                                 ~rs2_frame_allocator() {}
+};
+typedef std::shared_ptr<rs2_frame_allocator> rs2_frame_allocator_sptr;
+
 typedef void ( *log_callback_function_ptr )(rs2_log_severity severity, rs2_log_message const * msg );
 
 struct rs2_software_device_destruction_callback
@@ -138,6 +138,43 @@ float rs2_depth_frame_get_distance(const rs2_frame* frame_ref, int x, int y, rs2
 */
 rs2_time_t rs2_get_time( rs2_error** error);
 
+/**
+* Periodic background work (device polling, option watching, temperature monitoring, etc.) runs on a small pool of
+* threads shared by all devices. Returns the pool's size and, for each task registered with it, its name, interval,
+* whether it is active, how many times it ran, and its average/maximum run time and maximum lateness (all in ms).
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return            JSON text: { "threads": N, "tasks": [ { "name", "interval-ms", "active", "runs", "average-ms",
+*                    "max-ms", "max-late-ms" }, ... ] }; "threads" is 0 while no task exists.
+*                    Must be released with rs2_delete_raw_data()
+*/
+rs2_raw_data_buffer* rs2_get_timer_service_stats( rs2_error** error );
+
+/**
+* Start or stop timing frames on their way from the sensors to the user, per stream: how long after arriving from the
+* backend they were allocated, unpacked, synced and delivered to the user (to a callback, or out of a frame queue or
+* pipeline), how long each processing block took with them, and how long the user's callbacks took. A callback that
+* hands its frames straight back (to a processing block or a frame queue, like rs2::syncer does) is not the user's:
+* they are delivered where they come out. Off by default; starting clears the statistics so far.
+* \param[in] enable      non-zero to start tracing, zero to stop
+* \param[in] trace_file  if non-null and not empty when starting, every stamp is also written to this binary file, for
+*                        offline analysis (the format is documented in src/core/latency-tracer.cpp)
+* \param[out] error      if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_enable_latency_tracing( int enable, const char* trace_file, rs2_error** error );
+
+/**
+* The per-stream latency statistics gathered since rs2_enable_latency_tracing() was last started, for each device
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return            JSON text: { "enabled": bool, "devices": { "<device>": { "<stream>": { "frames": N, "allocated",
+*                    "unpacked", "synced", "delivered", "user-callback", "processing-blocks": { "<block>", ... } } } } },
+*                    where each entry present is { "count", "average", "p50", "p99", "max" } in ms. Devices go by
+*                    serial number, or name ("#2" and on if several have the same); streams made by processing blocks
+*                    are under the device of their source. Processing blocks are timed without what their output
+*                    callbacks do in-line.
+*                    Must be released with rs2_delete_raw_data()
+*/
+rs2_raw_data_buffer* rs2_get_stream_latency_stats( rs2_error** error );
+
 void rs2_hw_monitor_get_opcode_string(int opcode, char* buffer, size_t buffer_size,rs2_device* device, rs2_error** error);
 
 #ifdef __cplusplus
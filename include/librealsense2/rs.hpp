@@ -160,6 +160,51 @@ namespace rs2
         rs2_log(severity, message, &e);
         error::handle(e);
     }
+
+    // Statistics of the threads shared by all devices for periodic work, as JSON text (see rs2_get_timer_service_stats)
+    inline std::string get_timer_service_stats()
+    {
+        rs2_error* e = nullptr;
+        std::shared_ptr<const rs2_raw_data_buffer> stats(
+            rs2_get_timer_service_stats(&e),
+            rs2_delete_raw_data);
+        error::handle(e);
+
+        auto size = rs2_get_raw_data_size(stats.get(), &e);
+        error::handle(e);
+
+        auto start = rs2_get_raw_data(stats.get(), &e);
+        error::handle(e);
+
+        return std::string(start, start + size);
+    }
+
+    // Start or stop timing frames from the sensors to the user, optionally to a binary trace file (see
+    // rs2_enable_latency_tracing)
+    inline void enable_latency_tracing(bool enable, const std::string& trace_file = std::string())
+    {
+        rs2_error* e = nullptr;
+        rs2_enable_latency_tracing(enable, trace_file.c_str(), &e);
+        error::handle(e);
+    }
+
+    // Per-device, per-stream latency percentiles, as JSON text (see rs2_get_stream_latency_stats)
+    inline std::string get_stream_latency_stats()
+    {
+        rs2_error* e = nullptr;
+        std::shared_ptr<const rs2_raw_data_buffer> stats(
+            rs2_get_stream_latency_stats(&e),
+            rs2_delete_raw_data);
+        error::handle(e);
+
+        auto size = rs2_get_raw_data_size(stats.get(), &e);
+        error::handle(e);
+
+        auto start = rs2_get_raw_data(stats.get(), &e);
+        error::handle(e);
+
+        return std::string(start, start + size);
+    }
 }
 
 inline std::ostream & operator << (std::ostream & o, rs2_stream stream) { return o << rs2_stream_to_string(stream); }
@@ -5,12 +5,14 @@
 
 #include "core/frame-additional-data.h"
 #include "callback-invocation.h"
+#include "frame-buffer-pool.h"
 
 
 namespace librealsense
 {
     class frame_interface;
     class sensor_interface;
+    class frame_allocator;
 
     class archive_interface
     {
@@ -21,6 +23,11 @@ namespace librealsense
 
         virtual std::shared_ptr<metadata_parser_map> get_md_parsers() const = 0;
 
+        virtual frame_buffer_pool_stats get_buffer_pool_stats() const = 0;
+
+        // Use a user-supplied allocator for frame data, where the frame type allows it (nullptr to reset)
+        virtual void set_frame_allocator( std::shared_ptr< frame_allocator > const & allocator ) = 0;
+
         virtual std::shared_ptr< sensor_interface > get_sensor() const = 0;
         virtual void set_sensor( const std::weak_ptr< sensor_interface > & ) = 0;
 
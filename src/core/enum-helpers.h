@@ -62,6 +62,8 @@ RS2_ENUM_HELPERS( rs2_exception_type, EXCEPTION_TYPE )
 RS2_ENUM_HELPERS( rs2_log_severity, LOG_SEVERITY )
 RS2_ENUM_HELPERS( rs2_notification_category, NOTIFICATION_CATEGORY )
 RS2_ENUM_HELPERS( rs2_playback_status, PLAYBACK_STATUS )
+RS2_ENUM_HELPERS( rs2_record_overflow_policy, RECORD_OVERFLOW )
+RS2_ENUM_HELPERS( rs2_record_stream_codec, RECORD_STREAM_CODEC )
 RS2_ENUM_HELPERS( rs2_matchers, MATCHER )
 RS2_ENUM_HELPERS( rs2_sensor_mode, SENSOR_MODE )
 RS2_ENUM_HELPERS( rs2_l500_visual_preset, L500_VISUAL_PRESET )
@@ -7,6 +7,8 @@
 #include <map>
 #include <memory>
 #include <array>
+#include <bitset>
+#include <atomic>
 #include <cstring>  // memcpy
 
 
@@ -50,6 +52,60 @@ static_assert( sizeof( metadata_array_value ) == sizeof( rs2_metadata_type ) + 1
                "unexpected size for metadata array members" );
 
 
+// A frame's metadata, decoded by all the sensor's parsers on the first query so every query after it is an array
+// index (see frame::find_metadata). Copies start out empty, as the frame they go to may be parsed differently.
+class metadata_table
+{
+public:
+    metadata_table() = default;
+    metadata_table( metadata_table const & ) {}
+    metadata_table & operator=( metadata_table const & )
+    {
+        reset();
+        return *this;
+    }
+
+    // Forget the values, when what they are decoded from changes
+    void reset() { _state.store( empty, std::memory_order_release ); }
+
+    bool is_filled() const { return _state.load( std::memory_order_acquire ) == filled; }
+
+    // Only one caller gets to fill the table; until it is done, the others have to run the parsers themselves
+    bool try_start_filling()
+    {
+        int expected = empty;
+        if( ! _state.compare_exchange_strong( expected, filling, std::memory_order_acquire ) )
+            return false;
+        _supported.reset();
+        return true;
+    }
+    void set( size_t md, rs2_metadata_type value )
+    {
+        _values[md] = value;
+        _supported.set( md );
+    }
+    void finish_filling() { _state.store( filled, std::memory_order_release ); }
+    // When a parser fails, the frame is left to the parsers
+    void abandon_filling() { _state.store( abandoned, std::memory_order_release ); }
+
+    // Once filled
+    bool find( size_t md, rs2_metadata_type * p_value ) const
+    {
+        if( ! _supported.test( md ) )
+            return false;
+        if( p_value )
+            *p_value = _values[md];
+        return true;
+    }
+
+private:
+    enum : int { empty, filling, filled, abandoned };
+    std::atomic< int > _state{ empty };
+    std::bitset< RS2_FRAME_METADATA_ACTUAL_COUNT > _supported;
+    std::array< rs2_metadata_type, RS2_FRAME_METADATA_ACTUAL_COUNT > _values;
+};
+
+
 struct frame_additional_data : frame_header
 {
     uint32_t metadata_size = 0;
@@ -66,6 +122,10 @@ struct frame_additional_data : frame_header
 
     uint32_t raw_size = 0;  // The frame transmitted size (payload only)
 
+    uint32_t motion_samples = 0;  // In a batched motion frame (see RS2_OPTION_MOTION_BATCH_WINDOW), how many it holds
+
+    mutable metadata_table decoded_metadata;
+
     frame_additional_data() {}
 
     frame_additional_data( metadata_array const & metadata )
@@ -2,6 +2,8 @@
 // Copyright(c) 2023 RealSense, Inc. All Rights Reserved.
 #pragma once
 
+#include "frame-latency.h"
+
 #include <librealsense2/h/rs_frame.h>
 #include <iosfwd>
 
@@ -22,6 +24,7 @@ struct frame_header
     rs2_timestamp_domain timestamp_domain = RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK;
     rs2_time_t system_time = 0;        // sys-clock at the time the frame was received from the backend
     rs2_time_t backend_timestamp = 0;  // time when the frame arrived to the backend (OS dependent)
+    frame_latency_stamps latency;      // only when tracing latency
 
     frame_header() = default;
     frame_header( frame_header const & ) = default;
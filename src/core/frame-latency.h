@@ -0,0 +1,53 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace librealsense {
+
+
+// Where a frame is on its way from the backend to the user (see latency_tracer)
+enum class latency_stage : uint8_t
+{
+    arrival,    // received from the backend
+    allocated,  // frame allocated
+    unpacked,   // pixels copied into the frame
+    synced,     // out of a syncer
+    delivered,  // handed to the user: callback entered, or returned from a frame queue or pipeline
+    returned,   // user callback returned
+    count
+};
+
+
+// When a frame reached each stage, in latency_tracer::now() nanoseconds; zero if it hasn't (or tracing was off). Kept
+// in the frame header, so frames that processing blocks make from it start out with the same stamps.
+//
+// Stages are stamped from whatever thread the frame is on at the time, and may be read from another, so they're
+// atomic; they are never contended, though.
+class frame_latency_stamps
+{
+public:
+    frame_latency_stamps() = default;
+    frame_latency_stamps( frame_latency_stamps const & other ) { *this = other; }
+    frame_latency_stamps & operator=( frame_latency_stamps const & other )
+    {
+        for( size_t i = 0; i < _ns.size(); ++i )
+            _ns[i].store( other._ns[i].load( std::memory_order_relaxed ), std::memory_order_relaxed );
+        return *this;
+    }
+
+    int64_t get( latency_stage stage ) const { return _ns[size_t( stage )].load( std::memory_order_relaxed ); }
+    void set( latency_stage stage, int64_t ns ) const { _ns[size_t( stage )].store( ns, std::memory_order_relaxed ); }
+
+private:
+    // Mutable: stamping doesn't change the frame, and frames are mostly seen through their const header
+    mutable std::array< std::atomic< int64_t >, size_t( latency_stage::count ) > _ns{};
+};
+
+
+}  // namespace librealsense
@@ -0,0 +1,659 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "latency-tracer.h"
+#include "frame-interface.h"
+#include "stream-profile-interface.h"
+#include "sensor-interface.h"
+#include "device-interface.h"
+#include "enum-helpers.h"
+#include "../composite-frame.h"
+
+#include <rsutils/easylogging/easyloggingpp.h>
+#include <rsutils/json.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+namespace librealsense {
+
+
+/*static*/ std::atomic< bool > latency_tracer::_enabled{ false };
+
+
+namespace {
+
+
+// Log-linear histogram of durations, in microseconds: exact below 8us, then 8 buckets per power of two, so a bucket is
+// never wider than 12.5% of its values. Lock-free, so any thread can add to it.
+class histogram
+{
+    static constexpr int SUB_BITS = 3;
+    static constexpr size_t N_BUCKETS = ( 1 << SUB_BITS ) * 41;  // up to ~2^43us; anything longer goes in the last
+
+    std::array< std::atomic< uint32_t >, N_BUCKETS > _buckets{};
+    std::atomic< uint64_t > _count{ 0 };
+    std::atomic< int64_t > _sum_ns{ 0 };
+    std::atomic< int64_t > _max_ns{ 0 };
+
+    static size_t bucket_of( int64_t ns )
+    {
+        uint64_t const us = ns > 0 ? uint64_t( ns ) / 1000 : 0;
+        if( us < ( 1 << SUB_BITS ) )
+            return size_t( us );
+        int msb = 0;
+        for( auto v = us; v >>= 1; )
+            ++msb;
+        size_t const i = ( size_t( msb - SUB_BITS + 1 ) << SUB_BITS ) + ( ( us >> ( msb - SUB_BITS ) ) & 7 );
+        return std::min( i, N_BUCKETS - 1 );
+    }
+
+    // The smallest value in a bucket, in us
+    static double bucket_floor( size_t i )
+    {
+        if( i < ( 1 << SUB_BITS ) )
+            return double( i );
+        size_t const shift = ( i >> SUB_BITS ) - 1;
+        return double( uint64_t( ( 1 << SUB_BITS ) + ( i & 7 ) ) << shift );
+    }
+
+public:
+    void add( int64_t ns )
+    {
+        if( ns < 0 )
+            ns = 0;
+        _buckets[bucket_of( ns )].fetch_add( 1, std::memory_order_relaxed );
+        _count.fetch_add( 1, std::memory_order_relaxed );
+        _sum_ns.fetch_add( ns, std::memory_order_relaxed );
+        auto max = _max_ns.load( std::memory_order_relaxed );
+        while( ns > max && ! _max_ns.compare_exchange_weak( max, ns, std::memory_order_relaxed ) )
+        {
+        }
+    }
+
+    void reset()
+    {
+        for( auto & bucket : _buckets )
+            bucket.store( 0, std::memory_order_relaxed );
+        _count.store( 0, std::memory_order_relaxed );
+        _sum_ns.store( 0, std::memory_order_relaxed );
+        _max_ns.store( 0, std::memory_order_relaxed );
+    }
+
+    uint64_t count() const { return _count.load( std::memory_order_relaxed ); }
+
+    // { count, average, p50, p99, max }, in ms; percentiles are the middle of their bucket
+    rsutils::json to_json() const
+    {
+        auto const count = this->count();
+        double const max_ms = _max_ns.load( std::memory_order_relaxed ) / 1e6;
+        auto percentile = [&]( double p )
+        {
+            uint64_t const target = std::max< uint64_t >( 1, uint64_t( p * count + 0.5 ) );
+            uint64_t seen = 0;
+            for( size_t i = 0; i < N_BUCKETS; ++i )
+            {
+                seen += _buckets[i].load( std::memory_order_relaxed );
+                if( seen >= target )
+                {
+                    double const mid = i + 1 < N_BUCKETS ? ( bucket_floor( i ) + bucket_floor( i + 1 ) ) / 2
+                                                         : bucket_floor( i );
+                    return std::min( mid / 1e3, max_ms );
+                }
+            }
+            return max_ms;
+        };
+        return rsutils::json::object( { { "count", count },
+                                         { "average", count ? _sum_ns.load( std::memory_order_relaxed ) / 1e6 / count : 0. },
+                                         { "p50", percentile( .50 ) },
+                                         { "p99", percentile( .99 ) },
+                                         { "max", max_ms } } );
+    }
+};
+
+
+struct stream_stats
+{
+    // Which stream: its profile's unique ID, on the device it came from (null if none). Unique IDs are only unique per
+    // device: a software device's are whatever the user gives.
+    int const uid;
+    rs2_stream const type;
+    int const index;
+    device_interface const * const device;
+    std::weak_ptr< device_interface > const device_ref;  // to tell a device gone from another in its place
+    std::string const device_name;  // serial number, or name
+
+    // Time from arrival to each stage; the arrival and returned entries are unused
+    std::array< histogram, size_t( latency_stage::count ) > since_arrival;
+    // Time from delivered to returned: how long the user's callback took
+    histogram user_callback;
+
+    std::mutex blocks_mutex;
+    std::map< std::string, histogram > blocks;
+
+    stream_stats( int uid_,
+                  rs2_stream type_,
+                  int index_,
+                  device_interface const * device_,
+                  std::weak_ptr< device_interface > device_ref_,
+                  std::string device_name_ )
+        : uid( uid_ )
+        , type( type_ )
+        , index( index_ )
+        , device( device_ )
+        , device_ref( std::move( device_ref_ ) )
+        , device_name( std::move( device_name_ ) )
+    {
+    }
+
+    bool is_of( int uid_, device_interface const * device_ ) const
+    {
+        return uid == uid_ && device == device_ && ( ! device || ! device_ref.expired() );
+    }
+
+    // Its device is gone, so no more frames will come for it
+    bool is_stale() const { return device && device_ref.expired(); }
+
+    void reset()
+    {
+        for( auto & h : since_arrival )
+            h.reset();
+        user_callback.reset();
+        std::lock_guard< std::mutex > lock( blocks_mutex );
+        blocks.clear();
+    }
+};
+
+
+constexpr size_t N_STREAMS = 256;  // streams beyond this many, of devices still around, are not traced
+
+
+// Trace file format (host byte order):
+//     a 16-byte header: "rs2-latency", zero-padded to 12 bytes, then a uint32 version (1)
+//     32-byte records:
+//         int64   time (latency_tracer::now()): when the stage was reached, or when the processing block started
+//         uint64  frame number
+//         uint8   latency_stage; 6 for a processing block; 255 for a processing block's name
+//         uint8   stream type (rs2_stream)
+//         uint8   stream index
+//         uint8   reserved (0)
+//         uint32  processing block ID, for processing block and name records
+//         int64   processing block duration in ns; for names, the name length
+//     A name record precedes the first record of its block, and is followed by the name, zero-padded to 32 bytes.
+//
+#pragma pack( push, 1 )
+struct trace_record
+{
+    int64_t time;
+    uint64_t frame_number;
+    uint8_t stage;
+    uint8_t stream_type;
+    uint8_t stream_index;
+    uint8_t reserved;
+    uint32_t block_id;
+    int64_t duration;
+};
+#pragma pack( pop )
+static_assert( sizeof( trace_record ) == 32, "trace records should be 32 bytes" );
+
+constexpr uint8_t TRACE_PROCESSING_BLOCK = uint8_t( latency_stage::count );
+constexpr uint8_t TRACE_BLOCK_NAME = 255;
+constexpr uint32_t TRACE_VERSION = 1;
+constexpr size_t TRACE_FLUSH_SIZE = 1 << 20;
+
+
+class trace_file
+{
+    std::mutex _mutex;
+    FILE * _file = nullptr;
+    std::atomic< bool > _open{ false };  // whether _file is, without the mutex
+    std::vector< uint8_t > _buffer;
+    std::map< std::string, uint32_t > _block_ids;
+
+    void append( void const * data, size_t size )
+    {
+        auto p = static_cast< uint8_t const * >( data );
+        _buffer.insert( _buffer.end(), p, p + size );
+    }
+
+    void flush()
+    {
+        if( _file && ! _buffer.empty() )
+            fwrite( _buffer.data(), 1, _buffer.size(), _file );
+        _buffer.clear();
+    }
+
+public:
+    bool is_open() const { return _open.load( std::memory_order_relaxed ); }
+
+    void open( std::string const & filename )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        close_locked();
+        _file = fopen( filename.c_str(), "wb" );
+        if( ! _file )
+        {
+            LOG_ERROR( "failed to open latency trace file '" << filename << "'" );
+            return;
+        }
+        char magic[12] = "rs2-latency";
+        append( magic, sizeof( magic ) );
+        append( &TRACE_VERSION, sizeof( TRACE_VERSION ) );
+        _open = true;
+    }
+
+    void close()
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        close_locked();
+    }
+
+    void write( trace_record & record, std::string const * block_name = nullptr )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        if( ! _file )
+            return;
+        if( block_name )
+        {
+            auto it = _block_ids.find( *block_name );
+            if( it == _block_ids.end() )
+            {
+                it = _block_ids.emplace( *block_name, uint32_t( _block_ids.size() ) ).first;
+                trace_record name = record;
+                name.stage = TRACE_BLOCK_NAME;
+                name.block_id = it->second;
+                name.duration = int64_t( block_name->length() );
+                append( &name, sizeof( name ) );
+                append( block_name->data(), block_name->length() );
+                _buffer.resize( _buffer.size() + ( sizeof( trace_record ) - block_name->length() % sizeof( trace_record ) )
+                                                     % sizeof( trace_record ) );
+            }
+            record.block_id = it->second;
+        }
+        append( &record, sizeof( record ) );
+        if( _buffer.size() >= TRACE_FLUSH_SIZE )
+            flush();
+    }
+
+private:
+    void close_locked()
+    {
+        if( ! _file )
+            return;
+        _open = false;
+        flush();
+        fclose( _file );
+        _file = nullptr;
+        _block_ids.clear();
+    }
+};
+
+
+// Streams by device and profile unique ID, so the same stream of different devices is kept apart. An open-addressed
+// table, whose slots are never emptied, so lookups don't lock: those of devices that are gone are taken over by new
+// streams, while their stats stay around for any hook still using them.
+class tracer_state
+{
+    std::mutex _mutex;  // for adding streams
+    std::array< std::atomic< stream_stats * >, N_STREAMS > _streams{};
+    std::vector< std::unique_ptr< stream_stats > > _owned;  // never removed: hooks may still be using them
+
+    static size_t slot_of( int uid, device_interface const * device )
+    {
+        return ( size_t( uid ) ^ ( size_t( device ) >> 4 ) ) % N_STREAMS;
+    }
+
+public:
+    trace_file trace;
+
+    stream_stats * find( stream_profile_interface & profile, sensor_interface * sensor )
+    {
+        auto const uid = profile.get_unique_id();
+        device_interface * device = sensor ? &sensor->get_device() : nullptr;
+        auto const first = slot_of( uid, device );
+        for( size_t i = first, n = 0; n < N_STREAMS; i = ( i + 1 ) % N_STREAMS, ++n )
+        {
+            auto stats = _streams[i].load( std::memory_order_acquire );
+            if( ! stats )
+                break;
+            if( stats->is_of( uid, device ) )
+                return stats;
+        }
+
+        std::weak_ptr< device_interface > device_ref;
+        std::string device_name = "host";  // e.g., made by a processing block with no sensor
+        if( device )
+        {
+            try
+            {
+                device_ref = device->shared_from_this();
+            }
+            catch( std::bad_weak_ptr const & )
+            {
+                return nullptr;  // still being constructed
+            }
+            if( device->supports_info( RS2_CAMERA_INFO_SERIAL_NUMBER ) )
+                device_name = device->get_info( RS2_CAMERA_INFO_SERIAL_NUMBER );
+            else if( device->supports_info( RS2_CAMERA_INFO_NAME ) )
+                device_name = device->get_info( RS2_CAMERA_INFO_NAME );
+        }
+
+        std::lock_guard< std::mutex > lock( _mutex );
+        std::atomic< stream_stats * > * free_slot = nullptr;
+        for( size_t i = first, n = 0; n < N_STREAMS; i = ( i + 1 ) % N_STREAMS, ++n )
+        {
+            auto & slot = _streams[i];
+            auto stats = slot.load( std::memory_order_relaxed );
+            if( stats && stats->is_of( uid, device ) )
+                return stats;  // added since we looked
+            if( ! free_slot && ( ! stats || stats->is_stale() ) )
+                free_slot = &slot;
+            if( ! stats )
+                break;
+        }
+        if( ! free_slot )
+            return nullptr;
+        _owned.emplace_back( new stream_stats( uid,
+                                               profile.get_stream_type(),
+                                               profile.get_stream_index(),
+                                               device,
+                                               std::move( device_ref ),
+                                               std::move( device_name ) ) );
+        auto stats = _owned.back().get();
+        free_slot->store( stats, std::memory_order_release );
+        return stats;
+    }
+
+    // The streams in the table, in the order they were added
+    std::vector< stream_stats * > all()
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        std::vector< stream_stats * > streams;
+        for( auto & stats : _owned )
+            for( auto & slot : _streams )
+                if( slot.load( std::memory_order_relaxed ) == stats.get() )
+                {
+                    streams.push_back( stats.get() );
+                    break;
+                }
+        return streams;
+    }
+
+    void reset()
+    {
+        for( auto & slot : _streams )
+            if( auto stats = slot.load( std::memory_order_acquire ) )
+                stats->reset();
+    }
+};
+
+
+// Per thread: how long the processing block running on it spent passing frames on, and whether the user callback
+// running on it handed a frame back to us
+thread_local int64_t t_downstream_ns = 0;
+thread_local bool t_forwarded = false;
+
+
+tracer_state & state()
+{
+    static tracer_state the_state;
+    return the_state;
+}
+
+
+stream_stats * stats_of( frame_interface * f )
+{
+    auto profile = f->get_stream();
+    if( ! profile )
+        return nullptr;
+    return state().find( *profile, f->get_sensor().get() );
+}
+
+
+void trace( int64_t time, frame_interface * f, stream_stats const & stats, latency_stage stage )
+{
+    auto & file = state().trace;
+    if( ! file.is_open() )
+        return;
+    trace_record record{};
+    record.time = time;
+    record.frame_number = f->get_frame_number();
+    record.stage = uint8_t( stage );
+    record.stream_type = uint8_t( stats.type );
+    record.stream_index = uint8_t( stats.index );
+    file.write( record );
+}
+
+
+}  // namespace
+
+
+/*static*/ void latency_tracer::start( std::string const & trace_file )
+{
+    auto & st = state();
+    st.reset();
+    if( ! trace_file.empty() )
+        st.trace.open( trace_file );
+    _enabled = true;
+}
+
+
+/*static*/ void latency_tracer::stop()
+{
+    _enabled = false;
+    state().trace.close();
+}
+
+
+/*static*/ void latency_tracer::on_new_frame( frame_interface * f, int64_t arrival, int64_t allocated )
+{
+    if( ! f || ! is_enabled() )
+        return;
+    auto const unpacked = now();
+    auto & stamps = f->get_header().latency;
+    stamps.set( latency_stage::arrival, arrival );
+    stamps.set( latency_stage::allocated, allocated );
+    stamps.set( latency_stage::unpacked, unpacked );
+
+    if( auto stats = stats_of( f ) )
+    {
+        stats->since_arrival[size_t( latency_stage::allocated )].add( allocated - arrival );
+        stats->since_arrival[size_t( latency_stage::unpacked )].add( unpacked - arrival );
+        trace( arrival, f, *stats, latency_stage::arrival );
+        trace( allocated, f, *stats, latency_stage::allocated );
+        trace( unpacked, f, *stats, latency_stage::unpacked );
+    }
+}
+
+
+/*static*/ void latency_tracer::stamp( frame_interface * f, latency_stage stage )
+{
+    if( f && is_enabled() )
+        stamp( f, stage, now() );
+}
+
+
+/*static*/ void latency_tracer::stamp( frame_interface * f, latency_stage stage, int64_t ns )
+{
+    if( ! f || ! is_enabled() )
+        return;
+
+    if( auto cf = dynamic_cast< composite_frame * >( f ) )
+    {
+        for( size_t i = 0; i < cf->get_embedded_frames_count(); ++i )
+            stamp( cf->get_frame( int( i ) ), stage, ns );
+        return;
+    }
+
+    auto & stamps = f->get_header().latency;
+    stamps.set( stage, ns );
+    auto const arrival = stamps.get( latency_stage::arrival );
+    if( ! arrival )
+        return;  // arrived before tracing was started
+
+    if( auto stats = stats_of( f ) )
+    {
+        if( stage != latency_stage::returned )
+            stats->since_arrival[size_t( stage )].add( ns - arrival );
+        else if( auto const delivered = stamps.get( latency_stage::delivered ) )
+            stats->user_callback.add( ns - delivered );
+        trace( ns, f, *stats, stage );
+    }
+}
+
+
+/*static*/ void latency_tracer::on_processing_block( std::shared_ptr< stream_profile_interface > const & profile,
+                                                     std::shared_ptr< sensor_interface > const & sensor,
+                                                     unsigned long long frame_number,
+                                                     std::string const & block_name,
+                                                     int64_t start,
+                                                     int64_t end )
+{
+    if( ! profile || ! is_enabled() )
+        return;
+    auto stats = state().find( *profile, sensor.get() );
+    if( ! stats )
+        return;
+    {
+        std::lock_guard< std::mutex > lock( stats->blocks_mutex );
+        stats->blocks[block_name].add( end - start );
+    }
+
+    auto & file = state().trace;
+    if( file.is_open() )
+    {
+        trace_record record{};
+        record.time = start;
+        record.frame_number = frame_number;
+        record.stage = TRACE_PROCESSING_BLOCK;
+        record.stream_type = uint8_t( stats->type );
+        record.stream_index = uint8_t( stats->index );
+        record.duration = end - start;
+        file.write( record, &block_name );
+    }
+}
+
+
+latency_tracer::block_timer::block_timer()
+    : _start( is_enabled() ? now() : 0 )
+    , _outer_downstream( t_downstream_ns )
+{
+    t_downstream_ns = 0;
+}
+
+
+latency_tracer::block_timer::~block_timer()
+{
+    t_downstream_ns = _outer_downstream;
+}
+
+
+int64_t latency_tracer::block_timer::own_end() const
+{
+    return now() - t_downstream_ns;
+}
+
+
+latency_tracer::downstream_timer::downstream_timer()
+    : _start( is_enabled() ? now() : 0 )
+{
+}
+
+
+latency_tracer::downstream_timer::~downstream_timer()
+{
+    if( _start )
+        t_downstream_ns += now() - _start;
+}
+
+
+latency_tracer::user_callback_scope::user_callback_scope()
+    : _outer_forwarded( t_forwarded )
+{
+    t_forwarded = false;
+}
+
+
+latency_tracer::user_callback_scope::~user_callback_scope()
+{
+    t_forwarded = _outer_forwarded;
+}
+
+
+bool latency_tracer::user_callback_scope::forwarded() const
+{
+    return t_forwarded;
+}
+
+
+/*static*/ void latency_tracer::on_forwarded()
+{
+    t_forwarded = true;
+}
+
+
+/*static*/ rsutils::json latency_tracer::get_stats()
+{
+    static char const * const stage_names[] = { "arrival", "allocated", "unpacked", "synced", "delivered", "returned" };
+    static_assert( sizeof( stage_names ) / sizeof( *stage_names ) == size_t( latency_stage::count ),
+                   "stage names out of date" );
+
+    // Streams of the same device together, under its serial number (or name). Different devices by the same name,
+    // e.g. software devices, are told apart by a number.
+    std::map< std::weak_ptr< device_interface >, std::string, std::owner_less< std::weak_ptr< device_interface > > >
+        device_names;
+    rsutils::json devices = rsutils::json::object();
+    for( auto stats : state().all() )
+    {
+        auto const frames = stats->since_arrival[size_t( latency_stage::unpacked )].count();
+        rsutils::json j = rsutils::json::object( { { "frames", frames } } );
+        for( size_t stage = size_t( latency_stage::allocated ); stage <= size_t( latency_stage::delivered ); ++stage )
+            if( stats->since_arrival[stage].count() )
+                j[stage_names[stage]] = stats->since_arrival[stage].to_json();
+        if( stats->user_callback.count() )
+            j["user-callback"] = stats->user_callback.to_json();
+        {
+            std::lock_guard< std::mutex > lock( stats->blocks_mutex );
+            if( ! stats->blocks.empty() )
+            {
+                rsutils::json blocks = rsutils::json::object();
+                for( auto & block : stats->blocks )
+                    blocks[block.first] = block.second.to_json();
+                j["processing-blocks"] = std::move( blocks );
+            }
+        }
+        if( ! frames && j.size() == 1 )
+            continue;  // reset and nothing since
+
+        auto it = device_names.find( stats->device_ref );
+        if( it == device_names.end() )
+        {
+            std::string name = stats->device_name;
+            for( int n = 2; devices.contains( name ); ++n )
+                name = stats->device_name + " #" + std::to_string( n );
+            it = device_names.emplace( stats->device_ref, name ).first;
+            devices[name] = rsutils::json::object();
+        }
+
+        // A processing block's output, e.g. colorized depth, is another stream of the same type and index
+        std::string stream_name = get_string( stats->type );
+        if( stats->index )
+            stream_name += ' ' + std::to_string( stats->index );
+        auto & streams = devices[it->second];
+        std::string name = stream_name;
+        for( int n = 2; streams.contains( name ); ++n )
+            name = stream_name + " #" + std::to_string( n );
+        streams[name] = std::move( j );
+    }
+
+    return rsutils::json::object( { { "enabled", is_enabled() }, { "devices", std::move( devices ) } } );
+}
+
+
+}  // namespace librealsense
@@ -0,0 +1,119 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+#pragma once
+
+#include "frame-latency.h"
+
+#include <librealsense2/h/rs_sensor.h>
+#include <rsutils/json-fwd.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+
+
+namespace librealsense {
+
+
+class frame_interface;
+class stream_profile_interface;
+class sensor_interface;
+
+
+// Times frames on their way from the backend to the user (see latency_stage), to find out where the latency goes.
+//
+// For each stream (profile unique ID), of each device, we keep histograms of how long after arrival frames were allocated, unpacked, synced and delivered,
+// how long each processing block took with them, and how long the user's callbacks took; get_stats() reports their
+// percentiles. Optionally, every stamp is also written to a binary trace file (see latency-tracer.cpp for its format).
+//
+// Off by default; while off, each hook is a single relaxed load.
+//
+class latency_tracer
+{
+public:
+    static bool is_enabled() { return _enabled.load( std::memory_order_relaxed ); }
+
+    // Steady-clock nanoseconds, the time base of all stamps
+    static int64_t now()
+    {
+        return std::chrono::duration_cast< std::chrono::nanoseconds >(
+                   std::chrono::steady_clock::now().time_since_epoch() )
+            .count();
+    }
+
+    // Starting clears the statistics so far. With a trace file, any previous one is closed first.
+    static void start( std::string const & trace_file = std::string() );
+    static void stop();
+
+    // A new frame from a sensor, once its stream is set: it arrived and was allocated at the given times, and is now
+    // unpacked
+    static void on_new_frame( frame_interface *, int64_t arrival, int64_t allocated );
+
+    // A frame (or each of the frames in a frameset) reached the given stage now, or at the given time
+    static void stamp( frame_interface *, latency_stage );
+    static void stamp( frame_interface *, latency_stage, int64_t time );
+
+    // A processing block was busy with a frame from 'start' to 'end'. It may have passed the frame on and be rid of
+    // it by then, so we get the frame's stream and sensor as they were.
+    static void on_processing_block( std::shared_ptr< stream_profile_interface > const &,
+                                     std::shared_ptr< sensor_interface > const &,
+                                     unsigned long long frame_number,
+                                     std::string const & block_name,
+                                     int64_t start,
+                                     int64_t end );
+
+    // Per-device, per-stream percentiles, in ms: see rs2_get_stream_latency_stats()
+    static rsutils::json get_stats();
+
+    // A processing block at work on this thread. The time it spends passing frames on (see downstream_timer) belongs
+    // to whoever gets them, and is left out of its own.
+    class block_timer
+    {
+    public:
+        block_timer();
+        ~block_timer();
+
+        explicit operator bool() const { return _start != 0; }  // false while tracing is off
+        int64_t start() const { return _start; }
+        int64_t own_end() const;  // the start, plus the time spent in the block itself so far
+
+    private:
+        int64_t _start;
+        int64_t _outer_downstream;
+    };
+
+    // Frames being passed on from a processing block to its output callback
+    class downstream_timer
+    {
+    public:
+        downstream_timer();
+        ~downstream_timer();
+
+    private:
+        int64_t _start;
+    };
+
+    // A user callback at work on this thread. If it hands its frame back to us, to a processing block or a frame
+    // queue, the frame hasn't reached the user yet: it is stamped when it comes out at the other end instead.
+    class user_callback_scope
+    {
+    public:
+        user_callback_scope();
+        ~user_callback_scope();
+
+        bool forwarded() const;
+
+    private:
+        bool _outer_forwarded;
+    };
+
+    // The user handed a frame back to us, from inside a user callback or not
+    static void on_forwarded();
+
+private:
+    static std::atomic< bool > _enabled;
+};
+
+
+}  // namespace librealsense
@@ -16,6 +16,17 @@ public:
         : frame()
     {
     }
+
+    // A frame batched by RS2_OPTION_MOTION_BATCH_WINDOW holds this many samples; 0 if it's not a batch
+    uint32_t get_sample_count() const { return additional_data.motion_samples; }
+
+    // The samples of a batched frame, oldest first; null if it's not a batch
+    rs2_motion_sample const * get_samples() const
+    {
+        if( ! additional_data.motion_samples )
+            return nullptr;
+        return reinterpret_cast< rs2_motion_sample const * >( get_frame_data() );
+    }
 };
 
 MAP_EXTENSION( RS2_EXTENSION_MOTION_FRAME, librealsense::motion_frame );
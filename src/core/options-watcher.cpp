@@ -15,6 +15,8 @@ options_watcher::options_watcher( std::chrono::milliseconds update_interval )
     : _update_interval( update_interval )
     , _destructing( false )
     , _paused( false )
+    , _initial_update( false )
+    , _updater( "options watcher", update_interval, [this]() { periodic_update(); } )
 {
 }
 
@@ -68,71 +70,42 @@ bool options_watcher::should_stop() const
 
 void options_watcher::start()
 {
-    if( ! _updater.joinable() ) // If not already started
+    if( ! _updater.is_active() ) // If not already started
     {
-        _updater = std::thread( [this]() {
-            update_options();
-            thread_loop();
-        } );
+        _initial_update = true;
+        _updater.start( true );
     }
 }
 
 void options_watcher::stop()
 {
-    _stopping.notify_all();
-    if( _updater.joinable() )
-    {
-        try
-        {
-            _updater.join();
-        }
-        catch( ... )
-        {
-            // Nothing to do on error
-        }
-    }
+    _updater.stop();
 }
 
-void options_watcher::thread_loop()
+void options_watcher::periodic_update()
 {
-    while( !should_stop() )
+    if( should_stop() )
     {
-        {
-            std::unique_lock<std::mutex> lock( _mutex );
-            // 1. Block while paused
-            _stopping.wait( lock, [this]
-            {
-                return should_stop() || !_paused.load();
-            });
-            if (should_stop())
-                break;
+        _updater.stop();
+        return;
+    }
 
-            // 2. Periodic wait
-            _stopping.wait_for( lock, _update_interval, [this]
-            {
-                return should_stop() || _paused.load();
-            });
-            // Checking for stop conditions after sleep.
-            if( should_stop() )
-                break;
-
-            // If still paused, go back to waiting
-            // this check is needed - do not remove because:
-            // 1. predicate may not be true even if wait_for woke up
-            // 2. spurious waking may happen (mostly in linux)
-            // 3. the paused flag may become true between the wait_for and here
-            if( _paused.load() )
-                continue;
-        }
+    if( _initial_update.exchange( false ) )
+    {
+        update_options();
+        return;
+    }
 
-        auto updated_options = update_options();
+    if( _paused.load() )
+        return;
 
-        // Checking stop conditions after update, if stop requested no need to notify.
-        if( should_stop() )
-            break;
+    auto updated_options = update_options();
 
-        notify( updated_options );
-    }
+    // Checking stop conditions after update, if stop requested no need to notify.
+    if( should_stop() )
+        return;
+
+    notify( updated_options );
 }
 
 
@@ -7,13 +7,13 @@
 
 #include <rsutils/signal.h>
 #include <rsutils/concurrency/concurrency.h>
+#include <rsutils/concurrency/timer-service.h>
 #include <rsutils/json-fwd.h>
 
 #include <map>
 #include <chrono>
 #include <functional>
 #include <memory>
-#include <thread>
 #include <mutex>
 
 
@@ -22,8 +22,8 @@ namespace librealsense {
 
 // Watches registered options value and notifies interested users.
 // When a user subscribes to notification the options_watcher will automatically update (query) registered options
-// values in set time intervals (creates a thread). If one or more of the values have changed the watcher will notify
-// through the callback subscription.
+// values in set time intervals (a periodic task on the shared timer service). If one or more of the values have changed
+// the watcher will notify through the callback subscription.
 class options_watcher
 {
 public:
@@ -45,29 +45,34 @@ public:
 
     rsutils::subscription subscribe( callback && cb );
 
-    void set_update_interval( std::chrono::milliseconds update_interval ) { _update_interval = update_interval; }
+    void set_update_interval( std::chrono::milliseconds update_interval )
+    {
+        _update_interval = update_interval;
+        _updater.set_interval( update_interval );
+    }
 
-    inline void pause() { _paused.store(true); }
-    inline void unpause() { _paused.store(false);
-                          _stopping.notify_all();}
+    // While paused, updates are skipped
+    inline void pause() { _paused.store( true ); }
+    inline void unpause() { _paused.store( false ); }
 
 protected:
     bool should_start() const;
     bool should_stop() const;
     void start();
     void stop();
-    void thread_loop();
+    void periodic_update();
     virtual options_and_values update_options();
     void notify( options_and_values const & updated_options );
 
     options_and_values _options;
     rsutils::signal< options_and_values const & > _on_values_changed;
     std::chrono::milliseconds _update_interval;
-    std::thread _updater;
     std::mutex _mutex;
-    std::condition_variable _stopping;
     std::atomic_bool _destructing;
     std::atomic_bool _paused;
+    std::atomic_bool _initial_update;  // only records the values, without notifying
+    // Last, so it is destroyed (and its runs, which use all of the above, stopped) first
+    rsutils::concurrency::periodic_task _updater;
 };
 
 
@@ -20,6 +20,8 @@ namespace librealsense {
 
 class stream_profile_interface;
 class device_interface;
+class frame_allocator;
+struct frame_buffer_pool_stats;
 
 
 class sensor_interface
@@ -54,6 +56,12 @@ public:
 
     virtual rs2_frame_callback_sptr get_frames_callback() const = 0;
     virtual void set_frames_callback( rs2_frame_callback_sptr cb ) = 0;
+
+    // Frame data will be written into memory from the given allocator (nullptr for internal allocation)
+    virtual void set_frame_allocator( std::shared_ptr< frame_allocator > const & allocator ) = 0;
+
+    // How frame data buffers have been recycled so far, over the life of the sensor
+    virtual frame_buffer_pool_stats get_frame_buffer_pool_stats() const = 0;
 };
 
 
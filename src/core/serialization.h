@@ -12,6 +12,7 @@
 #include "frame-holder.h"
 #include "stream-profile-interface.h"
 #include "notification.h"
+#include <rsutils/string/from.h>
 
 
 namespace librealsense
@@ -50,6 +51,12 @@ namespace librealsense
         }
 
         using nanoseconds = std::chrono::duration<uint64_t, std::nano>;
+        struct stream_range
+        {
+            uint64_t frame_count;
+            nanoseconds first_frame;  // file time, as in seek_to_time
+            nanoseconds last_frame;
+        };
 
         class serialized_data : public std::enable_shared_from_this<serialized_data>
         {
@@ -336,6 +343,13 @@ namespace librealsense
             virtual void write_snapshot(const sensor_identifier& sensor_id, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) = 0;
             virtual void write_notification(const sensor_identifier& stream_id, const nanoseconds& timestamp, const notification& n) = 0;
             virtual void write_extrinsics(const stream_identifier& stream_id, uint32_t reference_id, const rs2_extrinsics& ext) {}
+            // May be called from any thread, while frames are being written
+            virtual void set_stream_codec(rs2_stream stream, int index, rs2_record_stream_codec codec)
+            {
+                if (codec != RS2_RECORD_STREAM_CODEC_DEFAULT)
+                    throw not_implemented_exception(rsutils::string::from() << "Stream codec " << codec
+                                                    << " requires recording to a .db3 or .mcap file");
+            }
             virtual const std::string& get_file_name() const = 0;
             virtual ~writer() = default;
         };
@@ -353,6 +367,12 @@ namespace librealsense
             virtual void disable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) = 0;
             virtual const std::string& get_file_name() const = 0;
             virtual std::vector<std::shared_ptr<serialized_data>> fetch_last_frames(const nanoseconds& seek_time) = 0;
+            // Frame count and time range of a stream (of any of the device's sensors), without reading through the
+            // file; false if the stream isn't in the file
+            virtual bool query_stream_range(uint32_t device_index, rs2_stream type, uint32_t index, stream_range& range) const
+            {
+                throw not_implemented_exception("Stream ranges are not available for " + get_file_name());
+            }
         };
     }
 }
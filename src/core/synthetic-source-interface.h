@@ -43,7 +43,8 @@ namespace librealsense
                                                        frame_interface* original,
                                                        rs2_extension frame_type = RS2_EXTENSION_MOTION_FRAME) = 0;
 
-        virtual frame_interface* allocate_composite_frame(std::vector<frame_holder> frames) = 0;
+        // The frames are moved out of the vector, but the vector itself is left to the caller to reuse
+        virtual frame_interface* allocate_composite_frame(std::vector<frame_holder> && frames) = 0;
 
         virtual frame_interface* allocate_points(std::shared_ptr<stream_profile_interface> stream, 
             frame_interface* original, 
@@ -65,25 +65,13 @@ void dds_depth_sensor_proxy::add_no_metadata( frame * const f, streaming_impl &
 }
 
 
-void dds_depth_sensor_proxy::add_frame_metadata( frame * const f, rsutils::json const & dds_md, streaming_impl & streaming )
+void dds_depth_sensor_proxy::add_frame_metadata( frame * const f,
+                                                 realdds::topics::binary_metadata const & md,
+                                                 streaming_impl & streaming )
 {
-    if( auto du = dds_md.nested( realdds::topics::metadata::key::header, realdds::topics::metadata::header::key::depth_units ) )
-    {
-        try
-        {
-            f->additional_data.depth_units = du.get< float >();
-        }
-        catch( rsutils::json::exception const & )
-        {
-            f->additional_data.depth_units = get_depth_scale();
-        }
-    }
-    else
-    {
-        f->additional_data.depth_units = get_depth_scale();
-    }
+    f->additional_data.depth_units = md.depth_units > 0.f ? md.depth_units : get_depth_scale();
 
-    super::add_frame_metadata( f, dds_md, streaming );
+    super::add_frame_metadata( f, md, streaming );
 }
 
 bool dds_depth_sensor_proxy::extend_to( rs2_extension extension_type, void ** ptr )
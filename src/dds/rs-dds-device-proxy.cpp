@@ -398,7 +398,17 @@ dds_device_proxy::dds_device_proxy( std::shared_ptr< const device_info > const &
         }
     }
 
-    if( _dds_dev->supports_metadata() )
+    if( _dds_dev->supports_binary_metadata() )
+    {
+        _metadata_subscription = _dds_dev->on_binary_metadata_available(
+            [this]( std::shared_ptr< const realdds::topics::binary_metadata > const & dds_md )
+            {
+                auto it = _stream_name_to_owning_sensor.find( dds_md->stream_name );
+                if( it != _stream_name_to_owning_sensor.end() )
+                    it->second->handle_new_metadata( dds_md );
+            } );
+    }
+    else if( _dds_dev->supports_metadata() )
     {
         _metadata_subscription = _dds_dev->on_metadata_available(
             [this]( std::shared_ptr< const json > const & dds_md )
@@ -651,6 +661,7 @@ void dds_device_proxy::tag_default_profile_of_stream(
         switch( target_format )
         {
         case RS2_FORMAT_YUYV:
+        case RS2_FORMAT_MJPEG:
             // We want to change to RGB8 - that's the LibRS default
             if( get_format_conversion() == format_conversion::full )
                 target_format = RS2_FORMAT_RGB8;
@@ -16,6 +16,7 @@
 #include <realdds/topics/imu-msg.h>
 #include <realdds/topics/string-msg.h>
 #include <realdds/topics/dds-topic-names.h>
+#include <realdds/topics/binary-metadata.h>
 #include <src/object-detection-frame.h>
 
 #include <src/core/options-registry.h>
@@ -31,6 +32,7 @@
 #include <src/proc/rotation-filter.h>
 
 #include <rsutils/string/nocase.h>
+#include <rsutils/codec/depth-codec.h>
 #include <rsutils/json.h>
 
 #include <dds/rs-dds-device-proxy.h>
@@ -43,6 +45,7 @@
 #include "rs-dds-depth-sensor-proxy.h"
 #include "rs-dds-inference-sensor-proxy.h"
 
+#include <algorithm>
 #include <cmath>
 
 using namespace realdds;
@@ -161,11 +164,14 @@ void dds_sensor_proxy::register_converters()
 
     if( jpeg_indexes.size() > 0 )
     {
-        std::vector< stream_profile > target_profiles;
-        for( int index : jpeg_indexes )
-            target_profiles.push_back( { RS2_FORMAT_RGB8, RS2_STREAM_COLOR, index } );
-        _formats_converter.register_converter( { { RS2_FORMAT_MJPEG, RS2_STREAM_COLOR } }, target_profiles,
-                                               []() { return std::make_shared< mjpeg_converter >( RS2_FORMAT_RGB8 ); } );
+        for( rs2_format format : { RS2_FORMAT_RGB8, RS2_FORMAT_BGR8, RS2_FORMAT_RGBA8, RS2_FORMAT_Y8 } )
+        {
+            std::vector< stream_profile > target_profiles;
+            for( int index : jpeg_indexes )
+                target_profiles.push_back( { format, RS2_STREAM_COLOR, index } );
+            _formats_converter.register_converter( { { RS2_FORMAT_MJPEG, RS2_STREAM_COLOR } }, target_profiles,
+                                                   [format]() { return std::make_shared< mjpeg_converter >( format ); } );
+        }
     }
 
     // Depth
@@ -239,8 +245,9 @@ dds_sensor_proxy::find_profile( sid_index sidx, realdds::dds_video_stream_profil
         for( auto & sp : stream->profiles() )
         {
             auto vsp = std::static_pointer_cast< realdds::dds_video_stream_profile >( sp );
+            // Compare rs2 formats: a compressed depth encoding is still Z16 to us
             if( profile.width() == vsp->width() && profile.height() == vsp->height()
-                && profile.encoding() == vsp->encoding() && profile.frequency() == vsp->frequency() )
+                && profile.encoding().to_rs2() == vsp->encoding().to_rs2() && profile.frequency() == vsp->frequency() )
             {
                 return vsp;
             }
@@ -393,11 +400,29 @@ void dds_sensor_proxy::handle_video_data( std::vector< uint8_t > && buffer,
 
     auto height = vid_profile->get_height();
     auto width = vid_profile->get_width();
-    auto stride = static_cast< int >(height > 0 ? data.raw_size / height : data.raw_size );
     auto expected_bpp = get_image_bpp(vid_profile->get_format()) / 8;
     auto expected_size = height * width * expected_bpp;
-    if( data.raw_size != expected_size )
+    if( streaming.depth_codec )
+    {
+        // Decode here, so everything downstream sees the Z16 it asked for
+        std::vector< uint8_t > pixels( expected_size );
+        uint32_t encoded_width, encoded_height;
+        if( expected_bpp != 2
+            || ! rsutils::codec::depth_decode_header( buffer.data(), buffer.size(), &encoded_width, &encoded_height )
+            || encoded_width != width || encoded_height != height
+            || ! rsutils::codec::depth_decode( buffer.data(),
+                                               buffer.size(),
+                                               reinterpret_cast< uint16_t * >( pixels.data() ),
+                                               pixels.size() / 2 ) )
+            throw invalid_value_exception( rsutils::string::from() << "Received depth frame (" << buffer.size()
+                                                                   << " bytes) that could not be decoded" );
+        buffer = std::move( pixels );
+        data.raw_size = static_cast< uint32_t >( buffer.size() );
+    }
+    // MJPEG frames are as big as they compress to: the converter gets their size from the frame's raw size
+    else if( data.raw_size != expected_size && vid_profile->get_format() != RS2_FORMAT_MJPEG )
         throw invalid_value_exception( rsutils::string::from() << "Received frame with unexpected size " << data.raw_size << ", expected " << expected_size );
+    auto stride = static_cast< int >(height > 0 ? data.raw_size / height : data.raw_size );
 
     auto new_frame_interface = allocate_new_video_frame( vid_profile, stride, expected_bpp, std::move( data ) );    
     if( ! new_frame_interface )
@@ -471,16 +496,60 @@ void dds_sensor_proxy::handle_new_metadata( std::string const & stream_name,
     auto it = _streaming_by_name.find( stream_name );
     if( it != _streaming_by_name.end() )
     {
-        if( auto timestamp = dds_md->nested( realdds::topics::metadata::key::header,
-                                             realdds::topics::metadata::header::key::timestamp ) )
-            it->second.syncer.enqueue_metadata( timestamp.get< realdds::dds_nsec >(), dds_md );
-        else
+        // JSON comes from servers that can't send binary metadata: convert it, with fields in rs2_frame_metadata_value
+        // order
+        auto md_header = dds_md->nested( realdds::topics::metadata::key::header );
+        auto timestamp = md_header.nested( realdds::topics::metadata::header::key::timestamp );
+        if( ! timestamp )
             throw std::runtime_error( "missing metadata header/timestamp" );
+
+        auto md = std::make_shared< realdds::topics::binary_metadata >();
+        md->reset( RS2_FRAME_METADATA_COUNT );
+        md->stream_name = stream_name;
+        md->timestamp = timestamp.get< realdds::dds_nsec >();
+        uint64_t frame_number;
+        if( md_header.nested( realdds::topics::metadata::header::key::frame_number ).get_ex( frame_number ) )
+            md->set_frame_number( frame_number );
+        md_header.nested( realdds::topics::metadata::header::key::timestamp_domain ).get_ex( md->timestamp_domain );
+        if( auto du = md_header.nested( realdds::topics::metadata::header::key::depth_units, &json::is_number ) )
+            md->depth_units = du.get< float >();
+
+        auto values = dds_md->nested( realdds::topics::metadata::key::metadata );
+        if( ! values.empty() )
+        {
+            // Metadata fields that are present but unknown by librealsense will be ignored.
+            for( size_t i = 0; i < static_cast< size_t >( RS2_FRAME_METADATA_COUNT ); ++i )
+            {
+                auto key = static_cast< rs2_frame_metadata_value >( i );
+                try
+                {
+                    if( auto value_j = values.nested( librealsense::get_string( key ), &json::is_number_integer ) )
+                        md->set( i, value_j.get< rs2_metadata_type >() );
+                }
+                catch( json::exception const & )
+                {
+                    // The metadata key doesn't exist or the value isn't the right type... we ignore it!
+                }
+            }
+        }
+        it->second.syncer.enqueue_metadata( md->timestamp, md );
     }
     // else we're not streaming -- must be another client that's subscribed
 }
 
 
+void dds_sensor_proxy::handle_new_metadata( std::shared_ptr< const realdds::topics::binary_metadata > const & md )
+{
+    if( ! _md_enabled )
+        return;
+
+    auto it = _streaming_by_name.find( md->stream_name );
+    if( it != _streaming_by_name.end() )
+        it->second.syncer.enqueue_metadata( md->timestamp, md );
+    // else we're not streaming -- must be another client that's subscribed
+}
+
+
 void dds_sensor_proxy::handle_inference_data( realdds::topics::string_msg && msg,
                                               realdds::dds_sample && sample,
                                               const std::shared_ptr< stream_profile_interface > & profile,
@@ -597,6 +666,33 @@ void dds_sensor_proxy::handle_inference_data( realdds::topics::string_msg && msg
 }
 
 
+void dds_sensor_proxy::init_metadata_fields( streaming_impl & streaming, realdds::dds_stream const & stream ) const
+{
+    streaming.md_fields.clear();
+    if( ! _dev->supports_binary_metadata() )
+    {
+        // We get JSON, converted in rs2_frame_metadata_value order
+        for( int i = 0; i < RS2_FRAME_METADATA_COUNT; ++i )
+            streaming.md_fields.push_back( i );
+        return;
+    }
+
+    // Map the server's schema, by name, once rather than for each frame
+    static std::map< std::string, int > const by_name = []()
+    {
+        std::map< std::string, int > map;
+        for( int i = 0; i < RS2_FRAME_METADATA_COUNT; ++i )
+            map[librealsense::get_string( static_cast< rs2_frame_metadata_value >( i ) )] = i;
+        return map;
+    }();
+    for( auto const & name : stream.metadata_schema() )
+    {
+        auto it = by_name.find( name );
+        streaming.md_fields.push_back( it == by_name.end() ? -1 : it->second );
+    }
+}
+
+
 void dds_sensor_proxy::add_no_metadata( frame * const f, streaming_impl & streaming )
 {
     // Without MD, we have no way of knowing the frame-number - we assume it's one higher than the last
@@ -608,26 +704,22 @@ void dds_sensor_proxy::add_no_metadata( frame * const f, streaming_impl & stream
 
 
 void dds_sensor_proxy::add_frame_metadata( frame * const f,
-                                           json const & dds_md,
+                                           realdds::topics::binary_metadata const & md,
                                            streaming_impl & streaming )
 {
-    auto md_header = dds_md.nested( realdds::topics::metadata::key::header );
-    auto md = dds_md.nested( realdds::topics::metadata::key::metadata );
-
     // A frame number is "optional". If the server supplies it, we try to use it for the simple fact that,
     // otherwise, we have no way of detecting drops without some advanced heuristic tracking the FPS and
     // timestamps. If not supplied, we use an increasing counter.
     // Note that if we have no metadata, we have no frame-numbers! So we need a way of generating them
-    if( md_header.nested( realdds::topics::metadata::header::key::frame_number )
-            .get_ex( f->additional_data.frame_number ) )
+    if( md.has_frame_number() )
     {
+        f->additional_data.frame_number = md.get_frame_number();
         f->additional_data.last_frame_number = streaming.last_frame_number.exchange( f->additional_data.frame_number );
         if( f->additional_data.frame_number != f->additional_data.last_frame_number + 1
             && f->additional_data.last_frame_number )
         {
-            LOG_DEBUG( dds_md.nested( realdds::topics::metadata::key::stream_name ).string_ref_or_empty()
-                       << " frame drop? expecting " << f->additional_data.last_frame_number + 1 << "; got "
-                       << f->additional_data.frame_number );
+            LOG_DEBUG( md.stream_name << " frame drop? expecting " << f->additional_data.last_frame_number + 1
+                                      << "; got " << f->additional_data.frame_number );
         }
     }
     else
@@ -640,27 +732,18 @@ void dds_sensor_proxy::add_frame_metadata( frame * const f,
     // purposes, so we ignore here. The domain is optional, and really only rs-dds-adapter communicates it
     // because the source is librealsense...
     f->additional_data.timestamp;
-    md_header.nested( realdds::topics::metadata::header::key::timestamp_domain ).get_ex( f->additional_data.timestamp_domain );
-
-    if( ! md.empty() )
+    if( md.timestamp_domain >= 0 )
+        f->additional_data.timestamp_domain = static_cast< rs2_timestamp_domain >( md.timestamp_domain );
+
+    // Other metadata fields, mapped by the stream schema; those unknown by librealsense are ignored (all metadata is
+    // not there when we create the frame, so no need to erase)
+    auto & metadata = reinterpret_cast< metadata_array & >( f->additional_data.metadata_blob );
+    size_t const n = std::min( md.size(), streaming.md_fields.size() );
+    for( size_t i = 0; i < n; ++i )
     {
-        // Other metadata fields. Metadata fields that are present but unknown by librealsense will be ignored.
-        auto & metadata = reinterpret_cast< metadata_array & >( f->additional_data.metadata_blob );
-        for( size_t i = 0; i < static_cast< size_t >( RS2_FRAME_METADATA_COUNT ); ++i )
-        {
-            auto key = static_cast< rs2_frame_metadata_value >( i );
-            std::string const & keystr = librealsense::get_string( key );
-            try
-            {
-                if( auto value_j = md.nested( keystr, &json::is_number_integer ) )
-                    metadata[key] = { true, value_j.get< rs2_metadata_type >() };
-            }
-            catch( json::exception const & )
-            {
-                // The metadata key doesn't exist or the value isn't the right type... we ignore it!
-                // (all metadata is not there when we create the frame, so no need to erase)
-            }
-        }
+        int const key = streaming.md_fields[i];
+        if( key >= 0 && md.has( i ) )
+            metadata[key] = { true, md.get( i ) };
     }
 }
 
@@ -682,9 +765,10 @@ void dds_sensor_proxy::start( rs2_frame_callback_sptr callback )
         // Opening it will start streaming on the server side automatically
         dds_stream->open( "rt/" + _dev->device_info().topic_root() + '_' + dds_stream->name(), _dev->subscriber() );
         auto & streaming = _streaming_by_name[dds_stream->name()];
+        init_metadata_fields( streaming, *dds_stream );
         streaming.syncer.on_frame_release( frame_releaser );
         streaming.syncer.on_frame_ready(
-            [this, &streaming]( syncer_type::frame_holder && fh, std::shared_ptr< const json > const & md )
+            [this, &streaming]( syncer_type::frame_holder && fh, syncer_type::metadata_type const & md )
             {
                 if( _is_streaming ) // stop was not called
                 {
@@ -699,6 +783,13 @@ void dds_sensor_proxy::start( rs2_frame_callback_sptr callback )
 
         if( auto dds_video_stream = std::dynamic_pointer_cast< realdds::dds_video_stream >( dds_stream ) )
         {
+            auto const & dds_profiles = dds_stream->profiles();
+            streaming.depth_codec = std::any_of( dds_profiles.begin(), dds_profiles.end(),
+                []( std::shared_ptr< realdds::dds_stream_profile > const & p )
+                {
+                    auto vsp = std::dynamic_pointer_cast< realdds::dds_video_stream_profile >( p );
+                    return vsp && vsp->encoding() == realdds::dds_video_encoding::depth_codec();
+                } );
             dds_video_stream->on_data_available(
                 [profile, this, &streaming]( std::vector< uint8_t > && data, realdds::dds_time && timestamp, realdds::dds_sample && sample )
                 {
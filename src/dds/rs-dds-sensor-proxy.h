@@ -13,6 +13,7 @@
 #include <realdds/dds-metadata-syncer.h>
 #include <realdds/dds-embedded-filter.h>
 #include <realdds/dds-stream-profile.h>
+#include <realdds/topics/binary-metadata.h>
 
 #include <rsutils/json-fwd.h>
 #include <memory>
@@ -49,7 +50,8 @@ class dds_sensor_proxy : public software_sensor
     bool const _md_enabled;
     options_watcher _options_watcher;
 
-    typedef realdds::dds_metadata_syncer syncer_type;
+    // Metadata is handled in binary form, whatever form the server sends it in
+    typedef realdds::dds_metadata_syncer_t< realdds::topics::binary_metadata > syncer_type;
     static void frame_releaser( syncer_type::frame_type * f ) { static_cast< frame * >( f )->release(); }
 
     std::shared_ptr< roi_sensor_interface > _roi_support;
@@ -58,8 +60,10 @@ protected:
     struct streaming_impl
     {
         syncer_type syncer;
+        std::vector< int > md_fields;  // the rs2_frame_metadata_value of each binary metadata field, or -1 if unknown
         std::atomic< unsigned long long > last_frame_number{ 0 };
         std::atomic< rs2_time_t > last_timestamp;
+        bool depth_codec = false;  // images arrive compressed with rsutils::codec, to be decoded back to Z16
     };
 
 private:
@@ -125,13 +129,15 @@ protected:
                              streaming_impl & );
     void handle_new_metadata( std::string const & stream_name,
                               std::shared_ptr< const rsutils::json > const & metadata );
+    void handle_new_metadata( std::shared_ptr< const realdds::topics::binary_metadata > const & metadata );
     void handle_inference_data( realdds::topics::string_msg &&,
                                 realdds::dds_sample &&,
                                 const std::shared_ptr< stream_profile_interface > &,
                                 streaming_impl & );
 
+    void init_metadata_fields( streaming_impl &, realdds::dds_stream const & ) const;
     virtual void add_no_metadata( frame *, streaming_impl & );
-    virtual void add_frame_metadata( frame *, rsutils::json const & metadata, streaming_impl & );
+    virtual void add_frame_metadata( frame *, realdds::topics::binary_metadata const & metadata, streaming_impl & );
 
     void add_processing_block_settings( const std::string & filter_name,
                                         std::shared_ptr< librealsense::processing_block_interface > & ppb ) const;
@@ -5,6 +5,8 @@
 #include "option.h"
 #include "device-calibration.h"
 
+#include <rsutils/concurrency/timer-service.h>
+
 #include <set>
 
 
@@ -26,12 +28,12 @@ namespace librealsense
         ds_thermal_monitor(const ds_thermal_monitor&) = delete;       // disable copy and assignment ctors
         ds_thermal_monitor& operator=(const ds_thermal_monitor&) = delete;
 
-        // Active Object's main routine
-        void polling(dispatcher::cancellable_timer cancellable_timer);
+        // Periodic task's main routine
+        void polling();
         void notify(float  temperature);
 
-        active_object<> _monitor;
         unsigned int _poll_intervals_ms;
+        rsutils::concurrency::periodic_task _monitor;
         float _thermal_threshold_deg;
         float _temp_base;
         bool _hw_loop_on;
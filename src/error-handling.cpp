@@ -18,11 +18,10 @@ namespace librealsense
         :_poll_intervals_ms(poll_intervals_ms),
         _option(std::move(option)),
         _device_alive(std::move(device_alive)),
+        _active_object("error polling", std::chrono::milliseconds(poll_intervals_ms), [this]() { polling(); }),
         _notifications_processor(std::move(processor)),
         _decoder(std::move(decoder))
     {
-        _active_object = std::make_shared<active_object<>>([this](dispatcher::cancellable_timer cancellable_timer)
-            {  polling(cancellable_timer);  });
     }
 
     polling_error_handler::~polling_error_handler()
@@ -33,85 +32,81 @@ namespace librealsense
     void polling_error_handler::start( unsigned int poll_intervals_ms )
     {
         if( poll_intervals_ms )
+        {
             _poll_intervals_ms = poll_intervals_ms;
-        _active_object->start();
+            _active_object.set_interval( std::chrono::milliseconds( _poll_intervals_ms ) );
+        }
+        _active_object.start();
     }
     void polling_error_handler::stop()
     {
-        _active_object->stop();
+        _active_object.stop();
     }
 
-    void polling_error_handler::polling( dispatcher::cancellable_timer cancellable_timer )
+    void polling_error_handler::polling()
     {
-        if( cancellable_timer.try_sleep( std::chrono::milliseconds( _poll_intervals_ms ) ) )
+        if( ! _silenced )
         {
-            if( ! _silenced )
+            // The owning device sets *_device_alive = false in its destructor body,
+            // before any of its members destruct. That's our signal to exit cleanly
+            // without firing another (failing) FW query. An expired weak_ptr is
+            // treated the same as a false flag for robustness against destruction
+            // ordering changes.
+            auto alive = _device_alive.lock();
+            if( ! alive || ! alive->load() )
             {
-                // The owning device sets *_device_alive = false in its destructor body,
-                // before any of its members destruct. That's our signal to exit cleanly
-                // without firing another (failing) FW query. An expired weak_ptr is
-                // treated the same as a false flag for robustness against destruction
-                // ordering changes.
-                auto alive = _device_alive.lock();
-                if( ! alive || ! alive->load() )
-                {
-                    LOG_DEBUG( "Device marked dead; shutting down polling loop" );
-                    _silenced = true;
-                    return;
-                }
-                try
+                LOG_DEBUG( "Device marked dead; shutting down polling loop" );
+                _silenced = true;
+                return;
+            }
+            try
+            {
+                auto val = static_cast< uint8_t >( _option->query() );
+
+                if( val != 0 )
                 {
-                    auto val = static_cast< uint8_t >( _option->query() );
+                    LOG_DEBUG( "Error detected from FW, error ID: " <<  std::to_string(val)  );
+                    // First reset the value in the FW.
+                    auto reseted_val = static_cast< uint8_t >( _option->query() );
+                    auto strong = _notifications_processor.lock();
+                    if( ! strong )
+                    {
+                        LOG_DEBUG( "Could not lock the notifications processor" );
+                        _silenced = true;
+                        return;
+                    }
 
-                    if( val != 0 )
+                    strong->raise_notification( _decoder->decode( val ) );
+
+                    // Reading from last-error control is supposed to set it to zero in the
+                    // firmware If this is not happening there is some issue
+                    // Note: if an error will be raised between the 2 queries, this will cause
+                    // the error polling loop to stop
+                    if( reseted_val != 0 )
                     {
-                        LOG_DEBUG( "Error detected from FW, error ID: " <<  std::to_string(val)  );
-                        // First reset the value in the FW.
-                        auto reseted_val = static_cast< uint8_t >( _option->query() );
-                        auto strong = _notifications_processor.lock();
-                        if( ! strong )
-                        {
-                            LOG_DEBUG( "Could not lock the notifications processor" );
-                            _silenced = true;
-                            return;
-                        }
-
-                        strong->raise_notification( _decoder->decode( val ) );
-
-                        // Reading from last-error control is supposed to set it to zero in the
-                        // firmware If this is not happening there is some issue
-                        // Note: if an error will be raised between the 2 queries, this will cause
-                        // the error polling loop to stop
-                        if( reseted_val != 0 )
-                        {
-                            std::string error_str = rsutils::string::from()
-                                                 << "Error polling loop is not behaving as expected! "
-                                                    "expecting value : 0 got : "
-                                                 << std::to_string( val ) << "\nShutting down error polling loop";
-                            LOG_ERROR( error_str );
-                            notification postcondition_failed{
-                                RS2_NOTIFICATION_CATEGORY_HARDWARE_ERROR,
-                                0,
-                                RS2_LOG_SEVERITY_WARN,
-                                error_str };
-                            strong->raise_notification( postcondition_failed );
-                            _silenced = true;
-                        }
+                        std::string error_str = rsutils::string::from()
+                                             << "Error polling loop is not behaving as expected! "
+                                                "expecting value : 0 got : "
+                                             << std::to_string( val ) << "\nShutting down error polling loop";
+                        LOG_ERROR( error_str );
+                        notification postcondition_failed{
+                            RS2_NOTIFICATION_CATEGORY_HARDWARE_ERROR,
+                            0,
+                            RS2_LOG_SEVERITY_WARN,
+                            error_str };
+                        strong->raise_notification( postcondition_failed );
+                        _silenced = true;
                     }
                 }
-                catch( const std::exception & ex )
-                {
-                    LOG_ERROR( "Error during polling error handler: " << ex.what() );
-                }
-                catch( ... )
-                {
-                    LOG_ERROR( "Unknown error during polling error handler!" );
-                }
             }
-        }
-        else
-        {
-            LOG_DEBUG( "Notification polling loop is being shut-down" );
+            catch( const std::exception & ex )
+            {
+                LOG_ERROR( "Error during polling error handler: " << ex.what() );
+            }
+            catch( ... )
+            {
+                LOG_ERROR( "Unknown error during polling error handler!" );
+            }
         }
     }
 
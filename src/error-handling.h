@@ -4,6 +4,7 @@
 
 #include "core/option-interface.h"
 #include <rsutils/concurrency/concurrency.h>
+#include <rsutils/concurrency/timer-service.h>
 
 #include <atomic>
 #include <memory>
@@ -32,13 +33,13 @@ namespace librealsense
         void stop();
 
     private:
-        void polling(dispatcher::cancellable_timer cancellable_timer);
+        void polling();
 
         unsigned int _poll_intervals_ms;
         bool _silenced = false;
         std::shared_ptr<option> _option;
         std::weak_ptr<std::atomic<bool>> _device_alive;
-        std::shared_ptr < active_object<> > _active_object;
+        rsutils::concurrency::periodic_task _active_object;
         std::weak_ptr<notifications_processor> _notifications_processor;
         std::shared_ptr<notification_decoder> _decoder;
     };
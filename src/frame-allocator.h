@@ -0,0 +1,78 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/hpp/rs_types.hpp>
+#include <rsutils/easylogging/easyloggingpp.h>
+
+#include <memory>
+#include <cstdint>
+
+
+namespace librealsense {
+
+
+// Wraps a user-supplied rs2_frame_allocator (see rs2_set_frame_allocator) so frame data can be placed in
+// application memory. The returned buffers keep the allocator alive, so frames the user holds on to can still be
+// freed after the sensor moved on to another allocator (or was destroyed).
+//
+class frame_allocator : public std::enable_shared_from_this< frame_allocator >
+{
+    rs2_frame_allocator_sptr _allocator;
+    int _alignment;
+
+public:
+    frame_allocator( rs2_frame_allocator_sptr allocator, int alignment )
+        : _allocator( std::move( allocator ) )
+        , _alignment( alignment )
+    {
+    }
+
+    int get_alignment() const { return _alignment; }
+
+    // Returns nullptr if the user could not supply the memory, in which case the frame should fall back to
+    // internal allocation
+    std::shared_ptr< uint8_t > allocate( size_t size )
+    {
+        void * data = nullptr;
+        try
+        {
+            data = _allocator->allocate( static_cast< int >( size ), _alignment );
+        }
+        catch( ... )
+        {
+            LOG_ERROR( "Received an exception from frame allocator!" );
+            return nullptr;
+        }
+        if( ! data )
+            return nullptr;
+
+        if( _alignment > 0 && reinterpret_cast< uintptr_t >( data ) % _alignment )
+        {
+            LOG_WARNING( "Frame allocator returned memory that is not " << _alignment << "-byte aligned; ignoring it" );
+            free( data, size );
+            return nullptr;
+        }
+
+        auto self = shared_from_this();
+        return std::shared_ptr< uint8_t >( static_cast< uint8_t * >( data ),
+                                           [self, size]( uint8_t * p ) { self->free( p, size ); } );
+    }
+
+private:
+    void free( void * data, size_t size )
+    {
+        try
+        {
+            _allocator->free( data, static_cast< int >( size ) );
+        }
+        catch( ... )
+        {
+            LOG_ERROR( "Received an exception from frame allocator!" );
+        }
+    }
+};
+
+
+}  // namespace librealsense
@@ -3,7 +3,10 @@
 #pragma once
 
 #include "archive.h"
+#include "frame-buffer-pool.h"
+#include "frame-allocator.h"
 #include <src/core/frame-interface.h>
+#include <src/core/video-frame.h>
 
 #include <atomic>
 #include <vector>
@@ -22,7 +25,8 @@ namespace librealsense
         std::shared_ptr<metadata_parser_map> _metadata_parsers = nullptr;
         callbacks_heap callback_inflight;
 
-        std::vector<T> freelist; // return frames here
+        frame_buffer_pool buffers; // return frame data here
+        std::shared_ptr<frame_allocator> user_allocator; // accessed atomically
         std::atomic<bool> recycle_frames;
         int pending_frames = 0;
         std::recursive_mutex mutex;
@@ -34,35 +38,18 @@ namespace librealsense
         T alloc_frame(const size_t size, frame_additional_data && additional_data, bool requires_memory)
         {
             T backbuffer;
-            //const size_t size = modes[stream].get_image_size(stream);
+            if (requires_memory)
             {
-                std::lock_guard<std::recursive_mutex> guard(mutex);
-
-                if (requires_memory)
-                {
-                    // Attempt to obtain a buffer of the appropriate size from the freelist
-                    for (auto it = begin(freelist); it != end(freelist); ++it)
-                    {
-                        if (it->data.size() == size)
-                        {
-                            backbuffer = std::move(*it);
-                            freelist.erase(it);
-                            break;
-                        }
-                    }
-                }
-
-                // Discard buffers that have been in the freelist for longer than 1s
-                for (auto it = begin(freelist); it != end(freelist);)
+                if (auto allocator = std::atomic_load(&user_allocator))
                 {
-                    if (additional_data.timestamp > it->additional_data.timestamp + 1000) it = freelist.erase(it);
-                    else ++it;
+                    backbuffer.allocated_data = allocator->allocate(size);
+                    if (backbuffer.allocated_data)
+                        backbuffer.allocated_data_size = size;
                 }
-            }
-
-            if (requires_memory)
-            {
-                backbuffer.data.resize(size, 0); // TODO: Allow users to provide a custom allocator for frame buffers
+                // Otherwise attempt to obtain a buffer of the appropriate size from the pool; a recycled
+                // buffer is already the right size so the resize below is a no-op
+                if (!backbuffer.allocated_data && !buffers.acquire(size, additional_data.timestamp, backbuffer.data))
+                    backbuffer.data.resize(size, 0);
             }
             backbuffer.additional_data = std::move( additional_data );
             return backbuffer;
@@ -88,15 +75,18 @@ namespace librealsense
             if( fi )
             {
                 auto f = (T *)fi;
-                std::unique_lock<std::recursive_mutex> lock(mutex);
 
                 fi->keep();
 
                 if (recycle_frames)
                 {
-                    freelist.push_back(std::move(*f));
+                    buffers.release(std::move(f->data), f->additional_data.timestamp);
                 }
-                lock.unlock();
+                // Give memory from a user frame allocator back as soon as the frame is released, whether the frame
+                // object is deleted or goes back to the heap to be reused
+                f->allocated_data.reset();
+                f->allocated_data_size = 0;
+                f->dmabuf_fd = -1;
 
                 if (f->is_fixed())
                     published_frames.deallocate(f);
@@ -142,6 +132,15 @@ namespace librealsense
 
         std::shared_ptr<metadata_parser_map> get_md_parsers() const override { return _metadata_parsers; };
 
+        frame_buffer_pool_stats get_buffer_pool_stats() const override { return buffers.get_stats(); }
+
+        void set_frame_allocator(std::shared_ptr<frame_allocator> const & allocator) override
+        {
+            // Only video frames access their data strictly through get_frame_data(); the others use 'data' directly
+            if (std::is_base_of<video_frame, T>::value)
+                std::atomic_store(&user_allocator, allocator);
+        }
+
         friend class frame;
 
     public:
@@ -184,10 +183,11 @@ namespace librealsense
             // wait until user is done with all the stuff he chose to borrow
             callback_inflight.wait_until_empty();
 
-            {
-                std::lock_guard<std::recursive_mutex> guard(mutex);
-                freelist.clear();
-            }
+            buffers.clear();
+
+            auto stats = buffers.get_stats();
+            LOG_DEBUG("Frame buffer pool 0x" << std::hex << this << std::dec << ": " << stats.hits << " hits, "
+                      << stats.misses << " misses, " << stats.evictions << " evictions");
 
             pending_frames = published_frames.get_size();
             if (pending_frames > 0)
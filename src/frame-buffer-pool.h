@@ -0,0 +1,219 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/h/rs_types.h>
+
+#include <atomic>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+
+namespace librealsense {
+
+
+// Counters describing how well a frame_buffer_pool is doing
+struct frame_buffer_pool_stats
+{
+    uint64_t hits = 0;       // buffers handed out from the pool
+    uint64_t misses = 0;     // buffers that had to be allocated
+    uint64_t evictions = 0;  // buffers freed instead of being reused: stale, or no room left in the pool
+
+    frame_buffer_pool_stats & operator+=( frame_buffer_pool_stats const & other )
+    {
+        hits += other.hits;
+        misses += other.misses;
+        evictions += other.evictions;
+        return *this;
+    }
+};
+
+
+// Recycles frame data buffers so that, once streaming has settled, allocating a frame does not touch
+// the heap (and, since a recycled buffer is already the right size, does not zero-fill it either).
+//
+// Buffers are kept in a few buckets, each holding buffers of a single exact size: a stream normally
+// produces only one size, so a handful of buckets is plenty. Each bucket is a fixed array of slots;
+// a slot is taken with a single compare-exchange on its state, so neither the backend thread that
+// allocates nor the user thread that releases a frame ever waits on a lock.
+//
+// Like the freelist this replaces, a buffer that was released more than STALE_MS (in frame time)
+// before the frame that wants it is freed rather than reused.
+//
+class frame_buffer_pool
+{
+public:
+    static constexpr int BUCKETS = 4;
+    static constexpr int SLOTS = 16;
+    static constexpr rs2_time_t STALE_MS = 1000.;
+
+    frame_buffer_pool() = default;
+    frame_buffer_pool( const frame_buffer_pool & ) = delete;
+    frame_buffer_pool & operator=( const frame_buffer_pool & ) = delete;
+
+    // Try to get a buffer of exactly 'size' bytes; 'now' is the timestamp of the frame it is for.
+    // Returns false (and leaves 'out' alone) if none is available.
+    bool acquire( size_t size, rs2_time_t now, std::vector< uint8_t > & out )
+    {
+        for( auto & b : _buckets )
+        {
+            if( b.size.load( std::memory_order_acquire ) != size )
+                continue;
+            for( auto & s : b.slots )
+            {
+                if( ! s.try_lock( FULL ) )
+                    continue;
+                // The bucket may have been handed to another size since the buffer was put here
+                if( s.buffer.size() == size && ! is_stale( s, now ) )
+                {
+                    out = std::move( s.buffer );
+                    s.buffer = std::vector< uint8_t >();
+                    s.unlock( EMPTY );
+                    _hits.fetch_add( 1, std::memory_order_relaxed );
+                    return true;
+                }
+                evict( s );
+            }
+        }
+
+        // A miss usually means a new size; take the opportunity to free whatever went stale, so
+        // the buckets of sizes that are no longer used can be reclaimed
+        trim( now );
+        _misses.fetch_add( 1, std::memory_order_relaxed );
+        return false;
+    }
+
+    // Give a buffer back to the pool; 'timestamp' is that of the frame that used it.
+    // If there's no room for it, the buffer is left untouched for the caller to free.
+    void release( std::vector< uint8_t > && buffer, rs2_time_t timestamp )
+    {
+        auto const size = buffer.size();
+        if( ! size )
+            return;
+
+        if( auto b = find_or_claim_bucket( size ) )
+        {
+            for( auto & s : b->slots )
+            {
+                if( ! s.try_lock( EMPTY ) )
+                    continue;
+                s.buffer = std::move( buffer );
+                s.timestamp = timestamp;
+                s.unlock( FULL );
+                return;
+            }
+        }
+        _evictions.fetch_add( 1, std::memory_order_relaxed );
+    }
+
+    // Free all the buffers currently in the pool
+    void clear()
+    {
+        for( auto & b : _buckets )
+        {
+            for( auto & s : b.slots )
+                if( s.try_lock( FULL ) )
+                    evict( s );
+            b.size.store( 0, std::memory_order_release );
+        }
+    }
+
+    frame_buffer_pool_stats get_stats() const
+    {
+        frame_buffer_pool_stats stats;
+        stats.hits = _hits.load( std::memory_order_relaxed );
+        stats.misses = _misses.load( std::memory_order_relaxed );
+        stats.evictions = _evictions.load( std::memory_order_relaxed );
+        return stats;
+    }
+
+private:
+    enum slot_state
+    {
+        EMPTY,
+        BUSY,  // someone is moving a buffer in or out
+        FULL
+    };
+
+    struct slot
+    {
+        std::atomic< int > state{ EMPTY };
+        std::vector< uint8_t > buffer;
+        rs2_time_t timestamp = 0;
+
+        bool try_lock( int expected )
+        {
+            return state.load( std::memory_order_relaxed ) == expected
+                && state.compare_exchange_strong( expected, BUSY, std::memory_order_acquire );
+        }
+        void unlock( int new_state ) { state.store( new_state, std::memory_order_release ); }
+    };
+
+    struct bucket
+    {
+        std::atomic< size_t > size{ 0 };  // 0 if not yet assigned a size
+        slot slots[SLOTS];
+
+        bool is_empty() const
+        {
+            for( auto & s : slots )
+                if( s.state.load( std::memory_order_relaxed ) != EMPTY )
+                    return false;
+            return true;
+        }
+    };
+
+    static bool is_stale( slot const & s, rs2_time_t now ) { return now > s.timestamp + STALE_MS; }
+
+    // Free the buffer of a slot we hold (BUSY)
+    void evict( slot & s )
+    {
+        std::vector< uint8_t >().swap( s.buffer );
+        s.unlock( EMPTY );
+        _evictions.fetch_add( 1, std::memory_order_relaxed );
+    }
+
+    void trim( rs2_time_t now )
+    {
+        for( auto & b : _buckets )
+            for( auto & s : b.slots )
+                if( s.try_lock( FULL ) )
+                {
+                    if( is_stale( s, now ) )
+                        evict( s );
+                    else
+                        s.unlock( FULL );
+                }
+    }
+
+    bucket * find_or_claim_bucket( size_t size )
+    {
+        for( auto & b : _buckets )
+            if( b.size.load( std::memory_order_acquire ) == size )
+                return &b;
+        // Claim an unused bucket, or else one that holds no buffers
+        for( auto & b : _buckets )
+        {
+            size_t unused = 0;
+            if( b.size.compare_exchange_strong( unused, size, std::memory_order_acq_rel ) )
+                return &b;
+        }
+        for( auto & b : _buckets )
+        {
+            size_t previous = b.size.load( std::memory_order_acquire );
+            if( b.is_empty() && b.size.compare_exchange_strong( previous, size, std::memory_order_acq_rel ) )
+                return &b;
+        }
+        return nullptr;
+    }
+
+    bucket _buckets[BUCKETS];
+    std::atomic< uint64_t > _hits{ 0 };
+    std::atomic< uint64_t > _misses{ 0 };
+    std::atomic< uint64_t > _evictions{ 0 };
+};
+
+
+}  // namespace librealsense
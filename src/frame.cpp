@@ -112,6 +112,42 @@ bool frame::find_metadata( rs2_frame_metadata_value frame_metadata, rs2_metadata
 {
     if( ! metadata_parsers )
         return false;
+
+    auto & table = additional_data.decoded_metadata;
+    if( size_t( frame_metadata ) < RS2_FRAME_METADATA_ACTUAL_COUNT && ( table.is_filled() || fill_metadata_table() ) )
+        return table.find( frame_metadata, p_value );
+
+    return parse_metadata( frame_metadata, p_value );
+}
+
+bool frame::fill_metadata_table() const
+{
+    auto & table = additional_data.decoded_metadata;
+    if( ! table.try_start_filling() )
+        return false;
+
+    try
+    {
+        // In key order, as for parse_metadata(): where a value has several parsers, the last to find it wins
+        for( auto & parser : *metadata_parsers )
+        {
+            rs2_metadata_type value;
+            if( size_t( parser.first ) < RS2_FRAME_METADATA_ACTUAL_COUNT && parser.second->find( *this, &value ) )
+                table.set( parser.first, value );
+        }
+    }
+    catch( ... )
+    {
+        // Let the failure surface from the query for the value whose parser threw
+        table.abandon_filling();
+        return false;
+    }
+    table.finish_filling();
+    return true;
+}
+
+bool frame::parse_metadata( rs2_frame_metadata_value frame_metadata, rs2_metadata_type * p_value ) const
+{
     auto parsers = metadata_parsers->equal_range( frame_metadata );
 
     bool value_retrieved = false;
@@ -124,12 +160,14 @@ bool frame::find_metadata( rs2_frame_metadata_value frame_metadata, rs2_metadata
 
 int frame::get_frame_data_size() const
 {
+    if( allocated_data )
+        return (int)allocated_data_size;
     return (int)data.size();
 }
 
 const uint8_t * frame::get_frame_data() const
 {
-    const uint8_t * frame_data = data.data();
+    const uint8_t * frame_data = allocated_data ? allocated_data.get() : data.data();
 
     if( on_release.get_data() )
     {
@@ -21,6 +21,12 @@ class LRS_EXTENSION_API frame : public frame_interface
 {
 public:
     std::vector< uint8_t > data;
+    // Frame data from a user-supplied frame_allocator; when set, 'data' is left empty
+    std::shared_ptr< uint8_t > allocated_data;
+    size_t allocated_data_size = 0;
+    // When allocated_data is a backend buffer that was exported as a DMABUF: its file descriptor, valid as long as
+    // allocated_data is; -1 otherwise
+    int dmabuf_fd = -1;
     frame_additional_data additional_data;
     std::shared_ptr< metadata_parser_map > metadata_parsers = nullptr;
     
@@ -46,6 +52,11 @@ public:
     frame& operator=(frame&& r)
     {
         data = std::move(r.data);
+        allocated_data = std::move(r.allocated_data);
+        allocated_data_size = r.allocated_data_size;
+        r.allocated_data_size = 0;
+        dmabuf_fd = r.dmabuf_fd;
+        r.dmabuf_fd = -1;
         owner = r.owner;
         ref_count = r.ref_count.exchange(0);
         _kept = r._kept.exchange(false);
@@ -68,7 +79,11 @@ public:
     const uint8_t * get_frame_data() const override;
     rs2_time_t get_frame_timestamp() const override;
     rs2_timestamp_domain get_frame_timestamp_domain() const override;
-    void set_timestamp( double new_ts ) override { additional_data.timestamp = new_ts; }
+    void set_timestamp( double new_ts ) override
+    {
+        additional_data.timestamp = new_ts;
+        additional_data.decoded_metadata.reset();  // the actual FPS depends on it
+    }
     unsigned long long get_frame_number() const override;
     void set_timestamp_domain( rs2_timestamp_domain timestamp_domain ) override
     {
@@ -110,6 +125,9 @@ public:
     bool is_blocking() const override { return additional_data.is_blocking; }
 
 private:
+    bool fill_metadata_table() const;
+    bool parse_metadata( rs2_frame_metadata_value, rs2_metadata_type * p_output_value ) const;
+
     // TODO: check boost::intrusive_ptr or an alternative
     std::atomic< int > ref_count;  // the reference count is on how many times this placeholder has
                                    // been observed (not lifetime, not content)
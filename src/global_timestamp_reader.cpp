@@ -174,9 +174,9 @@ namespace librealsense
         _users_count(0),
         _is_ready(false),
         _min_command_delay(1000),
-        _active_object([this](dispatcher::cancellable_timer cancellable_timer)
+        _active_object("time_diff_keeper", std::chrono::milliseconds(sampling_interval_ms), [this]()
             {
-                polling(cancellable_timer);
+                polling();
             })
     {
         //LOG_DEBUG("start new time_diff_keeper ");
@@ -187,7 +187,7 @@ namespace librealsense
         std::lock_guard<std::recursive_mutex> lock(_enable_mtx);
         _users_count++;
         LOG_DEBUG("time_diff_keeper::start: _users_count = " << _users_count);
-        _active_object.start();
+        _active_object.start(true);
     }
 
     void time_diff_keeper::stop()
@@ -259,14 +259,11 @@ namespace librealsense
         return false;
     }
 
-    void time_diff_keeper::polling(dispatcher::cancellable_timer cancellable_timer)
+    void time_diff_keeper::polling()
     {
         update_diff_time();
         unsigned int time_to_sleep = _poll_intervals_ms + _coefs.is_full() * (9 * _poll_intervals_ms);
-        if (!cancellable_timer.try_sleep( std::chrono::milliseconds( time_to_sleep )))
-        {
-            LOG_DEBUG("Notification: time_diff_keeper polling loop is being shut-down");
-        }
+        _active_object.set_interval( std::chrono::milliseconds( time_to_sleep ) );
     }
 
     double time_diff_keeper::get_system_hw_time(double crnt_hw_time, bool& is_ready)
@@ -7,6 +7,7 @@
 #include "error-handling.h"
 #include "option.h"
 #include <deque>
+#include <rsutils/concurrency/timer-service.h>
 
 namespace librealsense
 {
@@ -73,14 +74,14 @@ namespace librealsense
 
     private:
         bool update_diff_time();
-        void polling(dispatcher::cancellable_timer cancellable_timer);
+        void polling();
 
     private:
         global_time_interface* _device;
         unsigned int _poll_intervals_ms;
         int             _users_count;
         std::shared_ptr<global_time_option> _option_is_enabled;
-        active_object<> _active_object;
+        rsutils::concurrency::periodic_task _active_object;
         mutable std::recursive_mutex _read_mtx; // Watch only 1 reader at a time.
         mutable std::recursive_mutex _enable_mtx; // Watch only 1 start/stop operation at a time.
         CLinearCoefficients _coefs;
@@ -8,9 +8,11 @@
 #include "image.h"
 #include "global_timestamp_reader.h"
 #include "metadata.h"
+#include "option.h"
 #include "platform/stream-profile-impl.h"
 #include <src/metadata-parser.h>
 #include <src/core/time-service.h>
+#include <src/core/latency-tracer.h>
 
 #include <rsutils/type/fourcc.h>
 using rsutils::type::fourcc;
@@ -33,6 +35,10 @@ static const std::map< rs2_stream, fourcc::value_type > stream_and_fourcc
 static const std::map< float, double > gyro_sensitivity_convert
     = { { 0.0f, 0 }, { 1.0f, 0.1 }, { 2.0f, 0.2 }, { 3.0f, 0.3 }, { 4.0f, 0.4 } };
 
+// A batched frame is delivered once it holds this many samples, even if its window hasn't passed yet
+static constexpr size_t MAX_MOTION_BATCH = 256;
+static constexpr int MAX_MOTION_BATCH_WINDOW = 1000;  // ms
+
     // in sensor.cpp
 void log_callback_end( uint32_t fps,
                        rs2_time_t callback_start_time,
@@ -55,10 +61,22 @@ hid_sensor::hid_sensor(
     , _is_configured_stream( RS2_STREAM_COUNT )
     , _hid_iio_timestamp_reader( std::move( hid_iio_timestamp_reader ) )
     , _custom_hid_timestamp_reader( std::move( custom_hid_timestamp_reader ) )
+    , _motion_batch_window( 0 )
 {
     register_metadata( RS2_FRAME_METADATA_BACKEND_TIMESTAMP,
                        make_additional_data_parser( &frame_additional_data::backend_timestamp ) );
 
+    register_option( RS2_OPTION_MOTION_BATCH_WINDOW,
+                     std::make_shared< ptr_option< int > >(
+                         0,
+                         MAX_MOTION_BATCH_WINDOW,
+                         1,
+                         0,
+                         &_motion_batch_window,
+                         "Deliver motion samples in batches, one frame per batch: how long (in ms) to keep adding "
+                         "samples before delivering them; 0 for a frame per sample. Takes effect on the next stream "
+                         "start" ) );
+
     std::map< std::string, uint32_t > frequency_per_sensor;
     for( auto && elem : sensor_name_and_hid_profiles )
         frequency_per_sensor.insert( make_pair( elem.first, elem.second.fps ) );
@@ -187,12 +205,18 @@ void hid_sensor::start( rs2_frame_callback_sptr callback )
 
     unsigned long long last_frame_number = 0;
     rs2_time_t last_timestamp = 0;
+    int const batch_window = _motion_batch_window;
+    _motion_batches.clear();
+    if( batch_window )
+        for( auto & sensor_and_profile : _configured_profiles )
+            _motion_batches[sensor_and_profile.first].samples.reserve( MAX_MOTION_BATCH );
     raise_on_before_streaming_changes( true );  // Required to be just before actual start allow recording to work
 
     _hid_device->start_capture(
-        [this, last_frame_number, last_timestamp]( const platform::sensor_data & sensor_data ) mutable
+        [this, last_frame_number, last_timestamp, batch_window]( const platform::sensor_data & sensor_data ) mutable
         {
             const auto system_time = time_service::get_time();  // time frame was received from the backend
+            const auto arrival_ns = latency_tracer::is_enabled() ? latency_tracer::now() : 0;
             auto timestamp_reader = _hid_iio_timestamp_reader.get();
             static const std::string custom_sensor_name = "custom";
             auto && sensor_name = sensor_data.sensor.name;
@@ -252,20 +276,53 @@ void hid_sensor::start( rs2_frame_callback_sptr callback )
 
             last_frame_number = frame_counter;
             last_timestamp = timestamp;
-            frame_holder frame = _source.alloc_frame(
-                { request->get_stream_type(), request->get_stream_index(), RS2_EXTENSION_MOTION_FRAME },
-                data_size,
-                std::move( fr->additional_data ),
-                true );
-            memcpy( (void *)frame->get_frame_data(),
-                    sensor_data.fo.pixels,
-                    sizeof( uint8_t ) * sensor_data.fo.frame_size );
+
+            frame_holder frame;
+            auto batch = is_custom_sensor || ! batch_window ? _motion_batches.end() : _motion_batches.find( sensor_name );
+            if( batch != _motion_batches.end() )
+            {
+                // Hold on to the sample until the batch is due: the window has passed, and the backend has no more
+                // samples for us from the same read
+                auto & b = batch->second;
+                hid_batch_sample sample{};
+                std::memcpy( &sample.data, sensor_data.fo.pixels, std::min( sizeof( sample.data ), size_t( data_size ) ) );
+                sample.timestamp = timestamp;
+                sample.frame_number = frame_counter;
+                if( b.samples.empty() )
+                {
+                    b.first = std::move( fr->additional_data );
+                    b.first_system_time = system_time;
+                    b.first_arrival_ns = arrival_ns;
+                }
+                b.samples.push_back( sample );
+                if( b.samples.size() < MAX_MOTION_BATCH
+                    && ( sensor_data.more_in_read || system_time - b.first_system_time < batch_window ) )
+                    return;
+                frame = make_batch_frame( b, request );
+            }
+            else
+            {
+                frame = _source.alloc_frame(
+                    { request->get_stream_type(), request->get_stream_index(), RS2_EXTENSION_MOTION_FRAME },
+                    data_size,
+                    std::move( fr->additional_data ),
+                    true );
+                if( frame )
+                {
+                    const auto allocated_ns = arrival_ns ? latency_tracer::now() : 0;
+                    memcpy( (void *)frame->get_frame_data(),
+                            sensor_data.fo.pixels,
+                            sizeof( uint8_t ) * sensor_data.fo.frame_size );
+                    frame->set_stream( request );
+                    if( arrival_ns )
+                        latency_tracer::on_new_frame( frame.frame, arrival_ns, allocated_ns );
+                }
+            }
             if( ! frame )
             {
                 LOG_INFO( "Dropped frame. alloc_frame(...) returned nullptr" );
                 return;
             }
-            frame->set_stream( request );
             frame->set_timestamp_domain( timestamp_domain );
 
             // Gather info for logging the callback ended
@@ -284,6 +341,28 @@ void hid_sensor::start( rs2_frame_callback_sptr callback )
     _is_streaming = true;
 }
 
+frame_holder hid_sensor::make_batch_frame( motion_batch & batch,
+                                           std::shared_ptr< stream_profile_interface > const & profile )
+{
+    auto const n = batch.samples.size();
+    batch.first.motion_samples = uint32_t( n );
+    frame_holder frame = _source.alloc_frame(
+        { profile->get_stream_type(), profile->get_stream_index(), RS2_EXTENSION_MOTION_FRAME },
+        n * sizeof( hid_batch_sample ),
+        std::move( batch.first ),
+        true );
+    if( frame )
+    {
+        const auto allocated_ns = batch.first_arrival_ns ? latency_tracer::now() : 0;
+        memcpy( (void *)frame->get_frame_data(), batch.samples.data(), n * sizeof( hid_batch_sample ) );
+        frame->set_stream( profile );
+        if( batch.first_arrival_ns )
+            latency_tracer::on_new_frame( frame.frame, batch.first_arrival_ns, allocated_ns );
+    }
+    batch.samples.clear();
+    return frame;
+}
+
 void hid_sensor::stop()
 {
     if( ! _is_streaming )
@@ -291,6 +370,7 @@ void hid_sensor::stop()
 
     _hid_device->stop_capture();
     _is_streaming = false;
+    _motion_batches.clear();  // whatever is left of them is dropped
     {
         std::lock_guard< std::mutex > lock( _configure_lock );
         _source.flush();
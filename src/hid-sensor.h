@@ -5,6 +5,7 @@
 
 #include "sensor.h"
 #include "platform/hid-device.h"
+#include "platform/hid-data.h"
 
 
 namespace librealsense {
@@ -74,6 +75,20 @@ private:
     //Keeps set sensitivity values for gyro and accel
     std::map< rs2_stream, float > _imu_sensitivity_per_rs2_stream;
 
+    // Samples gathered for the next batched frame (see RS2_OPTION_MOTION_BATCH_WINDOW); each HID sensor's is only
+    // touched from its own capture thread
+    struct motion_batch
+    {
+        std::vector< hid_batch_sample > samples;
+        frame_additional_data first;  // the first sample's, for the frame
+        rs2_time_t first_system_time = 0;
+        int64_t first_arrival_ns = 0;
+    };
+    int _motion_batch_window;  // in ms; 0 when not batching
+    std::map< std::string, motion_batch > _motion_batches;  // per HID sensor, set up on start
+
+    frame_holder make_batch_frame( motion_batch &, std::shared_ptr< stream_profile_interface > const & );
+
     stream_profiles get_sensor_profiles( std::string sensor_name ) const;
 
     const std::string & rs2_stream_to_sensor_name( rs2_stream stream ) const;
@@ -598,6 +598,7 @@ namespace librealsense
                             auto p_raw_data = raw_data.data() + channel_size * i;
                             sensor_data sens_data{};
                             sens_data.sensor = hid_sensor{get_sensor_name()};
+                            sens_data.more_in_read = uint32_t( sz - 1 - i );
 
                             auto hid_data_size = channel_size - (metadata ? HID_METADATA_SIZE : 0);
                             // Populate HID IMU data - Header
@@ -318,7 +318,7 @@ namespace librealsense
             return r;
         }
 
-        buffer::buffer(int fd, v4l2_buf_type type, bool use_memory_map, uint32_t index)
+        buffer::buffer(int fd, v4l2_buf_type type, bool use_memory_map, uint32_t index, const capture_memory& memory)
             : _type(type), _use_memory_map(use_memory_map), _index(index)
         {
             v4l2_buffer buf = {};
@@ -352,16 +352,40 @@ namespace librealsense
                                                     fd, _offset));
                 if(_start == MAP_FAILED)
                     throw linux_backend_exception("mmap failed");
+
+                if (memory.export_dmabuf)
+                    export_dmabuf(fd);
             }
             else
             {
+                if (memory.allocate)
+                {
+                    _user_memory = memory.allocate(_length);
+                    if (!_user_memory)
+                        LOG_WARNING("Capture memory allocation failed for buffer " << index << "; using internal memory");
+                }
                 //_length += (V4L2_BUF_TYPE_VIDEO_CAPTURE==type) ? MAX_META_DATA_SIZE : 0;
-                _start = static_cast<uint8_t*>(malloc( _length));
+                _start = _user_memory ? _user_memory.get() : static_cast<uint8_t*>(malloc( _length));
                 if (!_start) throw linux_backend_exception("User_p allocation failed!");
                 memset(_start, 0, _length);
             }
         }
 
+        void buffer::export_dmabuf(int fd)
+        {
+            v4l2_exportbuffer expbuf = {};
+            expbuf.type = _type;
+            expbuf.index = _index;
+            expbuf.plane = 0;
+            expbuf.flags = O_RDONLY | O_CLOEXEC;
+            if (xioctl(fd, VIDIOC_EXPBUF, &expbuf) < 0)
+            {
+                LOG_WARNING("xioctl(VIDIOC_EXPBUF) failed for buffer " << _index << ", error: " << strerror(errno));
+                return;
+            }
+            _dmabuf_fd = expbuf.fd;
+        }
+
         void buffer::prepare_for_streaming(int fd)
         {
             v4l2_buffer buf = {};
@@ -386,12 +410,15 @@ namespace librealsense
 
         buffer::~buffer()
         {
+            if (_dmabuf_fd >= 0)
+                ::close(_dmabuf_fd);
+
             if (_use_memory_map)
             {
                if(munmap(_start, _original_length) < 0)
                    LOG_DEBUG_V4L("munmap failed on buffer Dtor");
             }
-            else
+            else if (!_user_memory)
             {
                free(_start);
             }
@@ -407,6 +434,23 @@ namespace librealsense
         void buffer::detach_buffer()
         {
             std::lock_guard<std::mutex> lock(_mutex);
+            // Still held by a (zero-copy) frame: the kernel can't free a buffer while it is mapped, so a copy of its
+            // pixels is moved in place of the mapping. The frame keeps reading them from the same address.
+            if (_must_enqueue && _use_memory_map)
+            {
+                auto copy = mmap(nullptr, _original_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (copy == MAP_FAILED)
+                    LOG_ERROR("Failed to detach buffer " << _index << " from its frame, error: " << strerror(errno));
+                else
+                {
+                    std::memcpy(copy, _start, _original_length);
+                    if (mremap(copy, _original_length, _original_length, MREMAP_MAYMOVE | MREMAP_FIXED, _start) == MAP_FAILED)
+                    {
+                        LOG_ERROR("Failed to detach buffer " << _index << " from its frame, error: " << strerror(errno));
+                        munmap(copy, _original_length);
+                    }
+                }
+            }
             _must_enqueue = false;
         }
 
@@ -598,12 +642,16 @@ namespace librealsense
 
             if(xioctl(fd, VIDIOC_REQBUFS, &req) < 0)
             {
-                if(errno == EINVAL)
-                    LOG_ERROR(dev_name + " does not support memory mapping");
+                std::string const error = rsutils::string::from() << dev_name << " xioctl(VIDIOC_REQBUFS) failed for "
+                                                                  << count << " buffers, error: " << strerror(errno);
+                //D457 - fails on close (when num = 0); nothing to do about it then but go on closing
+                if (!count)
+                    LOG_WARNING(error);
+                else if(errno == EINVAL)
+                    throw linux_backend_exception(dev_name + " does not support memory mapping");
                 else
-                    return;
-                    //D457 - fails on close (when num = 0)
-                    //throw linux_backend_exception("xioctl(VIDIOC_REQBUFS) failed");
+                    // E.g., EBUSY: buffers of the last run are still in use, or the queue belongs to someone else
+                    throw linux_backend_exception(error);
             }
         }
 
@@ -1566,6 +1614,8 @@ namespace librealsense
         {
             _is_capturing = false;
             if (_thread && _thread->joinable()) _thread->join();
+            if (_generation)
+                _generation->end();
             for (auto&& fd : _fds)
             {
                 try { if (fd) ::close(fd);} catch (...) {}
@@ -1656,6 +1706,7 @@ namespace librealsense
                 _error_handler = error_handler;
 
                 // Start capturing
+                _generation = std::make_shared<stream_generation>();
                 prepare_capture_buffers();
 
                 // Synchronise stream requests for meta and video data.
@@ -1685,6 +1736,9 @@ namespace librealsense
             _thread->join();
             _thread.reset();
 
+            // Frames released from now on keep their buffers out of the queue
+            _generation->end();
+
             // Notify kernel
             streamoff();
         }
@@ -1708,7 +1762,11 @@ namespace librealsense
 
             if (_callback)
             {
-                // Release allocated buffers
+                // The capture may have stopped on its own (on error), without ending the run
+                if (_generation)
+                    _generation->end();
+
+                // Release allocated buffers, detaching those frames still hold
                 allocate_io_buffers(0);
 
                 // Release IO
@@ -1863,7 +1921,7 @@ namespace librealsense
                             v4l2_buffer buf = {};
                             struct v4l2_plane planes[VIDEO_MAX_PLANES] = {};
                             buf.type = _dev.buf_type;
-                            buf.memory = _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
+                            buf.memory = get_video_memory_type();
                             if (_dev.buf_type == V4L2_BUF_TYPE_VIDEO_CAPTURE_MPLANE) {
                                 buf.m.planes = planes;
                                 buf.length = VIDEO_MAX_PLANES;
@@ -1874,7 +1932,7 @@ namespace librealsense
                             }
                             LOG_DEBUG_V4L("Dequeued buf " << std::dec << buf.index << " for fd " << _fd << " seq " << buf.sequence);
                             buf.type = _dev.buf_type;
-                            buf.memory = _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
+                            buf.memory = get_video_memory_type();
                             if (_dev.buf_type == V4L2_BUF_TYPE_VIDEO_CAPTURE_MPLANE) {
                                 buf.bytesused = buf.m.planes[0].bytesused;
                             }
@@ -1958,6 +2016,7 @@ namespace librealsense
                                                                 std::min(buf.bytesused - buf_mgr.metadata_size(), buffer->get_length_frame_only());
                                             frame_object fo{ frame_sz, buf_mgr.metadata_size(),
                                                              buffer->get_frame_start(), buf_mgr.metadata_start(), timestamp };
+                                            fo.dmabuf_fd = buffer->get_dmabuf_fd();
 
                                             buffer->attach_buffer(buf);
                                             buf_mgr.handle_buffer(e_video_buf,-1); // transfer new buffer request to the frame callback
@@ -1965,8 +2024,8 @@ namespace librealsense
                                             if (buf_mgr.verify_vd_md_sync())
                                             {
                                                 //Invoke user callback and enqueue next frame
-                                                _callback(_profile, fo, [buf_mgr]() mutable {
-                                                    buf_mgr.request_next_frame();
+                                                _callback(_profile, fo, [buf_mgr, generation = _generation]() mutable {
+                                                    generation->if_current([&] { buf_mgr.request_next_frame(); });
                                                 });
                                             }
                                             else
@@ -2003,10 +2062,11 @@ namespace librealsense
 
                                                 frame_object fo{ frame_sz, md_size,
                                                             buffer->get_frame_start(), md_start, timestamp };
+                                                fo.dmabuf_fd = buffer->get_dmabuf_fd();
 
                                                 //Invoke user callback and enqueue next frame
-                                                _callback(_profile, fo, [buf_mgr]() mutable {
-                                                    buf_mgr.request_next_frame();
+                                                _callback(_profile, fo, [buf_mgr, generation = _generation]() mutable {
+                                                    generation->if_current([&] { buf_mgr.request_next_frame(); });
                                                 });
                                             }
                                             else
@@ -2108,10 +2168,11 @@ namespace librealsense
                     //frame_object fo{ buf.bytesused - MAX_META_DATA_SIZE, buf_mgr.metadata_size(),
                     frame_object fo{ frame_sz, buf_mgr.metadata_size(),
                                      video_buffer->get_frame_start(), buf_mgr.metadata_start(), timestamp };
+                    fo.dmabuf_fd = video_buffer->get_dmabuf_fd();
 
                     //Invoke user callback and enqueue next frame
-                    _callback(_profile, fo, [buf_mgr]() mutable {
-                        buf_mgr.request_next_frame();
+                    _callback(_profile, fo, [buf_mgr, generation = _generation]() mutable {
+                        generation->if_current([&] { buf_mgr.request_next_frame(); });
                     });
                 }
                 else
@@ -2509,7 +2570,20 @@ namespace librealsense
 
         bool v4l_uvc_device::has_metadata() const
         {
-            return !_use_memory_map;
+            // Appended to the frame, in the extra room only our own buffers have
+            return get_video_memory_type() == V4L2_MEMORY_USERPTR;
+        }
+
+        void v4l_uvc_device::set_capture_memory(const capture_memory& memory)
+        {
+            _capture_memory = memory;
+            if (memory.export_dmabuf && !memory.allocate && !_use_memory_map)
+            {
+                LOG_DEBUG(_name << ": memory-mapped capture buffers, for DMABUF export");
+                if (!_info.has_metadata_node)
+                    LOG_WARNING(_name << ": no metadata with exported (memory-mapped) capture buffers; this kernel"
+                                         " appends it to the frame, which only fits in user-pointer buffers");
+            }
         }
 
         void v4l_uvc_device::streamon() const
@@ -2525,7 +2599,7 @@ namespace librealsense
         void v4l_uvc_device::negotiate_kernel_buffers(size_t num) const
         {
             req_io_buff(_fd, num, _name,
-                        _use_memory_map ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR,
+                        get_video_memory_type(),
                         _dev.buf_type);
         }
 
@@ -2535,7 +2609,9 @@ namespace librealsense
             {
                 for(size_t i = 0; i < buffers; ++i)
                 {
-                    _buffers.push_back(std::make_shared<buffer>(_fd, _dev.buf_type, _use_memory_map, i));
+                    _buffers.push_back(std::make_shared<buffer>(_fd, _dev.buf_type,
+                                                                get_video_memory_type() == V4L2_MEMORY_MMAP, i,
+                                                                _capture_memory));
                 }
             }
             else
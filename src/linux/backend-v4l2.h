@@ -118,7 +118,8 @@ namespace librealsense
         class buffer
         {
         public:
-            buffer(int fd, v4l2_buf_type type, bool use_memory_map, uint32_t index);
+            buffer(int fd, v4l2_buf_type type, bool use_memory_map, uint32_t index,
+                   const capture_memory& memory = capture_memory());
 
             void prepare_for_streaming(int fd);
 
@@ -137,9 +138,16 @@ namespace librealsense
 
             bool use_memory_map() const { return _use_memory_map; }
 
+            // The buffer exported as a DMABUF, or -1 if not exported
+            int get_dmabuf_fd() const { return _dmabuf_fd; }
+
         private:
+            void export_dmabuf(int fd);
+
             v4l2_buf_type _type;
             uint8_t* _start;
+            std::shared_ptr<uint8_t> _user_memory;  // when supplied through capture_memory::allocate
+            int _dmabuf_fd = -1;
             uint32_t _length;
             uint32_t _original_length;
             uint32_t _offset;
@@ -231,6 +239,32 @@ namespace librealsense
             std::array<kernel_buf_guard, e_max_kernel_buf_type> buffers;
         };
 
+        // One stream run, from stream_on() until the capture stops: frames handed out during a run re-queue their
+        // buffers only while it lasts, so frames released late (zero-copy ones can be held for any time) never touch
+        // a stopped stream, or a descriptor that was closed since
+        class stream_generation
+        {
+        public:
+            template< class T >
+            void if_current(T && requeue)
+            {
+                // Held throughout, so the run can't end in the middle of a re-queue
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_ended)
+                    requeue();
+            }
+
+            void end()
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _ended = true;
+            }
+
+        private:
+            std::mutex _mutex;
+            bool _ended = false;
+        };
+
         class v4l_uvc_interface
         {
             virtual void capture_loop() = 0;
@@ -376,6 +410,12 @@ namespace librealsense
 
             bool is_platform_jetson() const override {return false;}
 
+            // A buffer is re-queued only through the frame continuation, and stays mapped for as long as the
+            // continuation holds on to it; when the stream is closed first, the frame keeps a copy in its place
+            bool supports_zero_copy() const override { return true; }
+
+            void set_capture_memory(const capture_memory& memory) override;
+
         protected:
             virtual uint32_t get_cid(rs2_option option) const;
 
@@ -405,6 +445,13 @@ namespace librealsense
             virtual inline bool is_metadata_streamed() const { return false;}
             virtual inline std::shared_ptr<buffer> get_video_buffer(__u32 index) const {return _buffers[index];}
             virtual inline std::shared_ptr<buffer> get_md_buffer(__u32 index) const {return nullptr;}
+            // Memory type of the video buffers: capturing into user memory requires USERPTR, and only the kernel's
+            // own (memory-mapped) buffers can be exported as DMABUFs
+            v4l2_memory get_video_memory_type() const
+            {
+                return ((_use_memory_map || _capture_memory.export_dmabuf) && !_capture_memory.allocate)
+                         ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
+            }
 
             struct identifier
             {
@@ -445,6 +492,7 @@ namespace librealsense
             std::vector<std::shared_ptr<buffer>> _buffers;
             stream_profile _profile;
             frame_callback _callback;
+            std::shared_ptr<stream_generation> _generation;  // the current run, shared with the frames' continuations
             std::atomic<bool> _is_capturing;
             std::atomic<bool> _is_alive;
             std::atomic<bool> _is_started;
@@ -457,6 +505,7 @@ namespace librealsense
                 struct v4l2_cropcap cropcap;
             } _dev;
             bool _use_memory_map;
+            capture_memory _capture_memory;     // applies to the video buffers only
             int _max_fd = 0;                    // specifies the maximal pipe number the polling process will monitor
             std::vector<int>  _fds;             // list the file descriptors to be monitored during frames polling
             buffers_mgr     _buf_dispatch;      // Holder for partial (MD only) frames that shall be preserved between 'select' calls when polling v4l buffers
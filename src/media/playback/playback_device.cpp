@@ -337,6 +337,11 @@ uint64_t playback_device::get_duration() const
     return m_reader->query_duration().count();
 }
 
+bool playback_device::get_stream_range(rs2_stream type, int index, device_serializer::stream_range& range) const
+{
+    return m_reader->query_stream_range(get_device_index(), type, static_cast<uint32_t>(index), range);
+}
+
 void playback_device::pause()
 {
     LOG_DEBUG("Playback Pause called");
@@ -46,6 +46,7 @@ namespace librealsense
         bool is_real_time() const;
         const std::string& get_file_name() const;
         uint64_t get_position() const;
+        bool get_stream_range(rs2_stream type, int index, device_serializer::stream_range& range) const;
         rsutils::public_signal< playback_device, rs2_playback_status > playback_status_changed;
         std::shared_ptr< const device_info > get_device_info() const override;
         std::pair<uint32_t, rs2_extrinsics> get_extrinsics(const stream_interface& stream) const override;
@@ -307,6 +307,16 @@ void playback_sensor::set_frames_callback( rs2_frame_callback_sptr callback )
 {
     m_user_callback = callback;
 }
+void playback_sensor::set_frame_allocator( std::shared_ptr< frame_allocator > const & )
+{
+    // Played-back frames take over the buffers read from the file
+    throw not_implemented_exception( "Frame allocators are not supported by playback sensors" );
+}
+frame_buffer_pool_stats playback_sensor::get_frame_buffer_pool_stats() const
+{
+    // Nothing to recycle: frame data is read from the file
+    return {};
+}
 stream_profiles playback_sensor::get_active_streams() const
 {
     std::lock_guard<std::mutex> lock(m_active_profile_mutex);
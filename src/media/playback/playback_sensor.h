@@ -56,6 +56,8 @@ namespace librealsense
         void update(const device_serializer::sensor_snapshot& sensor_snapshot);
         rs2_frame_callback_sptr get_frames_callback() const override;
         void set_frames_callback( rs2_frame_callback_sptr callback ) override;
+        void set_frame_allocator( std::shared_ptr< frame_allocator > const & allocator ) override;
+        frame_buffer_pool_stats get_frame_buffer_pool_stats() const override;
         stream_profiles get_active_streams() const override;
         stream_profiles const & get_raw_stream_profiles() const override { return m_available_profiles; }
         int register_before_streaming_changes_callback(std::function<void(bool)> callback) override;
@@ -14,6 +14,11 @@ using namespace librealsense;
 librealsense::record_device::record_device(std::shared_ptr<librealsense::device_interface> device,
                                       std::shared_ptr<librealsense::device_serializer::writer> serializer):
     m_write_thread([](){return std::make_shared<dispatcher>(std::numeric_limits<unsigned int>::max());}),
+    m_max_queued_bytes(MAX_CACHED_DATA_SIZE),
+    m_overflow_policy(RS2_RECORD_OVERFLOW_DROP_NEWEST),
+    m_statistics(),
+    m_dropping(false),
+    m_closing(false),
     m_is_recording(true),
     m_record_total_pause_duration(0)
 {
@@ -67,6 +72,12 @@ librealsense::record_device::~record_device()
     {
         s->disable_recording();
     }
+    {
+        // Don't keep sensors waiting for room (RS2_RECORD_OVERFLOW_BLOCK)
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_closing = true;
+    }
+    m_queue_space.notify_all();
     if ((*m_write_thread)->flush() == false)
     {
         LOG_ERROR("Error - timeout waiting for flush, possible deadlock detected");
@@ -140,23 +151,39 @@ void librealsense::record_device::write_data(size_t sensor_index, librealsense::
         initialize_recording();
     });
 
-    //TODO: restore: uint64_t data_size = frame.frame->get_frame_data_size();
-    uint64_t cached_data_size = m_cached_data_size; //TODO: restore: (+ data_size)
-    if (cached_data_size > MAX_CACHED_DATA_SIZE)
+    //TODO: remove usage of shared pointer when frame_holder is copyable
+    auto queued = std::make_shared<queued_frame>();
+    queued->size = frame ? frame.frame->get_frame_data_size() : 0;
     {
-        LOG_WARNING("Recorder reached maximum cache size, frame dropped");
-        on_error("Recorder reached maximum cache size, frame dropped");
-        return;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        ++m_statistics.frames_received;
+        if (!make_room(lock, queued->size))
+        {
+            ++m_statistics.frames_dropped;
+            if (!m_dropping)
+                LOG_WARNING("Recorder reached its queue limit of " << m_max_queued_bytes << " bytes; dropping frames");
+            m_dropping = true;
+            return;
+        }
+        m_dropping = false;
+        queued->frame = std::move(frame);
+        m_queued_frames.push_back(queued);
+        m_statistics.queued_bytes += queued->size;
+        m_statistics.max_queued_bytes = std::max(m_statistics.max_queued_bytes, m_statistics.queued_bytes);
     }
 
-    m_cached_data_size = cached_data_size;
     auto capture_time = get_capture_time();
-    //TODO: remove usage of shared pointer when frame_holder is copyable
-    auto frame_holder_ptr = std::make_shared<frame_holder>();
-    *frame_holder_ptr = std::move(frame);
-    (*m_write_thread)->invoke([this, frame_holder_ptr, sensor_index, capture_time/*, data_size*/, on_error](dispatcher::cancellable_timer t) {
+    (*m_write_thread)->invoke([this, queued, sensor_index, capture_time, on_error](dispatcher::cancellable_timer t) {
+        frame_holder frame;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!queued->frame)
+                return; //Dropped to make room for newer frames
+            frame = std::move(queued->frame);
+        }
         if (m_is_recording == false)
         {
+            release(queued, false);
             return; //Recording is paused
         }
         std::call_once(m_first_frame_flag, [&]()
@@ -175,18 +202,130 @@ void librealsense::record_device::write_data(size_t sensor_index, librealsense::
         try
         {
             const uint32_t device_index = 0;
-            auto stream_type = frame_holder_ptr->frame->get_stream()->get_stream_type();
-            auto stream_index = static_cast<uint32_t>(frame_holder_ptr->frame->get_stream()->get_stream_index());
-            m_ros_writer->write_frame({ device_index, static_cast<uint32_t>(sensor_index), stream_type, stream_index }, capture_time, std::move(*frame_holder_ptr));
-            //TODO: restore: std::lock_guard<std::mutex> locker(m_mutex);  m_cached_data_size -= data_size;
+            auto stream_type = frame.frame->get_stream()->get_stream_type();
+            auto stream_index = static_cast<uint32_t>(frame.frame->get_stream()->get_stream_index());
+            device_serializer::stream_identifier stream_id{ device_index, static_cast<uint32_t>(sensor_index), stream_type, stream_index };
+            auto batch = As<motion_frame>(frame.frame);
+            if (batch && batch->get_sample_count())
+                write_motion_samples(stream_id, capture_time, *batch);
+            else
+                m_ros_writer->write_frame(stream_id, capture_time, std::move(frame));
+            release(queued, true);
         }
         catch(std::exception& e)
         {
+            release(queued, false);
             on_error( std::string( "Failed to write frame. " ) + e.what() );
         }
     });
 }
 
+// Batched motion frames (see RS2_OPTION_MOTION_BATCH_WINDOW) are written a sample at a time, each with its own
+// timestamp and frame number, so they play back as the single-sample frames a file holds
+void librealsense::record_device::write_motion_samples(const device_serializer::stream_identifier& stream_id,
+                                                        std::chrono::nanoseconds capture_time,
+                                                        const motion_frame& batch)
+{
+    auto samples = batch.get_samples();
+    for (uint32_t i = 0; i < batch.get_sample_count(); ++i)
+    {
+        // Not from any archive: nothing to return it to when it's released
+        motion_frame sample;
+        sample.additional_data = batch.additional_data;
+        sample.additional_data.timestamp = samples[i].timestamp;
+        sample.additional_data.frame_number = samples[i].frame_number;
+        sample.additional_data.motion_samples = 0;
+        auto xyz = reinterpret_cast<const uint8_t*>(&samples[i].data);
+        sample.data.assign(xyz, xyz + sizeof(samples[i].data));
+        sample.set_stream(batch.get_stream());
+        sample.set_sensor(batch.get_sensor());
+
+        // Later samples are written later, so the file keeps their spacing
+        std::chrono::duration<double, std::milli> offset(std::max(0., samples[i].timestamp - samples[0].timestamp));
+        m_ros_writer->write_frame(stream_id,
+                                  capture_time + std::chrono::duration_cast<std::chrono::nanoseconds>(offset),
+                                  frame_holder::acquire(&sample));
+    }
+}
+
+// Called with m_mutex held, before queueing a frame of the given size: returns false if the frame should be dropped
+bool librealsense::record_device::make_room(std::unique_lock<std::mutex>& lock, uint64_t size)
+{
+    // A frame larger than the whole budget still gets through on its own, rather than never
+    auto fits = [&]() {
+        return m_queued_frames.empty() || m_statistics.queued_bytes + size <= m_max_queued_bytes;
+    };
+    if (m_closing)
+        return false;
+    if (fits())
+        return true;
+
+    switch (m_overflow_policy)
+    {
+    case RS2_RECORD_OVERFLOW_BLOCK:
+    {
+        auto start = std::chrono::steady_clock::now();
+        m_queue_space.wait(lock, [&]() { return m_closing || fits(); });
+        m_statistics.blocked_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        return !m_closing;
+    }
+    case RS2_RECORD_OVERFLOW_DROP_OLDEST:
+        // Frames already taken by the write thread are empty, and stay until written
+        for (auto it = m_queued_frames.begin(); it != m_queued_frames.end() && !fits();)
+        {
+            auto& queued = *it;
+            if (!queued->frame)
+            {
+                ++it;
+                continue;
+            }
+            queued->frame = frame_holder();
+            m_statistics.queued_bytes -= queued->size;
+            ++m_statistics.frames_dropped;
+            it = m_queued_frames.erase(it);
+        }
+        return fits();
+    default:
+        return false;
+    }
+}
+
+// Called on the write thread once it's done with a frame it took from the queue
+void librealsense::record_device::release(const std::shared_ptr<queued_frame>& queued, bool written)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = std::find(m_queued_frames.begin(), m_queued_frames.end(), queued);
+        if (it != m_queued_frames.end())
+            m_queued_frames.erase(it);
+        m_statistics.queued_bytes -= queued->size;
+        if (written)
+            ++m_statistics.frames_written;
+    }
+    m_queue_space.notify_all();
+}
+
+void librealsense::record_device::set_queue_limit(uint64_t max_bytes, rs2_record_overflow_policy policy)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_max_queued_bytes = max_bytes;
+        m_overflow_policy = policy;
+    }
+    m_queue_space.notify_all();  // waiters may fit now
+}
+
+rs2_record_statistics librealsense::record_device::get_statistics() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_statistics;
+}
+
+void librealsense::record_device::set_stream_codec(rs2_stream stream, int index, rs2_record_stream_codec codec)
+{
+    m_ros_writer->set_stream_codec(stream, index, codec);
+}
+
 const std::string& librealsense::record_device::get_info(rs2_camera_info info) const
 {
     return m_device->get_info(info);
@@ -451,7 +590,6 @@ void record_device::initialize_recording()
 {
     //Expected to be called once when recording to file actually starts
     m_capture_time_base = std::chrono::high_resolution_clock::now();
-    m_cached_data_size = 0;
     LOG_DEBUG( "Recording capture time base set to: " << m_capture_time_base.time_since_epoch().count() );
 
 }
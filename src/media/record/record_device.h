@@ -6,11 +6,14 @@
 #include <core/extension.h>
 #include <core/serialization.h>
 #include <src/core/device-interface.h>
+#include <src/core/motion-frame.h>
 #include "archive.h"
 #include "sensor.h"
 #include "record_sensor.h"
 #include <rsutils/concurrency/concurrency.h>
 #include <rsutils/lazy.h>
+#include <condition_variable>
+#include <deque>
 
 
 namespace librealsense
@@ -20,7 +23,7 @@ namespace librealsense
                           public info_container
     {
     public:
-        static const uint64_t MAX_CACHED_DATA_SIZE = 1920 * 1080 * 4 * 30; // ~1 sec of HD video @ 30 FPS
+        static const uint64_t MAX_CACHED_DATA_SIZE = 1920 * 1080 * 4 * 30; // Default queue limit: ~1 sec of HD video @ 30 FPS
 
         record_device(std::shared_ptr<device_interface> device, std::shared_ptr<device_serializer::writer> serializer);
         virtual ~record_device();
@@ -41,6 +44,9 @@ namespace librealsense
         void pause_recording();
         void resume_recording();
         const std::string& get_filename() const;
+        void set_queue_limit(uint64_t max_bytes, rs2_record_overflow_policy policy);
+        rs2_record_statistics get_statistics() const;
+        void set_stream_codec(rs2_stream stream, int index, rs2_record_stream_codec codec);
         std::shared_ptr< const device_info > get_device_info() const override;
         std::pair<uint32_t, rs2_extrinsics> get_extrinsics(const stream_interface& stream) const override;
         bool is_valid() const override;
@@ -58,6 +64,17 @@ namespace librealsense
         void write_header();
         std::chrono::nanoseconds get_capture_time() const;
         void write_data(size_t sensor_index, frame_holder f, std::function<void(std::string const&)> on_error);
+        void write_motion_samples(const device_serializer::stream_identifier& stream_id, std::chrono::nanoseconds capture_time, const motion_frame& batch);
+
+        // A frame waiting for the write thread. Dropping it (see make_room) releases the frame right away; the write
+        // thread then finds it empty and skips it.
+        struct queued_frame
+        {
+            frame_holder frame;
+            uint64_t size = 0;
+        };
+        bool make_room(std::unique_lock<std::mutex>& lock, uint64_t size);
+        void release(const std::shared_ptr<queued_frame>& queued, bool written);
         void write_sensor_extension_snapshot(size_t sensor_index, rs2_extension ext, std::shared_ptr<extension_snapshot> snapshot, std::function<void(std::string const&)> on_error);
         void write_notification(size_t sensor_index, const notification& n);
         std::vector<std::shared_ptr<record_sensor>> create_record_sensors(std::shared_ptr<device_interface> m_device);
@@ -73,10 +90,17 @@ namespace librealsense
         std::chrono::high_resolution_clock::duration m_record_total_pause_duration;
         std::chrono::high_resolution_clock::time_point m_time_of_pause;
 
-        std::mutex m_mutex;
+        mutable std::mutex m_mutex;  // guards the frame queue and statistics
+        std::condition_variable m_queue_space;
+        std::deque<std::shared_ptr<queued_frame>> m_queued_frames;  // in write order; the front one may be getting written
+        uint64_t m_max_queued_bytes;
+        rs2_record_overflow_policy m_overflow_policy;
+        rs2_record_statistics m_statistics;
+        bool m_dropping;  // so we only warn when frames start getting dropped
+        bool m_closing;
+
         bool m_is_recording;
         std::once_flag m_first_frame_flag;
-        uint64_t m_cached_data_size;
         std::once_flag m_first_call_flag;
         void initialize_recording();
     };
@@ -236,6 +236,16 @@ void record_sensor::set_frames_callback( rs2_frame_callback_sptr callback )
     m_frame_callback = callback;
 }
 
+void record_sensor::set_frame_allocator( std::shared_ptr< frame_allocator > const & allocator )
+{
+    m_sensor.set_frame_allocator( allocator );
+}
+
+frame_buffer_pool_stats record_sensor::get_frame_buffer_pool_stats() const
+{
+    return m_sensor.get_frame_buffer_pool_stats();
+}
+
 stream_profiles record_sensor::get_active_streams() const
 {
     return m_sensor.get_active_streams();
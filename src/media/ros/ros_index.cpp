@@ -0,0 +1,414 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "ros_index.h"
+#include "ros_file_format.h"
+#include "rosbag/view.h"
+
+#include <rsutils/os/atomic-write-file.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <set>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+
+namespace librealsense
+{
+    namespace
+    {
+        const char INDEX_MAGIC[8] = { 'R', 'S', 'B', 'A', 'G', 'I', 'D', 'X' };
+        const uint32_t INDEX_VERSION = 2;  // 2: modification time in nanoseconds
+
+        enum : uint32_t
+        {
+            FRAME_TOPIC = 1,
+            OPTION_TOPIC = 2,
+        };
+
+        size_t align8( size_t n ) { return ( n + 7 ) & ~size_t( 7 ); }
+
+        // The size and last-write time of a file, the time in nanoseconds: a file rewritten within the same second
+        // must not pass for the one that was indexed
+        bool get_file_stamp( const std::string & path, uint64_t & size, int64_t & mtime )
+        {
+#ifdef _WIN32
+            WIN32_FILE_ATTRIBUTE_DATA attributes;
+            if( ! GetFileAttributesExA( path.c_str(), GetFileExInfoStandard, &attributes ) )
+                return false;
+            size = ( uint64_t( attributes.nFileSizeHigh ) << 32 ) | attributes.nFileSizeLow;
+            auto const ticks = ( uint64_t( attributes.ftLastWriteTime.dwHighDateTime ) << 32 )
+                             | attributes.ftLastWriteTime.dwLowDateTime;
+            mtime = static_cast< int64_t >( ticks ) * 100;  // 100ns units
+#else
+            struct stat st;
+            if( ::stat( path.c_str(), &st ) != 0 )
+                return false;
+            size = static_cast< uint64_t >( st.st_size );
+#ifdef __APPLE__
+            auto const & ts = st.st_mtimespec;
+#else
+            auto const & ts = st.st_mtim;
+#endif
+            mtime = static_cast< int64_t >( ts.tv_sec ) * 1000000000 + ts.tv_nsec;
+#endif
+            return true;
+        }
+
+        // Where the index of 'path' is kept in 'cache_dir': named after the full path of the bag, so bags of the
+        // same name in different directories don't share it
+        std::string get_sidecar_path( const std::string & path, std::string cache_dir )
+        {
+#ifdef _WIN32
+            char full[MAX_PATH];
+            auto const n = GetFullPathNameA( path.c_str(), MAX_PATH, full, nullptr );
+            std::string const full_path = n && n < MAX_PATH ? std::string( full, n ) : path;
+            char const separator = '\\';
+#else
+            char * full = realpath( path.c_str(), nullptr );
+            std::string const full_path = full ? full : path;
+            free( full );
+            char const separator = '/';
+#endif
+            if( cache_dir.back() != '/' && cache_dir.back() != separator )
+                cache_dir += separator;
+
+            // FNV-1a
+            uint64_t hash = 14695981039346656037ULL;
+            for( unsigned char c : full_path )
+                hash = ( hash ^ c ) * 1099511628211ULL;
+            char name[32];
+            snprintf( name, sizeof( name ), "%016llx.rsidx", static_cast< unsigned long long >( hash ) );
+
+            auto slash = full_path.find_last_of( "/\\" );
+            return cache_dir + full_path.substr( slash == std::string::npos ? 0 : slash + 1 ) + "." + name;
+        }
+    }
+
+    // The sidecar layout: a header, a record per topic, the topic names, then the times of each topic. Everything
+    // is 8-byte aligned, so it can be used straight from the mapped file.
+    struct ros_index::header
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t topic_count;
+        uint64_t bag_size;
+        int64_t bag_mtime;  // nanoseconds
+    };
+
+    struct ros_index::topic_record
+    {
+        uint32_t kind;
+        uint32_t device_index;
+        uint32_t sensor_index;
+        uint32_t stream_type;   // frame topics only
+        uint32_t stream_index;  // frame topics only
+        uint32_t name_size;
+        uint64_t name_offset;
+        uint64_t times_offset;  // of 'count' sorted uint64_t ros times, in nanoseconds
+        uint64_t count;
+    };
+
+    // A read-only mapping of a whole file
+    class ros_index::mapping
+    {
+    public:
+        static std::unique_ptr< mapping > map( const std::string & path )
+        {
+            std::unique_ptr< mapping > m( new mapping() );
+#ifdef _WIN32
+            m->_file = CreateFileA( path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+            if( m->_file == INVALID_HANDLE_VALUE )
+                return nullptr;
+            LARGE_INTEGER size;
+            if( ! GetFileSizeEx( m->_file, &size ) || ! size.QuadPart )
+                return nullptr;
+            m->_map = CreateFileMappingA( m->_file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+            if( ! m->_map )
+                return nullptr;
+            m->_data = static_cast< const char * >( MapViewOfFile( m->_map, FILE_MAP_READ, 0, 0, 0 ) );
+            if( ! m->_data )
+                return nullptr;
+            m->_size = static_cast< size_t >( size.QuadPart );
+#else
+            m->_fd = ::open( path.c_str(), O_RDONLY );
+            if( m->_fd < 0 )
+                return nullptr;
+            struct stat st;
+            if( fstat( m->_fd, &st ) != 0 || st.st_size <= 0 )
+                return nullptr;
+            void * data = mmap( nullptr, static_cast< size_t >( st.st_size ), PROT_READ, MAP_PRIVATE, m->_fd, 0 );
+            if( data == MAP_FAILED )
+                return nullptr;
+            m->_data = static_cast< const char * >( data );
+            m->_size = static_cast< size_t >( st.st_size );
+#endif
+            return m;
+        }
+
+        ~mapping()
+        {
+#ifdef _WIN32
+            if( _data )
+                UnmapViewOfFile( _data );
+            if( _map )
+                CloseHandle( _map );
+            if( _file != INVALID_HANDLE_VALUE )
+                CloseHandle( _file );
+#else
+            if( _data )
+                munmap( const_cast< char * >( _data ), _size );
+            if( _fd >= 0 )
+                close( _fd );
+#endif
+        }
+
+        const char * data() const { return _data; }
+        size_t size() const { return _size; }
+
+    private:
+        mapping() = default;
+
+#ifdef _WIN32
+        HANDLE _file = INVALID_HANDLE_VALUE;
+        HANDLE _map = nullptr;
+#else
+        int _fd = -1;
+#endif
+        const char * _data = nullptr;
+        size_t _size = 0;
+    };
+
+
+    ros_index::~ros_index() = default;
+
+
+    std::shared_ptr< ros_index > ros_index::open( const std::string & path,
+                                                  const rosbag::Bag & bag,
+                                                  const std::string & cache_dir )
+    {
+        std::shared_ptr< ros_index > index( new ros_index() );
+
+        uint64_t bag_size = 0;
+        int64_t bag_mtime = 0;
+        std::string sidecar;
+        if( ! cache_dir.empty() && get_file_stamp( path, bag_size, bag_mtime ) )
+        {
+            sidecar = get_sidecar_path( path, cache_dir );
+            auto m = mapping::map( sidecar );
+            if( m && index->load( m->data(), m->size(), bag_size, bag_mtime ) )
+            {
+                LOG_DEBUG( "Loaded playback index " << sidecar );
+                index->_mapping = std::move( m );
+                return index;
+            }
+        }
+
+        index->_built = build( bag, bag_size, bag_mtime );
+        if( ! index->load( index->_built.data(), index->_built.size(), bag_size, bag_mtime ) )
+            return nullptr;
+
+        // Best effort: the directory may not exist, or not be writable
+        if( ! sidecar.empty() )
+        {
+            if( rsutils::os::atomic_write_file( sidecar, std::string( index->_built.data(), index->_built.size() ) ) )
+                LOG_DEBUG( "Saved playback index " << sidecar );
+            else
+                LOG_DEBUG( "Could not save playback index " << sidecar );
+        }
+        return index;
+    }
+
+
+    std::vector< char > ros_index::build( const rosbag::Bag & bag, uint64_t bag_size, int64_t bag_mtime )
+    {
+        struct topic
+        {
+            topic_record record;
+            std::string name;
+            std::vector< uint64_t > times;
+        };
+        std::vector< topic > topics;
+
+        // Only the bag's own index is used, so no chunk needs to be decompressed
+        auto add_topics = [&]( std::function< bool( rosbag::ConnectionInfo const * ) > query, uint32_t kind )
+        {
+            std::set< std::string > names;
+            rosbag::View all( bag, query );
+            for( auto connection : all.getConnections() )
+                names.insert( connection->topic );
+
+            for( auto & name : names )
+            {
+                topic t;
+                std::memset( &t.record, 0, sizeof( t.record ) );
+                t.record.kind = kind;
+                try
+                {
+                    if( kind == FRAME_TOPIC )
+                    {
+                        auto id = ros_topic::get_stream_identifier( name );
+                        t.record.device_index = id.device_index;
+                        t.record.sensor_index = id.sensor_index;
+                        t.record.stream_type = id.stream_type;
+                        t.record.stream_index = id.stream_index;
+                    }
+                    else
+                    {
+                        auto id = ros_topic::get_sensor_identifier( name );
+                        t.record.device_index = id.device_index;
+                        t.record.sensor_index = id.sensor_index;
+                    }
+                }
+                catch( const std::exception & e )
+                {
+                    LOG_DEBUG( "Not indexing topic " << name << ": " << e.what() );
+                    continue;
+                }
+
+                t.name = name;
+                rosbag::View view( bag, rosbag::TopicQuery( name ) );
+                for( auto it = view.begin(); it != view.end(); ++it )
+                    t.times.push_back( ( *it ).getTime().toNSec() );
+                topics.push_back( std::move( t ) );
+            }
+        };
+        add_topics( FrameQuery(), FRAME_TOPIC );
+        add_topics( OptionsQuery(), OPTION_TOPIC );
+
+        size_t offset = sizeof( header ) + topics.size() * sizeof( topic_record );
+        for( auto & t : topics )
+        {
+            t.record.name_size = static_cast< uint32_t >( t.name.size() );
+            t.record.name_offset = offset;
+            offset = align8( offset + t.name.size() );
+        }
+        for( auto & t : topics )
+        {
+            t.record.count = t.times.size();
+            t.record.times_offset = offset;
+            offset += t.times.size() * sizeof( uint64_t );
+        }
+
+        std::vector< char > data( offset, 0 );
+        header h;
+        std::memcpy( h.magic, INDEX_MAGIC, sizeof( h.magic ) );
+        h.version = INDEX_VERSION;
+        h.topic_count = static_cast< uint32_t >( topics.size() );
+        h.bag_size = bag_size;
+        h.bag_mtime = bag_mtime;
+        std::memcpy( data.data(), &h, sizeof( h ) );
+        for( size_t i = 0; i < topics.size(); ++i )
+        {
+            auto & t = topics[i];
+            std::memcpy( data.data() + sizeof( header ) + i * sizeof( topic_record ), &t.record, sizeof( topic_record ) );
+            std::memcpy( data.data() + t.record.name_offset, t.name.data(), t.name.size() );
+            if( ! t.times.empty() )
+                std::memcpy( data.data() + t.record.times_offset, t.times.data(), t.times.size() * sizeof( uint64_t ) );
+        }
+        return data;
+    }
+
+
+    bool ros_index::load( const char * data, size_t size, uint64_t bag_size, int64_t bag_mtime )
+    {
+        _topics.clear();
+        if( size < sizeof( header ) )
+            return false;
+        auto h = reinterpret_cast< const header * >( data );
+        if( std::memcmp( h->magic, INDEX_MAGIC, sizeof( h->magic ) ) || h->version != INDEX_VERSION )
+            return false;
+        if( h->bag_size != bag_size || h->bag_mtime != bag_mtime )
+            return false;  // stale
+        if( ( size - sizeof( header ) ) / sizeof( topic_record ) < h->topic_count )
+            return false;
+
+        auto records = reinterpret_cast< const topic_record * >( data + sizeof( header ) );
+        for( uint32_t i = 0; i < h->topic_count; ++i )
+        {
+            auto & r = records[i];
+            if( r.name_offset > size || r.name_size > size - r.name_offset )
+                return false;
+            if( r.times_offset % sizeof( uint64_t ) || r.times_offset > size
+                || r.count > ( size - r.times_offset ) / sizeof( uint64_t ) )
+                return false;
+            _topics[std::string( data + r.name_offset, r.name_size )] = &r;
+        }
+        _data = data;
+        return true;
+    }
+
+
+    bool ros_index::find_last( const std::string & topic,
+                               uint32_t kind,
+                               rs2rosinternal::Time from,
+                               rs2rosinternal::Time to,
+                               rs2rosinternal::Time & time ) const
+    {
+        auto it = _topics.find( topic );
+        if( it == _topics.end() || it->second->kind != kind )
+            return false;
+
+        auto & r = *it->second;
+        auto times = reinterpret_cast< const uint64_t * >( _data + r.times_offset );
+        auto end = std::upper_bound( times, times + r.count, to.toNSec() );
+        if( end == times || end[-1] < from.toNSec() )
+            return false;
+        time.fromNSec( end[-1] );
+        return true;
+    }
+
+
+    bool ros_index::find_last_frame( const std::string & topic,
+                                     rs2rosinternal::Time from,
+                                     rs2rosinternal::Time to,
+                                     rs2rosinternal::Time & time ) const
+    {
+        return find_last( topic, FRAME_TOPIC, from, to, time );
+    }
+
+
+    bool ros_index::find_last_option( const std::string & topic,
+                                      rs2rosinternal::Time from,
+                                      rs2rosinternal::Time to,
+                                      rs2rosinternal::Time & time ) const
+    {
+        return find_last( topic, OPTION_TOPIC, from, to, time );
+    }
+
+
+    bool ros_index::query_stream_range( uint32_t device_index,
+                                        rs2_stream type,
+                                        uint32_t index,
+                                        device_serializer::stream_range & range ) const
+    {
+        for( auto & kvp : _topics )
+        {
+            auto & r = *kvp.second;
+            if( r.kind != FRAME_TOPIC || r.device_index != device_index || r.stream_type != uint32_t( type )
+                || r.stream_index != index || ! r.count )
+                continue;
+
+            auto times = reinterpret_cast< const uint64_t * >( _data + r.times_offset );
+            range.frame_count = r.count;
+            range.first_frame = device_serializer::nanoseconds( times[0] );
+            range.last_frame = device_serializer::nanoseconds( times[r.count - 1] );
+            return true;
+        }
+        return false;
+    }
+}
@@ -0,0 +1,60 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <core/serialization.h>
+#include "rosbag/bag.h"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace librealsense
+{
+    // An index of a .bag file: the time of every frame of every stream, and of every option value, as flat sorted
+    // arrays per topic.
+    //
+    // Playback needs what was current at some point in time (the last frame of each stream, the value of each
+    // option) whenever it seeks. The bag can only give that by going over everything recorded up to that point;
+    // with the index it's a binary search per topic, after which a single message is read from the bag.
+    //
+    // The index is built in memory when a file is opened. If a cache directory is given (the "playback-index-dir"
+    // context setting), it's also saved there, to be mapped into memory as-is the next time the same file is
+    // played; it's rebuilt whenever the file's size or modification time no longer match.
+    class ros_index
+    {
+    public:
+        // Loads the index of the bag at 'path' from 'cache_dir', or builds it from 'bag' (already open for reading) and
+        // saves it there; nothing is saved if 'cache_dir' is empty
+        static std::shared_ptr<ros_index> open(const std::string& path, const rosbag::Bag& bag, const std::string& cache_dir);
+
+        ~ros_index();
+
+        // The time of the last frame recorded to a frame topic in [from, to]; false if there is none
+        bool find_last_frame(const std::string& topic, rs2rosinternal::Time from, rs2rosinternal::Time to, rs2rosinternal::Time& time) const;
+
+        // The time of the last value recorded to an option value topic in [from, to]; false if there is none
+        bool find_last_option(const std::string& topic, rs2rosinternal::Time from, rs2rosinternal::Time to, rs2rosinternal::Time& time) const;
+
+        // Frame count and time range of a stream (of any sensor of the device); false if it's not in the file
+        bool query_stream_range(uint32_t device_index, rs2_stream type, uint32_t index, device_serializer::stream_range& range) const;
+
+    private:
+        struct header;
+        struct topic_record;
+        class mapping;
+
+        ros_index() = default;
+        static std::vector<char> build(const rosbag::Bag& bag, uint64_t bag_size, int64_t bag_mtime);
+        bool load(const char* data, size_t size, uint64_t bag_size, int64_t bag_mtime);
+        bool find_last(const std::string& topic, uint32_t kind, rs2rosinternal::Time from, rs2rosinternal::Time to, rs2rosinternal::Time& time) const;
+
+        std::unique_ptr<mapping> _mapping;  // the sidecar, when loaded from disk
+        std::vector<char> _built;           // the same layout, when built in memory
+        const char* _data = nullptr;
+        std::unordered_map<std::string, const topic_record*> _topics;
+    };
+}
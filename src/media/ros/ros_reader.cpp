@@ -43,6 +43,21 @@ namespace librealsense
             //Rethrowing with better clearer message
             throw io_exception( rsutils::string::from() << "Failed to create ros reader: " << e.what() );
         }
+
+        if (m_version != legacy_file_format::file_version())
+        {
+            try
+            {
+                std::string cache_dir;
+                if (m_context)
+                    cache_dir = m_context->get_settings().nested("playback-index-dir", &rsutils::json::is_string).default_value<std::string>("");
+                m_index = ros_index::open(m_file_path, m_file, cache_dir);
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("Failed to index " << m_file_path << ", seeking will be slower: " << e.what());
+            }
+        }
     }
 
     device_snapshot ros_reader::query_device_description(const nanoseconds& time)
@@ -123,10 +138,30 @@ namespace librealsense
     std::vector<std::shared_ptr<serialized_data>> ros_reader::fetch_last_frames(const nanoseconds& seek_time)
     {
         std::vector<std::shared_ptr<serialized_data>> result;
-        rosbag::View view(m_file, FalseQuery());
         auto as_rostime = to_rostime(seek_time);
         auto start_time = to_rostime(get_static_file_info_timestamp());
 
+        if (m_index)
+        {
+            // Find the last frame of each stream in the index, and read only that
+            for (auto&& topic : m_enabled_streams_topics)
+            {
+                rs2rosinternal::Time frame_time;
+                if (!m_index->find_last_frame(topic, start_time, as_rostime, frame_time))
+                    continue;
+                // Several messages may share that time: the last of them is the one a full read would have ended with
+                rosbag::View view(m_file, rosbag::TopicQuery(topic), frame_time, frame_time);
+                auto msg = view.end();
+                for (auto it = view.begin(); it != view.end(); ++it)
+                    msg = it;
+                if (msg != view.end() && ((*msg).isType<sensor_msgs::Image>() || (*msg).isType<sensor_msgs::Imu>()))
+                    result.push_back(create_frame(*msg));
+            }
+            return result;
+        }
+
+        rosbag::View view(m_file, FalseQuery());
+
         for (auto topic : m_enabled_streams_topics)
         {
             view.addQuery(m_file, rosbag::TopicQuery(topic), start_time, as_rostime);
@@ -250,6 +285,13 @@ namespace librealsense
         return m_file_path;
     }
 
+    bool ros_reader::query_stream_range(uint32_t device_index, rs2_stream type, uint32_t index, stream_range& range) const
+    {
+        if (!m_index)
+            return reader::query_stream_range(device_index, type, index, range);
+        return m_index->query_stream_range(device_index, type, index, range);
+    }
+
     std::shared_ptr<serialized_frame> ros_reader::create_frame(const rosbag::MessageInstance& msg)
     {
         auto next_msg_topic = msg.getTopic();
@@ -882,14 +924,14 @@ namespace librealsense
 
     }  // namespace
 
-    void ros_reader::update_sensor_options(const rosbag::Bag& file, uint32_t sensor_index, const nanoseconds& time, uint32_t file_version, snapshot_collection& sensor_extensions, uint32_t version)
+    void ros_reader::update_sensor_options(const rosbag::Bag& file, const ros_index* index, uint32_t sensor_index, const nanoseconds& time, uint32_t file_version, snapshot_collection& sensor_extensions, uint32_t version)
     {
         if (version == legacy_file_format::file_version())
         {
             LOG_DEBUG("Not updating options from legacy files");
             return;
         }
-        auto sensor_options = read_sensor_options(file, { get_device_index(), sensor_index }, time, file_version);
+        auto sensor_options = read_sensor_options(file, index, { get_device_index(), sensor_index }, time, file_version);
         sensor_extensions[RS2_EXTENSION_OPTIONS] = sensor_options;
 
         if (sensor_options->supports_option(RS2_OPTION_DEPTH_UNITS))
@@ -1202,7 +1244,7 @@ namespace librealsense
                     }
                     sensor_extensions[RS2_EXTENSION_INFO] = sensor_info;
                     //Update options
-                    update_sensor_options(m_file, sensor_index, time, m_version, sensor_extensions, m_version);
+                    update_sensor_options(m_file, m_index.get(), sensor_index, time, m_version, sensor_extensions, m_version);
 
                     std::string pid = "";
                     std::string sensor_name = "";
@@ -1230,7 +1272,7 @@ namespace librealsense
             for (auto& sensor : device_snapshot.get_sensors_snapshots())
             {
                 auto& sensor_extensions = sensor.get_sensor_extensions_snapshots();
-                update_sensor_options(m_file, sensor.get_sensor_index(), time, m_version, sensor_extensions, m_version);
+                update_sensor_options(m_file, m_index.get(), sensor.get_sensor_index(), time, m_version, sensor_extensions, m_version);
             }
             return device_snapshot;
         }
@@ -1604,7 +1646,7 @@ namespace librealsense
         return n;
     }
 
-    std::shared_ptr<options_container> ros_reader::read_sensor_options(const rosbag::Bag& file, device_serializer::sensor_identifier sensor_id, const nanoseconds& timestamp, uint32_t file_version)
+    std::shared_ptr<options_container> ros_reader::read_sensor_options(const rosbag::Bag& file, const ros_index* index, device_serializer::sensor_identifier sensor_id, const nanoseconds& timestamp, uint32_t file_version)
     {
         auto options = std::make_shared<options_container>();
         if (file_version == 2)
@@ -1629,7 +1671,29 @@ namespace librealsense
                 alternate_value_topic.replace(value_topic.find(option_name), option_name.length(), rs2_option_name);
 
                 std::vector<std::string> option_topics{ value_topic, alternate_value_topic };
-                rosbag::View option_view(file, rosbag::TopicQuery(option_topics), to_rostime(get_static_file_info_timestamp()), to_rostime(timestamp));
+                auto start_time = to_rostime(get_static_file_info_timestamp());
+                auto end_time = to_rostime(timestamp);
+                if (index)
+                {
+                    // Only the last value is needed: look it up in the index and read from there
+                    bool found = false;
+                    rs2rosinternal::Time last_time;
+                    for (auto&& topic : option_topics)
+                    {
+                        rs2rosinternal::Time t;
+                        if (index->find_last_option(topic, start_time, end_time, t) && (!found || t > last_time))
+                        {
+                            last_time = t;
+                            found = true;
+                        }
+                    }
+                    if (!found)
+                    {
+                        continue;
+                    }
+                    start_time = last_time;
+                }
+                rosbag::View option_view(file, rosbag::TopicQuery(option_topics), start_time, end_time);
                 auto it = option_view.begin();
                 if (it == option_view.end())
                 {
@@ -6,6 +6,7 @@
 #include <core/serialization.h>
 #include "rosbag/view.h"
 #include "ros_file_format.h"
+#include "ros_index.h"
 
 #include <rsutils/string/from.h>
 
@@ -35,6 +36,7 @@ namespace librealsense
         virtual void enable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) override;
         virtual void disable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) override;
         const std::string& get_file_name() const override;
+        bool query_stream_range(uint32_t device_index, rs2_stream type, uint32_t index, stream_range& range) const override;
 
     private:
 
@@ -87,7 +89,7 @@ namespace librealsense
         static uint32_t read_file_version(const rosbag::Bag& file);
         bool try_read_legacy_stream_extrinsic(const stream_identifier& stream_id, uint32_t& group_id, rs2_extrinsics& extrinsic) const;
         bool try_read_stream_extrinsic(const stream_identifier& stream_id, uint32_t& group_id, rs2_extrinsics& extrinsic) const;
-        static void update_sensor_options(const rosbag::Bag& file, uint32_t sensor_index, const nanoseconds& time, uint32_t file_version, snapshot_collection& sensor_extensions, uint32_t version);
+        static void update_sensor_options(const rosbag::Bag& file, const ros_index* index, uint32_t sensor_index, const nanoseconds& time, uint32_t file_version, snapshot_collection& sensor_extensions, uint32_t version);
         void update_proccesing_blocks(const rosbag::Bag& file, uint32_t sensor_index, const nanoseconds& time, uint32_t file_version, snapshot_collection& sensor_extensions, uint32_t version, std::string pid, std::string sensor_name);
         void add_sensor_extension(snapshot_collection & sensor_extensions, std::string sensor_name);
        
@@ -126,7 +128,7 @@ namespace librealsense
                                  std::shared_ptr< options_interface > options );
 
         static notification create_notification(const rosbag::Bag& file, const rosbag::MessageInstance& message_instance);
-        static std::shared_ptr<options_container> read_sensor_options(const rosbag::Bag& file, device_serializer::sensor_identifier sensor_id, const nanoseconds& timestamp, uint32_t file_version);
+        static std::shared_ptr<options_container> read_sensor_options(const rosbag::Bag& file, const ros_index* index, device_serializer::sensor_identifier sensor_id, const nanoseconds& timestamp, uint32_t file_version);
         static std::vector<std::string> get_topics(std::unique_ptr<rosbag::View>& view);
 
         std::shared_ptr<metadata_parser_map>    m_metadata_parser_map;
@@ -135,6 +137,7 @@ namespace librealsense
         std::string                             m_file_path;
         std::shared_ptr<frame_source>           m_frame_source;
         rosbag::Bag                             m_file;
+        std::shared_ptr<ros_index>              m_index;  // null for legacy files, or if it couldn't be built
         std::unique_ptr<rosbag::View>           m_samples_view;
         rosbag::View::iterator                  m_samples_itrator;
         std::vector<std::string>                m_enabled_streams_topics;
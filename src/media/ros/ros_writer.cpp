@@ -19,6 +19,7 @@
 #include <src/labeled-points.h>
 
 #include <rsutils/string/from.h>
+#include <thread>
 
 namespace librealsense
 {
@@ -31,6 +32,12 @@ namespace librealsense
         if (compress_while_record)
         {
             m_bag.setCompression(rosbag::CompressionType::LZ4);
+
+            // Compress chunks off the writing thread, so it can keep up with the sensors. With a single core there's
+            // nothing to gain from it.
+            auto cores = std::thread::hardware_concurrency();
+            if (cores > 1)
+                m_bag.setCompressionThreads(std::min(cores / 2, 4u));
         }
         write_file_version();
     }
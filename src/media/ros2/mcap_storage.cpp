@@ -0,0 +1,997 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "mcap_storage.h"
+
+#include <src/librealsense-exception.h>
+#include <librealsense2/rs.h>
+
+#include <rsutils/easylogging/easyloggingpp.h>
+#include <rsutils/number/crc32.h>
+#include <rsutils/string/from.h>
+
+#include <zstd.h>
+#include <lz4frame.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+
+namespace librealsense
+{
+    using rosbag2_storage::storage_interfaces::IOFlag;
+
+    namespace
+    {
+        enum opcode : uint8_t
+        {
+            OP_HEADER         = 0x01,
+            OP_FOOTER         = 0x02,
+            OP_SCHEMA         = 0x03,
+            OP_CHANNEL        = 0x04,
+            OP_MESSAGE        = 0x05,
+            OP_CHUNK          = 0x06,
+            OP_MESSAGE_INDEX  = 0x07,
+            OP_CHUNK_INDEX    = 0x08,
+            OP_STATISTICS     = 0x0B,
+            OP_SUMMARY_OFFSET = 0x0E,
+            OP_DATA_END       = 0x0F,
+        };
+
+        const uint8_t MAGIC[8] = { 0x89, 'M', 'C', 'A', 'P', '0', '\r', '\n' };
+        constexpr size_t RECORD_PREFIX = 1 + 8;                    // opcode + content length
+        constexpr size_t FOOTER_SIZE = RECORD_PREFIX + 8 + 8 + 4;
+
+        // Sizes read from the file are untrusted; cap them before allocating
+        constexpr uint64_t MAX_RECORD_SIZE = 1ull << 30;
+
+        // Appends MCAP's little-endian fields to a buffer
+        class record_writer
+        {
+        public:
+            explicit record_writer(std::vector<uint8_t>& out) : _out(out) {}
+
+            template<typename T>
+            void put(T value)
+            {
+                auto at = _out.size();
+                _out.resize(at + sizeof(T));
+                std::memcpy(_out.data() + at, &value, sizeof(T));
+            }
+            void put_bytes(void const* data, size_t size)
+            {
+                auto p = static_cast<uint8_t const*>(data);
+                _out.insert(_out.end(), p, p + size);
+            }
+            void put_string(std::string const& s)
+            {
+                put(uint32_t(s.size()));
+                put_bytes(s.data(), s.size());
+            }
+
+            // Records, arrays and maps are length-prefixed: begin leaves room for the length, end fills it in
+            size_t begin_record(uint8_t op)
+            {
+                put(op);
+                put(uint64_t(0));
+                return _out.size();
+            }
+            void end_record(size_t start) { patch<uint64_t>(start); }
+            size_t begin_array()
+            {
+                put(uint32_t(0));
+                return _out.size();
+            }
+            void end_array(size_t start) { patch<uint32_t>(start); }
+
+        private:
+            template<typename T>
+            void patch(size_t start)
+            {
+                T length = T(_out.size() - start);
+                std::memcpy(_out.data() + start - sizeof(T), &length, sizeof(T));
+            }
+
+            std::vector<uint8_t>& _out;
+        };
+
+        // Reads fields back out of a record, throwing if it runs out
+        class record_reader
+        {
+        public:
+            record_reader(uint8_t const* data, size_t size) : _p(data), _end(data + size) {}
+
+            template<typename T>
+            T get()
+            {
+                T value;
+                std::memcpy(&value, take(sizeof(T)), sizeof(T));
+                return value;
+            }
+            std::string get_string()
+            {
+                auto size = get<uint32_t>();
+                return std::string(reinterpret_cast<char const*>(take(size)), size);
+            }
+            uint8_t const* take(uint64_t size)
+            {
+                if (size > left())
+                    throw io_exception("Truncated MCAP record");
+                auto p = _p;
+                _p += size;
+                return p;
+            }
+            // A length-prefixed array or map
+            record_reader get_array()
+            {
+                auto size = get<uint32_t>();
+                return record_reader(take(size), size);
+            }
+            size_t left() const { return size_t(_end - _p); }
+            uint8_t const* pos() const { return _p; }
+
+        private:
+            uint8_t const* _p;
+            uint8_t const* _end;
+        };
+
+        struct chunk_header
+        {
+            uint64_t start_time;
+            uint64_t end_time;
+            uint64_t uncompressed_size;
+            std::string compression;
+            uint8_t const* data;
+            uint64_t size;
+        };
+
+        chunk_header parse_chunk(uint8_t const* content, size_t size)
+        {
+            record_reader r(content, size);
+            chunk_header h;
+            h.start_time = r.get<uint64_t>();
+            h.end_time = r.get<uint64_t>();
+            h.uncompressed_size = r.get<uint64_t>();
+            r.get<uint32_t>();  // uncompressed CRC: written for other tools, not checked on playback
+            h.compression = r.get_string();
+            h.size = r.get<uint64_t>();
+            h.data = r.take(h.size);
+            return h;
+        }
+
+        std::shared_ptr<const std::vector<uint8_t>> decompress(chunk_header const& h)
+        {
+            if (h.uncompressed_size > MAX_RECORD_SIZE)
+                throw io_exception(rsutils::string::from()
+                    << "MCAP chunk size " << h.uncompressed_size << " exceeds safety limit");
+
+            auto out = std::make_shared<std::vector<uint8_t>>(size_t(h.uncompressed_size));
+            if (out->empty())
+                return out;
+
+            if (h.compression.empty())
+            {
+                if (h.size != h.uncompressed_size)
+                    throw io_exception("Corrupt MCAP chunk: size mismatch");
+                std::memcpy(out->data(), h.data, out->size());
+            }
+            else if (h.compression == "zstd")
+            {
+                auto size = ZSTD_decompress(out->data(), out->size(), h.data, size_t(h.size));
+                if (ZSTD_isError(size))
+                    throw io_exception(rsutils::string::from() << "Zstd decompression failed: " << ZSTD_getErrorName(size));
+                if (size != out->size())
+                    throw io_exception("Corrupt MCAP chunk: size mismatch");
+            }
+            else if (h.compression == "lz4")
+            {
+                LZ4F_dctx* ctx = nullptr;
+                if (LZ4F_isError(LZ4F_createDecompressionContext(&ctx, LZ4F_VERSION)))
+                    throw io_exception("Failed to create LZ4 decompression context");
+                size_t dst_size = out->size();
+                size_t src_size = size_t(h.size);
+                auto ret = LZ4F_decompress(ctx, out->data(), &dst_size, h.data, &src_size, nullptr);
+                LZ4F_freeDecompressionContext(ctx);
+                if (LZ4F_isError(ret))
+                    throw io_exception(rsutils::string::from() << "LZ4 decompression failed: " << LZ4F_getErrorName(ret));
+                if (dst_size != out->size())
+                    throw io_exception("Corrupt MCAP chunk: size mismatch");
+            }
+            else
+            {
+                throw io_exception(rsutils::string::from()
+                    << "Unsupported MCAP chunk compression '" << h.compression << "'");
+            }
+            return out;
+        }
+
+        std::string compression_name(mcap_storage::compression c)
+        {
+            switch (c)
+            {
+            case mcap_storage::compression::zstd: return "zstd";
+            case mcap_storage::compression::lz4: return "lz4";
+            default: return std::string();
+            }
+        }
+
+        void write_bytes(std::ofstream& out, std::vector<uint8_t> const& bytes)
+        {
+            out.write(reinterpret_cast<char const*>(bytes.data()), std::streamsize(bytes.size()));
+        }
+    }
+
+
+    mcap_storage::mcap_storage(compression c, size_t chunk_size)
+        : _compression(c)
+        , _chunk_size(chunk_size)
+    {
+    }
+
+    mcap_storage::~mcap_storage()
+    {
+        try
+        {
+            close();
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR("Failed to finish MCAP file '" << _path << "': " << e.what());
+        }
+    }
+
+    void mcap_storage::open(const std::string& uri, IOFlag io_flag)
+    {
+        _path = uri;
+        if (io_flag == IOFlag::READ_ONLY)
+        {
+            _in.open(uri, std::ios::binary);
+            if (!_in)
+                throw io_exception(rsutils::string::from() << "Failed to open '" << uri << "'");
+            _in.seekg(0, std::ios::end);
+            _file_size = uint64_t(_in.tellg());
+
+            uint8_t magic[sizeof(MAGIC)] = {};
+            if (_file_size >= sizeof(MAGIC))
+                read_at(0, magic, sizeof(magic));
+            if (std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0)
+                throw invalid_value_exception(rsutils::string::from() << "'" << uri << "' is not an MCAP file");
+
+            if (!read_summary())
+            {
+                LOG_WARNING("MCAP file '" << uri << "' has no summary (recording interrupted?); scanning it instead");
+                scan_data_section();
+            }
+            std::stable_sort(_chunks.begin(), _chunks.end(),
+                [](chunk_info const& a, chunk_info const& b) { return a.start_time < b.start_time; });
+            return;
+        }
+
+        if (io_flag == IOFlag::APPEND)
+            throw not_implemented_exception("Appending to MCAP files is not supported");
+
+        _out.open(uri, std::ios::binary | std::ios::trunc);
+        if (!_out)
+            throw io_exception(rsutils::string::from() << "Failed to create '" << uri << "'");
+        _writing = true;
+        _chunk.reset(new open_chunk);
+        _chunk->records.reserve(_chunk_size);
+        _writer.reset(new dispatcher(MAX_QUEUED_CHUNKS));
+        _writer->start();
+        write_header();
+    }
+
+    void mcap_storage::write_header()
+    {
+        std::vector<uint8_t> header(MAGIC, MAGIC + sizeof(MAGIC));
+        record_writer w(header);
+        auto rec = w.begin_record(OP_HEADER);
+        w.put_string("ros2");
+        w.put_string(std::string("librealsense ") + RS2_API_VERSION_STR);
+        w.end_record(rec);
+        write_bytes(_out, header);
+        _out_pos += header.size();
+    }
+
+    void mcap_storage::put_schema(std::vector<uint8_t>& out, uint16_t schema_id) const
+    {
+        // Schema data would be the .msg definition; we only name the type, which is enough for our readers
+        record_writer w(out);
+        auto rec = w.begin_record(OP_SCHEMA);
+        w.put(schema_id);
+        w.put_string(_schemas.at(schema_id));
+        w.put_string("ros2msg");
+        w.put(uint32_t(0));
+        w.end_record(rec);
+    }
+
+    void mcap_storage::put_channel(std::vector<uint8_t>& out, uint16_t channel_id) const
+    {
+        auto& ch = _channels.at(channel_id);
+        record_writer w(out);
+        auto rec = w.begin_record(OP_CHANNEL);
+        w.put(ch.id);
+        w.put(ch.schema_id);
+        w.put_string(ch.topic);
+        w.put_string(ch.encoding);
+        w.end_array(w.begin_array());  // no metadata
+        w.end_record(rec);
+    }
+
+    void mcap_storage::create_topic(const rosbag2_storage::TopicMetadata& topic)
+    {
+        if (!_writing)
+            throw wrong_api_call_sequence_exception("MCAP storage is not open for writing");
+        if (_channel_ids.count(topic.name))
+            return;
+
+        // Definitions go into the open chunk, ahead of the first message that needs them
+        uint16_t schema_id;
+        auto schema = _schema_ids.find(topic.type);
+        if (schema != _schema_ids.end())
+            schema_id = schema->second;
+        else
+        {
+            schema_id = uint16_t(_schemas.size() + 1);  // 0 means "no schema"
+            _schemas[schema_id] = topic.type;
+            _schema_ids[topic.type] = schema_id;
+            put_schema(_chunk->records, schema_id);
+        }
+
+        channel ch;
+        ch.id = uint16_t(_channels.size() + 1);
+        ch.schema_id = schema_id;
+        ch.topic = topic.name;
+        ch.encoding = topic.serialization_format.empty() ? "cdr" : topic.serialization_format;
+        _channels[ch.id] = ch;
+        _channel_ids[topic.name] = ch.id;
+        put_channel(_chunk->records, ch.id);
+    }
+
+    void mcap_storage::remove_topic(const rosbag2_storage::TopicMetadata& topic)
+    {
+        // What's written stays written; we just stop accepting messages for it
+        _channel_ids.erase(topic.name);
+    }
+
+    void mcap_storage::write(std::shared_ptr<const rosbag2_storage::SerializedBagMessage> msg)
+    {
+        if (!_writing)
+            throw wrong_api_call_sequence_exception("MCAP storage is not open for writing");
+        throw_if_write_failed();
+
+        auto id = _channel_ids.find(msg->topic_name);
+        if (id == _channel_ids.end())
+            throw invalid_value_exception(rsutils::string::from()
+                << "No MCAP channel was created for topic '" << msg->topic_name << "'");
+        auto& ch = _channels[id->second];
+        auto const time = uint64_t(msg->time_stamp);
+
+        auto& chunk = *_chunk;
+        if (chunk.index.empty())
+            chunk.start_time = chunk.end_time = time;
+        chunk.start_time = std::min(chunk.start_time, time);
+        chunk.end_time = std::max(chunk.end_time, time);
+        chunk.index[ch.id].emplace_back(time, chunk.records.size());
+
+        record_writer w(chunk.records);
+        auto rec = w.begin_record(OP_MESSAGE);
+        w.put(ch.id);
+        w.put(ch.sequence++);
+        w.put(time);  // log time
+        w.put(time);  // publish time
+        if (msg->serialized_data)
+            w.put_bytes(msg->serialized_data->buffer, msg->serialized_data->buffer_length);
+        w.end_record(rec);
+
+        if (_message_count++ == 0)
+            _start_time = _end_time = time;
+        _start_time = std::min(_start_time, time);
+        _end_time = std::max(_end_time, time);
+        ++ch.message_count;
+
+        if (chunk.records.size() >= _chunk_size)
+            close_chunk();
+    }
+
+    void mcap_storage::write(const std::vector<std::shared_ptr<const rosbag2_storage::SerializedBagMessage>>& msgs)
+    {
+        for (auto& msg : msgs)
+            write(msg);
+    }
+
+    void mcap_storage::close_chunk()
+    {
+        std::shared_ptr<open_chunk> full(std::move(_chunk));
+        _chunk.reset(new open_chunk);
+        _chunk->records.reserve(_chunk_size);
+
+        // Blocks while MAX_QUEUED_CHUNKS are already waiting: the disk can't keep up
+        _writer->invoke([this, full](dispatcher::cancellable_timer)
+        {
+            try
+            {
+                write_chunk(*full);
+            }
+            catch (const std::exception& e)
+            {
+                std::lock_guard<std::mutex> lock(_write_error_mutex);
+                if (_write_error.empty())
+                    _write_error = e.what();
+            }
+        }, true);
+    }
+
+    void mcap_storage::throw_if_write_failed()
+    {
+        std::lock_guard<std::mutex> lock(_write_error_mutex);
+        if (!_write_error.empty())
+            throw io_exception(rsutils::string::from() << "Failed writing '" << _path << "': " << _write_error);
+    }
+
+    std::vector<uint8_t> mcap_storage::compress(std::vector<uint8_t> const& records) const
+    {
+        switch (_compression)
+        {
+        case compression::zstd:
+        {
+            std::vector<uint8_t> out(ZSTD_compressBound(records.size()));
+            // Level 1, same as ros2_writer's per-message compression: keeps up with the cameras on one thread
+            auto size = ZSTD_compress(out.data(), out.size(), records.data(), records.size(), 1);
+            if (ZSTD_isError(size))
+                throw io_exception(rsutils::string::from() << "Zstd compression failed: " << ZSTD_getErrorName(size));
+            out.resize(size);
+            return out;
+        }
+        case compression::lz4:
+        {
+            std::vector<uint8_t> out(LZ4F_compressFrameBound(records.size(), nullptr));
+            auto size = LZ4F_compressFrame(out.data(), out.size(), records.data(), records.size(), nullptr);
+            if (LZ4F_isError(size))
+                throw io_exception(rsutils::string::from() << "LZ4 compression failed: " << LZ4F_getErrorName(size));
+            out.resize(size);
+            return out;
+        }
+        default:
+            return records;
+        }
+    }
+
+    void mcap_storage::write_chunk(open_chunk& chunk)
+    {
+        {
+            // Once a chunk is lost, the offsets of everything after it would be wrong
+            std::lock_guard<std::mutex> lock(_write_error_mutex);
+            if (!_write_error.empty())
+                return;
+        }
+
+        chunk_info info;
+        info.start_time = chunk.start_time;
+        info.end_time = chunk.end_time;
+        info.offset = _out_pos;
+        info.uncompressed_size = chunk.records.size();
+        info.compression = compression_name(_compression);
+        info.order = uint32_t(_chunks.size());
+
+        auto const crc = rsutils::number::calc_crc32(chunk.records.data(), chunk.records.size());
+        std::vector<uint8_t> compressed;
+        if (_compression != compression::none)
+            compressed = compress(chunk.records);
+        auto const& data = _compression != compression::none ? compressed : chunk.records;
+        info.compressed_size = data.size();
+
+        std::vector<uint8_t> header;
+        record_writer w(header);
+        uint64_t const content_size = 8 + 8 + 8 + 4 + 4 + info.compression.size() + 8 + data.size();
+        w.put(uint8_t(OP_CHUNK));
+        w.put(content_size);
+        w.put(info.start_time);
+        w.put(info.end_time);
+        w.put(info.uncompressed_size);
+        w.put(crc);
+        w.put_string(info.compression);
+        w.put(uint64_t(data.size()));
+        info.length = RECORD_PREFIX + content_size;
+
+        std::vector<uint8_t> indexes;
+        record_writer iw(indexes);
+        for (auto& channel_index : chunk.index)
+        {
+            info.message_index_offsets.emplace_back(channel_index.first, info.offset + info.length + indexes.size());
+            auto rec = iw.begin_record(OP_MESSAGE_INDEX);
+            iw.put(channel_index.first);
+            auto entries = iw.begin_array();
+            for (auto& entry : channel_index.second)
+            {
+                iw.put(entry.first);
+                iw.put(entry.second);
+            }
+            iw.end_array(entries);
+            iw.end_record(rec);
+        }
+        info.message_index_length = indexes.size();
+
+        write_bytes(_out, header);
+        write_bytes(_out, data);
+        write_bytes(_out, indexes);
+        if (!_out)
+            throw io_exception("write failed (disk full?)");
+        _out_pos += header.size() + data.size() + indexes.size();
+        _chunks.push_back(std::move(info));
+    }
+
+    void mcap_storage::close()
+    {
+        if (!_writing)
+        {
+            _in.close();
+            return;
+        }
+        _writing = false;
+
+        if (!_chunk->records.empty())
+            close_chunk();
+        bool const flushed = _writer->flush(std::chrono::minutes(1));
+        _writer.reset();
+        if (!flushed)
+            throw io_exception("Timed out writing the last chunks");
+        throw_if_write_failed();
+
+        std::vector<uint8_t> tail;
+        record_writer w(tail);
+        auto rec = w.begin_record(OP_DATA_END);
+        w.put(uint32_t(0));  // no data section CRC: each chunk has its own
+        w.end_record(rec);
+
+        struct group
+        {
+            uint8_t op;
+            uint64_t start;
+            uint64_t length;
+        };
+        std::vector<group> groups;
+        auto begin_group = [&](uint8_t op) { groups.push_back({ op, _out_pos + tail.size(), 0 }); };
+        auto end_group = [&]() { groups.back().length = _out_pos + tail.size() - groups.back().start; };
+
+        uint64_t const summary_start = _out_pos + tail.size();
+        begin_group(OP_SCHEMA);
+        for (auto& schema : _schemas)
+            put_schema(tail, schema.first);
+        end_group();
+
+        begin_group(OP_CHANNEL);
+        for (auto& ch : _channels)
+            put_channel(tail, ch.first);
+        end_group();
+
+        begin_group(OP_STATISTICS);
+        rec = w.begin_record(OP_STATISTICS);
+        w.put(_message_count);
+        w.put(uint16_t(_schemas.size()));
+        w.put(uint32_t(_channels.size()));
+        w.put(uint32_t(0));  // attachments
+        w.put(uint32_t(0));  // metadata
+        w.put(uint32_t(_chunks.size()));
+        w.put(_start_time);
+        w.put(_end_time);
+        auto counts = w.begin_array();
+        for (auto& ch : _channels)
+        {
+            w.put(ch.first);
+            w.put(ch.second.message_count);
+        }
+        w.end_array(counts);
+        w.end_record(rec);
+        end_group();
+
+        begin_group(OP_CHUNK_INDEX);
+        for (auto& chunk : _chunks)
+        {
+            rec = w.begin_record(OP_CHUNK_INDEX);
+            w.put(chunk.start_time);
+            w.put(chunk.end_time);
+            w.put(chunk.offset);
+            w.put(chunk.length);
+            auto offsets = w.begin_array();
+            for (auto& offset : chunk.message_index_offsets)
+            {
+                w.put(offset.first);
+                w.put(offset.second);
+            }
+            w.end_array(offsets);
+            w.put(chunk.message_index_length);
+            w.put_string(chunk.compression);
+            w.put(chunk.compressed_size);
+            w.put(chunk.uncompressed_size);
+            w.end_record(rec);
+        }
+        end_group();
+
+        uint64_t const summary_offset_start = _out_pos + tail.size();
+        for (auto& g : groups)
+        {
+            if (!g.length)
+                continue;
+            rec = w.begin_record(OP_SUMMARY_OFFSET);
+            w.put(g.op);
+            w.put(g.start);
+            w.put(g.length);
+            w.end_record(rec);
+        }
+
+        w.put(uint8_t(OP_FOOTER));
+        w.put(uint64_t(FOOTER_SIZE - RECORD_PREFIX));
+        w.put(summary_start);
+        w.put(summary_offset_start);
+        auto const crc_start = size_t(summary_start - _out_pos);
+        w.put(rsutils::number::calc_crc32(tail.data() + crc_start, tail.size() - crc_start));
+        w.put_bytes(MAGIC, sizeof(MAGIC));
+
+        write_bytes(_out, tail);
+        _out_pos += tail.size();
+        _out.close();
+        if (!_out)
+            throw io_exception("write failed (disk full?)");
+    }
+
+    void mcap_storage::read_at(uint64_t offset, void* dst, size_t size)
+    {
+        _in.clear();
+        _in.seekg(std::streamoff(offset));
+        _in.read(static_cast<char*>(dst), std::streamsize(size));
+        if (size_t(_in.gcount()) != size)
+            throw io_exception(rsutils::string::from() << "Unexpected end of MCAP file '" << _path << "'");
+    }
+
+    void mcap_storage::read_definition(uint8_t op, uint8_t const* data, size_t size)
+    {
+        record_reader r(data, size);
+        if (op == OP_SCHEMA)
+        {
+            auto id = r.get<uint16_t>();
+            auto name = r.get_string();
+            _schemas.emplace(id, name);
+        }
+        else if (op == OP_CHANNEL)
+        {
+            channel ch;
+            ch.id = r.get<uint16_t>();
+            ch.schema_id = r.get<uint16_t>();
+            ch.topic = r.get_string();
+            ch.encoding = r.get_string();
+            if (_channels.emplace(ch.id, ch).second)
+                _channel_ids.emplace(ch.topic, ch.id);
+        }
+    }
+
+    bool mcap_storage::read_summary()
+    {
+        uint8_t footer[FOOTER_SIZE + sizeof(MAGIC)];
+        if (_file_size < sizeof(MAGIC) + sizeof(footer))
+            return false;
+        auto const footer_pos = _file_size - sizeof(footer);
+        read_at(footer_pos, footer, sizeof(footer));
+        if (footer[0] != OP_FOOTER || std::memcmp(footer + FOOTER_SIZE, MAGIC, sizeof(MAGIC)) != 0)
+            return false;
+        record_reader f(footer + 1, FOOTER_SIZE - 1);
+        if (f.get<uint64_t>() != FOOTER_SIZE - RECORD_PREFIX)
+            return false;
+        auto const summary_start = f.get<uint64_t>();
+        if (!summary_start || summary_start >= footer_pos || footer_pos - summary_start > MAX_RECORD_SIZE)
+            return false;
+
+        std::vector<uint8_t> summary(size_t(footer_pos - summary_start));
+        read_at(summary_start, summary.data(), summary.size());
+
+        bool have_statistics = false;
+        std::map<uint16_t, uint64_t> message_counts;
+        record_reader r(summary.data(), summary.size());
+        while (r.left())
+        {
+            auto op = r.get<uint8_t>();
+            auto size = r.get<uint64_t>();
+            auto content = r.take(size);
+            record_reader rec(content, size_t(size));
+            switch (op)
+            {
+            case OP_SCHEMA:
+            case OP_CHANNEL:
+                read_definition(op, content, size_t(size));
+                break;
+
+            case OP_STATISTICS:
+            {
+                have_statistics = true;
+                _message_count = rec.get<uint64_t>();
+                rec.take(2 + 4 + 4 + 4 + 4);  // schema, channel, attachment, metadata and chunk counts
+                _start_time = rec.get<uint64_t>();
+                _end_time = rec.get<uint64_t>();
+                auto counts = rec.get_array();
+                while (counts.left())
+                {
+                    auto id = counts.get<uint16_t>();
+                    message_counts[id] = counts.get<uint64_t>();
+                }
+                break;
+            }
+
+            case OP_CHUNK_INDEX:
+            {
+                chunk_info chunk;
+                chunk.start_time = rec.get<uint64_t>();
+                chunk.end_time = rec.get<uint64_t>();
+                chunk.offset = rec.get<uint64_t>();
+                chunk.length = rec.get<uint64_t>();
+                auto offsets = rec.get_array();
+                while (offsets.left())
+                {
+                    auto id = offsets.get<uint16_t>();
+                    chunk.message_index_offsets.emplace_back(id, offsets.get<uint64_t>());
+                }
+                chunk.message_index_length = rec.get<uint64_t>();
+                chunk.compression = rec.get_string();
+                chunk.compressed_size = rec.get<uint64_t>();
+                chunk.uncompressed_size = rec.get<uint64_t>();
+                if (chunk.offset + chunk.length > _file_size)
+                    throw io_exception(rsutils::string::from() << "Corrupt MCAP chunk index in '" << _path << "'");
+                chunk.order = uint32_t(_chunks.size());
+                _chunks.push_back(std::move(chunk));
+                break;
+            }
+            }
+        }
+
+        // Without statistics or a chunk index, the summary can't stand in for the data
+        if (!have_statistics || (_message_count && _chunks.empty()))
+        {
+            _schemas.clear();
+            _channels.clear();
+            _channel_ids.clear();
+            _chunks.clear();
+            _message_count = _start_time = _end_time = 0;
+            return false;
+        }
+        for (auto& count : message_counts)
+        {
+            auto ch = _channels.find(count.first);
+            if (ch != _channels.end())
+                ch->second.message_count = count.second;
+        }
+        return true;
+    }
+
+    void mcap_storage::scan_data_section()
+    {
+        uint64_t pos = sizeof(MAGIC);
+        std::vector<uint8_t> content;
+        while (pos + RECORD_PREFIX <= _file_size)
+        {
+            uint8_t prefix[RECORD_PREFIX];
+            read_at(pos, prefix, sizeof(prefix));
+            uint64_t size;
+            std::memcpy(&size, prefix + 1, sizeof(size));
+            if (size > _file_size - pos - RECORD_PREFIX)
+                break;  // cut off mid-record: everything before it is still good
+            auto const op = prefix[0];
+            if (op == OP_DATA_END || op == OP_FOOTER)
+                break;
+
+            if (op == OP_SCHEMA || op == OP_CHANNEL || op == OP_CHUNK)
+            {
+                if (size > MAX_RECORD_SIZE)
+                    throw io_exception(rsutils::string::from() << "Corrupt MCAP record in '" << _path << "'");
+                content.resize(size_t(size));
+                read_at(pos + RECORD_PREFIX, content.data(), content.size());
+                if (op == OP_CHUNK)
+                {
+                    auto h = parse_chunk(content.data(), content.size());
+                    chunk_info chunk;
+                    chunk.start_time = h.start_time;
+                    chunk.end_time = h.end_time;
+                    chunk.offset = pos;
+                    chunk.length = RECORD_PREFIX + size;
+                    chunk.compression = h.compression;
+                    chunk.compressed_size = h.size;
+                    chunk.uncompressed_size = h.uncompressed_size;
+                    chunk.order = uint32_t(_chunks.size());
+                    read_chunk_records(decompress(h), chunk.order, &chunk);
+                    _chunks.push_back(std::move(chunk));
+                }
+                else
+                    read_definition(op, content.data(), content.size());
+            }
+            pos += RECORD_PREFIX + size;
+        }
+    }
+
+    std::shared_ptr<const std::vector<uint8_t>> mcap_storage::load_chunk(chunk_info const& chunk)
+    {
+        if (chunk.length > MAX_RECORD_SIZE || chunk.length <= RECORD_PREFIX)
+            throw io_exception(rsutils::string::from() << "Corrupt MCAP chunk index in '" << _path << "'");
+        std::vector<uint8_t> record(size_t(chunk.length));
+        read_at(chunk.offset, record.data(), record.size());
+        if (record[0] != OP_CHUNK)
+            throw io_exception(rsutils::string::from() << "Corrupt MCAP chunk index in '" << _path << "'");
+        return decompress(parse_chunk(record.data() + RECORD_PREFIX, record.size() - RECORD_PREFIX));
+    }
+
+    void mcap_storage::read_chunk_records(std::shared_ptr<const std::vector<uint8_t>> const& records,
+                                          uint32_t chunk_order,
+                                          chunk_info* scanning)
+    {
+        record_reader r(records->data(), records->size());
+        uint32_t n_message = 0;
+        while (r.left())
+        {
+            auto op = r.get<uint8_t>();
+            auto size = r.get<uint64_t>();
+            auto content = r.take(size);
+            if (op == OP_SCHEMA || op == OP_CHANNEL)
+            {
+                if (scanning)
+                    read_definition(op, content, size_t(size));
+                continue;
+            }
+            if (op != OP_MESSAGE)
+                continue;
+
+            record_reader msg(content, size_t(size));
+            auto channel_id = msg.get<uint16_t>();
+            msg.get<uint32_t>();  // sequence
+            auto time = msg.get<uint64_t>();
+            msg.get<uint64_t>();  // publish time
+
+            if (scanning)
+            {
+                auto ch = _channels.find(channel_id);
+                if (ch != _channels.end())
+                    ++ch->second.message_count;
+                if (_message_count++ == 0)
+                    _start_time = _end_time = time;
+                _start_time = std::min(_start_time, time);
+                _end_time = std::max(_end_time, time);
+                auto& channels = scanning->message_index_offsets;
+                if (std::find_if(channels.begin(), channels.end(),
+                        [channel_id](std::pair<uint16_t, uint64_t> const& c) { return c.first == channel_id; })
+                    == channels.end())
+                    channels.emplace_back(channel_id, 0);
+            }
+            else if (time >= _seek_time && passes_filter(channel_id))
+            {
+                pending_message pending;
+                pending.time = time;
+                pending.order = (uint64_t(chunk_order) << 32) | n_message;
+                pending.channel_id = channel_id;
+                pending.chunk = records;
+                pending.offset = size_t(msg.pos() - records->data());
+                pending.size = msg.left();
+                _pending.push(std::move(pending));
+            }
+            ++n_message;
+        }
+    }
+
+    bool mcap_storage::passes_filter(uint16_t channel_id) const
+    {
+        return !_filtered || _filter.count(channel_id);
+    }
+
+    bool mcap_storage::chunk_passes_filter(chunk_info const& chunk) const
+    {
+        // The chunk index lists the channels that have messages in the chunk
+        if (!_filtered || chunk.message_index_offsets.empty())
+            return true;
+        for (auto& channel : chunk.message_index_offsets)
+            if (_filter.count(channel.first))
+                return true;
+        return false;
+    }
+
+    bool mcap_storage::has_next()
+    {
+        while (true)
+        {
+            // The filter may have changed since these were queued
+            while (!_pending.empty() && !passes_filter(_pending.top().channel_id))
+                _pending.pop();
+
+            // Load chunks until the next one starts after the earliest message we have
+            if (_next_chunk >= _chunks.size()
+                || (!_pending.empty() && _pending.top().time < _chunks[_next_chunk].start_time))
+                return !_pending.empty();
+
+            auto const& chunk = _chunks[_next_chunk++];
+            if (chunk.end_time >= _seek_time && chunk_passes_filter(chunk))
+                read_chunk_records(load_chunk(chunk), chunk.order, nullptr);
+        }
+    }
+
+    std::shared_ptr<rosbag2_storage::SerializedBagMessage> mcap_storage::read_next()
+    {
+        if (!has_next())
+            return nullptr;
+        auto next = _pending.top();
+        _pending.pop();
+
+        auto ch = _channels.find(next.channel_id);
+        if (ch == _channels.end())
+            throw io_exception(rsutils::string::from()
+                << "MCAP message on unknown channel " << next.channel_id << " in '" << _path << "'");
+
+        // The payload stays where it is, in the decompressed chunk, which the buffer keeps alive. Without an
+        // allocator, rcutils can't resize or free it.
+        auto chunk = next.chunk;
+        auto data = std::shared_ptr<rcutils_uint8_array_t>(
+            new rcutils_uint8_array_t(rcutils_get_zero_initialized_uint8_array()),
+            [chunk](rcutils_uint8_array_t* arr) { delete arr; });
+        data->buffer = const_cast<uint8_t*>(chunk->data() + next.offset);
+        data->buffer_length = data->buffer_capacity = next.size;
+
+        auto msg = std::make_shared<rosbag2_storage::SerializedBagMessage>();
+        msg->serialized_data = std::move(data);
+        msg->time_stamp = static_cast<rcutils_time_point_value_t>(next.time);
+        msg->topic_name = ch->second.topic;
+        return msg;
+    }
+
+    void mcap_storage::seek(const rcutils_time_point_value_t& timestamp)
+    {
+        _seek_time = timestamp > 0 ? uint64_t(timestamp) : 0;
+        _pending = decltype(_pending)();
+        _next_chunk = 0;
+    }
+
+    void mcap_storage::set_filter(const rosbag2_storage::StorageFilter& storage_filter)
+    {
+        _filter.clear();
+        _filtered = !storage_filter.topics.empty();
+        for (auto& ch : _channels)
+            if (std::find(storage_filter.topics.begin(), storage_filter.topics.end(), ch.second.topic)
+                != storage_filter.topics.end())
+                _filter.insert(ch.first);
+    }
+
+    void mcap_storage::reset_filter()
+    {
+        _filtered = false;
+        _filter.clear();
+    }
+
+    std::vector<rosbag2_storage::TopicMetadata> mcap_storage::get_all_topics_and_types()
+    {
+        std::vector<rosbag2_storage::TopicMetadata> topics;
+        for (auto& ch : _channels)
+        {
+            auto schema = _schemas.find(ch.second.schema_id);
+            topics.push_back({ ch.second.topic,
+                               schema != _schemas.end() ? schema->second : std::string(),
+                               ch.second.encoding,
+                               std::string() });
+        }
+        return topics;
+    }
+
+    rosbag2_storage::BagMetadata mcap_storage::get_metadata()
+    {
+        rosbag2_storage::BagMetadata metadata;
+        metadata.storage_identifier = get_storage_identifier();
+        metadata.relative_file_paths = { _path };
+        metadata.message_count = _message_count;
+        metadata.starting_time
+            = std::chrono::time_point<std::chrono::high_resolution_clock>(std::chrono::nanoseconds(_start_time));
+        metadata.duration = std::chrono::nanoseconds(_end_time - _start_time);
+        auto topics = get_all_topics_and_types();
+        auto ch = _channels.begin();
+        for (auto& topic : topics)
+            metadata.topics_with_message_count.push_back({ topic, size_t((ch++)->second.message_count) });
+        metadata.bag_size = get_bagfile_size();
+        return metadata;
+    }
+
+    uint64_t mcap_storage::get_bagfile_size() const
+    {
+        return _writing ? _out_pos.load() : _file_size;
+    }
+}
@@ -0,0 +1,184 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+#include <rosbag2_storage/storage_interfaces/read_write_interface.hpp>
+#include <rsutils/concurrency/concurrency.h>
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <set>
+#include <string>
+#include <vector>
+
+
+namespace librealsense
+{
+    // rosbag2 storage backed by an MCAP file (https://mcap.dev/spec), a drop-in for SqliteStorage under ros2_writer
+    // and the ros2 readers.
+    //
+    // The file is append-only: messages are gathered into chunks, and each chunk is written compressed (zstd or lz4)
+    // and followed by its per-channel message index. Closing the file appends the summary: schemas, channels,
+    // statistics and a chunk index, which is how a reader finds its way around without scanning.
+    //
+    // Writing only copies the message into the open chunk; full chunks are compressed, checksummed and appended by a
+    // background thread, with at most MAX_QUEUED_CHUNKS waiting, so recording is bounded by compression and disk speed
+    // rather than by per-message overhead.
+    //
+    // Reading merges chunks by message time, decompressing a chunk only once its first message is due and only if it
+    // holds a channel that passes the filter. seek() goes straight to the chunks whose time range covers the target.
+    // A file that was never closed (no summary) is indexed by scanning its chunks instead.
+    //
+    // Only chunked files are supported; messages written outside chunks are ignored.
+    //
+    class mcap_storage : public rosbag2_storage::storage_interfaces::ReadWriteInterface
+    {
+    public:
+        enum class compression { none, zstd, lz4 };
+
+        static constexpr size_t DEFAULT_CHUNK_SIZE = 4 * 1024 * 1024;
+        static constexpr size_t MAX_QUEUED_CHUNKS = 2;
+
+        explicit mcap_storage(compression = compression::zstd, size_t chunk_size = DEFAULT_CHUNK_SIZE);
+        ~mcap_storage() override;
+
+        // Unlike SqliteStorage, the uri is the exact file path in both modes (nothing is appended)
+        void open(const std::string& uri,
+                  rosbag2_storage::storage_interfaces::IOFlag io_flag
+                  = rosbag2_storage::storage_interfaces::IOFlag::READ_WRITE) override;
+
+        // Writes what's left of the data and then the summary; done on destruction if not before
+        void close();
+
+        void create_topic(const rosbag2_storage::TopicMetadata& topic) override;
+        void remove_topic(const rosbag2_storage::TopicMetadata& topic) override;
+        void write(std::shared_ptr<const rosbag2_storage::SerializedBagMessage> msg) override;
+        void write(const std::vector<std::shared_ptr<const rosbag2_storage::SerializedBagMessage>>& msgs) override;
+
+        bool has_next() override;
+        std::shared_ptr<rosbag2_storage::SerializedBagMessage> read_next() override;
+        std::vector<rosbag2_storage::TopicMetadata> get_all_topics_and_types() override;
+
+        // Takes effect on the next message read
+        void set_filter(const rosbag2_storage::StorageFilter& storage_filter) override;
+        void reset_filter() override;
+
+        // Continue reading from the first message at or after timestamp, same as SqliteStorage::seek()
+        void seek(const rcutils_time_point_value_t& timestamp);
+
+        rosbag2_storage::BagMetadata get_metadata() override;
+        std::string get_relative_file_path() const override { return _path; }
+        uint64_t get_bagfile_size() const override;
+        std::string get_storage_identifier() const override { return "mcap"; }
+        uint64_t get_minimum_split_file_size() const override { return _chunk_size; }
+
+    private:
+        struct channel
+        {
+            uint16_t id;
+            uint16_t schema_id;
+            std::string topic;
+            std::string encoding;
+            uint64_t message_count = 0;
+            uint32_t sequence = 0;
+        };
+
+        // What the summary knows of a chunk
+        struct chunk_info
+        {
+            uint64_t start_time = 0;
+            uint64_t end_time = 0;
+            uint64_t offset = 0;   // of the chunk record
+            uint64_t length = 0;   // of the chunk record, opcode and length included
+            uint64_t compressed_size = 0;
+            uint64_t uncompressed_size = 0;
+            std::string compression;
+            std::vector<std::pair<uint16_t, uint64_t>> message_index_offsets;  // channel -> message index record
+            uint64_t message_index_length = 0;
+            uint32_t order = 0;   // position in the file, to break timestamp ties in write order
+        };
+
+        // The chunk being filled by write()
+        struct open_chunk
+        {
+            std::vector<uint8_t> records;
+            uint64_t start_time = 0;
+            uint64_t end_time = 0;
+            std::map<uint16_t, std::vector<std::pair<uint64_t, uint64_t>>> index;  // channel -> (log time, offset)
+        };
+
+        // A message out of a decompressed chunk, waiting for its turn
+        struct pending_message
+        {
+            uint64_t time;
+            uint64_t order;
+            uint16_t channel_id;
+            std::shared_ptr<const std::vector<uint8_t>> chunk;
+            size_t offset;
+            size_t size;
+
+            bool operator>(pending_message const& other) const
+            {
+                return time != other.time ? time > other.time : order > other.order;
+            }
+        };
+
+        // Writing
+        void write_header();
+        void put_schema(std::vector<uint8_t>& out, uint16_t schema_id) const;
+        void put_channel(std::vector<uint8_t>& out, uint16_t channel_id) const;
+        void close_chunk();
+        void write_chunk(open_chunk& chunk);   // on the writer thread
+        void throw_if_write_failed();
+        std::vector<uint8_t> compress(std::vector<uint8_t> const& records) const;
+
+        // Reading
+        bool read_summary();
+        void scan_data_section();
+        void read_definition(uint8_t opcode, uint8_t const* data, size_t size);
+        // Queues the chunk's messages for reading or, while scanning, fills in what the chunk index would have told us
+        void read_chunk_records(std::shared_ptr<const std::vector<uint8_t>> const& records,
+                                uint32_t chunk_order,
+                                chunk_info* scanning);
+        std::shared_ptr<const std::vector<uint8_t>> load_chunk(chunk_info const& chunk);
+        bool passes_filter(uint16_t channel_id) const;
+        bool chunk_passes_filter(chunk_info const& chunk) const;
+        void read_at(uint64_t offset, void* dst, size_t size);
+
+        compression _compression;
+        size_t _chunk_size;
+        std::string _path;
+        bool _writing = false;
+
+        std::map<uint16_t, std::string> _schemas;                 // id -> name (the ROS2 type)
+        std::map<std::string, uint16_t> _schema_ids;
+        std::map<uint16_t, channel> _channels;
+        std::map<std::string, uint16_t> _channel_ids;             // topic -> channel
+        uint64_t _message_count = 0;
+        uint64_t _start_time = 0;
+        uint64_t _end_time = 0;
+        std::vector<chunk_info> _chunks;
+
+        // Writing
+        std::ofstream _out;
+        std::atomic<uint64_t> _out_pos{ 0 };                      // written by _writer, read by get_bagfile_size()
+        std::unique_ptr<open_chunk> _chunk;
+        std::unique_ptr<dispatcher> _writer;
+        std::mutex _write_error_mutex;
+        std::string _write_error;
+
+        // Reading
+        std::ifstream _in;
+        uint64_t _file_size = 0;
+        bool _filtered = false;
+        std::set<uint16_t> _filter;                               // channels that pass, if _filtered
+        uint64_t _seek_time = 0;
+        size_t _next_chunk = 0;                                   // in _chunks, which are sorted by start time
+        std::priority_queue<pending_message, std::vector<pending_message>, std::greater<pending_message>> _pending;
+    };
+}
@@ -294,6 +294,17 @@ namespace librealsense
         static size_t getCdrSerializedSize(const cdr_uint32&, size_t = 0) { return sizeof(uint32_t); }
     };
 
+    // Appended to the image encoding of frames recorded with RS2_RECORD_STREAM_CODEC_DEPTH_LOSSLESS, whose data is then
+    // rsutils::codec::depth_encode() output (after the ROS convention, e.g. "16UC1; compressedDepth")
+    static constexpr const char* DEPTH_CODEC_ENCODING_SUFFIX = "; rs-depth";
+
+    inline bool is_depth_codec_encoding(const std::string& encoding)
+    {
+        static const std::string suffix = DEPTH_CODEC_ENCODING_SUFFIX;
+        return encoding.size() > suffix.size()
+            && encoding.compare(encoding.size() - suffix.size(), suffix.size(), suffix) == 0;
+    }
+
     inline std::shared_ptr<rcutils_uint8_array_t> create_buffer(size_t size)
     {
         auto buffer = std::shared_ptr<rcutils_uint8_array_t>(new rcutils_uint8_array_t(),
@@ -20,6 +20,7 @@
 #include <src/object-detection-frame.h>
 #include <rsutils/json.h>
 #include <rsutils/number/crc32.h>
+#include <rsutils/codec/depth-codec.h>
 
 #include <cstring>
 
@@ -265,7 +266,18 @@ namespace librealsense
         else
         {
             auto img = deserialize_message<sensor_msgs::msg::Image>(msg);
-            data = std::move(img.data());
+            if (is_depth_codec_encoding(img.encoding()))
+            {
+                data.resize(size_t(img.width()) * img.height() * 2);
+                if (!rsutils::codec::depth_decode(img.data().data(), img.data().size(),
+                                                  reinterpret_cast<uint16_t*>(data.data()), data.size() / 2))
+                {
+                    LOG_WARNING("Malformed depth-codec frame in " << msg->topic_name);
+                    return std::make_shared<serialized_invalid_frame>(timestamp, stream_id);
+                }
+            }
+            else
+                data = std::move(img.data());
         }
 
         auto frame = alloc_and_move_frame(std::move(data), stream_id, std::move(additional_data));
@@ -2,6 +2,7 @@
 // Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
 
 #include "ros2_reader_base.h"
+#include "mcap_storage.h"
 
 #include <zstd.h>
 
@@ -9,6 +10,7 @@
 #include <src/sensor.h>
 #include <src/stream.h>
 #include <src/core/extension.h>
+#include <src/media/ros_factory.h>
 
 
 namespace librealsense
@@ -47,18 +49,31 @@ namespace librealsense
         return nanoseconds(meta.duration.count());
     }
 
-    std::shared_ptr<rosbag2_storage_plugins::SqliteStorage> ros2_reader_base::as_sqlite_storage()
+    std::shared_ptr<rosbag2_storage::storage_interfaces::ReadWriteInterface> ros2_reader_base::open_storage(const std::string& file)
     {
-        auto as_sqlite = std::dynamic_pointer_cast<rosbag2_storage_plugins::SqliteStorage>(_storage);
-        if (!as_sqlite)
-            throw std::runtime_error("expected a SqliteStorage backend");
-        return as_sqlite;
+        std::shared_ptr<rosbag2_storage::storage_interfaces::ReadWriteInterface> storage;
+        if (is_mcap_file(file))
+            storage = std::make_shared< mcap_storage >();
+        else
+            storage = std::make_shared< rosbag2_storage_plugins::SqliteStorage >();
+        storage->open(file, rosbag2_storage::storage_interfaces::IOFlag::READ_ONLY);
+        return storage;
+    }
+
+    void ros2_reader_base::seek_storage(const nanoseconds& time)
+    {
+        auto timestamp = static_cast<rcutils_time_point_value_t>(time.count() + _first_timestamp_ns);
+        if (auto as_mcap = std::dynamic_pointer_cast<mcap_storage>(_storage))
+            as_mcap->seek(timestamp);  // through the chunk index in the summary
+        else if (auto as_sqlite = std::dynamic_pointer_cast<rosbag2_storage_plugins::SqliteStorage>(_storage))
+            as_sqlite->seek(timestamp);
+        else
+            throw std::runtime_error("storage backend does not support seeking");
     }
 
     void ros2_reader_base::reset()
     {
-        _storage = std::make_shared< rosbag2_storage_plugins::SqliteStorage >();
-        _storage->open(m_file_path, rosbag2_storage::storage_interfaces::IOFlag::READ_ONLY);
+        _storage = open_storage(m_file_path);
         m_frame_source = std::make_shared<frame_source>(32);
         m_frame_source->init(m_metadata_parser_map);
         _cache_valid = false;
@@ -88,7 +103,7 @@ namespace librealsense
         // Window assumes every active stream emits >= 1 frame/sec.
         static const nanoseconds lookback( std::chrono::seconds( 1 ) );
         const auto from = seek_time > lookback ? seek_time - lookback : nanoseconds( 0 );
-        as_sqlite_storage()->seek( static_cast<rcutils_time_point_value_t>( from.count() + _first_timestamp_ns ) );
+        seek_storage( from );
         _cached_message = nullptr;
         _cache_valid = false;
 
@@ -204,8 +219,7 @@ namespace librealsense
     void ros2_reader_base::prepare_for_streaming()
     {
         // Reopen storage to reset the filter, and apply relevant filters for streaming
-        _storage = std::make_shared< rosbag2_storage_plugins::SqliteStorage >();
-        _storage->open(m_file_path, rosbag2_storage::storage_interfaces::IOFlag::READ_ONLY);
+        _storage = open_storage(m_file_path);
 
         auto stream_topics       = get_stream_topics();
         auto option_topics       = get_option_topics();
@@ -229,7 +243,7 @@ namespace librealsense
         }
 
         // Position the cursor at seek_time (indexed); paused frames are handled by fetch_last_frames.
-        as_sqlite_storage()->seek(static_cast<rcutils_time_point_value_t>(seek_time.count() + _first_timestamp_ns));
+        seek_storage(seek_time);
         _cached_message = nullptr;   // lookahead stale after the jump
         _cache_valid = false;
     }
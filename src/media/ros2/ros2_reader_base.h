@@ -32,6 +32,9 @@ namespace librealsense
         std::vector<std::shared_ptr<serialized_data>> fetch_last_frames(const nanoseconds& seek_time) override;
         const std::string& get_file_name() const override;
 
+        // SqliteStorage for .db3 files, mcap_storage for .mcap, opened for reading
+        static std::shared_ptr<rosbag2_storage::storage_interfaces::ReadWriteInterface> open_storage(const std::string& file);
+
         static bool is_zstd_compressed(const uint8_t* src, size_t src_size);
         static void decompress_if_needed(std::shared_ptr<rosbag2_storage::SerializedBagMessage>& msg);
 
@@ -53,7 +56,8 @@ namespace librealsense
     protected:
         nanoseconds get_file_duration();
 
-        std::shared_ptr<rosbag2_storage_plugins::SqliteStorage> as_sqlite_storage();
+        // Neither backend has seek() in the storage interface
+        void seek_storage(const nanoseconds& time);
 
         virtual device_snapshot read_device_description(const nanoseconds& time, bool reset = false) = 0;
 
@@ -11,7 +11,9 @@
 #include "proc/hdr-merge.h"
 #include "proc/sequence-id-filter.h"
 #include "ros2_writer.h"
+#include "mcap_storage.h"
 #include <zstd.h>
+#include <rsutils/codec/depth-codec.h>
 #include "media/ros_factory.h"
 #include "core/motion-frame.h"
 #include <sstream>
@@ -33,13 +35,23 @@ namespace librealsense
     static std::string strip_db3_extension(const std::string& file)
     {
         if (!is_db3_file(file))
-            throw std::runtime_error("Output file must have .db3 extension: '" + file + "'");
+            throw std::runtime_error("Output file must have .db3 or .mcap extension: '" + file + "'");
         return file.substr(0, file.size() - 4);
     }
 
     ros2_writer::ros2_writer(const std::string& file, bool compress_while_record) : m_file_path(file)
     {
         LOG_INFO("Compression while record is set to " << (compress_while_record ? "ON" : "OFF"));
+        if (is_mcap_file(file))
+        {
+            // Whole chunks get compressed instead of each message, off the recording thread
+            _storage = std::make_shared< mcap_storage >(compress_while_record ? mcap_storage::compression::zstd
+                                                                              : mcap_storage::compression::none);
+            _storage->open(file, rosbag2_storage::storage_interfaces::IOFlag::READ_WRITE);
+            write_file_version();
+            return;
+        }
+
         _storage = std::make_shared< rosbag2_storage_plugins::SqliteStorage >();
 
         // rosbag2 sqlite plugin appends .db3 internally, so pass the stem
@@ -91,6 +103,22 @@ namespace librealsense
         return out;
     }
 
+    void ros2_writer::set_stream_codec(rs2_stream stream, int index, rs2_record_stream_codec codec)
+    {
+        std::lock_guard<std::mutex> lock(_stream_codecs_mutex);
+        if (codec == RS2_RECORD_STREAM_CODEC_DEFAULT)
+            _stream_codecs.erase({ stream, index });
+        else
+            _stream_codecs[{ stream, index }] = codec;
+    }
+
+    rs2_record_stream_codec ros2_writer::get_stream_codec(const stream_identifier& stream_id)
+    {
+        std::lock_guard<std::mutex> lock(_stream_codecs_mutex);
+        auto it = _stream_codecs.find({ stream_id.stream_type, int(stream_id.stream_index) });
+        return it == _stream_codecs.end() ? RS2_RECORD_STREAM_CODEC_DEFAULT : it->second;
+    }
+
     void ros2_writer::write_string(std::string const& topic, const nanoseconds& ts, std::string const& payload)
     {
         write_message(topic, "std_msgs/msg/String", ts, cdr_string{ payload });
@@ -150,15 +178,30 @@ namespace librealsense
             img.height(vid_frame->get_height());
             img.step(vid_frame->get_stride());
 
+            auto format = vid_frame->get_stream()->get_format();
             std::string encoding;
-            convert(vid_frame->get_stream()->get_format(), encoding);
-            img.encoding(std::move(encoding));
+            convert(format, encoding);
 
-            auto data_size = vid_frame->get_stride() * vid_frame->get_height();
             auto raw = vid_frame->get_frame_data();
-            img.data(std::vector<uint8_t>(raw, raw + data_size));
-
-            write_message(ros2_topic::frame_data_topic(stream_id), "sensor_msgs/msg/Image", timestamp, img);
+            if (format == RS2_FORMAT_Z16 && get_stream_codec(stream_id) == RS2_RECORD_STREAM_CODEC_DEPTH_LOSSLESS)
+            {
+                auto width = uint32_t(vid_frame->get_width());
+                auto height = uint32_t(vid_frame->get_height());
+                _depth_codec_buf.resize(rsutils::codec::depth_encode_bound(width, height));
+                auto size = rsutils::codec::depth_encode(reinterpret_cast<const uint16_t*>(raw), width, height,
+                                                         vid_frame->get_stride(), _depth_codec_buf.data());
+                img.step(width * 2);  // decoded images are packed
+                img.encoding(encoding + DEPTH_CODEC_ENCODING_SUFFIX);
+                img.data(std::vector<uint8_t>(_depth_codec_buf.begin(), _depth_codec_buf.begin() + size));
+                write_message(ros2_topic::frame_data_topic(stream_id), "sensor_msgs/msg/Image", timestamp, img, false);
+            }
+            else
+            {
+                img.encoding(std::move(encoding));
+                auto data_size = vid_frame->get_stride() * vid_frame->get_height();
+                img.data(std::vector<uint8_t>(raw, raw + data_size));
+                write_message(ros2_topic::frame_data_topic(stream_id), "sensor_msgs/msg/Image", timestamp, img);
+            }
         }
         else if (Is<motion_frame>(frame.frame))
         {
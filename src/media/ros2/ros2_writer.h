@@ -6,6 +6,8 @@
 #include <rosbag2_storage/topic_metadata.hpp>
 #include <rosbag2_storage_default_plugins/sqlite/sqlite_storage.hpp>
 
+#include <mutex>
+
 #include "ros2_file_format.h"
 
 
@@ -26,6 +28,7 @@ namespace librealsense
         void write_snapshot(uint32_t device_index, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) override;
         void write_snapshot(const sensor_identifier& sensor_id, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) override;
         const std::string& get_file_name() const override;
+        void set_stream_codec(rs2_stream stream, int index, rs2_record_stream_codec codec) override;
 
     private:
         void write_file_version();
@@ -64,8 +67,10 @@ namespace librealsense
         // CDR encapsulation header: 2 bytes representation identifier + 2 bytes options
         static constexpr size_t CDR_HEADER_SIZE = 4;
 
+        // Already-compressed data (compress == false) isn't compressed again
         template<typename T>
-        void write_message(const std::string& topic, const std::string& msg_type, const nanoseconds& timestamp, const T& data)
+        void write_message(const std::string& topic, const std::string& msg_type, const nanoseconds& timestamp, const T& data,
+                           bool compress = true)
         {
             // Serialize into reusable CDR buffer — avoids per-message malloc on the hot path
             auto total_size = T::getCdrSerializedSize(data) + CDR_HEADER_SIZE;
@@ -79,21 +84,25 @@ namespace librealsense
             // Write to storage
             ensure_topic(topic, msg_type);
             auto msg = std::make_shared<rosbag2_storage::SerializedBagMessage>();
-            msg->serialized_data = _compress ? compress_buffer(buffer) : buffer;
+            msg->serialized_data = _compress && compress ? compress_buffer(buffer) : buffer;
             msg->time_stamp = static_cast<rcutils_time_point_value_t>(timestamp.count());
             msg->topic_name = topic;
             _storage->write(msg);
         }
 
         std::shared_ptr<rcutils_uint8_array_t> compress_buffer(const std::shared_ptr<rcutils_uint8_array_t>& input);
+        rs2_record_stream_codec get_stream_codec(const stream_identifier& stream_id);
 
         static uint8_t is_big_endian();
         std::string m_file_path;
         bool _compress = false;
         // Reused across calls. Safe only while _storage->write() stays synchronous
-        // (sqlite binds SQLITE_STATIC and drops the ref in execute_and_reset).
+        // (sqlite binds SQLITE_STATIC and drops the ref in execute_and_reset; mcap copies into its chunk).
         std::shared_ptr<rcutils_uint8_array_t> _cdr_buf;
         std::shared_ptr<rcutils_uint8_array_t> _compress_buf;
+        std::vector<uint8_t> _depth_codec_buf;
+        std::mutex _stream_codecs_mutex;
+        std::map<std::pair<rs2_stream, int>, rs2_record_stream_codec> _stream_codecs;  // those not default
         std::map< std::string, rosbag2_storage::TopicMetadata > _topics; // created topics cache
         std::shared_ptr< rosbag2_storage::storage_interfaces::ReadWriteInterface > _storage;
         std::map<uint32_t, std::set<rs2_option>> m_written_options_descriptions;
@@ -11,7 +11,6 @@
 #include "ros2/ros2_writer.h"
 #include "ros2/ros2_file_format.h"
 #include "rcutils/logging.h"
-#include <rosbag2_storage_default_plugins/sqlite/sqlite_storage.hpp>
 #endif
 
 namespace librealsense
@@ -41,25 +40,32 @@ namespace librealsense
         return filename.substr(filename.size() - 4) == ".db3";
     }
 
+    bool is_mcap_file(const std::string& filename)
+    {
+        if (filename.size() < 5)
+            return false;
+        return filename.substr(filename.size() - 5) == ".mcap";
+    }
+
 #ifdef BUILD_ROSBAG2
     // ros2_writer always emits /file_version first; anything else is a native ROS2 bag.
     static bool is_native_ros2_format(const std::string& filename)
     {
-        auto storage = std::make_shared<rosbag2_storage_plugins::SqliteStorage>();
+        std::shared_ptr<rosbag2_storage::storage_interfaces::ReadWriteInterface> storage;
         try
         {
-            storage->open(filename, rosbag2_storage::storage_interfaces::IOFlag::READ_ONLY);
+            storage = ros2_reader_base::open_storage(filename);
         }
         catch (const std::exception& e)
         {
             throw invalid_value_exception(rsutils::string::from()
-                << "Failed to open .db3 file '" << filename << "': " << e.what());
+                << "Failed to open '" << filename << "': " << e.what());
         }
         if (!storage->has_next()) return true;
         auto msg = storage->read_next();
         if (!msg)
             throw invalid_value_exception(rsutils::string::from()
-                << "Corrupt .db3 file '" << filename << "': storage claimed has_next() but read_next() returned null");
+                << "Corrupt file '" << filename << "': storage claimed has_next() but read_next() returned null");
         return msg->topic_name != ros2_topic::file_version_topic();
     }
 #endif
@@ -67,7 +73,7 @@ namespace librealsense
     std::shared_ptr<device_serializer::reader> create_reader_for_file(
         const std::string& filename, const std::shared_ptr<context>& ctx)
     {
-        if (is_db3_file(filename))
+        if (is_db3_file(filename) || is_mcap_file(filename))
         {
 #ifdef BUILD_ROSBAG2
             rcutils_logging_set_output_handler(rcutils_to_librealsense_log);
@@ -75,7 +81,7 @@ namespace librealsense
                 return std::make_shared<ros2_native_reader>(filename, ctx);
             return std::make_shared<ros2_reader>(filename, ctx);
 #else
-            throw invalid_value_exception("Cannot open .db3 files without BUILD_ROSBAG2");
+            throw invalid_value_exception("Cannot open .db3 or .mcap files without BUILD_ROSBAG2");
 #endif
         }
         return std::make_shared<ros_reader>(filename, ctx);
@@ -88,8 +94,8 @@ namespace librealsense
         rcutils_logging_set_output_handler(rcutils_to_librealsense_log);
         return std::make_shared<ros2_writer>(file, compress);
 #else
-        if (is_db3_file(file))
-            throw invalid_value_exception("Cannot record to .db3 without BUILD_ROSBAG2");
+        if (is_db3_file(file) || is_mcap_file(file))
+            throw invalid_value_exception("Cannot record to .db3 or .mcap without BUILD_ROSBAG2");
         return std::make_shared<ros_writer>(file, compress);
 #endif
     }
@@ -12,13 +12,14 @@ namespace librealsense
     class context;
 
     bool is_db3_file(const std::string& filename);
+    bool is_mcap_file(const std::string& filename);
 
-    // Dispatches to ros_reader or ros2_reader based on file extension (.db3 → ROS2, everything else → ROS1)
+    // Dispatches to ros_reader or ros2_reader based on file extension (.db3 or .mcap → ROS2, everything else → ROS1)
     std::shared_ptr<device_serializer::reader> create_reader_for_file(
         const std::string& filename, const std::shared_ptr<context>& ctx);
 
-    // With BUILD_ROSBAG2: always ros2_writer (requires .db3 extension)
-    // Without BUILD_ROSBAG2: ros_writer (rejects .db3)
+    // With BUILD_ROSBAG2: always ros2_writer (requires .db3 or .mcap extension)
+    // Without BUILD_ROSBAG2: ros_writer (rejects .db3 and .mcap)
     std::shared_ptr<device_serializer::writer> create_writer_for_file(
         const std::string& file, bool compress);
 }
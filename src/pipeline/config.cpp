@@ -66,6 +66,18 @@ namespace librealsense
             _device_request.record_output = file;
         }
 
+        void config::set_frame_allocator(std::shared_ptr<frame_allocator> allocator)
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            _frame_allocator = std::move(allocator);
+        }
+
+        std::shared_ptr<frame_allocator> config::get_frame_allocator() const
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            return _frame_allocator;
+        }
+
         std::shared_ptr<profile> config::get_cached_resolved_profile()
         {
             std::lock_guard<std::mutex> lock(_mtx);
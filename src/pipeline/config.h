@@ -24,6 +24,8 @@ namespace librealsense
             void enable_device(const std::string& serial);
             void enable_device_from_file(const std::string& file, bool repeat_playback);
             void enable_record_to_file(const std::string& file);
+            void set_frame_allocator(std::shared_ptr<frame_allocator> allocator);
+            std::shared_ptr<frame_allocator> get_frame_allocator() const;
             void disable_stream(rs2_stream stream, int index = -1);
             void disable_all_streams();
             std::shared_ptr<profile> resolve(std::shared_ptr<pipeline> pipe, const std::chrono::milliseconds& timeout = std::chrono::milliseconds(0));
@@ -41,6 +43,7 @@ namespace librealsense
                 _enable_all_streams = other._enable_all_streams;
                 _resolved_profile = nullptr;
                 _playback_loop = other._playback_loop;
+                _frame_allocator = other._frame_allocator;
             }
         private:
             struct device_request
@@ -62,6 +65,7 @@ namespace librealsense
             std::shared_ptr<profile> _resolved_profile;
             bool _playback_loop = false;
             std::vector<std::pair<rs2_stream, int>> _streams_to_disable;
+            std::shared_ptr<frame_allocator> _frame_allocator;
         };
     }
 }
@@ -103,6 +103,11 @@ namespace librealsense
             if (!profile->_multistream.get_profiles().size())
                 throw librealsense::wrong_api_call_sequence_exception("No streams are selected!");
 
+            // Played-back frames are not allocated by us
+            auto allocator = conf->get_frame_allocator();
+            if (allocator && !Is<librealsense::playback_device>(profile->get_device()))
+                profile->_multistream.set_frame_allocator(allocator);
+
             auto synced_streams_ids = on_start(profile);
 
             rs2_frame_callback_sptr callbacks = get_callback(synced_streams_ids);
@@ -176,6 +176,12 @@ namespace librealsense
                         sensor.second->stop();
                 }
 
+                void set_frame_allocator(std::shared_ptr<frame_allocator> const & allocator)
+                {
+                    for (auto&& sensor : _results)
+                        sensor.second->set_frame_allocator(allocator);
+                }
+
                 void close()
                 {
                     for (auto&& sensor : _results)
@@ -20,6 +20,7 @@ struct frame_object
     const void * pixels;
     const void * metadata;
     rs2_time_t backend_time;
+    int dmabuf_fd = -1;  // the pixels' buffer exported as a DMABUF, valid until the continuation is called
 };
 
 
@@ -41,6 +41,16 @@ struct hid_mipi_data_32
     uint64_t hwTs2;
     uint64_t skip2;
 };
+
+
+// A sample in a batched raw motion frame (see hid_sensor): the same size as the rs2_motion_sample it is converted to
+struct hid_batch_sample
+{
+    hid_data data;
+    uint32_t reserved;
+    double timestamp;
+    uint64_t frame_number;
+};
 #pragma pack( pop )
 
 
@@ -39,6 +39,7 @@ struct sensor_data
 {
     hid_sensor sensor;
     frame_object fo;
+    uint32_t more_in_read = 0;  // samples that follow from the same read, for the receiver to batch them
 };
 
 #pragma pack( push, 1 )
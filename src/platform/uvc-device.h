@@ -81,6 +81,16 @@ constexpr uint8_t uvc_header_mipi_size = sizeof( uvc_header_mipi );
 typedef std::function< void( stream_profile, frame_object, std::function< void() > ) > frame_callback;
 
 
+// Where a uvc_device captures frames into; see uvc_device::set_capture_memory()
+struct capture_memory
+{
+    // Export each capture buffer as a DMABUF and pass its file descriptor in frame_object::dmabuf_fd
+    bool export_dmabuf = false;
+    // If set, capture directly into memory obtained from here rather than into memory the backend allocates
+    std::function< std::shared_ptr< uint8_t >( size_t size ) > allocate;
+};
+
+
 struct control_range
 {
     control_range() {}
@@ -147,6 +157,13 @@ public:
 
     virtual bool is_platform_jetson() const = 0;
 
+    // True if the frame data passed to the frame callback remains valid, and its buffer is not reused, until the
+    // continuation is called - so a frame can wrap it instead of copying it
+    virtual bool supports_zero_copy() const { return false; }
+
+    // Applies to the streams committed from now on; ignored by backends that support neither
+    virtual void set_capture_memory( capture_memory const & ) {}
+
     virtual ~uvc_device() = default;
 
 protected:
@@ -251,6 +268,10 @@ public:
 
     bool is_platform_jetson() const override { return _dev->is_platform_jetson(); }
 
+    bool supports_zero_copy() const override { return _dev->supports_zero_copy(); }
+
+    void set_capture_memory( capture_memory const & memory ) override { _dev->set_capture_memory( memory ); }
+
 private:
     std::shared_ptr< uvc_device > _dev;
 };
@@ -401,6 +422,20 @@ public:
         return false;
     }
 
+    bool supports_zero_copy() const override
+    {
+        for( auto & elem : _dev )
+            if( ! elem->supports_zero_copy() )
+                return false;
+        return ! _dev.empty();
+    }
+
+    void set_capture_memory( capture_memory const & memory ) override
+    {
+        for( auto & elem : _dev )
+            elem->set_capture_memory( memory );
+    }
+
 private:
     // Width of the pin_index range reserved per sub-device = (max native pin index across all sub-devices) + 1.
     // Computed lazily (not at construction): get_profiles() requires the device to be powered to D0, which is not
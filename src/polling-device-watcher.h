@@ -6,6 +6,7 @@
 #include "backend.h"
 #include "platform/device-watcher.h"
 #include <rsutils/concurrency/concurrency.h>
+#include <rsutils/concurrency/timer-service.h>
 #include "callback-invocation.h"
 
 
@@ -19,7 +20,9 @@ class polling_device_watcher : public librealsense::platform::device_watcher
 public:
     polling_device_watcher( const platform::backend * backend_ref )
         : _backend( backend_ref )
-        , _active_object( [this]( dispatcher::cancellable_timer cancellable_timer ) { polling( cancellable_timer ); } )
+        , _active_object( "device watcher",
+                          std::chrono::milliseconds( POLLING_DEVICES_INTERVAL_MS ),
+                          [this]() { polling(); } )
         , _devices_data()
     {
         _devices_data = { _backend->query_uvc_devices(), _backend->query_usb_devices(), _backend->query_hid_devices() };
@@ -27,23 +30,20 @@ public:
 
     ~polling_device_watcher() { stop(); }
 
-    void polling( dispatcher::cancellable_timer cancellable_timer )
+    void polling()
     {
-        if( cancellable_timer.try_sleep( std::chrono::milliseconds( POLLING_DEVICES_INTERVAL_MS ) ) )
+        platform::backend_device_group curr( _backend->query_uvc_devices(),
+                                             _backend->query_usb_devices(),
+                                             _backend->query_hid_devices() );
+        if( list_changed( _devices_data.uvc_devices, curr.uvc_devices )
+            || list_changed( _devices_data.usb_devices, curr.usb_devices )
+            || list_changed( _devices_data.hid_devices, curr.hid_devices ) )
         {
-            platform::backend_device_group curr( _backend->query_uvc_devices(),
-                                                 _backend->query_usb_devices(),
-                                                 _backend->query_hid_devices() );
-            if( list_changed( _devices_data.uvc_devices, curr.uvc_devices )
-                || list_changed( _devices_data.usb_devices, curr.usb_devices )
-                || list_changed( _devices_data.hid_devices, curr.hid_devices ) )
+            callback_invocation_holder callback = { _callback_inflight.allocate(), &_callback_inflight };
+            if( callback )
             {
-                callback_invocation_holder callback = { _callback_inflight.allocate(), &_callback_inflight };
-                if( callback )
-                {
-                    _callback( _devices_data, curr );
-                    _devices_data = curr;
-                }
+                _callback( _devices_data, curr );
+                _devices_data = curr;
             }
         }
     }
@@ -65,7 +65,7 @@ public:
     bool is_stopped() const override { return ! _active_object.is_active(); }
 
 private:
-    active_object<> _active_object;
+    rsutils::concurrency::periodic_task _active_object;
 
     callbacks_heap _callback_inflight;
     const platform::backend * _backend;
@@ -3,6 +3,7 @@
 
 #include <librealsense2/hpp/rs_sensor.hpp>
 #include <librealsense2/hpp/rs_processing.hpp>
+#include <librealsense2/hpp/rs_device.hpp>
 
 #include "core/video.h"
 #include "core/depth-frame.h"
@@ -10,6 +11,9 @@
 #include "environment.h"
 #include "align.h"
 #include "stream.h"
+#include "device.h"
+#include "device-calibration.h"
+#include "core/sensor-interface.h"
 #include <rsutils/easylogging/easyloggingpp.h>
 
 #if defined(RS2_USE_CUDA)
@@ -20,6 +24,7 @@
 #include "proc/sse/sse-align.h"
 #endif
 #include "proc/neon/neon-align.h"
+#include "proc/avx/avx-align.h"
 
 namespace librealsense
 {
@@ -34,6 +39,11 @@ namespace librealsense
             return std::make_shared<librealsense::align_cuda>(align_to);
         }
         #endif
+        if (align_avx::is_supported())
+        {
+            LOG_INFO("Using AVX-optimized align implementation");
+            return std::make_shared<librealsense::align_avx>(align_to);
+        }
         #if defined(__SSSE3__)
             LOG_INFO("Using SSE-optimized align implementation");
             return std::make_shared<librealsense::align_sse>(align_to);
@@ -46,10 +56,16 @@ namespace librealsense
         #endif
     }
 
+    // Deprojection is linear in the depth, so a corner at some depth is the ray through it scaled by that depth. The
+    // rays (see align::pre_compute_rays) already include the rotation to the other stream: only the translation and
+    // the projection are left per frame.
     template<class GET_DEPTH, class TRANSFER_PIXEL>
     void align_images(const rs2_intrinsics& depth_intrin, const rs2_extrinsics& depth_to_other,
-        const rs2_intrinsics& other_intrin, GET_DEPTH get_depth, TRANSFER_PIXEL transfer_pixel)
+        const rs2_intrinsics& other_intrin, const float3* top_left_rays, const float3* bottom_right_rays,
+        GET_DEPTH get_depth, TRANSFER_PIXEL transfer_pixel)
     {
+        const float3 translation = { depth_to_other.translation[0], depth_to_other.translation[1], depth_to_other.translation[2] };
+
         // Iterate over the pixels of the depth image
 #pragma omp parallel for schedule(dynamic)
         for (int depth_y = 0; depth_y < depth_intrin.height; ++depth_y)
@@ -61,18 +77,15 @@ namespace librealsense
                 if (float depth = get_depth(depth_pixel_index))
                 {
                     // Map the top-left corner of the depth pixel onto the other image
-                    float depth_pixel[2] = { depth_x - 0.5f, depth_y - 0.5f }, depth_point[3], other_point[3], other_pixel[2];
-                    rs2_deproject_pixel_to_point(depth_point, &depth_intrin, depth_pixel, depth);
-                    rs2_transform_point_to_point(other_point, &depth_to_other, depth_point);
-                    rs2_project_point_to_pixel(other_pixel, &other_intrin, other_point);
+                    float3 other_point = top_left_rays[depth_pixel_index] * depth + translation;
+                    float other_pixel[2];
+                    rs2_project_point_to_pixel(other_pixel, &other_intrin, &other_point.x);
                     const int other_x0 = static_cast<int>(other_pixel[0] + 0.5f);
                     const int other_y0 = static_cast<int>(other_pixel[1] + 0.5f);
 
                     // Map the bottom-right corner of the depth pixel onto the other image
-                    depth_pixel[0] = depth_x + 0.5f; depth_pixel[1] = depth_y + 0.5f;
-                    rs2_deproject_pixel_to_point(depth_point, &depth_intrin, depth_pixel, depth);
-                    rs2_transform_point_to_point(other_point, &depth_to_other, depth_point);
-                    rs2_project_point_to_pixel(other_pixel, &other_intrin, other_point);
+                    other_point = bottom_right_rays[depth_pixel_index] * depth + translation;
+                    rs2_project_point_to_pixel(other_pixel, &other_intrin, &other_point.x);
                     const int other_x1 = static_cast<int>(other_pixel[0] + 0.5f);
                     const int other_y1 = static_cast<int>(other_pixel[1] + 0.5f);
 
@@ -95,6 +108,75 @@ namespace librealsense
     align::align(rs2_stream to_stream) : align(to_stream, "Align")
     {}
 
+    void align::reset_cache(rs2_stream from, rs2_stream to)
+    {
+        // Either way, the rays go from depth into the other stream
+        auto const other = from == RS2_STREAM_DEPTH ? to : from;
+        for (auto it = _rays.begin(); it != _rays.end();)
+        {
+            if (it->second->other == other)
+                it = _rays.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    // A frameset has a few streams to align at most: more pairs than that are of profiles no longer streaming
+    static const size_t MAX_RAY_CACHES = 4;
+
+    align::rays& align::pre_compute_rays(const rs2::stream_profile& depth, const rs2::stream_profile& other,
+        const rs2_intrinsics& depth_intrin, const rs2_extrinsics& depth_to_other, bool* computed)
+    {
+        auto const key = std::make_pair(depth.unique_id(), other.unique_id());
+        auto it = _rays.find(key);
+        if (it == _rays.end())
+        {
+            if (_rays.size() >= MAX_RAY_CACHES)
+                _rays.clear();
+            it = _rays.emplace(key, make_rays()).first;
+        }
+        // The profiles and the calibration can change under us; the rays are kept as long as what they were computed
+        // from stays the same
+        else if (!memcmp(&it->second->depth_intrin, &depth_intrin, sizeof(depth_intrin))
+            && !memcmp(it->second->depth_to_other.rotation, depth_to_other.rotation, sizeof(depth_to_other.rotation)))
+        {
+            if (computed)
+                *computed = false;
+            return *it->second;
+        }
+
+        auto& r = *it->second;
+        r.other = other.stream_type();
+        r.depth_intrin = depth_intrin;
+        r.depth_to_other = depth_to_other;
+        r.top_left.resize(size_t(depth_intrin.width) * depth_intrin.height);
+        r.bottom_right.resize(r.top_left.size());
+
+        const rs2_extrinsics rotation = { { depth_to_other.rotation[0], depth_to_other.rotation[1], depth_to_other.rotation[2],
+                                            depth_to_other.rotation[3], depth_to_other.rotation[4], depth_to_other.rotation[5],
+                                            depth_to_other.rotation[6], depth_to_other.rotation[7], depth_to_other.rotation[8] },
+                                          { 0, 0, 0 } };
+        auto ray = [&](float3& out, float x, float y)
+        {
+            const float pixel[] = { x, y };
+            float point[3];
+            rs2_deproject_pixel_to_point(point, &depth_intrin, pixel, 1.f);
+            rs2_transform_point_to_point(&out.x, &rotation, point);
+        };
+        for (int y = 0; y < depth_intrin.height; ++y)
+        {
+            for (int x = 0; x < depth_intrin.width; ++x)
+            {
+                auto i = size_t(y) * depth_intrin.width + x;
+                ray(r.top_left[i], x - 0.5f, y - 0.5f);
+                ray(r.bottom_right[i], x + 0.5f, y + 0.5f);
+            }
+        }
+        if (computed)
+            *computed = true;
+        return r;
+    }
+
     void align::align_z_to_other(rs2::video_frame& aligned, 
         const rs2::video_frame& depth, const rs2::video_stream_profile& other_profile, float z_scale)
     {
@@ -111,7 +193,8 @@ namespace librealsense
         auto z_pixels = reinterpret_cast<const uint16_t*>(depth.get_data());
         auto out_z = (uint16_t *)(aligned_data);
 
-        align_images(z_intrin, z_to_other, other_intrin,
+        auto& rays = pre_compute_rays(depth_profile, other_profile, z_intrin, z_to_other);
+        align_images(z_intrin, z_to_other, other_intrin, rays.top_left.data(), rays.bottom_right.data(),
             [z_pixels, z_scale](int z_pixel_index) { return z_scale * z_pixels[z_pixel_index]; },
             [out_z, z_pixels](int z_pixel_index, int other_pixel_index)
         {
@@ -122,33 +205,33 @@ namespace librealsense
     }
 
     template<int N, class GET_DEPTH>
-    void align_other_to_depth_bytes( uint8_t * other_aligned_to_depth, GET_DEPTH get_depth, const rs2_intrinsics& depth_intrin, const rs2_extrinsics& depth_to_other, const rs2_intrinsics& other_intrin, const uint8_t * other_pixels)
+    void align_other_to_depth_bytes( uint8_t * other_aligned_to_depth, GET_DEPTH get_depth, const rs2_intrinsics& depth_intrin, const rs2_extrinsics& depth_to_other, const rs2_intrinsics& other_intrin, const float3* top_left_rays, const float3* bottom_right_rays, const uint8_t * other_pixels)
     {
         auto in_other = (const bytes<N> *)(other_pixels);
         auto out_other = (bytes<N> *)(other_aligned_to_depth);
-        align_images(depth_intrin, depth_to_other, other_intrin, get_depth,
+        align_images(depth_intrin, depth_to_other, other_intrin, top_left_rays, bottom_right_rays, get_depth,
             [out_other, in_other](int depth_pixel_index, int other_pixel_index) { out_other[depth_pixel_index] = in_other[other_pixel_index]; });
     }
 
     template<class GET_DEPTH>
-    void align_other_to_depth( uint8_t * other_aligned_to_depth, GET_DEPTH get_depth, const rs2_intrinsics& depth_intrin, const rs2_extrinsics & depth_to_other, const rs2_intrinsics& other_intrin, const uint8_t * other_pixels, rs2_format other_format)
+    void align_other_to_depth( uint8_t * other_aligned_to_depth, GET_DEPTH get_depth, const rs2_intrinsics& depth_intrin, const rs2_extrinsics & depth_to_other, const rs2_intrinsics& other_intrin, const float3* top_left_rays, const float3* bottom_right_rays, const uint8_t * other_pixels, rs2_format other_format)
     {
         switch (other_format)
         {
         case RS2_FORMAT_Y8:
-            align_other_to_depth_bytes<1>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
+            align_other_to_depth_bytes<1>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, top_left_rays, bottom_right_rays, other_pixels);
             break;
         case RS2_FORMAT_Y16:
         case RS2_FORMAT_Z16:
-            align_other_to_depth_bytes<2>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
+            align_other_to_depth_bytes<2>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, top_left_rays, bottom_right_rays, other_pixels);
             break;
         case RS2_FORMAT_RGB8:
         case RS2_FORMAT_BGR8:
-            align_other_to_depth_bytes<3>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
+            align_other_to_depth_bytes<3>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, top_left_rays, bottom_right_rays, other_pixels);
             break;
         case RS2_FORMAT_RGBA8:
         case RS2_FORMAT_BGRA8:
-            align_other_to_depth_bytes<4>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, other_pixels);
+            align_other_to_depth_bytes<4>(other_aligned_to_depth, get_depth, depth_intrin, depth_to_other, other_intrin, top_left_rays, bottom_right_rays, other_pixels);
             break;
         default:
             assert(false); // NOTE: rs2_align_other_to_depth_bytes<2>(...) is not appropriate for RS2_FORMAT_YUYV/RS2_FORMAT_RAW10 images, no logic prevents U/V channels from being written to one another
@@ -171,8 +254,9 @@ namespace librealsense
         auto z_pixels = reinterpret_cast<const uint16_t*>(depth.get_data());
         auto other_pixels = reinterpret_cast<const uint8_t *>(other.get_data());
 
+        auto& rays = pre_compute_rays(depth_profile, other_profile, z_intrin, z_to_other);
         align_other_to_depth(aligned_data, [z_pixels, z_scale](int z_pixel_index) { return z_scale * z_pixels[z_pixel_index]; },
-            z_intrin, z_to_other, other_intrin, other_pixels, other_profile.format());
+            z_intrin, z_to_other, other_intrin, rays.top_left.data(), rays.bottom_right.data(), other_pixels, other_profile.format());
     }
 
     std::shared_ptr<rs2::video_stream_profile> align::create_aligned_profile(
@@ -278,6 +362,40 @@ namespace librealsense
         }
     }
 
+    void align::register_calibration_change(const rs2::frame& depth)
+    {
+        if (_registered_calib_cb)
+            return;
+
+        auto sensor = ((frame_interface*)depth.get())->get_sensor();
+        if (!sensor)
+            return;
+
+        // The callback may outlive us: it only does anything while this (non-owning) pointer is alive
+        _registered_calib_cb = std::shared_ptr<align>(this, [](align*) {});
+        try
+        {
+            auto dev = sensor->get_device().shared_from_this();
+            if (auto d2r = dynamic_cast<calibration_change_device*>(dev.get()))
+            {
+                std::weak_ptr<align> wr{ _registered_calib_cb };
+                auto fn = [wr](rs2_calibration_status status)
+                {
+                    auto r = wr.lock();
+                    if (r && status == RS2_CALIBRATION_SUCCESSFUL)
+                        r->on_calibration_change();
+                };
+                typedef rs2::calibration_change_callback<decltype(fn)> callback;
+                d2r->register_calibration_change_callback(
+                    { new callback(std::move(fn)), [](rs2_calibration_change_callback* p) { p->release(); } });
+            }
+        }
+        catch (const std::bad_weak_ptr&)
+        {
+            LOG_WARNING("Device destroyed");
+        }
+    }
+
     rs2::frame align::process_frame(const rs2::frame_source& source, const rs2::frame& f)
     {
         rs2::frame rv;
@@ -287,6 +405,8 @@ namespace librealsense
         auto frames = f.as<rs2::frameset>();
         auto depth = frames.first_or_default(RS2_STREAM_DEPTH, RS2_FORMAT_Z16).as<rs2::depth_frame>();
 
+        register_calibration_change(depth);
+
         _depth_scale = ((librealsense::depth_frame*)depth.get())->get_units();
 
         if (_to_stream_type == RS2_STREAM_DEPTH)
@@ -294,6 +414,17 @@ namespace librealsense
         else
             frames.foreach_rs([this, &other_frames](const rs2::frame& f) {if (f.get_profile().stream_type() == _to_stream_type) other_frames.push_back(f); });
 
+        // Whatever was precomputed from the old calibration is recomputed (here, where it's used) from the new one,
+        // for each pair of streams we align, in the direction we align them
+        if (_calibration_changed.exchange(false))
+        {
+            if (_to_stream_type == RS2_STREAM_DEPTH)
+                for (auto& from : other_frames)
+                    reset_cache(from.get_profile().stream_type(), RS2_STREAM_DEPTH);
+            else
+                reset_cache(RS2_STREAM_DEPTH, _to_stream_type);
+        }
+
         if (_to_stream_type == RS2_STREAM_DEPTH)
         {
             for (auto from : other_frames)
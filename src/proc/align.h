@@ -5,8 +5,12 @@
 #include "synthetic-stream.h"
 
 #include <src/basics.h>
+#include <src/float3.h>
+#include <atomic>
 #include <map>
+#include <memory>
 #include <utility>
+#include <vector>
 
 
 namespace librealsense
@@ -20,13 +24,17 @@ namespace librealsense
     protected:
         align(rs2_stream to_stream, const char* name)
             : generic_processing_block(name),
-              _to_stream_type(to_stream), _depth_scale(0)
+              _to_stream_type(to_stream), _depth_scale(0), _calibration_changed(false)
         {}
 
         bool should_process(const rs2::frame& frame) override;
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
 
-        virtual void reset_cache(rs2_stream from, rs2_stream to) {}
+        // Drops whatever was precomputed for the streams, which are about to change or have a new calibration
+        virtual void reset_cache(rs2_stream from, rs2_stream to);
+
+        // The device has a new calibration: the next frame resets the caches before it's aligned
+        void on_calibration_change() { _calibration_changed = true; }
 
         virtual void align_z_to_other(rs2::video_frame& aligned, 
                                       const rs2::video_frame& depth, 
@@ -49,8 +57,35 @@ namespace librealsense
         rs2::stream_profile _source_stream_profile;
         float _depth_scale;
 
+        // Per depth pixel, the points at a depth of 1 under its top-left and bottom-right corners, rotated into the
+        // other stream's coordinates: a frame then only needs to scale them by the depth and project them
+        struct rays
+        {
+            virtual ~rays() = default;
+
+            rs2_stream other;  // the stream they're rotated into
+            rs2_intrinsics depth_intrin;
+            rs2_extrinsics depth_to_other;
+            std::vector<float3> top_left, bottom_right;
+        };
+
+        // The rays from a depth profile into another, kept for each pair of profiles a frameset has (e.g., color and
+        // infrared aligned to depth). Sets 'computed' if they had to be computed again.
+        rays& pre_compute_rays(const rs2::stream_profile& depth, const rs2::stream_profile& other,
+            const rs2_intrinsics& depth_intrin, const rs2_extrinsics& depth_to_other, bool* computed = nullptr);
+
+        // A new, empty entry in the rays cache: implementations can keep what they derive from the rays along with them
+        virtual std::unique_ptr<rays> make_rays() const { return std::unique_ptr<rays>(new rays); }
+
     private:
         rs2::video_frame allocate_aligned_frame(const rs2::frame_source& source, const rs2::video_frame& from, const rs2::video_frame& to);
         void align_frames(rs2::video_frame& aligned, const rs2::video_frame& from, const rs2::video_frame& to);
+        void register_calibration_change(const rs2::frame& depth);
+
+        // By the depth and other profiles' unique IDs
+        std::map<std::pair<int, int>, std::unique_ptr<rays>> _rays;
+
+        std::shared_ptr<align> _registered_calib_cb;
+        std::atomic<bool> _calibration_changed;
     };
 }
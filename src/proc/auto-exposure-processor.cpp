@@ -22,6 +22,7 @@ rs2::frame librealsense::auto_exposure_processor::process_frame(const rs2::frame
     // We dont actually modify the frame, only calculate and process the exposure values.
     auto&& fi = (frame_interface*)f.get();
     ((librealsense::frame*)fi)->additional_data.fisheye_ae_mode = true;
+    ((librealsense::frame*)fi)->additional_data.decoded_metadata.reset();
 
     fi->acquire();
     auto&& auto_exposure = _enable_ae_option.get_auto_exposure();
@@ -0,0 +1,156 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+// NOTE: this file is built with AVX2 code generation enabled, and so must not contain anything (inline functions,
+// templates from headers) that the linker could pick to share with the rest of the library!
+
+#include "avx-align-kernels.h"
+
+#if defined( __AVX2__ )
+#define LRS_AVX2_KERNELS
+#include "avx-projection.h"
+#endif
+
+
+namespace librealsense {
+namespace avx2 {
+
+
+#ifdef LRS_AVX2_KERNELS
+
+namespace {
+
+
+// Like static_cast< int >( v + 0.5f ) in the generic align
+inline __m256i round_pixel( __m256 v )
+{
+    return _mm256_cvttps_epi32( _mm256_add_ps( v, _mm256_set1_ps( 0.5f ) ) );
+}
+
+
+template< rs2_distortion dist >
+void project_corners_8( align_corners const & out,
+                        size_t i,
+                        const uint16_t * depth,
+                        align_corner_maps const & maps,
+                        __m256 scale,
+                        projection const & p )
+{
+    __m256i const d = _mm256_cvtepu16_epi32( _mm_loadu_si128( reinterpret_cast< const __m128i * >( depth + i ) ) );
+    __m256 const z = _mm256_mul_ps( _mm256_cvtepi32_ps( d ), scale );
+
+    __m256 px, py;
+    project< dist >( px, py,
+                     _mm256_add_ps( _mm256_mul_ps( _mm256_loadu_ps( maps.top_left_x + i ), z ), p.t[0] ),
+                     _mm256_add_ps( _mm256_mul_ps( _mm256_loadu_ps( maps.top_left_y + i ), z ), p.t[1] ),
+                     _mm256_add_ps( _mm256_mul_ps( _mm256_loadu_ps( maps.top_left_z + i ), z ), p.t[2] ),
+                     p );
+    _mm256_storeu_si256( reinterpret_cast< __m256i * >( out.x0 + i ), round_pixel( px ) );
+    _mm256_storeu_si256( reinterpret_cast< __m256i * >( out.y0 + i ), round_pixel( py ) );
+
+    project< dist >( px, py,
+                     _mm256_add_ps( _mm256_mul_ps( _mm256_loadu_ps( maps.bottom_right_x + i ), z ), p.t[0] ),
+                     _mm256_add_ps( _mm256_mul_ps( _mm256_loadu_ps( maps.bottom_right_y + i ), z ), p.t[1] ),
+                     _mm256_add_ps( _mm256_mul_ps( _mm256_loadu_ps( maps.bottom_right_z + i ), z ), p.t[2] ),
+                     p );
+    _mm256_storeu_si256( reinterpret_cast< __m256i * >( out.x1 + i ), round_pixel( px ) );
+    _mm256_storeu_si256( reinterpret_cast< __m256i * >( out.y1 + i ), round_pixel( py ) );
+}
+
+
+template< rs2_distortion dist >
+void project_corners( align_corners const & out,
+                      const uint16_t * depth,
+                      align_corner_maps const & maps,
+                      size_t count,
+                      float depth_scale,
+                      projection const & p )
+{
+    __m256 const scale = _mm256_set1_ps( depth_scale );
+
+    size_t i = 0;
+    for( ; i + 8 <= count; i += 8 )
+        project_corners_8< dist >( out, i, depth, maps, scale, p );
+
+    // Run the remainder through a padded copy, so it gets exactly the same math
+    if( i < count )
+    {
+        size_t const rest = count - i;
+        uint16_t d[8] = {};
+        float tlx[8] = {}, tly[8] = {}, tlz[8] = {}, brx[8] = {}, bry[8] = {}, brz[8] = {};
+        int32_t x0[8], y0[8], x1[8], y1[8];
+        for( size_t j = 0; j < rest; ++j )
+        {
+            d[j] = depth[i + j];
+            tlx[j] = maps.top_left_x[i + j];
+            tly[j] = maps.top_left_y[i + j];
+            tlz[j] = maps.top_left_z[i + j];
+            brx[j] = maps.bottom_right_x[i + j];
+            bry[j] = maps.bottom_right_y[i + j];
+            brz[j] = maps.bottom_right_z[i + j];
+        }
+        project_corners_8< dist >( { x0, y0, x1, y1 }, 0, d, { tlx, tly, tlz, brx, bry, brz }, scale, p );
+        for( size_t j = 0; j < rest; ++j )
+        {
+            out.x0[i + j] = x0[j];
+            out.y0[i + j] = y0[j];
+            out.x1[i + j] = x1[j];
+            out.y1[i + j] = y1[j];
+        }
+    }
+}
+
+
+}  // namespace
+
+
+bool align_kernels_available()
+{
+    return true;
+}
+
+
+void project_corners( align_corners const & out,
+                      const uint16_t * depth,
+                      align_corner_maps const & maps,
+                      size_t count,
+                      float depth_scale,
+                      const rs2_intrinsics & other,
+                      const rs2_extrinsics & extr )
+{
+    projection const p( other, extr );
+    switch( other.model )
+    {
+    case RS2_DISTORTION_MODIFIED_BROWN_CONRADY:
+        project_corners< RS2_DISTORTION_MODIFIED_BROWN_CONRADY >( out, depth, maps, count, depth_scale, p );
+        break;
+    case RS2_DISTORTION_INVERSE_BROWN_CONRADY:
+        project_corners< RS2_DISTORTION_INVERSE_BROWN_CONRADY >( out, depth, maps, count, depth_scale, p );
+        break;
+    case RS2_DISTORTION_BROWN_CONRADY:
+        project_corners< RS2_DISTORTION_BROWN_CONRADY >( out, depth, maps, count, depth_scale, p );
+        break;
+    default:
+        project_corners< RS2_DISTORTION_NONE >( out, depth, maps, count, depth_scale, p );
+        break;
+    }
+}
+
+
+#else  // ! LRS_AVX2_KERNELS
+
+bool align_kernels_available()
+{
+    return false;
+}
+
+void project_corners( align_corners const &, const uint16_t *, align_corner_maps const &, size_t, float,
+                      const rs2_intrinsics &, const rs2_extrinsics & )
+{
+}
+
+#endif
+
+
+}  // namespace avx2
+}  // namespace librealsense
@@ -0,0 +1,76 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/h/rs_types.h>
+#include <librealsense2/h/rs_sensor.h>
+
+#include <cstdint>
+#include <cstddef>
+
+
+namespace librealsense {
+
+
+// Per depth pixel, the point at a depth of 1 under its top-left and bottom-right corners, already rotated into the
+// other stream's coordinates (the rays of align::pre_compute_rays)
+struct align_corner_maps
+{
+    const float * top_left_x;
+    const float * top_left_y;
+    const float * top_left_z;
+    const float * bottom_right_x;
+    const float * bottom_right_y;
+    const float * bottom_right_z;
+};
+
+// Per depth pixel, the rectangle of pixels it covers on the other stream (inclusive, and possibly empty)
+struct align_corners
+{
+    int32_t * x0;
+    int32_t * y0;
+    int32_t * x1;
+    int32_t * y1;
+};
+
+
+// The align inner loops, each in a translation unit built for its instruction set. Callers must check
+// align_kernels_available() (the library may have been built without them) and the matching cpu_supports_*() first.
+// Buffers need not be aligned, and any number of pixels is handled.
+//
+// project_corners() maps 'count' depth pixels onto 'other' (whose model must be NONE or one of the Brown-Conrady
+// variants). Only the translation of 'extr' is left to apply to the maps. The math, and so the result, is exactly
+// that of the generic align. Pixels with no depth are left for the caller to skip.
+
+namespace avx2 {
+
+bool align_kernels_available();
+
+void project_corners( align_corners const & out,
+                      const uint16_t * depth,
+                      align_corner_maps const & maps,
+                      size_t count,
+                      float depth_scale,
+                      const rs2_intrinsics & other,
+                      const rs2_extrinsics & extr );
+
+}  // namespace avx2
+
+
+namespace avx512 {
+
+bool align_kernels_available();
+
+void project_corners( align_corners const & out,
+                      const uint16_t * depth,
+                      align_corner_maps const & maps,
+                      size_t count,
+                      float depth_scale,
+                      const rs2_intrinsics & other,
+                      const rs2_extrinsics & extr );
+
+}  // namespace avx512
+
+
+}  // namespace librealsense
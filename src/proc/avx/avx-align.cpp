@@ -0,0 +1,195 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "avx-align.h"
+#include "cpu-features.h"
+
+#include <librealsense2/hpp/rs_sensor.hpp>
+#include <librealsense2/hpp/rs_processing.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace librealsense
+{
+    template<int N> struct bytes { uint8_t b[N]; };
+
+    // The kernels project with these models; anything else is left to the generic implementation
+    static bool can_project_to(const rs2_intrinsics& other)
+    {
+        switch (other.model)
+        {
+        case RS2_DISTORTION_NONE:
+        case RS2_DISTORTION_MODIFIED_BROWN_CONRADY:
+        case RS2_DISTORTION_INVERSE_BROWN_CONRADY:
+        case RS2_DISTORTION_BROWN_CONRADY:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    align_avx::align_avx(rs2_stream to_stream)
+        : align_avx(to_stream, use_avx512())
+    {}
+
+    align_avx::align_avx(rs2_stream to_stream, bool avx512)
+        : align(to_stream, avx512 ? "Align (AVX-512)" : "Align (AVX2)")
+        , _project_corners(avx512 ? avx512::project_corners : avx2::project_corners)
+    {}
+
+    bool align_avx::is_supported()
+    {
+        return avx2::align_kernels_available() && cpu_supports_avx2();
+    }
+
+    bool align_avx::use_avx512()
+    {
+        return avx512::align_kernels_available() && cpu_supports_avx512();
+    }
+
+    align_avx::corner_rays& align_avx::pre_compute_corner_maps(const rs2::stream_profile& depth_profile,
+        const rs2::stream_profile& other_profile, const rs2_intrinsics& depth, const rs2_extrinsics& depth_to_other)
+    {
+        // The generic align's rays, split into one array per coordinate for the kernels, so the corners come out
+        // exactly the same as with the generic implementation
+        bool computed;
+        auto& rays = static_cast<corner_rays&>(pre_compute_rays(depth_profile, other_profile, depth, depth_to_other, &computed));
+        size_t const size = rays.top_left.size();
+
+        _x0.resize(depth.width);
+        _y0.resize(depth.width);
+        _x1.resize(depth.width);
+        _y1.resize(depth.width);
+
+        if (!computed)
+            return rays;
+
+        for (auto* map : { &rays.top_left_x, &rays.top_left_y, &rays.top_left_z,
+                           &rays.bottom_right_x, &rays.bottom_right_y, &rays.bottom_right_z })
+            map->resize(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            rays.top_left_x[i] = rays.top_left[i].x;
+            rays.top_left_y[i] = rays.top_left[i].y;
+            rays.top_left_z[i] = rays.top_left[i].z;
+            rays.bottom_right_x[i] = rays.bottom_right[i].x;
+            rays.bottom_right_y[i] = rays.bottom_right[i].y;
+            rays.bottom_right_z[i] = rays.bottom_right[i].z;
+        }
+        return rays;
+    }
+
+    template<class TRANSFER_PIXEL>
+    void align_avx::align_images(const corner_rays& rays, const uint16_t* z_pixels, float z_scale, const rs2_intrinsics& depth_intrin,
+        const rs2_extrinsics& depth_to_other, const rs2_intrinsics& other_intrin, TRANSFER_PIXEL transfer_pixel)
+    {
+        // A row at a time, so the corners are still in cache when the pixels are transferred
+        for (int depth_y = 0; depth_y < depth_intrin.height; ++depth_y)
+        {
+            int row = depth_y * depth_intrin.width;
+            _project_corners({ _x0.data(), _y0.data(), _x1.data(), _y1.data() },
+                z_pixels + row,
+                { rays.top_left_x.data() + row, rays.top_left_y.data() + row, rays.top_left_z.data() + row,
+                  rays.bottom_right_x.data() + row, rays.bottom_right_y.data() + row, rays.bottom_right_z.data() + row },
+                depth_intrin.width, z_scale, other_intrin, depth_to_other);
+
+            for (int depth_x = 0; depth_x < depth_intrin.width; ++depth_x)
+            {
+                // Skip over depth pixels with the value of zero, we have no depth data so we will not write anything into our aligned images
+                if (!z_pixels[row + depth_x])
+                    continue;
+
+                const int other_x0 = _x0[depth_x], other_y0 = _y0[depth_x];
+                const int other_x1 = _x1[depth_x], other_y1 = _y1[depth_x];
+                if (other_x0 < 0 || other_y0 < 0 || other_x1 >= other_intrin.width || other_y1 >= other_intrin.height)
+                    continue;
+
+                // Transfer between the depth pixels and the pixels inside the rectangle on the other image
+                for (int y = other_y0; y <= other_y1; ++y)
+                {
+                    for (int x = other_x0; x <= other_x1; ++x)
+                    {
+                        transfer_pixel(row + depth_x, y * other_intrin.width + x);
+                    }
+                }
+            }
+        }
+    }
+
+    void align_avx::align_z_to_other(rs2::video_frame& aligned, const rs2::video_frame& depth, const rs2::video_stream_profile& other_profile, float z_scale)
+    {
+        auto depth_profile = depth.get_profile().as<rs2::video_stream_profile>();
+        auto other_intrin = other_profile.get_intrinsics();
+        if (!can_project_to(other_intrin))
+        {
+            align::align_z_to_other(aligned, depth, other_profile, z_scale);
+            return;
+        }
+
+        uint8_t * aligned_data = reinterpret_cast<uint8_t *>(const_cast<void*>(aligned.get_data()));
+        auto aligned_profile = aligned.get_profile().as<rs2::video_stream_profile>();
+        memset(aligned_data, 0, aligned_profile.height() * aligned_profile.width() * aligned.get_bytes_per_pixel());
+
+        auto z_intrin = depth_profile.get_intrinsics();
+        auto z_to_other = depth_profile.get_extrinsics_to(other_profile);
+
+        auto z_pixels = reinterpret_cast<const uint16_t*>(depth.get_data());
+        auto out_z = (uint16_t *)(aligned_data);
+
+        auto& rays = pre_compute_corner_maps(depth_profile, other_profile, z_intrin, z_to_other);
+        align_images(rays, z_pixels, z_scale, z_intrin, z_to_other, other_intrin,
+            [out_z, z_pixels](int z_pixel_index, int other_pixel_index)
+        {
+            out_z[other_pixel_index] = out_z[other_pixel_index] ?
+                std::min(out_z[other_pixel_index], z_pixels[z_pixel_index]) :
+                z_pixels[z_pixel_index];
+        });
+    }
+
+    void align_avx::align_other_to_z(rs2::video_frame& aligned, const rs2::video_frame& depth, const rs2::video_frame& other, float z_scale)
+    {
+        auto depth_profile = depth.get_profile().as<rs2::video_stream_profile>();
+        auto other_profile = other.get_profile().as<rs2::video_stream_profile>();
+        auto other_intrin = other_profile.get_intrinsics();
+        if (!can_project_to(other_intrin))
+        {
+            align::align_other_to_z(aligned, depth, other, z_scale);
+            return;
+        }
+
+        uint8_t * aligned_data = reinterpret_cast<uint8_t *>(const_cast<void*>(aligned.get_data()));
+        auto aligned_profile = aligned.get_profile().as<rs2::video_stream_profile>();
+        memset(aligned_data, 0, aligned_profile.height() * aligned_profile.width() * aligned.get_bytes_per_pixel());
+
+        auto z_intrin = depth_profile.get_intrinsics();
+        auto z_to_other = depth_profile.get_extrinsics_to(other_profile);
+
+        auto z_pixels = reinterpret_cast<const uint16_t*>(depth.get_data());
+        auto other_pixels = reinterpret_cast<const uint8_t *>(other.get_data());
+
+        auto& rays = pre_compute_corner_maps(depth_profile, other_profile, z_intrin, z_to_other);
+        auto transfer = [&](auto in, auto out)
+        {
+            align_images(rays, z_pixels, z_scale, z_intrin, z_to_other, other_intrin,
+                [in, out](int z_pixel_index, int other_pixel_index) { out[z_pixel_index] = in[other_pixel_index]; });
+        };
+        switch (other.get_bytes_per_pixel())
+        {
+        case 1:
+            transfer(reinterpret_cast<const bytes<1>*>(other_pixels), reinterpret_cast<bytes<1>*>(aligned_data));
+            break;
+        case 2:
+            transfer(reinterpret_cast<const bytes<2>*>(other_pixels), reinterpret_cast<bytes<2>*>(aligned_data));
+            break;
+        case 3:
+            transfer(reinterpret_cast<const bytes<3>*>(other_pixels), reinterpret_cast<bytes<3>*>(aligned_data));
+            break;
+        case 4:
+            transfer(reinterpret_cast<const bytes<4>*>(other_pixels), reinterpret_cast<bytes<4>*>(aligned_data));
+            break;
+        default:
+            break;
+        }
+    }
+}
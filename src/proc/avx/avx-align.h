@@ -0,0 +1,58 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+#include "../align.h"
+#include "avx-align-kernels.h"
+
+#include <vector>
+
+namespace librealsense
+{
+    // Maps 16 (AVX-512) or 8 (AVX2) depth pixels at a time onto the other stream. The wide code lives in the kernel
+    // files, so this class can be built into any x86 library and picked at runtime, when is_supported(). The widest
+    // kernels the CPU can run are used.
+    class align_avx : public align
+    {
+    public:
+        align_avx(rs2_stream to_stream);
+
+        // True if the AVX2 kernels were built in and the CPU can run them
+        static bool is_supported();
+
+        // True if the AVX-512 kernels were built in and the CPU can run them: they are then used
+        static bool use_avx512();
+
+    protected:
+        // With the AVX-512 kernels, or the AVX2 ones
+        align_avx(rs2_stream to_stream, bool avx512);
+
+        std::unique_ptr<rays> make_rays() const override { return std::unique_ptr<rays>(new corner_rays); }
+
+        void align_z_to_other(rs2::video_frame& aligned, const rs2::video_frame& depth, const rs2::video_stream_profile& other_profile, float z_scale) override;
+
+        void align_other_to_z(rs2::video_frame& aligned, const rs2::video_frame& depth, const rs2::video_frame& other, float z_scale) override;
+
+    private:
+        typedef void (*project_corners_fn)(align_corners const&, const uint16_t*, align_corner_maps const&, size_t, float,
+            const rs2_intrinsics&, const rs2_extrinsics&);
+
+        // The rays under the corners of each depth pixel, also as one array per coordinate
+        struct corner_rays : rays
+        {
+            std::vector<float> top_left_x, top_left_y, top_left_z, bottom_right_x, bottom_right_y, bottom_right_z;
+        };
+
+        corner_rays& pre_compute_corner_maps(const rs2::stream_profile& depth_profile, const rs2::stream_profile& other_profile,
+            const rs2_intrinsics& depth, const rs2_extrinsics& depth_to_other);
+
+        template<class TRANSFER_PIXEL>
+        void align_images(const corner_rays& rays, const uint16_t* z_pixels, float z_scale, const rs2_intrinsics& depth_intrin,
+            const rs2_extrinsics& depth_to_other, const rs2_intrinsics& other_intrin, TRANSFER_PIXEL transfer_pixel);
+
+        project_corners_fn _project_corners;
+
+        // Where the corners of one row of depth pixels land on the other stream
+        std::vector<int32_t> _x0, _y0, _x1, _y1;
+    };
+}
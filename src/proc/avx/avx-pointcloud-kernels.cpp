@@ -0,0 +1,196 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+// NOTE: this file is built with AVX2 code generation enabled, and so must not contain anything (inline functions,
+// templates from headers) that the linker could pick to share with the rest of the library!
+
+#include "avx-pointcloud-kernels.h"
+
+#if defined( __AVX2__ )
+#define LRS_AVX2_KERNELS
+#include "avx-projection.h"
+#endif
+
+
+namespace librealsense {
+namespace avx2 {
+
+
+#ifdef LRS_AVX2_KERNELS
+
+namespace {
+
+
+// Interleave 8 x, y, z values into 24 floats
+inline void store_xyz( float * dst, __m256 x, __m256 y, __m256 z )
+{
+    __m256 const rxy = _mm256_shuffle_ps( x, y, _MM_SHUFFLE( 2, 0, 2, 0 ) );  // x0 x2 y0 y2
+    __m256 const ryz = _mm256_shuffle_ps( y, z, _MM_SHUFFLE( 3, 1, 3, 1 ) );  // y1 y3 z1 z3
+    __m256 const rzx = _mm256_shuffle_ps( z, x, _MM_SHUFFLE( 3, 1, 2, 0 ) );  // z0 z2 x1 x3
+
+    __m256 const r03 = _mm256_shuffle_ps( rxy, rzx, _MM_SHUFFLE( 2, 0, 2, 0 ) );  // x0 y0 z0 x1
+    __m256 const r14 = _mm256_shuffle_ps( ryz, rxy, _MM_SHUFFLE( 3, 1, 2, 0 ) );  // y1 z1 x2 y2
+    __m256 const r25 = _mm256_shuffle_ps( rzx, ryz, _MM_SHUFFLE( 3, 1, 3, 1 ) );  // z2 x3 y3 z3
+
+    // Each lane now holds 4 points: the low lanes points 0-3, the high lanes points 4-7
+    _mm256_storeu_ps( dst, _mm256_permute2f128_ps( r03, r14, 0x20 ) );
+    _mm256_storeu_ps( dst + 8, _mm256_permute2f128_ps( r25, r03, 0x30 ) );
+    _mm256_storeu_ps( dst + 16, _mm256_permute2f128_ps( r14, r25, 0x31 ) );
+}
+
+// The reverse of store_xyz
+inline void load_xyz( const float * src, __m256 & x, __m256 & y, __m256 & z )
+{
+    __m256 const m03 = _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_loadu_ps( src ) ), _mm_loadu_ps( src + 12 ), 1 );
+    __m256 const m14 = _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_loadu_ps( src + 4 ) ), _mm_loadu_ps( src + 16 ), 1 );
+    __m256 const m25 = _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_loadu_ps( src + 8 ) ), _mm_loadu_ps( src + 20 ), 1 );
+
+    __m256 const xy = _mm256_shuffle_ps( m14, m25, _MM_SHUFFLE( 2, 1, 3, 2 ) );  // x2 y2 x3 y3
+    __m256 const yz = _mm256_shuffle_ps( m03, m14, _MM_SHUFFLE( 1, 0, 2, 1 ) );  // y0 z0 y1 z1
+    x = _mm256_shuffle_ps( m03, xy, _MM_SHUFFLE( 2, 0, 3, 0 ) );
+    y = _mm256_shuffle_ps( yz, xy, _MM_SHUFFLE( 3, 1, 2, 0 ) );
+    z = _mm256_shuffle_ps( yz, m25, _MM_SHUFFLE( 3, 0, 3, 1 ) );
+}
+
+// Interleave 8 x, y values into 16 floats
+inline void store_xy( float * dst, __m256 x, __m256 y )
+{
+    __m256 const lo = _mm256_unpacklo_ps( x, y );  // x0 y0 x1 y1 | x4 y4 x5 y5
+    __m256 const hi = _mm256_unpackhi_ps( x, y );  // x2 y2 x3 y3 | x6 y6 x7 y7
+    _mm256_storeu_ps( dst, _mm256_permute2f128_ps( lo, hi, 0x20 ) );
+    _mm256_storeu_ps( dst + 8, _mm256_permute2f128_ps( lo, hi, 0x31 ) );
+}
+
+
+void deproject_8( float * points, const uint16_t * depth, const float * map_x, const float * map_y, __m256 scale )
+{
+    __m256i const d = _mm256_cvtepu16_epi32( _mm_loadu_si128( reinterpret_cast< const __m128i * >( depth ) ) );
+    __m256 const z = _mm256_mul_ps( _mm256_cvtepi32_ps( d ), scale );
+    store_xyz( points, _mm256_mul_ps( _mm256_loadu_ps( map_x ), z ), _mm256_mul_ps( _mm256_loadu_ps( map_y ), z ), z );
+}
+
+
+template< rs2_distortion dist >
+void project_8( float * texture, float * pixels, const float * points, projection const & p )
+{
+    __m256 x, y, z;
+    load_xyz( points, x, y, z );
+
+    __m256 px, py;
+    transform_and_project< dist >( px, py, x, y, z, p );
+
+    // Points with no depth are not projected
+    __m256 const valid = _mm256_cmp_ps( z, _mm256_setzero_ps(), _CMP_NEQ_OQ );
+    px = _mm256_and_ps( px, valid );
+    py = _mm256_and_ps( py, valid );
+
+    store_xy( pixels, px, py );
+    store_xy( texture, _mm256_div_ps( px, p.width ), _mm256_div_ps( py, p.height ) );
+}
+
+
+template< rs2_distortion dist >
+void project_points( float * texture, float * pixels, const float * points, size_t count, projection const & p )
+{
+    size_t i = 0;
+    for( ; i + 8 <= count; i += 8 )
+        project_8< dist >( texture + i * 2, pixels + i * 2, points + i * 3, p );
+
+    // Run the remainder through a padded copy, so it gets exactly the same math
+    if( i < count )
+    {
+        size_t const rest = count - i;
+        float in[8 * 3] = {}, tex[8 * 2], pix[8 * 2];
+        for( size_t j = 0; j < rest * 3; ++j )
+            in[j] = points[i * 3 + j];
+        project_8< dist >( tex, pix, in, p );
+        for( size_t j = 0; j < rest * 2; ++j )
+        {
+            texture[i * 2 + j] = tex[j];
+            pixels[i * 2 + j] = pix[j];
+        }
+    }
+}
+
+
+}  // namespace
+
+
+bool kernels_available()
+{
+    return true;
+}
+
+
+void deproject_depth( float * points,
+                      const uint16_t * depth,
+                      const float * map_x,
+                      const float * map_y,
+                      size_t count,
+                      float depth_scale )
+{
+    __m256 const scale = _mm256_set1_ps( depth_scale );
+
+    size_t i = 0;
+    for( ; i + 8 <= count; i += 8 )
+        deproject_8( points + i * 3, depth + i, map_x + i, map_y + i, scale );
+
+    if( i < count )
+    {
+        size_t const rest = count - i;
+        uint16_t d[8] = {};
+        float mx[8] = {}, my[8] = {}, out[8 * 3];
+        for( size_t j = 0; j < rest; ++j )
+        {
+            d[j] = depth[i + j];
+            mx[j] = map_x[i + j];
+            my[j] = map_y[i + j];
+        }
+        deproject_8( out, d, mx, my, scale );
+        for( size_t j = 0; j < rest * 3; ++j )
+            points[i * 3 + j] = out[j];
+    }
+}
+
+
+void project_points( float * texture,
+                     float * pixels,
+                     const float * points,
+                     size_t count,
+                     const rs2_intrinsics & other,
+                     const rs2_extrinsics & extr )
+{
+    projection const p( other, extr );
+    switch( other.model )
+    {
+    case RS2_DISTORTION_MODIFIED_BROWN_CONRADY:
+        project_points< RS2_DISTORTION_MODIFIED_BROWN_CONRADY >( texture, pixels, points, count, p );
+        break;
+    case RS2_DISTORTION_INVERSE_BROWN_CONRADY:
+        project_points< RS2_DISTORTION_INVERSE_BROWN_CONRADY >( texture, pixels, points, count, p );
+        break;
+    case RS2_DISTORTION_BROWN_CONRADY:
+        project_points< RS2_DISTORTION_BROWN_CONRADY >( texture, pixels, points, count, p );
+        break;
+    default:
+        project_points< RS2_DISTORTION_NONE >( texture, pixels, points, count, p );
+        break;
+    }
+}
+
+#else  // ! LRS_AVX2_KERNELS
+
+bool kernels_available()
+{
+    return false;
+}
+
+void deproject_depth( float *, const uint16_t *, const float *, const float *, size_t, float ) {}
+
+void project_points( float *, float *, const float *, size_t, const rs2_intrinsics &, const rs2_extrinsics & ) {}
+
+#endif
+
+
+}  // namespace avx2
+}  // namespace librealsense
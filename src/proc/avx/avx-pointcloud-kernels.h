@@ -0,0 +1,43 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/h/rs_types.h>
+#include <librealsense2/h/rs_sensor.h>
+
+#include <cstdint>
+#include <cstddef>
+
+
+namespace librealsense {
+namespace avx2 {
+
+
+// The pointcloud inner loops, in the only translation unit built with AVX2 enabled. Callers must check
+// kernels_available() (the library may have been built without AVX2 support) and cpu_supports_avx2() first.
+// Buffers need not be aligned, and any number of points is handled.
+
+bool kernels_available();
+
+// points[i] = { map_x[i] * d, map_y[i] * d, d } where d = depth[i] * depth_scale
+void deproject_depth( float * points,
+                      const uint16_t * depth,
+                      const float * map_x,
+                      const float * map_y,
+                      size_t count,
+                      float depth_scale );
+
+// Transform points (xyz triplets) with 'extr' and project them into 'other' (whose model must be NONE or one of the
+// Brown-Conrady variants), writing pixel coordinates into 'pixels' and normalized texture coordinates into 'texture'
+// (both xy pairs). Points with no depth map to (0,0).
+void project_points( float * texture,
+                     float * pixels,
+                     const float * points,
+                     size_t count,
+                     const rs2_intrinsics & other,
+                     const rs2_extrinsics & extr );
+
+
+}  // namespace avx2
+}  // namespace librealsense
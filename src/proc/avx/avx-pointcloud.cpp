@@ -0,0 +1,83 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "avx-pointcloud.h"
+#include "avx-pointcloud-kernels.h"
+#include "cpu-features.h"
+
+#include <librealsense2/rs.hpp>
+#include <librealsense2/rsutil.h>
+
+namespace librealsense
+{
+    pointcloud_avx2::pointcloud_avx2() : pointcloud("Pointcloud (AVX2)") {}
+
+    bool pointcloud_avx2::is_supported()
+    {
+        return avx2::kernels_available() && cpu_supports_avx2();
+    }
+
+    void pointcloud_avx2::preprocess()
+    {
+        _pre_compute_map_x.resize(_depth_intrinsics->width * _depth_intrinsics->height);
+        _pre_compute_map_y.resize(_depth_intrinsics->width * _depth_intrinsics->height);
+
+        // Deprojecting at a depth of 1 gives the per-pixel factors for any distortion model, so the points come
+        // out the same as with the generic implementation
+        for (int h = 0; h < _depth_intrinsics->height; ++h)
+        {
+            for (int w = 0; w < _depth_intrinsics->width; ++w)
+            {
+                const float pixel[] = { (float)w, (float)h };
+                float point[3];
+                rs2_deproject_pixel_to_point(point, &*_depth_intrinsics, pixel, 1.f);
+
+                _pre_compute_map_x[h * _depth_intrinsics->width + w] = point[0];
+                _pre_compute_map_y[h * _depth_intrinsics->width + w] = point[1];
+            }
+        }
+    }
+
+    const float3 * pointcloud_avx2::depth_to_points(rs2::points output,
+        const rs2_intrinsics &depth_intrinsics,
+        const rs2::depth_frame& depth_frame)
+    {
+        auto points = (float *)output.get_vertices();
+        avx2::deproject_depth(points,
+            (const uint16_t *)depth_frame.get_data(),
+            _pre_compute_map_x.data(),
+            _pre_compute_map_y.data(),
+            size_t(depth_intrinsics.width) * depth_intrinsics.height,
+            depth_frame.get_units());
+        return (const float3 *)points;
+    }
+
+    void pointcloud_avx2::get_texture_map(rs2::points output,
+        const float3* points,
+        const unsigned int width,
+        const unsigned int height,
+        const rs2_intrinsics &other_intrinsics,
+        const rs2_extrinsics& extr,
+        float2* pixels_ptr)
+    {
+        switch (other_intrinsics.model)
+        {
+        case RS2_DISTORTION_NONE:
+        case RS2_DISTORTION_MODIFIED_BROWN_CONRADY:
+        case RS2_DISTORTION_INVERSE_BROWN_CONRADY:
+        case RS2_DISTORTION_BROWN_CONRADY:
+            avx2::project_points((float *)output.get_texture_coordinates(),
+                (float *)pixels_ptr,
+                (const float *)points,
+                size_t(width) * height,
+                other_intrinsics,
+                extr);
+            break;
+
+        default:
+            // The fisheye models need trigonometry: leave them to the generic implementation
+            pointcloud::get_texture_map(output, points, width, height, other_intrinsics, extr, pixels_ptr);
+            break;
+        }
+    }
+}
@@ -0,0 +1,37 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+#include "../pointcloud.h"
+
+namespace librealsense
+{
+    // Processes 8 points at a time with AVX2. The AVX2 code lives in avx-pointcloud-kernels.cpp, so this class can
+    // be built into any x86 library and picked at runtime, when is_supported()
+    class pointcloud_avx2 : public pointcloud
+    {
+    public:
+        pointcloud_avx2();
+
+        // True if the AVX2 kernels were built in and the CPU can run them
+        static bool is_supported();
+
+        void preprocess() override;
+        const float3 * depth_to_points(
+            rs2::points output,
+            const rs2_intrinsics &depth_intrinsics,
+            const rs2::depth_frame& depth_frame) override;
+        void get_texture_map(
+            rs2::points output,
+            const float3* points,
+            const unsigned int width,
+            const unsigned int height,
+            const rs2_intrinsics &other_intrinsics,
+            const rs2_extrinsics& extr,
+            float2* pixels_ptr) override;
+
+    private:
+        std::vector<float> _pre_compute_map_x;
+        std::vector<float> _pre_compute_map_y;
+    };
+}
@@ -0,0 +1,135 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+// NOTE: only for the kernel files built with AVX2 code generation enabled. Everything here is in an unnamed
+// namespace, so each of them gets its own copy and nothing built for AVX2 can leak into the rest of the library.
+
+#pragma once
+
+#include <librealsense2/h/rs_types.h>
+#include <librealsense2/h/rs_sensor.h>
+
+#include <immintrin.h>
+
+
+namespace librealsense {
+namespace avx2 {
+namespace {
+
+
+struct projection
+{
+    __m256 r[9], t[3], c[5];
+    __m256 fx, fy, ppx, ppy, width, height;
+
+    projection( const rs2_intrinsics & other, const rs2_extrinsics & extr )
+    {
+        for( int i = 0; i < 9; ++i )
+            r[i] = _mm256_set1_ps( extr.rotation[i] );
+        for( int i = 0; i < 3; ++i )
+            t[i] = _mm256_set1_ps( extr.translation[i] );
+        for( int i = 0; i < 5; ++i )
+            c[i] = _mm256_set1_ps( other.coeffs[i] );
+        fx = _mm256_set1_ps( other.fx );
+        fy = _mm256_set1_ps( other.fy );
+        ppx = _mm256_set1_ps( other.ppx );
+        ppy = _mm256_set1_ps( other.ppy );
+        width = _mm256_set1_ps( float( other.width ) );
+        height = _mm256_set1_ps( float( other.height ) );
+    }
+};
+
+
+// Same math as rs2_project_point_to_pixel, one operation at a time and in the same order, so the results are exactly
+// the same (which is also why these files are built without FMA: a fused multiply-add rounds differently)
+template< rs2_distortion dist >
+inline void distort( __m256 & x, __m256 & y, const __m256 ( &c )[5] );
+
+template<>
+inline void distort< RS2_DISTORTION_NONE >( __m256 &, __m256 &, const __m256 ( & )[5] )
+{
+}
+
+// 1 + c0 * r2 + c1 * r2 * r2 + c4 * r2 * r2 * r2
+inline __m256 radial( __m256 r2, const __m256 ( &c )[5] )
+{
+    __m256 f = _mm256_add_ps( _mm256_set1_ps( 1.f ), _mm256_mul_ps( c[0], r2 ) );
+    f = _mm256_add_ps( f, _mm256_mul_ps( _mm256_mul_ps( c[1], r2 ), r2 ) );
+    return _mm256_add_ps( f, _mm256_mul_ps( _mm256_mul_ps( _mm256_mul_ps( c[4], r2 ), r2 ), r2 ) );
+}
+
+// xf + 2 * ca * x * y + cb * (r2 + 2 * xx * xx)
+inline __m256 tangential( __m256 xf, __m256 x, __m256 y, __m256 xx, __m256 r2, __m256 ca, __m256 cb )
+{
+    __m256 const two = _mm256_set1_ps( 2.f );
+    __m256 const d = _mm256_add_ps( xf, _mm256_mul_ps( _mm256_mul_ps( _mm256_mul_ps( two, ca ), x ), y ) );
+    return _mm256_add_ps( d, _mm256_mul_ps( cb, _mm256_add_ps( r2, _mm256_mul_ps( _mm256_mul_ps( two, xx ), xx ) ) ) );
+}
+
+// Radial distortion first, then the tangential terms on the radially-distorted point
+template<>
+inline void distort< RS2_DISTORTION_MODIFIED_BROWN_CONRADY >( __m256 & x, __m256 & y, const __m256 ( &c )[5] )
+{
+    __m256 const r2 = _mm256_add_ps( _mm256_mul_ps( x, x ), _mm256_mul_ps( y, y ) );
+    __m256 const f = radial( r2, c );
+    __m256 const xf = _mm256_mul_ps( x, f );
+    __m256 const yf = _mm256_mul_ps( y, f );
+    x = tangential( xf, xf, yf, xf, r2, c[2], c[3] );
+    y = tangential( yf, xf, yf, yf, r2, c[3], c[2] );
+}
+
+template<>
+inline void distort< RS2_DISTORTION_INVERSE_BROWN_CONRADY >( __m256 & x, __m256 & y, const __m256 ( &c )[5] )
+{
+    distort< RS2_DISTORTION_MODIFIED_BROWN_CONRADY >( x, y, c );
+}
+
+// Tangential distortion applied to the original (non-radially-distorted) point
+template<>
+inline void distort< RS2_DISTORTION_BROWN_CONRADY >( __m256 & x, __m256 & y, const __m256 ( &c )[5] )
+{
+    __m256 const r2 = _mm256_add_ps( _mm256_mul_ps( x, x ), _mm256_mul_ps( y, y ) );
+    __m256 const f = radial( r2, c );
+    __m256 const xf = _mm256_mul_ps( x, f );
+    __m256 const yf = _mm256_mul_ps( y, f );
+    __m256 const dx = tangential( xf, x, y, x, r2, c[2], c[3] );
+    y = tangential( yf, x, y, y, r2, c[3], c[2] );
+    x = dx;
+}
+
+
+// Project 8 points, already in the other stream's coordinates, onto it
+template< rs2_distortion dist >
+inline void project( __m256 & px, __m256 & py, __m256 x, __m256 y, __m256 z, projection const & p )
+{
+    px = _mm256_div_ps( x, z );
+    py = _mm256_div_ps( y, z );
+    distort< dist >( px, py, p.c );
+    px = _mm256_add_ps( _mm256_mul_ps( px, p.fx ), p.ppx );
+    py = _mm256_add_ps( _mm256_mul_ps( py, p.fy ), p.ppy );
+}
+
+
+// r0 * x + r3 * y + r6 * z + t0, as rs2_transform_point_to_point does it
+inline __m256 transform( __m256 x, __m256 y, __m256 z, __m256 r0, __m256 r3, __m256 r6, __m256 t0 )
+{
+    __m256 const xy = _mm256_add_ps( _mm256_mul_ps( r0, x ), _mm256_mul_ps( r3, y ) );
+    return _mm256_add_ps( _mm256_add_ps( xy, _mm256_mul_ps( r6, z ) ), t0 );
+}
+
+
+// Transform 8 points from the source stream's coordinates with p's extrinsics, and project them onto the other stream
+template< rs2_distortion dist >
+inline void transform_and_project( __m256 & px, __m256 & py, __m256 x, __m256 y, __m256 z, projection const & p )
+{
+    project< dist >( px, py,
+                     transform( x, y, z, p.r[0], p.r[3], p.r[6], p.t[0] ),
+                     transform( x, y, z, p.r[1], p.r[4], p.r[7], p.t[1] ),
+                     transform( x, y, z, p.r[2], p.r[5], p.r[8], p.t[2] ),
+                     p );
+}
+
+
+}  // namespace
+}  // namespace avx2
+}  // namespace librealsense
@@ -0,0 +1,238 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+// NOTE: this file is built with AVX-512 code generation enabled, and so must not contain anything (inline functions,
+// templates from headers) that the linker could pick to share with the rest of the library!
+
+#include "avx-align-kernels.h"
+
+#if defined( __AVX512F__ )
+#define LRS_AVX512_KERNELS
+#include <immintrin.h>
+#endif
+
+
+namespace librealsense {
+namespace avx512 {
+
+
+#ifdef LRS_AVX512_KERNELS
+
+namespace {
+
+
+// The 16-wide counterpart of avx2's projection (see avx-projection.h), with the same math: one operation at a time,
+// in the order of rs2_project_point_to_pixel, and without FMA
+struct projection
+{
+    __m512 r[9], t[3], c[5];
+    __m512 fx, fy, ppx, ppy;
+
+    projection( const rs2_intrinsics & other, const rs2_extrinsics & extr )
+    {
+        for( int i = 0; i < 9; ++i )
+            r[i] = _mm512_set1_ps( extr.rotation[i] );
+        for( int i = 0; i < 3; ++i )
+            t[i] = _mm512_set1_ps( extr.translation[i] );
+        for( int i = 0; i < 5; ++i )
+            c[i] = _mm512_set1_ps( other.coeffs[i] );
+        fx = _mm512_set1_ps( other.fx );
+        fy = _mm512_set1_ps( other.fy );
+        ppx = _mm512_set1_ps( other.ppx );
+        ppy = _mm512_set1_ps( other.ppy );
+    }
+};
+
+
+template< rs2_distortion dist >
+inline void distort( __m512 & x, __m512 & y, const __m512 ( &c )[5] );
+
+template<>
+inline void distort< RS2_DISTORTION_NONE >( __m512 &, __m512 &, const __m512 ( & )[5] )
+{
+}
+
+inline __m512 radial( __m512 r2, const __m512 ( &c )[5] )
+{
+    __m512 f = _mm512_add_ps( _mm512_set1_ps( 1.f ), _mm512_mul_ps( c[0], r2 ) );
+    f = _mm512_add_ps( f, _mm512_mul_ps( _mm512_mul_ps( c[1], r2 ), r2 ) );
+    return _mm512_add_ps( f, _mm512_mul_ps( _mm512_mul_ps( _mm512_mul_ps( c[4], r2 ), r2 ), r2 ) );
+}
+
+inline __m512 tangential( __m512 xf, __m512 x, __m512 y, __m512 xx, __m512 r2, __m512 ca, __m512 cb )
+{
+    __m512 const two = _mm512_set1_ps( 2.f );
+    __m512 const d = _mm512_add_ps( xf, _mm512_mul_ps( _mm512_mul_ps( _mm512_mul_ps( two, ca ), x ), y ) );
+    return _mm512_add_ps( d, _mm512_mul_ps( cb, _mm512_add_ps( r2, _mm512_mul_ps( _mm512_mul_ps( two, xx ), xx ) ) ) );
+}
+
+template<>
+inline void distort< RS2_DISTORTION_MODIFIED_BROWN_CONRADY >( __m512 & x, __m512 & y, const __m512 ( &c )[5] )
+{
+    __m512 const r2 = _mm512_add_ps( _mm512_mul_ps( x, x ), _mm512_mul_ps( y, y ) );
+    __m512 const f = radial( r2, c );
+    __m512 const xf = _mm512_mul_ps( x, f );
+    __m512 const yf = _mm512_mul_ps( y, f );
+    x = tangential( xf, xf, yf, xf, r2, c[2], c[3] );
+    y = tangential( yf, xf, yf, yf, r2, c[3], c[2] );
+}
+
+template<>
+inline void distort< RS2_DISTORTION_INVERSE_BROWN_CONRADY >( __m512 & x, __m512 & y, const __m512 ( &c )[5] )
+{
+    distort< RS2_DISTORTION_MODIFIED_BROWN_CONRADY >( x, y, c );
+}
+
+template<>
+inline void distort< RS2_DISTORTION_BROWN_CONRADY >( __m512 & x, __m512 & y, const __m512 ( &c )[5] )
+{
+    __m512 const r2 = _mm512_add_ps( _mm512_mul_ps( x, x ), _mm512_mul_ps( y, y ) );
+    __m512 const f = radial( r2, c );
+    __m512 const xf = _mm512_mul_ps( x, f );
+    __m512 const yf = _mm512_mul_ps( y, f );
+    __m512 const dx = tangential( xf, x, y, x, r2, c[2], c[3] );
+    y = tangential( yf, x, y, y, r2, c[3], c[2] );
+    x = dx;
+}
+
+
+// Like static_cast< int >( v + 0.5f ) in the generic align
+inline __m512i round_pixel( __m512 v )
+{
+    return _mm512_cvttps_epi32( _mm512_add_ps( v, _mm512_set1_ps( 0.5f ) ) );
+}
+
+
+// The corner under a ray at depth z, as the generic align computes it: ray * z + translation, then projected
+template< rs2_distortion dist >
+inline void project_corner( int32_t * x_out, int32_t * y_out, const float * ray_x, const float * ray_y,
+                            const float * ray_z, __m512 z, projection const & p )
+{
+    __m512 px = _mm512_add_ps( _mm512_mul_ps( _mm512_loadu_ps( ray_x ), z ), p.t[0] );
+    __m512 py = _mm512_add_ps( _mm512_mul_ps( _mm512_loadu_ps( ray_y ), z ), p.t[1] );
+    __m512 const pz = _mm512_add_ps( _mm512_mul_ps( _mm512_loadu_ps( ray_z ), z ), p.t[2] );
+
+    px = _mm512_div_ps( px, pz );
+    py = _mm512_div_ps( py, pz );
+    distort< dist >( px, py, p.c );
+    px = _mm512_add_ps( _mm512_mul_ps( px, p.fx ), p.ppx );
+    py = _mm512_add_ps( _mm512_mul_ps( py, p.fy ), p.ppy );
+
+    _mm512_storeu_si512( x_out, round_pixel( px ) );
+    _mm512_storeu_si512( y_out, round_pixel( py ) );
+}
+
+
+template< rs2_distortion dist >
+void project_corners_16( align_corners const & out,
+                         size_t i,
+                         const uint16_t * depth,
+                         align_corner_maps const & maps,
+                         __m512 scale,
+                         projection const & p )
+{
+    __m512i const d = _mm512_cvtepu16_epi32( _mm256_loadu_si256( reinterpret_cast< const __m256i * >( depth + i ) ) );
+    __m512 const z = _mm512_mul_ps( _mm512_cvtepi32_ps( d ), scale );
+
+    project_corner< dist >( out.x0 + i, out.y0 + i, maps.top_left_x + i, maps.top_left_y + i, maps.top_left_z + i, z, p );
+    project_corner< dist >( out.x1 + i, out.y1 + i, maps.bottom_right_x + i, maps.bottom_right_y + i,
+                            maps.bottom_right_z + i, z, p );
+}
+
+
+template< rs2_distortion dist >
+void project_corners( align_corners const & out,
+                      const uint16_t * depth,
+                      align_corner_maps const & maps,
+                      size_t count,
+                      float depth_scale,
+                      projection const & p )
+{
+    __m512 const scale = _mm512_set1_ps( depth_scale );
+
+    size_t i = 0;
+    for( ; i + 16 <= count; i += 16 )
+        project_corners_16< dist >( out, i, depth, maps, scale, p );
+
+    // Run the remainder through a padded copy, so it gets exactly the same math
+    if( i < count )
+    {
+        size_t const rest = count - i;
+        uint16_t d[16] = {};
+        float tlx[16] = {}, tly[16] = {}, tlz[16] = {}, brx[16] = {}, bry[16] = {}, brz[16] = {};
+        int32_t x0[16], y0[16], x1[16], y1[16];
+        for( size_t j = 0; j < rest; ++j )
+        {
+            d[j] = depth[i + j];
+            tlx[j] = maps.top_left_x[i + j];
+            tly[j] = maps.top_left_y[i + j];
+            tlz[j] = maps.top_left_z[i + j];
+            brx[j] = maps.bottom_right_x[i + j];
+            bry[j] = maps.bottom_right_y[i + j];
+            brz[j] = maps.bottom_right_z[i + j];
+        }
+        project_corners_16< dist >( { x0, y0, x1, y1 }, 0, d, { tlx, tly, tlz, brx, bry, brz }, scale, p );
+        for( size_t j = 0; j < rest; ++j )
+        {
+            out.x0[i + j] = x0[j];
+            out.y0[i + j] = y0[j];
+            out.x1[i + j] = x1[j];
+            out.y1[i + j] = y1[j];
+        }
+    }
+}
+
+
+}  // namespace
+
+
+bool align_kernels_available()
+{
+    return true;
+}
+
+
+void project_corners( align_corners const & out,
+                      const uint16_t * depth,
+                      align_corner_maps const & maps,
+                      size_t count,
+                      float depth_scale,
+                      const rs2_intrinsics & other,
+                      const rs2_extrinsics & extr )
+{
+    projection const p( other, extr );
+    switch( other.model )
+    {
+    case RS2_DISTORTION_MODIFIED_BROWN_CONRADY:
+        project_corners< RS2_DISTORTION_MODIFIED_BROWN_CONRADY >( out, depth, maps, count, depth_scale, p );
+        break;
+    case RS2_DISTORTION_INVERSE_BROWN_CONRADY:
+        project_corners< RS2_DISTORTION_INVERSE_BROWN_CONRADY >( out, depth, maps, count, depth_scale, p );
+        break;
+    case RS2_DISTORTION_BROWN_CONRADY:
+        project_corners< RS2_DISTORTION_BROWN_CONRADY >( out, depth, maps, count, depth_scale, p );
+        break;
+    default:
+        project_corners< RS2_DISTORTION_NONE >( out, depth, maps, count, depth_scale, p );
+        break;
+    }
+}
+
+
+#else  // ! LRS_AVX512_KERNELS
+
+bool align_kernels_available()
+{
+    return false;
+}
+
+void project_corners( align_corners const &, const uint16_t *, align_corner_maps const &, size_t, float,
+                      const rs2_intrinsics &, const rs2_extrinsics & )
+{
+}
+
+#endif
+
+
+}  // namespace avx512
+}  // namespace librealsense
@@ -0,0 +1,111 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "cpu-features.h"
+
+#if defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+#include <intrin.h>
+#define LRS_CPUID_X86
+#elif defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#include <cpuid.h>
+#define LRS_CPUID_X86
+#endif
+
+#include <cstdint>
+
+
+namespace librealsense {
+
+
+#ifdef LRS_CPUID_X86
+
+static void cpuid( unsigned leaf, unsigned subleaf, unsigned regs[4] )
+{
+#ifdef _MSC_VER
+    int r[4];
+    __cpuidex( r, static_cast< int >( leaf ), static_cast< int >( subleaf ) );
+    for( int i = 0; i < 4; ++i )
+        regs[i] = static_cast< unsigned >( r[i] );
+#else
+    __cpuid_count( leaf, subleaf, regs[0], regs[1], regs[2], regs[3] );
+#endif
+}
+
+// The state components the OS saves on context switch (XCR0); only valid when OSXSAVE is set
+static uint64_t xgetbv0()
+{
+#ifdef _MSC_VER
+    return _xgetbv( 0 );
+#else
+    uint32_t eax, edx;
+    __asm__ __volatile__( "xgetbv" : "=a"( eax ), "=d"( edx ) : "c"( 0 ) );
+    return ( uint64_t( edx ) << 32 ) | eax;
+#endif
+}
+
+static bool detect_avx2()
+{
+    unsigned regs[4];  // eax, ebx, ecx, edx
+    cpuid( 0, 0, regs );
+    if( regs[0] < 7 )
+        return false;
+
+    cpuid( 1, 0, regs );
+    bool const fma = ( regs[2] & ( 1u << 12 ) ) != 0;
+    bool const osxsave = ( regs[2] & ( 1u << 27 ) ) != 0;
+    bool const avx = ( regs[2] & ( 1u << 28 ) ) != 0;
+    if( ! fma || ! osxsave || ! avx )
+        return false;
+
+    // XMM and YMM state must both be enabled by the OS
+    if( ( xgetbv0() & 0x6 ) != 0x6 )
+        return false;
+
+    cpuid( 7, 0, regs );
+    return ( regs[1] & ( 1u << 5 ) ) != 0;
+}
+
+static bool detect_avx512()
+{
+    if( ! cpu_supports_avx2() )
+        return false;
+
+    // Opmask, and the upper halves of ZMM0-15 and all of ZMM16-31, on top of XMM and YMM
+    if( ( xgetbv0() & 0xe6 ) != 0xe6 )
+        return false;
+
+    unsigned regs[4];
+    cpuid( 7, 0, regs );
+    return ( regs[1] & ( 1u << 16 ) ) != 0;
+}
+
+#else
+
+static bool detect_avx2()
+{
+    return false;
+}
+
+static bool detect_avx512()
+{
+    return false;
+}
+
+#endif
+
+
+bool cpu_supports_avx2()
+{
+    static bool const supported = detect_avx2();
+    return supported;
+}
+
+
+bool cpu_supports_avx512()
+{
+    static bool const supported = detect_avx512();
+    return supported;
+}
+
+
+}  // namespace librealsense
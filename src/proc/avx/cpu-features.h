@@ -0,0 +1,20 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+
+namespace librealsense {
+
+
+// Runtime CPU feature detection, for processing blocks that carry code built for newer instruction sets than the
+// rest of the library and must only use it when the CPU (and OS) support it. Results are computed once and cached.
+
+// AVX2 together with FMA (every CPU with AVX2 we care about has both), with the OS saving the YMM registers
+bool cpu_supports_avx2();
+
+// AVX-512 Foundation on top of AVX2, with the OS saving the opmask and ZMM registers
+bool cpu_supports_avx512();
+
+
+}  // namespace librealsense
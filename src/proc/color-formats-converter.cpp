@@ -7,9 +7,9 @@
 #include "image-avx.h"
 #include "image.h"
 
-#define STB_IMAGE_STATIC
-#define STB_IMAGE_IMPLEMENTATION
-#include "../third-party/stb_image.h"
+#include <rsutils/string/from.h>
+
+#include <thread>
 
 #ifdef RS2_USE_CUDA
 #include "cuda/cuda-conversion.cuh"
@@ -1233,29 +1233,6 @@ namespace librealsense
         }
     }
 
-    /////////////////////////////
-    // MJPEG unpacking routines //
-    /////////////////////////////
-    void unpack_mjpeg( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size)
-    {
-        int w, h, bpp;
-        auto uncompressed_rgb = stbi_load_from_memory(source, actual_size, &w, &h, &bpp, false);
-        if (uncompressed_rgb)
-        {
-            auto uncompressed_size = w * h * bpp;
-            if (uncompressed_size != actual_size)
-            {
-                LOG_WARNING( "MJPEG decode size mismatch. Expected " << actual_size << ", got "
-                                                                     << uncompressed_size );
-                uncompressed_size = std::min( uncompressed_size, actual_size );
-            }
-            std::memcpy( dest[0], uncompressed_rgb, uncompressed_size );
-            stbi_image_free(uncompressed_rgb);
-        }
-        else
-            LOG_ERROR("mjpeg decode failed");
-    }
-
     /////////////////////////////
     // BGR unpacking routines //
     /////////////////////////////
@@ -1282,9 +1259,26 @@ namespace librealsense
         unpack_uyvyc(_target_format, _target_stream, dest, source, width, height, actual_size);
     }
 
+    mjpeg_converter::mjpeg_converter(const char* name, rs2_format target_format)
+        : color_converter(name, target_format)
+    {
+        if (!mjpeg_decoder::supports(target_format))
+            throw invalid_value_exception(rsutils::string::from() << "Unsupported MJPEG conversion to " << target_format);
+
+        _workers.register_option(*this);
+    }
+
     void mjpeg_converter::process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size)
     {
-        unpack_mjpeg(dest, source, width, height, actual_size, input_size);
+        _workers.update();
+
+        // The size of the compressed data, or at least of its buffer (see functional_processing_block). The bands are
+        // found by scanning the data, so without it there's no telling where to stop: the decoder has to find the EOI
+        // by itself, in one pass.
+        bool const size_known = input_size > 0;
+        size_t const size = size_known ? input_size : actual_size;
+        if (!_decoder.decode(source, size, _target_format, dest[0], width, height, size_known ? _workers.get() : nullptr))
+            LOG_ERROR("mjpeg decode failed");
     }
 
     void bgr_to_rgb::process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size)
@@ -4,6 +4,9 @@
 #pragma once
 
 #include "synthetic-stream.h"
+#include "mjpeg-decoder.h"
+
+#include "processing-workers.h"
 
 namespace librealsense
 {
@@ -38,6 +41,8 @@ namespace librealsense
         void process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size) override;
     };
 
+    // Decodes to RGB8, BGR8, RGBA8 or Y8; with RS2_OPTION_PROCESSING_THREADS, frames with restart markers are split
+    // between threads (see mjpeg_decoder)
     class LRS_EXTENSION_API mjpeg_converter : public color_converter
     {
     public:
@@ -45,9 +50,12 @@ namespace librealsense
             mjpeg_converter("MJPEG Converter", target_format) {};
 
     protected:
-        mjpeg_converter(const char* name, rs2_format target_format) :
-            color_converter(name, target_format) {};
+        mjpeg_converter(const char* name, rs2_format target_format);
         void process_function( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size, int input_size) override;
+
+    private:
+        mjpeg_decoder _decoder;
+        processing_workers _workers;
     };
 
     class LRS_EXTENSION_API bgr_to_rgb : public color_converter
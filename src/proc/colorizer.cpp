@@ -11,6 +11,9 @@
 #include "colorizer.h"
 #include "disparity-transform.h"
 
+#include <algorithm>
+#include <thread>
+
 namespace librealsense
 {
     static color_map hue{ {
@@ -145,6 +148,7 @@ namespace librealsense
     {
         _histogram = std::vector<int>(MAX_DEPTH, 0);
         _hist_data = _histogram.data();
+        _lut.resize(MAX_DEPTH * 3);
         _stream_filter.stream = RS2_STREAM_DEPTH;
         _stream_filter.format = RS2_FORMAT_Z16;
 
@@ -238,6 +242,110 @@ namespace librealsense
         register_option(RS2_OPTION_VISUAL_PRESET, preset_opt);
 
         register_option(RS2_OPTION_HISTOGRAM_EQUALIZATION_ENABLED, hist_opt);
+
+        _workers.register_option(*this);
+    }
+
+    void colorizer::update_histogram_z16(const uint16_t* depth_data, int w, int h)
+    {
+        const size_t pixels = size_t(w) * h;
+        const size_t bands = _workers ? _workers->size() : 1;
+        std::vector<int> band_max(bands, 0);
+
+        auto count = [&](int* hist, size_t band)
+        {
+            memset(hist, 0, MAX_DEPTH * sizeof(int));
+            int max_value = 0;
+            for (auto i = pixels * band / bands, end = pixels * (band + 1) / bands; i < end; ++i)
+            {
+                int index = depth_data[i];
+                hist[index] += 1;
+                max_value = std::max(max_value, index);
+            }
+            band_max[band] = max_value;
+        };
+
+        if (bands == 1)
+        {
+            count(_hist_data, 0);
+        }
+        else
+        {
+            _partial_histograms.resize(bands * MAX_DEPTH);
+            _workers->parallel_for(bands, [&](size_t begin, size_t end)
+            {
+                for (auto band = begin; band < end; ++band)
+                    count(_partial_histograms.data() + band * MAX_DEPTH, band);
+            });
+
+            // Merge the partial histograms, splitting the depth values between the threads
+            _workers->parallel_for(MAX_DEPTH, [&](size_t begin, size_t end)
+            {
+                for (auto i = begin; i < end; ++i)
+                {
+                    int sum = 0;
+                    for (size_t band = 0; band < bands; ++band)
+                        sum += _partial_histograms[band * MAX_DEPTH + i];
+                    _hist_data[i] = sum;
+                }
+            }, 4096);
+        }
+
+        for (auto i = 2; i < MAX_DEPTH; ++i) _hist_data[i] += _hist_data[i - 1]; // Build a cumulative histogram for the indices in [1,0xFFFF]
+        _max_depth_value = *std::max_element(band_max.begin(), band_max.end());
+    }
+
+    void colorizer::make_rgb_data_z16(const uint16_t* depth_data, uint8_t* rgb_data, int width, int height)
+    {
+        auto lut = _lut.data();
+        auto rows = [&](size_t begin, size_t end)
+        {
+            for (auto i = begin * width, last = end * width; i < last; ++i)
+            {
+                auto c = lut + depth_data[i] * 3;
+                rgb_data[i * 3 + 0] = c[0];
+                rgb_data[i * 3 + 1] = c[1];
+                rgb_data[i * 3 + 2] = c[2];
+            }
+        };
+        if (_workers)
+            _workers->parallel_for(height, rows, 16);
+        else
+            rows(0, height);
+    }
+
+    void colorizer::make_equalized_z16(const uint16_t* depth_data, uint8_t* rgb_data, int width, int height)
+    {
+        update_histogram_z16(depth_data, width, height);
+        auto coloring_function = [this](float data) {
+            auto hist_data = _hist_data[(int)data];
+            auto pixels = (float)_hist_data[MAX_DEPTH - 1];
+            return (hist_data / pixels);
+        };
+        // The histogram changes every frame, but only the values actually present need a color
+        fill_lut(1, _max_depth_value, coloring_function);
+        _lut_valid = false;
+        make_rgb_data_z16(depth_data, rgb_data, width, height);
+    }
+
+    void colorizer::make_value_cropped_z16(const uint16_t* depth_data, uint8_t* rgb_data, int width, int height)
+    {
+        auto min = _min;
+        auto max = _max;
+        auto coloring_function = [&, this](float data) {
+            if (min >= max) return 0.f;
+            return (data * _depth_units - min) / (max - min);
+        };
+        if (!_lut_valid || _lut_map_index != _map_index || _lut_min != min || _lut_max != max || _lut_depth_units != _depth_units)
+        {
+            fill_lut(1, MAX_DEPTH - 1, coloring_function);
+            _lut_valid = true;
+            _lut_map_index = _map_index;
+            _lut_min = min;
+            _lut_max = max;
+            _lut_depth_units = _depth_units;
+        }
+        make_rgb_data_z16(depth_data, rgb_data, width, height);
     }
 
     bool colorizer::should_process(const rs2::frame& frame)
@@ -267,6 +375,8 @@ namespace librealsense
             _d2d_convert_factor = 681678.625;
         }
 
+        _workers.update();
+
         auto make_equalized_histogram = [this](const rs2::video_frame& depth, rs2::video_frame rgb)
         {
             auto depth_format = depth.get_profile().format();
@@ -286,9 +396,7 @@ namespace librealsense
             }
             else if (depth_format == RS2_FORMAT_Z16)
             {
-                auto depth_data = reinterpret_cast<const uint16_t*>(depth.get_data());
-                update_histogram(_hist_data, depth_data, w, h);
-                make_rgb_data<uint16_t>(depth_data, rgb_data, w, h, coloring_function);
+                make_equalized_z16(reinterpret_cast<const uint16_t*>(depth.get_data()), rgb_data, w, h);
             }
         };
 
@@ -314,14 +422,7 @@ namespace librealsense
             }
             else if (depth_format == RS2_FORMAT_Z16)
             {
-                auto depth_data = reinterpret_cast<const uint16_t*>(depth.get_data());
-                auto min = _min;
-                auto max = _max;
-                auto coloring_function = [&, this](float data) {
-                    if (min >= max) return 0.f;
-                    return (data * _depth_units - min) / (max - min);
-                };
-                make_rgb_data<uint16_t>(depth_data, rgb_data, w, h, coloring_function);
+                make_value_cropped_z16(reinterpret_cast<const uint16_t*>(depth.get_data()), rgb_data, w, h);
             }
         };
 
@@ -3,6 +3,7 @@
 #pragma once
 
 #include <src/float3.h>
+#include "processing-workers.h"
 
 #include <map>
 #include <vector>
@@ -125,6 +126,27 @@ namespace librealsense {
         bool should_process(const rs2::frame& frame) override;
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
 
+        // The Z16 path: the histogram is built in bands, each counted into its own partial histogram, and every pixel
+        // then takes its color from _lut, where each depth value present was colored once
+        void update_histogram_z16(const uint16_t* depth_data, int w, int h);
+        void make_rgb_data_z16(const uint16_t* depth_data, uint8_t* rgb_data, int width, int height);
+        void make_equalized_z16(const uint16_t* depth_data, uint8_t* rgb_data, int width, int height);
+        void make_value_cropped_z16(const uint16_t* depth_data, uint8_t* rgb_data, int width, int height);
+
+        template<typename F>
+        void fill_lut(int first, int last, F coloring_func)
+        {
+            auto cm = _maps[_map_index];
+            _lut[0] = _lut[1] = _lut[2] = 0;  // no depth
+            for (auto d = first; d <= last; ++d)
+            {
+                auto c = cm->get(coloring_func(float(d)));
+                _lut[d * 3 + 0] = (uint8_t)c.x;
+                _lut[d * 3 + 1] = (uint8_t)c.y;
+                _lut[d * 3 + 2] = (uint8_t)c.z;
+            }
+        }
+
         template<typename T, typename F>
         void make_rgb_data(const T* depth_data, uint8_t* rgb_data, int width, int height, F coloring_func)
         {
@@ -163,6 +185,16 @@ namespace librealsense {
 
         std::vector<int> _histogram;
         int* _hist_data;
+        std::vector<int> _partial_histograms;  // one per band, when the histogram is built in parallel
+        int _max_depth_value = 0;             // the largest depth value in the last histogram
+
+        // RGB per Z16 depth value; with a fixed range it's kept as long as these don't change
+        std::vector<uint8_t> _lut;
+        bool _lut_valid = false;
+        int _lut_map_index = 0;
+        float _lut_min = 0.f, _lut_max = 0.f, _lut_depth_units = 0.f;
+
+        processing_workers _workers;
 
         int _preset = 0;
         rs2::stream_profile _target_stream_profile;
@@ -15,6 +15,14 @@
 
 #include <rsutils/string/from.h>
 
+#ifdef __SSSE3__
+#include <tmmintrin.h> // For SSSE3 intrinsics
+#endif
+#if defined(__ARM_NEON) && defined(BUILD_WITH_NEON) && !defined(ANDROID)
+#include <arm_neon.h>
+#define DECIMATION_NEON
+#endif
+
 
 #define PIX_SORT(a,b) { if ((a)>(b)) PIX_SWAP((a),(b)); }
 #define PIX_SWAP(a,b) { pixelvalue temp=(a);(a)=(b);(b)=temp; }
@@ -196,6 +204,175 @@ namespace librealsense
         return PIX_MIN(p[4], p[2]);
     }
 
+#if defined(__SSSE3__) || defined(DECIMATION_NEON)
+
+    // Vectorized medians of the 2x2 and 3x3 patches, 8 output pixels at a time: each lane works on a different
+    // output pixel, and the patch is sorted with a sorting network of min/max operations.
+    //
+    // Invalid (zero) pixels are mapped above all valid ones, so they sort to the end: with k valid pixels the median
+    // is then element (k-1)/2 -- the same member the scalar path picks (one below the middle for even k). With no
+    // valid pixels at all, element 0 is itself invalid and maps back to zero.
+
+#ifdef __SSSE3__
+    typedef __m128i pixel8;
+
+    // Valid pixels 1..65535 map to -32768..32766 and zero to 32767, so signed 16-bit min/max (SSE2) sort them
+    inline pixel8 to_sortable(pixel8 v) { return _mm_xor_si128(_mm_sub_epi16(v, _mm_set1_epi16(1)), _mm_set1_epi16(-32768)); }
+    inline pixel8 from_sortable(pixel8 v) { return _mm_add_epi16(_mm_xor_si128(v, _mm_set1_epi16(-32768)), _mm_set1_epi16(1)); }
+    inline pixel8 is_zero(pixel8 v) { return _mm_cmpeq_epi16(v, _mm_setzero_si128()); }
+    inline void pix_sort(pixel8 & a, pixel8 & b)
+    {
+        pixel8 t = _mm_min_epi16(a, b);
+        b = _mm_max_epi16(a, b);
+        a = t;
+    }
+    inline pixel8 select(pixel8 mask, pixel8 a, pixel8 b) { return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b)); }
+
+    // Load 8 patches from a row: lane j of the m-th result gets row[scale*j + m]
+    template <int S>
+    struct deinterleave_masks
+    {
+        pixel8 mask[S][S];  // [m][source vector]
+
+        deinterleave_masks()
+        {
+            for (int m = 0; m < S; ++m)
+                for (int v = 0; v < S; ++v)
+                {
+                    uint8_t bytes[16];
+                    for (int j = 0; j < 8; ++j)
+                    {
+                        int idx = S * j + m;
+                        bool here = idx / 8 == v;
+                        bytes[2 * j] = here ? uint8_t(2 * (idx % 8)) : 0x80;
+                        bytes[2 * j + 1] = here ? uint8_t(2 * (idx % 8) + 1) : 0x80;
+                    }
+                    mask[m][v] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+                }
+        }
+    };
+
+    template <int S>
+    inline void load_patches(const uint16_t * row, pixel8 * out)
+    {
+        static const deinterleave_masks<S> masks;
+        pixel8 in[S];
+        for (int v = 0; v < S; ++v)
+            in[v] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + 8 * v));
+        for (int m = 0; m < S; ++m)
+        {
+            pixel8 c = _mm_shuffle_epi8(in[0], masks.mask[m][0]);
+            for (int v = 1; v < S; ++v)
+                c = _mm_or_si128(c, _mm_shuffle_epi8(in[v], masks.mask[m][v]));
+            out[m] = c;
+        }
+    }
+
+    inline pixel8 count_zero(pixel8 count, pixel8 v) { return _mm_sub_epi16(count, is_zero(v)); }
+    inline pixel8 median_index(pixel8 zeros, int n) { return _mm_srai_epi16(_mm_sub_epi16(_mm_set1_epi16(int16_t(n - 1)), zeros), 1); }
+    inline pixel8 lane_equals(pixel8 v, int i) { return _mm_cmpeq_epi16(v, _mm_set1_epi16(int16_t(i))); }
+    inline pixel8 zero8() { return _mm_setzero_si128(); }
+    inline void store8(uint16_t * out, pixel8 v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(out), v); }
+#else
+    typedef uint16x8_t pixel8;
+
+    // Valid pixels 1..65535 map to 0..65534 and zero to 65535
+    inline pixel8 to_sortable(pixel8 v) { return vsubq_u16(v, vdupq_n_u16(1)); }
+    inline pixel8 from_sortable(pixel8 v) { return vaddq_u16(v, vdupq_n_u16(1)); }
+    inline void pix_sort(pixel8 & a, pixel8 & b)
+    {
+        pixel8 t = vminq_u16(a, b);
+        b = vmaxq_u16(a, b);
+        a = t;
+    }
+    inline pixel8 select(pixel8 mask, pixel8 a, pixel8 b) { return vbslq_u16(mask, a, b); }
+
+    template <int S>
+    inline void load_patches(const uint16_t * row, pixel8 * out);
+
+    template <>
+    inline void load_patches<2>(const uint16_t * row, pixel8 * out)
+    {
+        uint16x8x2_t in = vld2q_u16(row);
+        out[0] = in.val[0];
+        out[1] = in.val[1];
+    }
+
+    template <>
+    inline void load_patches<3>(const uint16_t * row, pixel8 * out)
+    {
+        uint16x8x3_t in = vld3q_u16(row);
+        out[0] = in.val[0];
+        out[1] = in.val[1];
+        out[2] = in.val[2];
+    }
+
+    inline pixel8 count_zero(pixel8 count, pixel8 v) { return vsubq_u16(count, vceqq_u16(v, vdupq_n_u16(0))); }
+    inline pixel8 median_index(pixel8 zeros, int n)
+    {
+        return vreinterpretq_u16_s16(vshrq_n_s16(vreinterpretq_s16_u16(vsubq_u16(vdupq_n_u16(uint16_t(n - 1)), zeros)), 1));
+    }
+    inline pixel8 lane_equals(pixel8 v, int i) { return vceqq_u16(v, vdupq_n_u16(uint16_t(i))); }
+    inline pixel8 zero8() { return vdupq_n_u16(0); }
+    inline void store8(uint16_t * out, pixel8 v) { vst1q_u16(out, v); }
+#endif
+
+    // Only the lower half of the sorted patch is needed, but the networks below sort it completely
+    inline void sort_network(pixel8 (&p)[4])
+    {
+        pix_sort(p[0], p[1]); pix_sort(p[2], p[3]);
+        pix_sort(p[0], p[2]); pix_sort(p[1], p[3]);
+        pix_sort(p[1], p[2]);
+    }
+
+    inline void sort_network(pixel8 (&p)[9])
+    {
+        pix_sort(p[0], p[3]); pix_sort(p[1], p[7]); pix_sort(p[2], p[5]); pix_sort(p[4], p[8]);
+        pix_sort(p[0], p[7]); pix_sort(p[2], p[4]); pix_sort(p[3], p[8]); pix_sort(p[5], p[6]);
+        pix_sort(p[0], p[2]); pix_sort(p[1], p[3]); pix_sort(p[4], p[5]); pix_sort(p[7], p[8]);
+        pix_sort(p[1], p[4]); pix_sort(p[3], p[6]); pix_sort(p[5], p[7]);
+        pix_sort(p[0], p[1]); pix_sort(p[2], p[4]); pix_sort(p[3], p[5]); pix_sort(p[6], p[8]);
+        pix_sort(p[2], p[3]); pix_sort(p[4], p[5]); pix_sort(p[6], p[7]);
+        pix_sort(p[1], p[2]); pix_sort(p[3], p[4]); pix_sort(p[5], p[6]);
+    }
+
+    // Median of the SxS patches of 8 consecutive output pixels; 'rows' point at the first input pixel of each row
+    template <int S>
+    inline void median8(const uint16_t * const * rows, size_t offset, uint16_t * out)
+    {
+        pixel8 p[S * S];
+        pixel8 zeros = zero8();
+        for (int n = 0; n < S; ++n)
+        {
+            load_patches<S>(rows[n] + offset, p + n * S);
+            for (int m = 0; m < S; ++m)
+            {
+                zeros = count_zero(zeros, p[n * S + m]);
+                p[n * S + m] = to_sortable(p[n * S + m]);
+            }
+        }
+
+        sort_network(p);
+
+        pixel8 idx = median_index(zeros, S * S);
+        pixel8 median = p[0];
+        for (int i = 1; i <= (S * S - 1) / 2; ++i)
+            median = select(lane_equals(idx, i), p[i], median);
+        store8(out, from_sortable(median));
+    }
+
+    // Returns how many of the output pixels were done; the rest are left for the scalar code
+    template <int S>
+    size_t median_row_simd(const uint16_t * const * rows, uint16_t * out, size_t width_out)
+    {
+        size_t i = 0;
+        for (; i + 8 <= width_out; i += 8)
+            median8<S>(rows, i * S, out + i);
+        return i;
+    }
+
+#endif
+
     const uint8_t decimation_min_val = 1;
     const uint8_t decimation_max_val = 8;    // Decimation levels according to the reference design
     const uint8_t decimation_default_val = 2;
@@ -245,12 +422,15 @@ namespace librealsense
             }
         });
 
+
         register_option(RS2_OPTION_FILTER_MAGNITUDE, decimation_control);
+        _workers.register_option(*this);
     }
 
     rs2::frame decimation_filter::process_frame(const rs2::frame_source& source, const rs2::frame& f)
     {
         update_output_profile(f);
+        _workers.update();
 
         auto src = f.as<rs2::video_frame>();
         rs2::stream_profile profile = f.get_profile();
@@ -282,6 +462,26 @@ namespace librealsense
         return f;
     }
 
+    rs2::frame decimation_filter::decimate(const rs2::frame_source& source, const rs2::frame& f,
+        std::function<void(const rs2::frame&)> const& prepare, range_fn const& then)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        update_output_profile(f);
+        _workers.update();
+
+        auto src = f.as<rs2::video_frame>();
+        if (auto tgt = prepare_target_frame(f, source, RS2_EXTENSION_DEPTH_FRAME))
+        {
+            prepare(tgt);
+            decimate_depth(static_cast<const uint16_t*>(src.get_data()),
+                static_cast<uint16_t*>(const_cast<void*>(tgt.get_data())),
+                src.get_width(), src.get_height(), this->_patch_size, &then);
+            return tgt;
+        }
+        return f;
+    }
+
     void  decimation_filter::update_output_profile(const rs2::frame& f)
     {
         if (_options_changed || f.get_profile().get() != _source_stream_profile.get())
@@ -374,7 +574,34 @@ namespace librealsense
     }
 
     void decimation_filter::decimate_depth(const uint16_t * frame_data_in, uint16_t * frame_data_out,
-        size_t width_in, size_t height_in, size_t scale)
+        size_t width_in, size_t height_in, size_t scale, range_fn const* then)
+    {
+        // Output rows are independent: split them between the worker threads, if any
+        auto rows = [&](size_t begin, size_t end)
+        {
+            decimate_depth_rows(frame_data_in + begin * scale * width_in, frame_data_out + begin * _padded_width,
+                width_in, scale, end - begin);
+            if (then)
+                (*then)(begin, end);
+        };
+        if (_workers)
+            _workers->parallel_for(_real_height, rows, 4);
+        else
+            rows(0, _real_height);
+
+        // Fill-in the padded rows with zeros
+        frame_data_out += size_t(_real_height) * _padded_width;
+        for (auto v = _real_height; v < _padded_height; ++v)
+        {
+            for (auto u = 0; u < _padded_width; ++u)
+                *frame_data_out++ = 0;
+        }
+        if (then && _padded_height > _real_height)
+            (*then)(_real_height, _padded_height);
+    }
+
+    void decimation_filter::decimate_depth_rows(const uint16_t * frame_data_in, uint16_t * frame_data_out,
+        size_t width_in, size_t scale, size_t n_rows)
     {
         // Use median filtering
         std::vector<uint16_t> working_kernel(_kernel_size);
@@ -385,14 +612,21 @@ namespace librealsense
 
         if (scale == 2 || scale == 3)
         {
-            for (int j = 0; j < _real_height; j++)
+            for (size_t j = 0; j < n_rows; j++)
             {
                 uint16_t *p{};
                 // Mark the beginning of each of the N lines that the filter will run upon
                 for (size_t i = 0; i < pixel_raws.size(); i++)
                     pixel_raws[i] = block_start + (width_in*i);
 
-                for (size_t i = 0, chunk_offset = 0; i < _real_width; i++)
+                size_t i = 0, chunk_offset = 0;
+#if defined(__SSSE3__) || defined(DECIMATION_NEON)
+                i = (scale == 2) ? median_row_simd<2>(pixel_raws.data(), frame_data_out, _real_width)
+                                 : median_row_simd<3>(pixel_raws.data(), frame_data_out, _real_width);
+                frame_data_out += i;
+                chunk_offset = i * scale;
+#endif
+                for (; i < _real_width; i++)
                 {
                     wk_itr = wk_begin;
                     // extract data the kernel to process
@@ -457,7 +691,7 @@ namespace librealsense
         }
         else
         {
-            for (int j = 0; j < _real_height; j++)
+            for (size_t j = 0; j < n_rows; j++)
             {
                 uint16_t *p{};
                 // Mark the beginning of each of the N lines that the filter will run upon
@@ -495,13 +729,6 @@ namespace librealsense
                 block_start += width_in * scale;
             }
         }
-
-        // Fill-in the padded rows with zeros
-        for (auto v = _real_height; v < _padded_height; ++v)
-        {
-            for (auto u = 0; u < _padded_width; ++u)
-                *frame_data_out++ = 0;
-        }
     }
 
     void decimation_filter::decimate_others(rs2_format format, const void * frame_data_in, void * frame_data_out,
@@ -7,6 +7,8 @@
 #include "../include/librealsense2/hpp/rs_processing.hpp"
 #include "proc/synthetic-stream.h"
 
+#include "processing-workers.h"
+
 namespace librealsense
 {
 
@@ -15,11 +17,23 @@ namespace librealsense
     public:
         decimation_filter();
 
+        typedef rsutils::concurrency::worker_pool::range_fn range_fn;
+
+        // Decimates a Z16 depth frame on behalf of another block (see depth_pipeline), with this block's options,
+        // into a frame allocated from 'source'. 'prepare' is called with that frame before any of it is written; then
+        // 'then' is called on each band of output rows [begin, end) as soon as it's written, from the same thread, so
+        // the caller can go on working on it while it's still in cache. Like process_frame, gives 'f' itself when there
+        // is no frame to decimate into, without calling either.
+        rs2::frame decimate(const rs2::frame_source& source, const rs2::frame& f,
+            std::function<void(const rs2::frame&)> const& prepare, range_fn const& then);
+
     protected:
-        rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source, rs2_extension tgt_type);
+        virtual rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source, rs2_extension tgt_type);
 
         void decimate_depth(const uint16_t * frame_data_in, uint16_t * frame_data_out,
-            size_t width_in, size_t height_in, size_t scale);
+            size_t width_in, size_t height_in, size_t scale, range_fn const* then = nullptr);
+        void decimate_depth_rows(const uint16_t * frame_data_in, uint16_t * frame_data_out,
+            size_t width_in, size_t scale, size_t n_rows);
 
         void decimate_others(rs2_format format, const void * frame_data_in, void * frame_data_out,
             size_t width_in, size_t height_in, size_t scale);
@@ -41,6 +55,7 @@ namespace librealsense
         uint16_t                _padded_height;
         bool                    _recalc_profile;
         bool                    _options_changed;   // Tracking changes imposed by user
+        processing_workers      _workers;
     };
     MAP_EXTENSION(RS2_EXTENSION_DECIMATION_FILTER, librealsense::decimation_filter);
 }
@@ -0,0 +1,123 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include <librealsense2/hpp/rs_sensor.hpp>
+#include <librealsense2/hpp/rs_processing.hpp>
+#include "option.h"
+#include "proc/depth-pipeline.h"
+
+
+namespace librealsense
+{
+    depth_pipeline::depth_pipeline(std::shared_ptr<decimation_filter> decimation,
+                                   std::shared_ptr<spatial_filter> spatial,
+                                   std::shared_ptr<temporal_filter> temporal)
+        : depth_processing_block("Depth Pipeline")
+        , _decimation(std::move(decimation))
+        , _spatial(std::move(spatial))
+        , _temporal(std::move(temporal))
+    {
+        _stream_filter.stream = RS2_STREAM_DEPTH;
+        _stream_filter.format = RS2_FORMAT_Z16;
+    }
+
+    bool depth_pipeline::should_process(const rs2::frame& frame)
+    {
+        // The chain starts from depth: disparity input would not go through the disparity transforms
+        return depth_processing_block::should_process(frame)
+            && frame.get_profile().format() == RS2_FORMAT_Z16
+            && !frame.is<rs2::disparity_frame>();
+    }
+
+    rs2::frame depth_pipeline::process_frame(const rs2::frame_source& source, const rs2::frame& f)
+    {
+        rs2::frame tgt;
+        uint16_t* depth = nullptr;
+        size_t width = 0, height = 0;
+
+        // Called with the output frame before any of its data is written, and the frame the depth-to-disparity block
+        // would see
+        auto prepare = [&](const rs2::frame& out, const rs2::frame& disparity_input)
+        {
+            update_disparity_info(disparity_input);
+
+            auto vf = out.as<rs2::video_frame>();
+            width = vf.get_width();
+            height = vf.get_height();
+            depth = static_cast<uint16_t*>(const_cast<void*>(out.get_data()));
+            if (_disparity_info.stereoscopic_depth)
+                _disparity.resize(width * height);
+        };
+
+        if (_decimation)
+        {
+            tgt = _decimation->decimate(source, f, [&](const rs2::frame& out) { prepare(out, out); },
+                [&](size_t row_begin, size_t row_end)
+            {
+                if (_disparity_info.stereoscopic_depth)
+                    convert_disparity(depth + row_begin * width, _disparity.data() + row_begin * width,
+                        (row_end - row_begin) * width, _disparity_info.d2d_convert_factor);
+            });
+        }
+        // When the decimation block lets the frame through as is, the rest of the chain works on it as is too
+        if (!_decimation || tgt.get() == f.get())
+        {
+            tgt = prepare_target_frame(f, source);
+            prepare(tgt, f);
+            if (_disparity_info.stereoscopic_depth)
+                convert_disparity(static_cast<const uint16_t*>(f.get_data()), _disparity.data(), width * height,
+                    _disparity_info.d2d_convert_factor);
+            else
+                memmove(depth, f.get_data(), width * height * sizeof(uint16_t));
+        }
+
+        if (_disparity_info.stereoscopic_depth)
+        {
+            auto disparity = _disparity.data();
+            if (_spatial)
+                _spatial->filter_in_place(disparity, width, height, true);
+
+            // The disparity-to-depth block reads the same intrinsics and units, so the factor is the same
+            auto to_depth = [&](size_t begin, size_t end)
+            {
+                convert_disparity(disparity + begin, depth + begin, end - begin, _disparity_info.d2d_convert_factor);
+            };
+            if (_temporal)
+                _temporal->filter_in_place(disparity, width, height, true, to_depth);
+            else
+                to_depth(0, width * height);
+        }
+        else
+        {
+            // Without a stereo sensor the disparity transforms let depth through as is
+            if (_spatial)
+                _spatial->filter_in_place(depth, width, height, false);
+            if (_temporal)
+                _temporal->filter_in_place(depth, width, height, false, [](size_t, size_t) {});
+        }
+
+        return tgt;
+    }
+
+    void depth_pipeline::update_disparity_info(const rs2::frame& f)
+    {
+        if (f.get_profile().get() != _disparity_profile.get())
+        {
+            _disparity_profile = f.get_profile();
+            _disparity_info = disparity_info::update_info_from_frame(f);
+        }
+    }
+
+    rs2::frame depth_pipeline::prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source)
+    {
+        if (f.get_profile().get() != _source_stream_profile.get())
+        {
+            _source_stream_profile = f.get_profile();
+            _target_stream_profile = _source_stream_profile.clone(RS2_STREAM_DEPTH, 0, _source_stream_profile.format());
+        }
+
+        auto vf = f.as<rs2::video_frame>();
+        return source.allocate_video_frame(_target_stream_profile, f, vf.get_bytes_per_pixel(), vf.get_width(),
+            vf.get_height(), vf.get_width() * vf.get_bytes_per_pixel(), RS2_EXTENSION_DEPTH_FRAME);
+    }
+}
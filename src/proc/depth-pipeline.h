@@ -0,0 +1,48 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+// Runs the decimation -> depth to disparity -> spatial -> temporal -> disparity to depth chain as a single block
+
+#pragma once
+
+#include "proc/synthetic-stream.h"
+#include "proc/decimation-filter.h"
+#include "proc/spatial-filter.h"
+#include "proc/temporal-filter.h"
+#include "proc/disparity-transform.h"
+
+#include <vector>
+#include <memory>
+
+namespace librealsense
+{
+    // The output is exactly that of the chained blocks, but the frame goes through memory fewer times:
+    // rows are converted to disparity as soon as they are decimated, and temporal filtering converts the result back
+    // to depth tile by tile, so the only intermediate buffer is the disparity image the spatial filter works on.
+    // The stages are the user's own blocks, options included; any of them may be left out.
+    class depth_pipeline : public depth_processing_block
+    {
+    public:
+        depth_pipeline(std::shared_ptr<decimation_filter> decimation,
+                       std::shared_ptr<spatial_filter> spatial,
+                       std::shared_ptr<temporal_filter> temporal);
+
+    protected:
+        bool should_process(const rs2::frame& frame) override;
+        rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
+
+    private:
+        void update_disparity_info(const rs2::frame& f);
+        rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source);
+
+        std::shared_ptr<decimation_filter>  _decimation;
+        std::shared_ptr<spatial_filter>     _spatial;
+        std::shared_ptr<temporal_filter>    _temporal;
+
+        rs2::stream_profile     _source_stream_profile;     // Used only without decimation
+        rs2::stream_profile     _target_stream_profile;
+        rs2::stream_profile     _disparity_profile;         // The one _disparity_info comes from
+        disparity_info::info    _disparity_info;
+        std::vector<float>      _disparity;
+    };
+    MAP_EXTENSION(RS2_EXTENSION_DEPTH_PIPELINE, librealsense::depth_pipeline);
+}
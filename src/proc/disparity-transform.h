@@ -14,6 +14,30 @@
 
 namespace librealsense
 {
+    // Converts 'count' depth values to disparity, or back (the conversion is its own inverse, up to rounding).
+    // Shared with depth_pipeline, which must produce the very same values as this block does.
+    template<typename Tin, typename Tout>
+    void convert_disparity(const Tin* in, Tout* out, size_t count, float d2d_convert_factor)
+    {
+        static_assert((std::is_arithmetic<Tin>::value), "disparity transform requires numeric type for input data");
+        static_assert((std::is_arithmetic<Tout>::value), "disparity transform requires numeric type for output data");
+
+        const bool fp = (std::is_floating_point<Tin>::value);
+        const float round = fp ? 0.5f : 0.f;
+
+        float input{};
+        //TODO SSE optimize
+        for (size_t i = 0; i < count; i++)
+        {
+            input = *in;
+            if (std::isnormal(input))
+                *out++ = static_cast<Tout>((d2d_convert_factor / input)+round);
+            else
+                *out++ = 0;
+            in++;
+        }
+    }
+
     class disparity_transform : public generic_processing_block
     {
     public:
@@ -27,27 +51,8 @@ namespace librealsense
         template<typename Tin, typename Tout>
         void convert(const void* in_data, void* out_data)
         {
-            static_assert((std::is_arithmetic<Tin>::value), "disparity transform requires numeric type for input data");
-            static_assert((std::is_arithmetic<Tout>::value), "disparity transform requires numeric type for output data");
-
-            auto in = reinterpret_cast<const Tin*>(in_data);
-            auto out = reinterpret_cast<Tout*>(out_data);
-
-            const bool fp = (std::is_floating_point<Tin>::value);
-            const float round = fp ? 0.5f : 0.f;
-
-            float input{};
-            //TODO SSE optimize
-            for (size_t i = 0; i < _height; i++)
-                for (size_t j = 0; j < _width; j++)
-                {
-                    input = *in;
-                    if (std::isnormal(input))
-                        *out++ = static_cast<Tout>((_d2d_convert_factor / input)+round);
-                    else
-                        *out++ = 0;
-                    in++;
-                }
+            convert_disparity(reinterpret_cast<const Tin*>(in_data), reinterpret_cast<Tout*>(out_data),
+                _width * _height, _d2d_convert_factor);
         }
 
     private:
@@ -0,0 +1,380 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "mjpeg-decoder.h"
+
+#include <rsutils/concurrency/worker-pool.h>
+#include <rsutils/easylogging/easyloggingpp.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#ifdef RS2_USE_LIBJPEG_TURBO
+#include <cstdio> // jpeglib.h needs FILE
+#include <csetjmp>
+#include <jpeglib.h>
+#if ! defined( JCS_EXTENSIONS ) || ! defined( JCS_ALPHA_EXTENSIONS )
+#error "BUILD_WITH_LIBJPEG_TURBO needs libjpeg-turbo, for its BGR/RGBA output"
+#endif
+#else
+#define STB_IMAGE_STATIC
+#define STB_IMAGE_IMPLEMENTATION
+#include "../third-party/stb_image.h"
+#endif
+
+namespace librealsense
+{
+    namespace
+    {
+        // What is needed of a JPEG's headers to cut it into bands
+        struct jpeg_layout
+        {
+            size_t header_size = 0;   // SOI through the end of the SOS segment
+            size_t height_offset = 0; // of the frame height, in the SOF segment
+            int width = 0;
+            int height = 0;
+            int mcu_width = 0;
+            int mcu_height = 0;
+            int restart_interval = 0; // in MCUs, or 0 if there are no restart markers
+            bool vertical_upsampling = false;
+        };
+
+        int read_u16(const uint8_t* p)
+        {
+            return (p[0] << 8) | p[1];
+        }
+
+        size_t gcd(size_t a, size_t b)
+        {
+            while (b)
+            {
+                auto r = a % b;
+                a = b;
+                b = r;
+            }
+            return a;
+        }
+
+        // Only a single-scan, Huffman-coded sequential JPEG (what cameras send) can be split
+        bool parse_layout(const uint8_t* jpeg, size_t size, jpeg_layout& layout)
+        {
+            if (size < 4 || jpeg[0] != 0xFF || jpeg[1] != 0xD8)
+                return false;
+
+            int components = 0;
+            size_t pos = 2;
+            while (pos + 4 <= size)
+            {
+                if (jpeg[pos] != 0xFF)
+                    return false;
+                uint8_t const marker = jpeg[pos + 1];
+                if (marker == 0xFF) // fill byte
+                {
+                    ++pos;
+                    continue;
+                }
+                size_t const length = read_u16(jpeg + pos + 2);
+                if (length < 2 || pos + 2 + length > size)
+                    return false;
+                const uint8_t* segment = jpeg + pos + 4;
+
+                switch (marker)
+                {
+                case 0xC0: // SOF0: baseline
+                case 0xC1: // SOF1: extended sequential
+                {
+                    if (length < 8 || segment[0] != 8)
+                        return false;
+                    layout.height_offset = pos + 5;
+                    layout.height = read_u16(segment + 1);
+                    layout.width = read_u16(segment + 3);
+                    components = segment[5];
+                    if (!components || length < 8 + 3 * size_t(components))
+                        return false;
+
+                    int h_max = 1, v_max = 1, v_min = 4;
+                    for (int i = 0; i < components; ++i)
+                    {
+                        h_max = std::max(h_max, segment[7 + 3 * i] >> 4);
+                        v_max = std::max(v_max, segment[7 + 3 * i] & 0x0F);
+                        v_min = std::min(v_min, segment[7 + 3 * i] & 0x0F);
+                    }
+                    // Upsampling (e.g., of 4:2:0 chroma) blends in the rows above and below
+                    layout.vertical_upsampling = v_min < v_max;
+                    // A scan of one component is not interleaved: its MCU is a single block, whatever the sampling
+                    layout.mcu_width = components == 1 ? 8 : 8 * h_max;
+                    layout.mcu_height = components == 1 ? 8 : 8 * v_max;
+                    break;
+                }
+                case 0xC2: case 0xC3: case 0xC5: case 0xC6: case 0xC7:
+                case 0xC9: case 0xCA: case 0xCB: case 0xCD: case 0xCE: case 0xCF:
+                    return false; // progressive, lossless, hierarchical or arithmetic-coded
+                case 0xDD: // DRI
+                    if (length < 4)
+                        return false;
+                    layout.restart_interval = read_u16(segment);
+                    break;
+                case 0xDA: // SOS
+                    // With fewer components the other scans would follow, and each would need cutting
+                    if (!components || segment[0] != components || !layout.width || !layout.height)
+                        return false;
+                    layout.header_size = pos + 2 + length;
+                    return true;
+                default:
+                    break;
+                }
+                pos += 2 + length;
+            }
+            return false;
+        }
+
+        int bytes_per_pixel(rs2_format format)
+        {
+            switch (format)
+            {
+            case RS2_FORMAT_Y8: return 1;
+            case RS2_FORMAT_RGBA8: return 4;
+            default: return 3;
+            }
+        }
+
+#ifdef RS2_USE_LIBJPEG_TURBO
+
+        // libjpeg reports errors by calling error_exit, which must not return
+        struct error_handler
+        {
+            jpeg_error_mgr mgr;
+            jmp_buf jump;
+        };
+
+        void on_error(j_common_ptr cinfo)
+        {
+            longjmp(reinterpret_cast<error_handler*>(cinfo->err)->jump, 1);
+        }
+
+        // Warnings (e.g., about corrupt data) still leave a decoded image
+        void on_message(j_common_ptr)
+        {
+        }
+
+        J_COLOR_SPACE color_space(rs2_format format)
+        {
+            switch (format)
+            {
+            case RS2_FORMAT_BGR8: return JCS_EXT_BGR;
+            case RS2_FORMAT_RGBA8: return JCS_EXT_RGBA;
+            case RS2_FORMAT_Y8: return JCS_GRAYSCALE;
+            default: return JCS_RGB;
+            }
+        }
+
+        // Decode 'rows' rows into 'dest', after skipping the first 'skip'. Nothing with a destructor may live here:
+        // errors longjmp() out.
+        bool decode_band(const uint8_t* jpeg, size_t size, rs2_format format, uint8_t* dest, int width, int skip, int rows)
+        {
+            jpeg_decompress_struct cinfo;
+            error_handler errors;
+            cinfo.err = jpeg_std_error(&errors.mgr);
+            errors.mgr.error_exit = on_error;
+            errors.mgr.output_message = on_message;
+            if (setjmp(errors.jump))
+            {
+                jpeg_destroy_decompress(&cinfo);
+                return false;
+            }
+
+            jpeg_create_decompress(&cinfo);
+            jpeg_mem_src(&cinfo, jpeg, static_cast<unsigned long>(size));
+            jpeg_read_header(&cinfo, TRUE);
+            cinfo.out_color_space = color_space(format);
+            jpeg_start_decompress(&cinfo);
+            if (int(cinfo.output_width) != width)
+            {
+                jpeg_destroy_decompress(&cinfo);
+                return false;
+            }
+
+            if (skip)
+                jpeg_skip_scanlines(&cinfo, JDIMENSION(skip));
+
+            size_t const stride = size_t(width) * bytes_per_pixel(format);
+            JDIMENSION const last = std::min(JDIMENSION(skip + rows), cinfo.output_height);
+            while (cinfo.output_scanline < last)
+            {
+                JSAMPROW row = dest + (cinfo.output_scanline - skip) * stride;
+                jpeg_read_scanlines(&cinfo, &row, 1);
+            }
+            // Any rows past what fits in the frame are dropped along with the decoder
+            jpeg_destroy_decompress(&cinfo);
+            return true;
+        }
+
+#else
+
+        // Decode 'rows' rows into 'dest', after skipping the first 'skip'
+        bool decode_band(const uint8_t* jpeg, size_t size, rs2_format format, uint8_t* dest, int width, int skip, int rows)
+        {
+            int const bpp = bytes_per_pixel(format);
+            int w, h, n;
+            auto pixels = stbi_load_from_memory(jpeg, static_cast<int>(size), &w, &h, &n, bpp);
+            if (!pixels)
+                return false;
+
+            if (w != width || h < skip + rows)
+                LOG_WARNING("MJPEG decode size mismatch. Expected " << width << "x" << skip + rows << ", got " << w << "x" << h);
+
+            size_t const row_size = size_t(std::min(w, width)) * bpp;
+            for (int y = 0; y < std::min(h - skip, rows); ++y)
+            {
+                auto in = pixels + size_t(skip + y) * w * bpp;
+                auto out = dest + size_t(y) * width * bpp;
+                if (format == RS2_FORMAT_BGR8)
+                {
+                    for (size_t i = 0; i < row_size; i += 3)
+                    {
+                        out[i] = in[i + 2];
+                        out[i + 1] = in[i + 1];
+                        out[i + 2] = in[i];
+                    }
+                }
+                else
+                    std::memcpy(out, in, row_size);
+            }
+            stbi_image_free(pixels);
+            return true;
+        }
+
+#endif
+    }
+
+    bool mjpeg_decoder::supports(rs2_format format)
+    {
+        switch (format)
+        {
+        case RS2_FORMAT_RGB8:
+        case RS2_FORMAT_BGR8:
+        case RS2_FORMAT_RGBA8:
+        case RS2_FORMAT_Y8:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool mjpeg_decoder::split(const uint8_t* jpeg, size_t size, size_t n_bands)
+    {
+        jpeg_layout layout;
+        if (!parse_layout(jpeg, size, layout) || !layout.restart_interval)
+            return false;
+
+        size_t const mcus_per_row = (layout.width + layout.mcu_width - 1) / layout.mcu_width;
+        size_t const mcu_rows = (layout.height + layout.mcu_height - 1) / layout.mcu_height;
+        size_t const interval = layout.restart_interval;
+
+        // A band can only start on an MCU row that also starts a restart interval
+        size_t const step = interval / gcd(interval, mcus_per_row);
+        if (step >= mcu_rows)
+            return false;
+
+        // Find the restart markers, and the EOI (what comes after it is padding)
+        _restarts.clear();
+        size_t end = size;
+        for (size_t pos = layout.header_size; pos + 1 < size; ++pos)
+        {
+            auto ff = static_cast<const uint8_t*>(memchr(jpeg + pos, 0xFF, size - 1 - pos));
+            if (!ff)
+                break;
+            pos = ff - jpeg;
+            uint8_t const marker = jpeg[pos + 1];
+            if (marker >= 0xD0 && marker <= 0xD7)
+                _restarts.push_back(pos);
+            else if (marker == 0xD9)
+            {
+                end = pos;
+                break;
+            }
+            else if (marker != 0x00 && marker != 0xFF) // not a stuffed 0xFF, or fill
+                return false;
+        }
+
+        // Anything but a marker per interval means corrupt data, which is left for the decoder to deal with as a whole
+        if (_restarts.size() != (mcus_per_row * mcu_rows + interval - 1) / interval - 1)
+            return false;
+
+        // Spread the MCU rows evenly, rounding each band's start down to where an interval starts
+        std::vector<size_t> starts;
+        for (size_t i = 0; i < n_bands; ++i)
+        {
+            size_t const start = i * mcu_rows / n_bands / step * step;
+            if (starts.empty() || start != starts.back())
+                starts.push_back(start);
+        }
+        if (starts.size() < 2)
+            return false;
+        _bands.resize(starts.size());
+
+        // Where upsampling looks past a band's edges, it gets an interval more on either side to look at
+        size_t const context = layout.vertical_upsampling ? step : 0;
+        size_t const header_size = layout.header_size;
+        for (size_t i = 0; i < starts.size(); ++i)
+        {
+            size_t const end_mcu_row = i + 1 < starts.size() ? starts[i + 1] : mcu_rows;
+            size_t const from = starts[i] ? starts[i] - context : 0;
+            size_t const to = std::min(mcu_rows, end_mcu_row + context);
+            bool const to_end = to == mcu_rows;
+
+            // The last interval may be cut short by the end of the frame
+            size_t const first_interval = from * mcus_per_row / interval;
+            size_t const end_interval = to_end ? _restarts.size() + 1 : to * mcus_per_row / interval;
+            size_t const data_begin = first_interval ? _restarts[first_interval - 1] + 2 : header_size;
+            size_t const data_end = to_end ? end : _restarts[end_interval - 1];
+
+            auto & b = _bands[i];
+            b.first_row = int(starts[i]) * layout.mcu_height;
+            b.skip = int(starts[i] - from) * layout.mcu_height;
+            b.rows = std::min(layout.height, int(end_mcu_row) * layout.mcu_height) - b.first_row;
+            int const jpeg_rows = std::min(layout.height, int(to) * layout.mcu_height) - int(from) * layout.mcu_height;
+
+            b.jpeg.resize(header_size + (data_end - data_begin) + 2);
+            std::memcpy(b.jpeg.data(), jpeg, header_size);
+            b.jpeg[layout.height_offset] = uint8_t(jpeg_rows >> 8);
+            b.jpeg[layout.height_offset + 1] = uint8_t(jpeg_rows);
+            std::memcpy(b.jpeg.data() + header_size, jpeg + data_begin, data_end - data_begin);
+            b.jpeg[b.jpeg.size() - 2] = 0xFF;
+            b.jpeg[b.jpeg.size() - 1] = 0xD9;
+
+            // The decoder expects the restart markers to count from RST0 again
+            for (size_t r = first_interval + 1; r < end_interval; ++r)
+                b.jpeg[header_size + (_restarts[r - 1] - data_begin) + 1] = uint8_t(0xD0 + ((r - first_interval - 1) & 7));
+        }
+        return true;
+    }
+
+    bool mjpeg_decoder::decode(const uint8_t* jpeg, size_t size, rs2_format format, uint8_t* dest, int width, int height,
+        rsutils::concurrency::worker_pool* workers)
+    {
+        if (!workers || workers->size() < 2 || !split(jpeg, size, workers->size()))
+        {
+            _last_bands = 1;
+            return decode_band(jpeg, size, format, dest, width, 0, height);
+        }
+        _last_bands = _bands.size();
+
+        size_t const stride = size_t(width) * bytes_per_pixel(format);
+        std::atomic<bool> ok{ true };
+        workers->parallel_for(_bands.size(), [&](size_t begin, size_t end)
+        {
+            for (auto i = begin; i < end; ++i)
+            {
+                auto const& b = _bands[i];
+                if (b.first_row >= height)
+                    continue;
+                if (!decode_band(b.jpeg.data(), b.jpeg.size(), format, dest + b.first_row * stride, width, b.skip,
+                    std::min(b.rows, height - b.first_row)))
+                    ok = false;
+            }
+        });
+        return ok;
+    }
+}
@@ -0,0 +1,60 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/h/rs_sensor.h>
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+
+namespace rsutils {
+namespace concurrency {
+class worker_pool;
+}  // namespace concurrency
+}  // namespace rsutils
+
+
+namespace librealsense
+{
+    // Decodes MJPEG frames straight into the output frame, as RGB8, BGR8, RGBA8 or Y8.
+    //
+    // A baseline JPEG whose restart markers fall at the start of MCU rows can be cut at those markers into bands
+    // of rows, each of which is a JPEG of its own once given the frame's headers (with the height patched). The bands
+    // are then decoded in parallel. Frames without such markers (or that are not baseline) are decoded as a whole.
+    //
+    // When built with libjpeg-turbo (BUILD_WITH_LIBJPEG_TURBO) it decodes each band directly into its rows of the
+    // output; otherwise stb_image decodes into a buffer of its own, which is then copied out.
+    class mjpeg_decoder
+    {
+    public:
+        static bool supports(rs2_format format);
+
+        // Decode a 'width' x 'height' frame of 'size' bytes (which may include padding after the EOI, but must all be
+        // there to read) into 'dest'.
+        // The frame is split into as many bands as there are 'workers' (when given). Returns false if the frame
+        // could not be decoded; rows that were decoded before the error are left in 'dest'.
+        bool decode(const uint8_t* jpeg, size_t size, rs2_format format, uint8_t* dest, int width, int height,
+            rsutils::concurrency::worker_pool* workers);
+
+        // How many bands the last frame was decoded in (1 if it was decoded as a whole)
+        size_t last_bands() const { return _last_bands; }
+
+    private:
+        struct band
+        {
+            int first_row = 0;
+            int rows = 0;
+            int skip = 0;              // rows decoded before first_row, only for the upsampling to see
+            std::vector<uint8_t> jpeg; // headers, the band's entropy-coded data, EOI
+        };
+
+        bool split(const uint8_t* jpeg, size_t size, size_t n_bands);
+
+        std::vector<band> _bands; // kept between frames so their buffers are reused
+        std::vector<size_t> _restarts;
+        size_t _last_bands = 0;
+    };
+}
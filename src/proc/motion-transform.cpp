@@ -12,6 +12,11 @@
 
 namespace librealsense
 {
+    void imu_to_librs_converter::convert_batch( rs2_motion_sample *, const hid_batch_sample *, size_t )
+    {
+        throw not_implemented_exception( "batched motion samples are not supported with this IMU data format" );
+    }
+
     class converter_16_bit : public imu_to_librs_converter
     {
     public:
@@ -31,6 +36,17 @@ namespace librealsense
             float3 res = float3{ float( hid.x ), float( hid.y ), float( hid.z ) } * float( _scale_factor );
             std::memcpy( dest[0], &res, sizeof( float3 ) );
         }
+
+        void convert_batch( rs2_motion_sample * dest, const hid_batch_sample * source, size_t n ) override
+        {
+            float const scale = float( _scale_factor );
+            for( size_t i = 0; i < n; ++i )
+            {
+                dest[i].data.x = float( static_cast< int16_t >( source[i].data.x ) ) * scale;
+                dest[i].data.y = float( static_cast< int16_t >( source[i].data.y ) ) * scale;
+                dest[i].data.z = float( static_cast< int16_t >( source[i].data.z ) ) * scale;
+            }
+        }
     };
 
     class converter_32_bit : public imu_to_librs_converter
@@ -46,6 +62,17 @@ namespace librealsense
             float3 res = float3{ float( hid->x ), float( hid->y ), float( hid->z ) } * float( _scale_factor );
             std::memcpy( dest[0], &res, sizeof( float3 ) );
         }
+
+        void convert_batch( rs2_motion_sample * dest, const hid_batch_sample * source, size_t n ) override
+        {
+            float const scale = float( _scale_factor );
+            for( size_t i = 0; i < n; ++i )
+            {
+                dest[i].data.x = float( source[i].data.x ) * scale;
+                dest[i].data.y = float( source[i].data.y ) * scale;
+                dest[i].data.z = float( source[i].data.z ) * scale;
+            }
+        }
     };
 
     class converter_16_bit_mipi : public imu_to_librs_converter
@@ -115,12 +142,60 @@ namespace librealsense
 
     rs2::frame motion_transform::process_frame(const rs2::frame_source& source, const rs2::frame& f)
     {
+        auto mf = dynamic_cast< librealsense::frame * >( (frame_interface *)f.get() );
+        if( mf && mf->additional_data.motion_samples )
+        {
+            // A batched frame: samples are converted to the same size, so the frame we get fits them all
+            auto ret = prepare_frame( source, f );
+            process_batch( (rs2_motion_sample *)ret.get_data(),
+                           (const hid_batch_sample *)f.get_data(),
+                           mf->additional_data.motion_samples,
+                           ret.get_profile().stream_type() );
+            return ret;
+        }
+
         auto&& ret = functional_processing_block::process_frame(source, f);
         correct_motion(&ret);
 
         return ret;
     }
 
+    // The whole batch is converted in a couple of tight loops: the raw values are scaled first, then the alignment and
+    // correction, the same for all samples, are applied as a single affine transform
+    void motion_transform::process_batch( rs2_motion_sample * dest,
+                                          const hid_batch_sample * source,
+                                          size_t n,
+                                          rs2_stream stream_type ) const
+    {
+        _converter->convert_batch( dest, source, n );
+
+        float3x3 m = _imu2depth_cs_alignment_matrix;
+        float3 bias{ 0, 0, 0 };
+        if( _mm_correct_opt && _mm_correct_opt->query() > 0.f )
+        {
+            if( stream_type == RS2_STREAM_ACCEL )
+            {
+                m = _accel_sensitivity * m;
+                bias = _accel_bias;
+            }
+            else if( stream_type == RS2_STREAM_GYRO )
+            {
+                m = _gyro_sensitivity * m;
+                bias = _gyro_bias;
+            }
+        }
+
+        for( size_t i = 0; i < n; ++i )
+        {
+            auto & xyz = dest[i].data;
+            float3 const v = m * float3{ xyz.x, xyz.y, xyz.z } - bias;
+            xyz = { v.x, v.y, v.z };
+            dest[i].reserved = 0;
+            dest[i].timestamp = source[i].timestamp;
+            dest[i].frame_number = source[i].frame_number;
+        }
+    }
+
     void motion_transform::correct_motion_helper(float3* xyz, rs2_stream stream_type) const
     {
         // The IMU sensor orientation shall be aligned with depth sensor's coordinate system
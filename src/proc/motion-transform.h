@@ -9,6 +9,7 @@ namespace librealsense
     class enable_motion_correction;
     class mm_calib_handler;
     class functional_processing_block;
+    struct hid_batch_sample;
 
     class imu_to_librs_converter
     {
@@ -21,6 +22,9 @@ namespace librealsense
         }
 
         virtual void convert( uint8_t * const dest[], const uint8_t * source ) = 0;
+
+        // Scales the raw values of a batched frame's samples; the rest of each sample is left to the caller
+        virtual void convert_batch( rs2_motion_sample * dest, const hid_batch_sample * source, size_t n );
     };
 
     class motion_transform : public functional_processing_block
@@ -39,6 +43,7 @@ namespace librealsense
     protected:
         void correct_motion(rs2::frame* f) const;
         void correct_motion_helper(float3* xyz, rs2_stream stream_type) const;
+        void process_batch( rs2_motion_sample * dest, const hid_batch_sample * source, size_t n, rs2_stream stream_type ) const;
 
         std::shared_ptr<enable_motion_correction> _mm_correct_opt = nullptr;
         float3x3            _accel_sensitivity;
@@ -25,6 +25,7 @@
 #include "proc/sse/sse-pointcloud.h"
 #endif
 #include "proc/neon/neon-pointcloud.h"
+#include "proc/avx/avx-pointcloud.h"
 
 
 namespace librealsense
@@ -404,6 +405,11 @@ namespace librealsense
             return std::make_shared<librealsense::pointcloud_cuda>();
         }
         #endif
+        if (pointcloud_avx2::is_supported())
+        {
+            LOG_INFO("Using AVX2-optimized pointcloud implementation");
+            return std::make_shared<librealsense::pointcloud_avx2>();
+        }
         #ifdef __SSSE3__
             LOG_INFO("Using SSE-optimized pointcloud implementation");
             return std::make_shared<librealsense::pointcloud_sse>();
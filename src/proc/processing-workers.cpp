@@ -0,0 +1,41 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "processing-workers.h"
+#include "option.h"
+#include "core/options-container.h"
+
+#include <algorithm>
+#include <thread>
+
+
+namespace librealsense {
+
+
+processing_workers::processing_workers( int default_threads )
+    : _default( default_threads )
+    , _threads( default_threads )
+{
+}
+
+
+void processing_workers::register_option( options_container & block )
+{
+    auto threads = std::make_shared< ptr_option< int > >( 0, 64, 1, _default, &_threads,
+                                                          "Number of threads to split each frame between" );
+    threads->set_description( 0, "One per core" );
+    block.register_option( RS2_OPTION_PROCESSING_THREADS, threads );
+}
+
+
+void processing_workers::update()
+{
+    size_t threads = _threads ? size_t( _threads ) : std::max( 1u, std::thread::hardware_concurrency() );
+    if( threads <= 1 )
+        _pool.reset();
+    else if( ! _pool || _pool->size() != threads )
+        _pool = std::make_shared< rsutils::concurrency::worker_pool >( threads );
+}
+
+
+}  // namespace librealsense
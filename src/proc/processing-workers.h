@@ -0,0 +1,49 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <rsutils/concurrency/worker-pool.h>
+
+#include <memory>
+
+
+namespace librealsense {
+
+
+class options_container;
+
+
+// The worker pool a processing block splits its frames between, with the RS2_OPTION_PROCESSING_THREADS option that
+// sizes it. Used like a pointer to the pool, which is null when frames are processed on the calling thread only:
+//
+//     _workers.update();  // once per frame
+//     if( _workers )
+//         _workers->parallel_for( ... );
+//
+class processing_workers
+{
+public:
+    // 'default_threads' is the option's default; 0 means one per core
+    explicit processing_workers( int default_threads = 1 );
+
+    processing_workers( const processing_workers & ) = delete;
+    processing_workers & operator=( const processing_workers & ) = delete;
+
+    void register_option( options_container & block );
+
+    // The pool is kept between frames, and only replaced when the option changes
+    void update();
+
+    explicit operator bool() const { return _pool != nullptr; }
+    rsutils::concurrency::worker_pool * operator->() const { return _pool.get(); }
+    rsutils::concurrency::worker_pool * get() const { return _pool.get(); }
+
+private:
+    int const _default;
+    int _threads;
+    std::shared_ptr< rsutils::concurrency::worker_pool > _pool;
+};
+
+
+}  // namespace librealsense
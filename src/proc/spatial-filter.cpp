@@ -153,10 +153,12 @@ namespace librealsense
             }
         });
 
+
         register_option(RS2_OPTION_FILTER_SMOOTH_ALPHA, spatial_filter_alpha);
         register_option(RS2_OPTION_FILTER_SMOOTH_DELTA, spatial_filter_delta);
         register_option(RS2_OPTION_FILTER_MAGNITUDE, spatial_filter_iterations);
         register_option(RS2_OPTION_HOLES_FILL, holes_filling_mode);
+        _workers.register_option(*this);
     }
 
     rs2::frame spatial_filter::process_frame(const rs2::frame_source& source, const rs2::frame& f)
@@ -164,6 +166,7 @@ namespace librealsense
         rs2::frame tgt;
 
         update_configuration(f);
+        _workers.update();
         tgt = prepare_target_frame(f, source);
 
         // Spatial domain transform edge-preserving filter
@@ -175,6 +178,28 @@ namespace librealsense
         return tgt;
     }
 
+    void spatial_filter::filter_in_place(void* data, size_t width, size_t height, bool disparity)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        // Frames coming in directly afterwards will have to reconfigure
+        _source_stream_profile = rs2::stream_profile();
+
+        _extension_type = disparity ? RS2_EXTENSION_DISPARITY_FRAME : RS2_EXTENSION_DEPTH_FRAME;
+        _bpp = disparity ? sizeof(float) : sizeof(uint16_t);
+        _width = width;
+        _height = height;
+        _stride = _width * _bpp;
+        _current_frm_size_pixels = _width * _height;
+        _spatial_edge_threshold = _spatial_delta_param;
+
+        _workers.update();
+        if (disparity)
+            dxf_smooth<float>(data, _spatial_alpha_param, _spatial_edge_threshold, _spatial_iterations);
+        else
+            dxf_smooth<uint16_t>(data, _spatial_alpha_param, _spatial_edge_threshold, _spatial_iterations);
+    }
+
     void  spatial_filter::update_configuration(const rs2::frame& f)
     {
         if (f.get_profile().get() != _source_stream_profile.get())
@@ -238,13 +263,13 @@ namespace librealsense
         return tgt;
     }
 
-    void spatial_filter::recursive_filter_horizontal_fp(void * image_data, float alpha, float deltaZ)
+    void spatial_filter::recursive_filter_horizontal_fp(void * image_data, float alpha, float deltaZ, size_t row_begin, size_t row_end)
     {
         float *image = reinterpret_cast<float*>(image_data);
 
         int v, u;
 
-        for (v = 0; v < _height;) {
+        for (v = int(row_begin); v < int(row_end);) {
             // left to right
             float *im = image + v * _width;
             float state = *im;
@@ -366,7 +391,7 @@ namespace librealsense
         }
     }
 
-    void spatial_filter::recursive_filter_vertical_fp(void * image_data, float alpha, float deltaZ)
+    void spatial_filter::recursive_filter_vertical_fp(void * image_data, float alpha, float deltaZ, size_t col_begin, size_t col_end)
     {
         float *image = reinterpret_cast<float*>(image_data);
 
@@ -374,7 +399,7 @@ namespace librealsense
 
         // we'll do one column at a time, top to bottom, bottom to top, left to right,
 
-        for (u = 0; u < _width;) {
+        for (u = int(col_begin); u < int(col_end);) {
 
             float *im = image + u;
             float state = im[0];
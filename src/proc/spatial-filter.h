@@ -8,11 +8,14 @@
 
 #include <map>
 #include <vector>
+#include <memory>
 #include <cmath>
 
 #include "../include/librealsense2/hpp/rs_frame.hpp"
 #include "../include/librealsense2/hpp/rs_processing.hpp"
 
+#include "processing-workers.h"
+
 namespace librealsense
 {
     class spatial_filter : public depth_processing_block
@@ -20,29 +23,52 @@ namespace librealsense
     public:
         spatial_filter();
 
+        // Filters a depth (uint16) or disparity (float) image in place with this block's options, on behalf of
+        // another block (see depth_pipeline)
+        void filter_in_place(void* data, size_t width, size_t height, bool disparity);
+
     protected:
         void    update_configuration(const rs2::frame& f);
 
         rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source);
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
 
+        // Rows of the horizontal pass and columns of the vertical one are filtered independently, so each pass can
+        // be split into bands across the worker threads (if any) without changing the result
+        template <typename Fn>
+        void for_each_band(size_t count, size_t min_band, Fn fn)
+        {
+            if (_workers)
+                _workers->parallel_for(count, fn, min_band);
+            else
+                fn(0, count);
+        }
+
         template <typename T>
         void dxf_smooth(void *frame_data, float alpha, float delta, int iterations)
         {
             static_assert((std::is_arithmetic<T>::value), "Spatial filter assumes numeric types");
             const bool fp = (std::is_floating_point<T>::value);
 
+            // Bands of whole cache lines, so that threads don't write to the same ones
+            const size_t min_rows = 4;
+            const size_t min_columns = 64 / sizeof(T);
+
             for (int i = 0; i < iterations; i++)
             {
                 if (fp)
                 {
-                    recursive_filter_horizontal_fp(frame_data, alpha, delta);
-                    recursive_filter_vertical_fp(frame_data, alpha, delta);
+                    for_each_band(_height, min_rows, [&](size_t begin, size_t end)
+                        { recursive_filter_horizontal_fp(frame_data, alpha, delta, begin, end); });
+                    for_each_band(_width, min_columns, [&](size_t begin, size_t end)
+                        { recursive_filter_vertical_fp(frame_data, alpha, delta, begin, end); });
                 }
                 else
                 {
-                    recursive_filter_horizontal<T>(frame_data, alpha, delta);
-                    recursive_filter_vertical<T>(frame_data, alpha, delta);
+                    for_each_band(_height, min_rows, [&](size_t begin, size_t end)
+                        { recursive_filter_horizontal<T>(frame_data, alpha, delta, begin, end); });
+                    for_each_band(_width, min_columns, [&](size_t begin, size_t end)
+                        { recursive_filter_vertical<T>(frame_data, alpha, delta, begin, end); });
                 }
             }
 
@@ -50,14 +76,17 @@ namespace librealsense
             // For depth domain a more efficient in-place hole filling is performed
             // No need to lock the '_holes_filling_mode' or '_holes_filling_radius' as they are locked at the processing block scope
             if (_holes_filling_mode && fp)
-                intertial_holes_fill<T>(static_cast<T*>(frame_data));
+                for_each_band(_height, min_rows, [&](size_t begin, size_t end)
+                    { intertial_holes_fill<T>(static_cast<T*>(frame_data), begin, end); });
         }
 
-        void recursive_filter_horizontal_fp(void * image_data, float alpha, float deltaZ);
-        void recursive_filter_vertical_fp(void * image_data, float alpha, float deltaZ);
+        // Filter rows [row_begin, row_end)
+        void recursive_filter_horizontal_fp(void * image_data, float alpha, float deltaZ, size_t row_begin, size_t row_end);
+        // Filter columns [col_begin, col_end)
+        void recursive_filter_vertical_fp(void * image_data, float alpha, float deltaZ, size_t col_begin, size_t col_end);
 
         template <typename T>
-        void  recursive_filter_horizontal(void * image_data, float alpha, float deltaZ)
+        void  recursive_filter_horizontal(void * image_data, float alpha, float deltaZ, size_t row_begin, size_t row_end)
         {
             size_t v{}, u{};
 
@@ -73,7 +102,7 @@ namespace librealsense
             auto image = reinterpret_cast<T*>(image_data);
             size_t cur_fill = 0;
 
-            for (v = 0; v < _height; v++)
+            for (v = row_begin; v < row_end; v++)
             {
                 // left to right
                 T *im = image + v * _width;
@@ -152,7 +181,7 @@ namespace librealsense
         }
 
         template <typename T>
-        void recursive_filter_vertical(void * image_data, float alpha, float deltaZ)
+        void recursive_filter_vertical(void * image_data, float alpha, float deltaZ, size_t col_begin, size_t col_end)
         {
             size_t v{}, u{};
 
@@ -171,12 +200,13 @@ namespace librealsense
 
             // top to bottom
 
-            T *im = image;
+            T *im = nullptr;
             T im0{};
             T imw{};
             for (v = 1; v < _height; v++)
             {
-                for (u = 0; u < _width; u++)
+                im = image + (v - 1) * _width + col_begin;
+                for (u = col_begin; u < col_end; u++)
                 {
                     im0 = im[0];
                     imw = im[_width];
@@ -195,10 +225,10 @@ namespace librealsense
             }
 
             // bottom to top
-            im = image + (_height - 2) * _width;
-            for (v = 1; v < _height; v++, im -= (_width * 2))
+            for (v = 1; v < _height; v++)
             {
-                for (u = 0; u < _width; u++)
+                im = image + (_height - 1 - v) * _width + col_begin;
+                for (u = col_begin; u < col_end; u++)
                 {
                     im0 = im[0];
                     imw = im[_width];
@@ -218,7 +248,7 @@ namespace librealsense
         }
 
         template<typename T>
-        inline void intertial_holes_fill(T* image_data)
+        inline void intertial_holes_fill(T* image_data, size_t row_begin, size_t row_end)
         {
             std::function<bool(T*)> fp_oper = [](T* ptr) { return !*((int *)ptr); };
             std::function<bool(T*)> uint_oper = [](T* ptr) { return !(*ptr); };
@@ -226,8 +256,8 @@ namespace librealsense
 
             size_t cur_fill = 0;
 
-            T* p = image_data;
-            for (int j = 0; j < _height; ++j)
+            T* p = image_data + row_begin * _width;
+            for (size_t j = row_begin; j < row_end; ++j)
             {
                 ++p;
                 cur_fill = 0;
@@ -281,6 +311,7 @@ namespace librealsense
         float                   _stereo_baseline_mm;
         uint8_t                 _holes_filling_mode;
         uint8_t                 _holes_filling_radius;
+        processing_workers      _workers;
     };
     MAP_EXTENSION(RS2_EXTENSION_SPATIAL_FILTER, librealsense::spatial_filter);
 }
@@ -2,18 +2,24 @@
 // Copyright(c) 2015 RealSense, Inc. All Rights Reserved.
 
 #include <functional>
+#include <algorithm>
 #include "source.h"
 #include "sync.h"
 #include "proc/synthetic-stream.h"
 #include "proc/syncer-processing-block.h"
+#include "core/stream-profile-interface.h"
 #include <src/core/frame-processor-callback.h>
+#include <src/core/latency-tracer.h>
 
 
 namespace librealsense
 {
-    syncer_process_unit::syncer_process_unit(std::initializer_list< bool_option::ptr > enable_opts, bool log)
+    syncer_process_unit::syncer_process_unit( std::initializer_list< bool_option::ptr > enable_opts,
+                                              bool log,
+                                              sync_engine engine )
         : processing_block("syncer"), _matcher((new composite_identity_matcher({})))
         , _enable_opts(enable_opts.begin(), enable_opts.end())
+        , _engine( engine )
     {
         _matcher->set_callback( []( frame_holder f, syncronization_environment const & env ) {
             if( env.log )
@@ -54,34 +60,222 @@ namespace librealsense
                 return;
             }
             LOG_DEBUG( "--> syncing " << frame );
+            if( _engine == sync_engine::lock_free )
+                enqueue_lock_free( std::move( frame ), source, log );
+            else
+                dispatch( std::move( frame ), source, log );
+        };
+
+        set_processing_callback( make_frame_processor_callback( std::move( f ) ) );
+    }
+
+    void syncer_process_unit::dispatch( frame_holder && frame, synthetic_source_interface * source, bool log )
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            match( std::move( frame ), source, log );
+        }
+
+        release_matches();
+    }
+
+    void syncer_process_unit::match( frame_holder && frame, synthetic_source_interface * source, bool log )
+    {
+        if( ! _matcher->get_active() )
+        {
+            LOG_DEBUG( "matcher was stopped: NOT DISPATCHING FRAME!" );
+            return;
+        }
+        _matcher->dispatch(std::move(frame), { source, _matches, log });
+    }
+
+    void syncer_process_unit::release_matches()
+    {
+        frame_holder f;
+        {
+            // Another thread has the lock, meaning will get into the following loop and dequeue all
+            // the frames. So there's nothing for us to do...
+            std::unique_lock< std::mutex > lock(_callback_mutex, std::try_to_lock);
+            if (!lock.owns_lock())
+                return;
+
+            while (_matches.try_dequeue(&f))
             {
-                std::lock_guard<std::mutex> lock(_mutex);
-                if( ! _matcher->get_active() )
-                {
-                    LOG_DEBUG( "matcher was stopped: NOT DISPATCHING FRAME!" );
-                    return;
-                }
-                _matcher->dispatch(std::move(frame), { source, _matches, log });
+                LOG_DEBUG( "--> frame ready: " << *f.frame );
+                latency_tracer::stamp( f.frame, latency_stage::synced );
+                get_source().frame_ready(std::move(f));
             }
+        }
+    }
 
-            frame_holder f;
-            {
-                // Another thread has the lock, meaning will get into the following loop and dequeue all
-                // the frames. So there's nothing for us to do...
-                std::unique_lock< std::mutex > lock(_callback_mutex, std::try_to_lock);
-                if (!lock.owns_lock())
-                    return;
+    bool syncer_process_unit::try_enter( stream_ring & ring )
+    {
+        int producers = ring.producers.load();
+        while( producers != stream_ring::RECLAIMING )
+            if( ring.producers.compare_exchange_weak( producers, producers + 1 ) )
+                return true;
+        return false;
+    }
+
+    // The ring of the stream, entered: until we leave() it, it cannot be taken over by another stream. Null if the
+    // stream has none and all are taken by streams that are still active.
+    syncer_process_unit::stream_ring * syncer_process_unit::enter_ring( int stream_uid )
+    {
+        for( auto & ring : _rings )
+        {
+            // Rings are claimed in order, so the first unused one means the stream has none yet -- unless another
+            // stream claims it first, in which case we keep looking
+            int uid = ring.stream_uid.load();
+            if( uid != stream_ring::UNUSED && uid != stream_uid )
+                continue;
+            if( ! try_enter( ring ) )
+                continue;
+            if( uid == stream_ring::UNUSED )
+                ring.stream_uid.compare_exchange_strong( uid, stream_uid );
+            // Still (or now) ours, unless it was taken over before we entered it
+            if( ring.stream_uid.load() == stream_uid )
+                return &ring;
+            leave( ring );
+        }
+
+        // Take over a ring from a stream that went away (or is just slow: it'll look for another when it's back)
+        for( auto & ring : _rings )
+            if( try_reclaim( ring, stream_uid ) )
+                return &ring;
+        return nullptr;
+    }
+
+    bool syncer_process_unit::try_reclaim( stream_ring & ring, int stream_uid )
+    {
+        if( ring.stream_uid.load() == stream_ring::UNUSED
+            || _arrivals.load() - ring.last_arrival.load() < IDLE_RING_ARRIVALS )
+            return false;
+        int idle = 0;
+        if( ! ring.producers.compare_exchange_strong( idle, stream_ring::RECLAIMING ) )
+            return false;
 
-                while (_matches.try_dequeue(&f))
+        // Nobody can push into it now, and the dispatching thread only pops: once empty, it stays empty. Its stream may
+        // have pushed since we looked, though.
+        bool const reclaimed = ring.frames.empty()
+                            && _arrivals.load() - ring.last_arrival.load() >= IDLE_RING_ARRIVALS;
+        if( reclaimed )
+        {
+            LOG_DEBUG( "sync ring of stream " << ring.stream_uid.load() << " taken over by stream " << stream_uid );
+            ring.stream_uid = stream_uid;
+        }
+        ring.producers = reclaimed ? 1 : 0;
+        return reclaimed;
+    }
+
+    void syncer_process_unit::enqueue_lock_free( frame_holder && frame,
+                                                 synthetic_source_interface * source,
+                                                 bool log )
+    {
+        auto ring = enter_ring( frame->get_stream()->get_unique_id() );
+        if( ! ring )
+        {
+            // More streams than rings: the frame has to wait for whoever is dispatching
+            LOG_DEBUG( "no free sync ring for " << frame << "; waiting to dispatch it" );
+            wait_for_progress( [this]() { return ! _dispatching.exchange( true ); } );
+            match( std::move( frame ), source, log );
+            _dispatching = false;
+            std::atomic_thread_fence( std::memory_order_seq_cst );
+            notify_progress();
+            release_matches();
+            dispatch_pending( log );
+            return;
+        }
+
+        // Frames are dispatched strictly in the order of these stamps: if we have to wait for room below, frames that
+        // arrive after ours wait for it too
+        pending_frame pending;
+        pending.frame = std::move( frame );
+        pending.source = source;
+        pending.arrival = _arrivals++;
+        auto const arrival = pending.arrival;
+        while( ! ring->frames.try_push( std::move( pending ) ) )
+        {
+            // The matcher is behind: help it catch up, or wait for whoever is dispatching to make room
+            dispatch_pending( log );
+            wait_for_progress( [ring]() { return ! ring->frames.full(); } );
+        }
+        ring->last_arrival = arrival;
+        leave( *ring );
+
+        // Pairs with the fence in dispatch_pending(): either the dispatching thread sees our count after it lets go, or
+        // we see it already gone and dispatch the frame ourselves
+        ++_pushed;
+        dispatch_pending( log );
+    }
+
+    void syncer_process_unit::dispatch_pending( bool log )
+    {
+        // Only one thread dispatches at a time; the others leave their frames for it. Once done, it has to look again:
+        // a frame may have been pushed after it last looked but before it let go, by a thread that then saw it busy.
+        // Only the dispatching thread may look inside the rings, so we go by how many frames were pushed meanwhile.
+        uint64_t pushed;
+        do
+        {
+            if( _dispatching.exchange( true ) )
+                return;
+            pushed = _pushed.load();
+
+            while( true )
+            {
+                // Dispatch in order of arrival, so the matcher sees what it would have with the mutex. A frame that got
+                // its stamp but isn't in its ring yet holds up the rest: the thread pushing it dispatches once it's in.
+                auto const next = _next_arrival.load();
+                stream_ring * ring = nullptr;
+                for( auto & r : _rings )
                 {
-                    LOG_DEBUG( "--> frame ready: " << *f.frame );
-                    get_source().frame_ready(std::move(f));
+                    if( r.stream_uid.load( std::memory_order_acquire ) == stream_ring::UNUSED )
+                        break;
+                    auto p = r.frames.front();
+                    if( p && p->arrival == next )
+                    {
+                        ring = &r;
+                        break;
+                    }
                 }
+                if( ! ring )
+                    break;
+
+                pending_frame pending;
+                ring->frames.try_pop( pending );
+                _next_arrival = next + 1;
+                std::atomic_thread_fence( std::memory_order_seq_cst );
+                notify_progress();  // there's room in the ring now
+                match( std::move( pending.frame ), pending.source, log );
+
+                // Other streams keep pushing meanwhile, so a slow callback only holds back the matching
+                release_matches();
             }
 
-        };
+            _dispatching = false;
+            std::atomic_thread_fence( std::memory_order_seq_cst );
+            notify_progress();
+        }
+        while( _pushed.load() != pushed );
+    }
 
-        set_processing_callback( make_frame_processor_callback( std::move( f ) ) );
+    // The fences before notify_progress() pair with the one in here: either the waker sees us waiting, or we see
+    // whatever it did before waking us
+    void syncer_process_unit::wait_for_progress( std::function< bool() > const & done )
+    {
+        std::unique_lock< std::mutex > lock( _progress_mutex );
+        ++_waiting;
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        _progress.wait( lock, done );
+        --_waiting;
+    }
+
+    void syncer_process_unit::notify_progress()
+    {
+        if( _waiting.load() )
+        {
+            std::lock_guard< std::mutex > lock( _progress_mutex );
+            _progress.notify_all();
+        }
     }
 
     // Stopping the syncer means no more frames will be enqueued, and any existing frames
@@ -89,6 +283,9 @@ namespace librealsense
     void syncer_process_unit::stop()
     {
         _matcher->stop();
+
+        // Anything still in the rings gets dropped by the (now stopped) matcher
+        if( _engine == sync_engine::lock_free )
+            dispatch_pending( false );
     }
 }
-
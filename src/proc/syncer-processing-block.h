@@ -4,11 +4,16 @@
 #pragma once
 
 #include <src/core/frame-holder.h>
+#include <rsutils/concurrency/spsc-ring.h>
 
 #include <stdint.h>
 #include <vector>
 #include <mutex>
 #include <memory>
+#include <atomic>
+#include <array>
+#include <condition_variable>
+#include <functional>
 
 #include "types.h"
 #include "archive.h"
@@ -18,13 +23,31 @@ namespace librealsense
 {
     class processing_block;
     class timestamp_composite_matcher;
+
+    // How frames from the different streams get to the matcher:
+    //     locking   - each frame takes the syncer's mutex, so streams wait for each other
+    //     lock_free - each stream pushes into a ring of its own and never waits; whichever thread finds the matcher
+    //                 free dispatches everything pending, in arrival order. Frames of any one stream must come from
+    //                 one thread at a time (as they do from a sensor). Rings of streams that went idle are taken
+    //                 over by new ones.
+    // Either way the matcher sees the same frames in the same order, so the framesets are the same.
+    enum class sync_engine
+    {
+        locking,
+        lock_free
+    };
+
     class syncer_process_unit : public processing_block
     {
     public:
-        syncer_process_unit(std::initializer_list< bool_option::ptr > enable_opts, bool log = true);
+        syncer_process_unit( std::initializer_list< bool_option::ptr > enable_opts,
+                             bool log = true,
+                             sync_engine engine = sync_engine::locking );
 
-        syncer_process_unit( bool_option::ptr is_enabled_opt = nullptr, bool log = true)
-            : syncer_process_unit( { is_enabled_opt }, log) {}
+        syncer_process_unit( bool_option::ptr is_enabled_opt = nullptr,
+                             bool log = true,
+                             sync_engine engine = sync_engine::locking )
+            : syncer_process_unit( { is_enabled_opt }, log, engine ) {}
 
         void add_enabling_option( bool_option::ptr is_enabled_opt )
         {
@@ -40,10 +63,58 @@ namespace librealsense
             _matcher.reset();
         }
     private:
+        // Frames of streams beyond this many active at once wait for the dispatching thread instead of queueing
+        static const size_t MAX_RING_STREAMS = 16;
+        static const size_t RING_SIZE = 16;
+        // A ring whose stream hasn't pushed while this many frames arrived can be taken over by another stream
+        static const uint64_t IDLE_RING_ARRIVALS = MAX_RING_STREAMS * RING_SIZE;
+
+        struct pending_frame
+        {
+            frame_holder frame;
+            synthetic_source_interface * source = nullptr;
+            uint64_t arrival = 0;
+        };
+
+        struct stream_ring
+        {
+            static const int UNUSED = -1;
+            static const int RECLAIMING = -1;
+            std::atomic< int > stream_uid{ UNUSED };   // claimed by the first frame of a stream, until it goes idle
+            std::atomic< int > producers{ 0 };         // threads in the ring (see enter_ring()), or RECLAIMING
+            std::atomic< uint64_t > last_arrival{ 0 }; // stamp of the last frame pushed
+            rsutils::concurrency::spsc_ring< pending_frame > frames{ RING_SIZE };
+        };
+
+        void dispatch( frame_holder && frame, synthetic_source_interface * source, bool log );
+        void match( frame_holder && frame, synthetic_source_interface * source, bool log );
+        void enqueue_lock_free( frame_holder && frame, synthetic_source_interface * source, bool log );
+        stream_ring * enter_ring( int stream_uid );
+        bool try_reclaim( stream_ring & ring, int stream_uid );
+        static bool try_enter( stream_ring & ring );
+        static void leave( stream_ring & ring ) { ring.producers.fetch_sub( 1 ); }
+        void dispatch_pending( bool log );
+        void wait_for_progress( std::function< bool() > const & done );
+        void notify_progress();
+        void release_matches();
+
         std::shared_ptr<matcher> _matcher;
         std::vector< std::weak_ptr<bool_option> > _enable_opts;
 
         single_consumer_frame_queue<frame_holder> _matches;
         std::mutex _callback_mutex;
+
+        sync_engine const _engine;
+        std::array< stream_ring, MAX_RING_STREAMS > _rings;
+        std::atomic< uint64_t > _arrivals{ 0 };       // stamps pending frames with their order of arrival
+        std::atomic< uint64_t > _next_arrival{ 0 };   // the stamp to dispatch next; later ones wait until it's pushed
+        std::atomic< uint64_t > _pushed{ 0 };         // frames pushed into the rings so far
+        std::atomic< bool > _dispatching{ false };    // held by the thread moving pending frames into the matcher
+
+        // Producers that cannot go on (their ring is full, or they need to dispatch themselves) sleep here until the
+        // dispatching thread makes room or lets go
+        std::mutex _progress_mutex;
+        std::condition_variable _progress;
+        std::atomic< int > _waiting{ 0 };
     };
 }
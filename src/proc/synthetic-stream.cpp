@@ -14,6 +14,7 @@
 #include "types.h"
 #include <src/image.h>
 #include <src/core/time-service.h>
+#include <src/core/latency-tracer.h>
 
 #include <rsutils/string/from.h>
 
@@ -44,6 +45,17 @@ namespace librealsense
         frame_source::archive_id id
             = { f->get_stream()->get_stream_type(), f->get_stream()->get_stream_index(), RS2_EXTENSION_VIDEO_FRAME };
         auto callback = _source.begin_callback( id );
+        // Timed without whatever our output callback does in-line
+        latency_tracer::block_timer timer;
+        std::shared_ptr< stream_profile_interface > traced_stream;
+        std::shared_ptr< sensor_interface > traced_sensor;
+        unsigned long long frame_number = 0;
+        if( timer )
+        {
+            traced_stream = f->get_stream();
+            traced_sensor = f->get_sensor();
+            frame_number = f->get_frame_number();
+        }
         try
         {
             if (_callback)
@@ -62,6 +74,13 @@ namespace librealsense
         {
             LOG_ERROR( "Exception was thrown during callback!" );
         }
+        if( timer )
+            latency_tracer::on_processing_block( traced_stream,
+                                                 traced_sensor,
+                                                 frame_number,
+                                                 get_info( RS2_CAMERA_INFO_NAME ),
+                                                 timer.start(),
+                                                 timer.own_end() );
     }
 
     generic_processing_block::generic_processing_block(const char* name)
@@ -259,8 +278,15 @@ namespace librealsense
         {
             width = vf.get_width();
             height = vf.get_height();
+            // The size of compressed data (e.g., MJPEG) is in the metadata; without it, all we know is the size of
+            // the buffer it's in
+            raw_size = static_cast<int>(f.get_data_size());
             if (f.supports_frame_metadata(RS2_FRAME_METADATA_RAW_FRAME_SIZE))
-                raw_size = static_cast<int>(f.get_frame_metadata(RS2_FRAME_METADATA_RAW_FRAME_SIZE));
+            {
+                auto const metadata_size = f.get_frame_metadata(RS2_FRAME_METADATA_RAW_FRAME_SIZE);
+                if (metadata_size > 0 && metadata_size < raw_size)
+                    raw_size = static_cast<int>(metadata_size);
+            }
         }
         uint8_t * planes[1];
         planes[0] = (uint8_t *)ret.get_data();
@@ -339,6 +365,7 @@ namespace librealsense
 
     void synthetic_source::frame_ready(frame_holder result)
     {
+        latency_tracer::downstream_timer timer;
         _actual_source.invoke_callback(std::move(result));
     }
 
@@ -354,6 +381,7 @@ namespace librealsense
             data.metadata_size = 0;
             data.system_time = time_service::get_time();
             data.is_blocking = original->is_blocking();
+            data.latency = original->get_header().latency;
 
             auto res = _actual_source.alloc_frame(
                 { vid_stream->get_stream_type(), vid_stream->get_stream_index(), frame_type },
@@ -503,7 +531,7 @@ namespace librealsense
         }
     }
 
-    frame_interface* synthetic_source::allocate_composite_frame(std::vector<frame_holder> holders)
+    frame_interface* synthetic_source::allocate_composite_frame(std::vector<frame_holder> && holders)
     {
         frame_additional_data d{};
 
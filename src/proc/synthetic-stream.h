@@ -36,7 +36,7 @@ namespace librealsense
             frame_interface* original,
             rs2_extension frame_type = RS2_EXTENSION_MOTION_FRAME) override;
 
-        frame_interface* allocate_composite_frame(std::vector<frame_holder> frames) override;
+        frame_interface* allocate_composite_frame(std::vector<frame_holder> && frames) override;
 
         frame_interface* allocate_points(std::shared_ptr<stream_profile_interface> stream, 
             frame_interface* original, rs2_extension frame_type = RS2_EXTENSION_POINTS) override;
@@ -60,6 +60,9 @@ namespace librealsense
         void invoke(frame_holder frames) override;
         synthetic_source_interface& get_source() override { return _source_wrapper; }
 
+        void set_frame_allocator( std::shared_ptr< frame_allocator > const & allocator ) { _source.set_frame_allocator( allocator ); }
+        frame_buffer_pool_stats get_buffer_pool_stats() const { return _source.get_buffer_pool_stats(); }
+
         virtual ~processing_block() { _source.flush(); }
     protected:
         frame_source _source;
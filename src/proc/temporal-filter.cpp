@@ -132,6 +132,49 @@ namespace librealsense
     }
 
 
+    void temporal_filter::filter_in_place(void* data, size_t width, size_t height, bool disparity, range_fn const& then)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        auto extension_type = disparity ? RS2_EXTENSION_DISPARITY_FRAME : RS2_EXTENSION_DEPTH_FRAME;
+        size_t bpp = disparity ? sizeof(float) : sizeof(uint16_t);
+        size_t pixels = width * height;
+
+        // Same as update_configuration(), without a profile to compare against: the history is restarted when
+        // the image changes, or when frames came in directly in between
+        if (_source_stream_profile || extension_type != _extension_type || width != _width || height != _height
+            || _last_frame.size() != pixels * bpp)
+        {
+            _source_stream_profile = rs2::stream_profile();
+            _extension_type = extension_type;
+            _bpp = bpp;
+            _width = width;
+            _height = height;
+            _stride = _width * _bpp;
+            _current_frm_size_pixels = pixels;
+
+            _last_frame.clear();
+            _last_frame.resize(_current_frm_size_pixels*_bpp);
+
+            _history.clear();
+            _history.resize(_current_frm_size_pixels*_bpp);
+        }
+
+        // A tile, its history and its converted output fit in L2
+        const size_t tile = 4096;
+        for (size_t begin = 0; begin < pixels; begin += tile)
+        {
+            auto end = std::min(begin + tile, pixels);
+            if (disparity)
+                temp_jw_smooth_range<float>(data, _last_frame.data(), _history.data(), begin, end);
+            else
+                temp_jw_smooth_range<uint16_t>(data, _last_frame.data(), _history.data(), begin, end);
+            then(begin, end);
+        }
+
+        _cur_frame_index = (_cur_frame_index + 1) % 8;  // at end of cycle
+    }
+
     void temporal_filter::on_set_persistence_control(uint8_t val)
     {
         std::lock_guard<std::mutex> lock(_mutex);
@@ -4,6 +4,8 @@
 #pragma once
 #include "types.h"
 
+#include <functional>
+
 namespace librealsense
 {
     const size_t PRESISTENCY_LUT_SIZE = 256;
@@ -13,6 +15,13 @@ namespace librealsense
     public:
         temporal_filter();
 
+        typedef std::function<void(size_t begin, size_t end)> range_fn;
+
+        // Filters a depth (uint16) or disparity (float) image in place with this block's options and history, on
+        // behalf of another block (see depth_pipeline). The image is processed in tiles small enough to stay in
+        // cache, and 'then' is called on the pixels [begin, end) of each as soon as it's done.
+        void filter_in_place(void* data, size_t width, size_t height, bool disparity, range_fn const& then);
+
     protected:
         void    update_configuration(const rs2::frame& f);
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
@@ -21,6 +30,15 @@ namespace librealsense
 
         template<typename T>
         void temp_jw_smooth(void* frame_data, void * _last_frame_data, uint8_t *history)
+        {
+            temp_jw_smooth_range<T>(frame_data, _last_frame_data, history, 0, _current_frm_size_pixels);
+
+            _cur_frame_index = (_cur_frame_index + 1) % 8;  // at end of cycle
+        }
+
+        // Pixels are filtered independently, so the frame can be done in any number of ranges [begin, end)
+        template<typename T>
+        void temp_jw_smooth_range(void* frame_data, void * _last_frame_data, uint8_t *history, size_t begin, size_t end)
         {
             static_assert((std::is_arithmetic<T>::value), "temporal filter assumes numeric types");
 
@@ -37,7 +55,7 @@ namespace librealsense
             float alpha = _alpha_param;
             float one_minus_alpha = 1.f - alpha;
             // pass one -- go through image and update all
-            for (size_t i = 0; i < _current_frm_size_pixels; i++)
+            for (size_t i = begin; i < end; i++)
             {
                 T cur_val = frame[i];
                 T prev_val = _last_frame[i];
@@ -82,8 +100,6 @@ namespace librealsense
                     history[i] &= ~mask;
                 }
             }
-
-            _cur_frame_index = (_cur_frame_index + 1) % 8;  // at end of cycle
         }
 
     private:
@@ -18,8 +18,10 @@
 #include "core/advanced_mode.h"
 #include "core/pose-frame.h"
 #include "core/motion-frame.h"
+#include "platform/hid-data.h"
 #include "core/disparity-frame.h"
 #include "source.h"
+#include "frame-allocator.h"
 #include "proc/synthetic-stream.h"
 #include "proc/processing-blocks-factory.h"
 #include "proc/colorizer.h"
@@ -33,6 +35,7 @@
 #include "proc/rotation-filter.h"
 #include "proc/spatial-filter.h"
 #include "proc/hole-filling-filter.h"
+#include "proc/depth-pipeline.h"
 #include "proc/color-formats-converter.h"
 #include "proc/y411-converter.h"
 #include "proc/rates-printer.h"
@@ -51,6 +54,7 @@
 #include "software-device-info.h"
 #include "software-sensor.h"
 #include "global_timestamp_reader.h"
+#include <rsutils/concurrency/timer-service.h>
 #include "auto-calibrated-device.h"
 #include "terminal-parser.h"
 #include "firmware_logger_device.h"
@@ -60,6 +64,7 @@
 #include "max-usable-range-sensor.h"
 #include "fw-update/fw-update-device-interface.h"
 #include "core/frame-callback.h"
+#include "core/latency-tracer.h"
 #include "color-sensor.h"
 #include "inference-sensor.h"
 #include "safety-sensor.h"
@@ -1138,11 +1143,44 @@ rs2_frame_callback_sptr make_user_frame_callback( rs2_frame_callback_ptr on_fram
 }
 
 
+// A frame callback that belongs to the user: when tracing latency, we stamp the frames it gets and when it returns.
+// Unless it hands them right back to us (e.g., an rs2::syncer or frame_queue), in which case they're stamped where
+// they finally come out.
+rs2_frame_callback_sptr traced_user_callback( rs2_frame_callback_sptr callback )
+{
+    return librealsense::make_frame_callback(
+        [callback]( frame_interface * f )
+        {
+            if( ! f || ! latency_tracer::is_enabled() )
+                return callback->on_frame( (rs2_frame *)f );
+
+            f->acquire();  // the user releases theirs
+            auto const delivered = latency_tracer::now();
+            latency_tracer::user_callback_scope scope;
+            try
+            {
+                callback->on_frame( (rs2_frame *)f );
+            }
+            catch( ... )
+            {
+                f->release();
+                throw;
+            }
+            if( ! scope.forwarded() )
+            {
+                latency_tracer::stamp( f, latency_stage::delivered, delivered );
+                latency_tracer::stamp( f, latency_stage::returned );
+            }
+            f->release();
+        } );
+}
+
+
 void rs2_start(const rs2_sensor* sensor, rs2_frame_callback_ptr on_frame, void* user, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(sensor);
     VALIDATE_NOT_NULL(on_frame);
-    auto callback = make_user_frame_callback( on_frame, user );
+    auto callback = traced_user_callback( make_user_frame_callback( on_frame, user ) );
     sensor->sensor->start(std::move(callback));
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, sensor, on_frame, user)
@@ -1200,6 +1238,83 @@ void rs2_set_notifications_callback(const rs2_sensor* sensor, rs2_notification_c
 HANDLE_EXCEPTIONS_AND_RETURN(, sensor, on_notification, user)
 
 
+class frame_allocator_from_ptrs : public rs2_frame_allocator
+{
+    rs2_frame_allocate_ptr _allocate;
+    rs2_frame_free_ptr _free;
+    void * _user;
+
+public:
+    frame_allocator_from_ptrs( rs2_frame_allocate_ptr allocate, rs2_frame_free_ptr free, void * user )
+        : _allocate( allocate )
+        , _free( free )
+        , _user( user )
+    {
+    }
+
+    void * allocate( int size, int alignment ) override { return _allocate( size, alignment, _user ); }
+    void free( void * data, int size ) override { _free( data, size, _user ); }
+    void release() override { delete this; }
+};
+
+std::shared_ptr< librealsense::frame_allocator > make_frame_allocator( rs2_frame_allocator_sptr allocator, int alignment )
+{
+    if( ! allocator )
+        return nullptr;
+    if( alignment < 0 || ( alignment & ( alignment - 1 ) ) )
+        throw librealsense::invalid_value_exception( rsutils::string::from()
+                                                     << "frame allocator alignment must be a power of 2; got " << alignment );
+    return std::make_shared< librealsense::frame_allocator >( std::move( allocator ), alignment );
+}
+
+void rs2_set_frame_allocator( const rs2_sensor * sensor,
+                              rs2_frame_allocate_ptr allocate,
+                              rs2_frame_free_ptr free,
+                              int alignment,
+                              void * user,
+                              rs2_error ** error ) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL( sensor );
+    rs2_frame_allocator_sptr allocator;
+    if( allocate )
+    {
+        VALIDATE_NOT_NULL( free );
+        allocator.reset( new frame_allocator_from_ptrs( allocate, free, user ),
+                         []( rs2_frame_allocator * p ) { p->release(); } );
+    }
+    sensor->sensor->set_frame_allocator( make_frame_allocator( std::move( allocator ), alignment ) );
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, sensor, allocate, free, alignment, user)
+
+void rs2_set_frame_allocator_cpp( const rs2_sensor * sensor,
+                                  rs2_frame_allocator * allocator,
+                                  int alignment,
+                                  rs2_error ** error ) BEGIN_API_CALL
+{
+    // Take ownership of the allocator ASAP or else memory leaks could result if we throw! (the caller usually does
+    // a 'new' when calling us)
+    rs2_frame_allocator_sptr allocator_ptr;
+    if( allocator )
+        allocator_ptr.reset( allocator, []( rs2_frame_allocator * p ) { p->release(); } );
+
+    VALIDATE_NOT_NULL( sensor );
+    sensor->sensor->set_frame_allocator( make_frame_allocator( std::move( allocator_ptr ), alignment ) );
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, sensor, allocator, alignment)
+
+void rs2_get_frame_buffer_pool_stats( const rs2_sensor * sensor,
+                                      rs2_frame_buffer_pool_stats * stats,
+                                      rs2_error ** error ) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL( sensor );
+    VALIDATE_NOT_NULL( stats );
+    auto const pool_stats = sensor->sensor->get_frame_buffer_pool_stats();
+    stats->hits = pool_stats.hits;
+    stats->misses = pool_stats.misses;
+    stats->evictions = pool_stats.evictions;
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, sensor, stats)
+
 class software_device_destruction_callback : public rs2_software_device_destruction_callback
 {
     rs2_software_device_destruction_callback_ptr nptr;
@@ -1281,7 +1396,7 @@ void rs2_start_cpp(const rs2_sensor* sensor, rs2_frame_callback* callback, rs2_e
                                           } };
 
     VALIDATE_NOT_NULL(sensor);
-    sensor->sensor->start( callback_ptr );
+    sensor->sensor->start( traced_user_callback( callback_ptr ) );
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, sensor, callback)
 
@@ -1362,6 +1477,27 @@ int rs2_supports_frame_metadata(const rs2_frame* frame, rs2_frame_metadata_value
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, frame, frame_metadata)
 
+int rs2_get_frame_metadata_all(const rs2_frame* frame, rs2_metadata_type* values, int* supported, int count, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    VALIDATE_NOT_NULL(values);
+    VALIDATE_NOT_NULL(supported);
+    VALIDATE_GT(count, -1);
+    auto frame_ifc = (frame_interface*)frame;
+    int n_supported = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        // Only the first query runs the parsers; the rest come from the frame's decoded table
+        rs2_metadata_type value = 0;
+        bool found = i < RS2_FRAME_METADATA_COUNT && frame_ifc->find_metadata((rs2_frame_metadata_value)i, &value);
+        values[i] = found ? value : 0;
+        supported[i] = found;
+        n_supported += found;
+    }
+    return n_supported;
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, frame, values, supported, count)
+
 rs2_metadata_type rs2_get_frame_metadata(const rs2_frame* frame, rs2_frame_metadata_value frame_metadata, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(frame);
@@ -1513,6 +1649,28 @@ int rs2_get_frame_bits_per_pixel(const rs2_frame* frame_ref, rs2_error** error)
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, frame_ref)
 
+int rs2_get_frame_dmabuf_fd(const rs2_frame* frame_ref, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame_ref);
+    auto f = dynamic_cast< librealsense::frame * >( (frame_interface *)frame_ref );
+    if( ! f || f->dmabuf_fd < 0 )
+        throw invalid_value_exception( "frame data is not a DMABUF" );
+    return f->dmabuf_fd;
+}
+HANDLE_EXCEPTIONS_AND_RETURN(-1, frame_ref)
+
+const rs2_motion_sample* rs2_get_motion_samples(const rs2_frame* frame_ref, int* count, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame_ref);
+    VALIDATE_NOT_NULL(count);
+    auto mf = VALIDATE_INTERFACE(((frame_interface*)frame_ref), librealsense::motion_frame);
+    static_assert( sizeof( rs2_motion_sample ) == sizeof( hid_batch_sample ),
+                   "batched samples are converted in place" );
+    *count = int( mf->get_sample_count() );
+    return mf->get_samples();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frame_ref, count)
+
 unsigned long long rs2_get_frame_number(const rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(frame);
@@ -1644,6 +1802,7 @@ rs2_frame* rs2_wait_for_frame(rs2_frame_queue* queue, unsigned int timeout_ms, r
 
     frame_interface* result = nullptr;
     std::swap(result, fh.frame);
+    latency_tracer::stamp( result, latency_stage::delivered );
     return (rs2_frame*)result;
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, queue)
@@ -1657,6 +1816,7 @@ int rs2_poll_for_frame(rs2_frame_queue* queue, rs2_frame** output_frame, rs2_err
     {
         frame_interface* result = nullptr;
         std::swap(result, fh.frame);
+        latency_tracer::stamp( result, latency_stage::delivered );
         *output_frame = (rs2_frame*)result;
         return true;
     }
@@ -1677,6 +1837,7 @@ int rs2_try_wait_for_frame(rs2_frame_queue* queue, unsigned int timeout_ms, rs2_
 
     frame_interface* result = nullptr;
     std::swap(result, fh.frame);
+    latency_tracer::stamp( result, latency_stage::delivered );
     *output_frame = (rs2_frame*)result;
     return true;
 }
@@ -1687,6 +1848,7 @@ void rs2_enqueue_frame(rs2_frame* frame, void* queue) BEGIN_API_CALL
     VALIDATE_NOT_NULL(frame);
     VALIDATE_NOT_NULL(queue);
     auto q = reinterpret_cast<rs2_frame_queue*>(queue);
+    latency_tracer::on_forwarded();
     librealsense::frame_holder fh;
     fh.frame = (frame_interface*)frame;
     q->queue.enqueue(std::move(fh));
@@ -2032,6 +2194,11 @@ int rs2_is_frame_extendable_to(const rs2_frame* f, rs2_extension extension_type,
     case RS2_EXTENSION_LABELED_POINTS         : return VALIDATE_INTERFACE_NO_THROW((frame_interface*)f, librealsense::labeled_points) != nullptr;
     case RS2_EXTENSION_INFERENCE_FRAME        : return VALIDATE_INTERFACE_NO_THROW((frame_interface*)f, librealsense::inference_frame) != nullptr;
     case RS2_EXTENSION_OBJECT_DETECTION_FRAME : return VALIDATE_INTERFACE_NO_THROW((frame_interface*)f, librealsense::object_detection_frame) != nullptr;
+    case RS2_EXTENSION_DMABUF_FRAME           :
+    {
+        auto fr = dynamic_cast< librealsense::frame * >( (frame_interface *)f );
+        return fr && fr->dmabuf_fd >= 0;
+    }
 
     default:
         return false;
@@ -2052,6 +2219,7 @@ int rs2_is_processing_block_extendable_to(const rs2_processing_block* f, rs2_ext
     case RS2_EXTENSION_SPATIAL_FILTER: return VALIDATE_INTERFACE_NO_THROW((processing_block_interface*)(f->block.get()), librealsense::spatial_filter) != nullptr;
     case RS2_EXTENSION_TEMPORAL_FILTER: return VALIDATE_INTERFACE_NO_THROW((processing_block_interface*)(f->block.get()), librealsense::temporal_filter) != nullptr;
     case RS2_EXTENSION_HOLE_FILLING_FILTER: return VALIDATE_INTERFACE_NO_THROW((processing_block_interface*)(f->block.get()), librealsense::hole_filling_filter) != nullptr;
+    case RS2_EXTENSION_DEPTH_PIPELINE: return VALIDATE_INTERFACE_NO_THROW((processing_block_interface*)(f->block.get()), librealsense::depth_pipeline) != nullptr;
     case RS2_EXTENSION_ZERO_ORDER_FILTER: throw not_implemented_exception( "deprecated" );
     case RS2_EXTENSION_DEPTH_HUFFMAN_DECODER: throw not_implemented_exception( "deprecated" );
     case RS2_EXTENSION_HDR_MERGE: return VALIDATE_INTERFACE_NO_THROW((processing_block_interface*)(f->block.get()), librealsense::hdr_merge) != nullptr;
@@ -2100,7 +2268,7 @@ rs2_device* rs2_context_add_device(rs2_context* ctx, const char* file, rs2_error
     VALIDATE_NOT_NULL(ctx);
     VALIDATE_NOT_NULL(file);
 
-    if (!librealsense::is_db3_file(file))
+    if (!librealsense::is_db3_file(file) && !librealsense::is_mcap_file(file))
 #ifdef BUILD_ROSBAG2
         LOG_WARNING("ROS1 .bag format is deprecated. Use rs-convert -D to convert to .db3 format.");
 #else
@@ -2174,6 +2342,24 @@ unsigned long long int rs2_playback_get_position(const rs2_device* device, rs2_e
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, device)
 
+int rs2_playback_get_stream_range(const rs2_device* device, rs2_stream stream, int index, rs2_playback_stream_range* range, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_ENUM(stream);
+    VALIDATE_LE(0, index);
+    VALIDATE_NOT_NULL(range);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    *range = {};
+    librealsense::device_serializer::stream_range stream_range;
+    if (!playback->get_stream_range(stream, index, stream_range))
+        return 0;
+    range->frame_count = stream_range.frame_count;
+    range->first_frame_ns = stream_range.first_frame.count();
+    range->last_frame_ns = stream_range.last_frame.count();
+    return 1;
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, device, stream, index, range)
+
 void rs2_playback_device_resume(const rs2_device* device, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(device);
@@ -2310,6 +2496,34 @@ const char* rs2_record_device_filename(const rs2_device* device, rs2_error** err
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device)
 
+void rs2_record_device_set_queue_limit(const rs2_device* device, unsigned long long max_bytes, rs2_record_overflow_policy policy, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_ENUM(policy);
+    auto record_device = VALIDATE_INTERFACE(device->device, librealsense::record_device);
+    record_device->set_queue_limit(max_bytes, policy);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, max_bytes, policy)
+
+void rs2_record_device_get_statistics(const rs2_device* device, rs2_record_statistics* statistics, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(statistics);
+    auto record_device = VALIDATE_INTERFACE(device->device, librealsense::record_device);
+    *statistics = record_device->get_statistics();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, statistics)
+
+void rs2_record_device_set_stream_codec(const rs2_device* device, rs2_stream stream, int index, rs2_record_stream_codec codec, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_ENUM(stream);
+    VALIDATE_ENUM(codec);
+    auto record_device = VALIDATE_INTERFACE(device->device, librealsense::record_device);
+    record_device->set_stream_codec(stream, index, codec);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, stream, index, codec)
+
 
 rs2_frame* rs2_allocate_synthetic_video_frame(rs2_source* source, const rs2_stream_profile* new_stream, rs2_frame* original,
     int new_bpp, int new_width, int new_height, int new_stride, rs2_extension frame_type, rs2_error** error) BEGIN_API_CALL
@@ -2397,6 +2611,7 @@ rs2_frame* rs2_pipeline_wait_for_frames(rs2_pipeline* pipe, unsigned int timeout
     auto f = pipe->pipeline->wait_for_frames(timeout_ms);
     auto frame = f.frame;
     f.frame = nullptr;
+    latency_tracer::stamp( frame, latency_stage::delivered );
     return (rs2_frame*)(frame);
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, pipe)
@@ -2411,6 +2626,7 @@ int rs2_pipeline_poll_for_frames(rs2_pipeline * pipe, rs2_frame** output_frame,
     {
         frame_interface* result = nullptr;
         std::swap(result, fh.frame);
+        latency_tracer::stamp( result, latency_stage::delivered );
         *output_frame = (rs2_frame*)result;
         return true;
     }
@@ -2428,6 +2644,7 @@ int rs2_pipeline_try_wait_for_frames(rs2_pipeline* pipe, rs2_frame** output_fram
     {
         frame_interface* result = nullptr;
         std::swap(result, fh.frame);
+        latency_tracer::stamp( result, latency_stage::delivered );
         *output_frame = (rs2_frame*)result;
         return true;
     }
@@ -2461,7 +2678,7 @@ HANDLE_EXCEPTIONS_AND_RETURN(nullptr, pipe, config)
 rs2_pipeline_profile* rs2_pipeline_start_with_callback(rs2_pipeline* pipe, rs2_frame_callback_ptr on_frame, void* user, rs2_error ** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(pipe);
-    auto callback = make_user_frame_callback( on_frame, user );
+    auto callback = traced_user_callback( make_user_frame_callback( on_frame, user ) );
     return new rs2_pipeline_profile{ pipe->pipeline->start(std::make_shared<pipeline::config>(), std::move(callback)) };
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, pipe, on_frame, user)
@@ -2470,7 +2687,7 @@ rs2_pipeline_profile* rs2_pipeline_start_with_config_and_callback(rs2_pipeline*
 {
     VALIDATE_NOT_NULL(pipe);
     VALIDATE_NOT_NULL(config);
-    auto callback = make_user_frame_callback( on_frame, user );
+    auto callback = traced_user_callback( make_user_frame_callback( on_frame, user ) );
     return new rs2_pipeline_profile{ pipe->pipeline->start(config->config, callback) };
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, pipe, config, on_frame, user)
@@ -2487,7 +2704,7 @@ rs2_pipeline_profile* rs2_pipeline_start_with_callback_cpp(rs2_pipeline* pipe, r
                                           } };
 
     VALIDATE_NOT_NULL(pipe);
-    return new rs2_pipeline_profile{ pipe->pipeline->start( std::make_shared< pipeline::config >(), callback_ptr ) };
+    return new rs2_pipeline_profile{ pipe->pipeline->start( std::make_shared< pipeline::config >(), traced_user_callback( callback_ptr ) ) };
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, pipe, callback)
 
@@ -2504,7 +2721,7 @@ rs2_pipeline_profile* rs2_pipeline_start_with_config_and_callback_cpp(rs2_pipeli
 
     VALIDATE_NOT_NULL(pipe);
     VALIDATE_NOT_NULL(config);
-    return new rs2_pipeline_profile{ pipe->pipeline->start( config->config, callback_ptr ) };
+    return new rs2_pipeline_profile{ pipe->pipeline->start( config->config, traced_user_callback( callback_ptr ) ) };
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, pipe, config, callback)
 
@@ -2613,6 +2830,17 @@ void rs2_config_enable_record_to_file(rs2_config* config, const char* file, rs2_
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, config, file)
 
+void rs2_config_set_frame_allocator_cpp(rs2_config* config, rs2_frame_allocator* allocator, int alignment, rs2_error ** error) BEGIN_API_CALL
+{
+    rs2_frame_allocator_sptr allocator_ptr;
+    if( allocator )
+        allocator_ptr.reset( allocator, []( rs2_frame_allocator * p ) { p->release(); } );
+
+    VALIDATE_NOT_NULL(config);
+    config->config->set_frame_allocator( make_frame_allocator( std::move( allocator_ptr ), alignment ) );
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, config, allocator, alignment)
+
 void rs2_config_disable_stream(rs2_config* config, rs2_stream stream, rs2_error ** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(config);
@@ -2736,6 +2964,14 @@ rs2_processing_block* rs2_create_sync_processing_block(rs2_error** error) BEGIN_
 }
 NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
 
+rs2_processing_block* rs2_create_lock_free_sync_processing_block(rs2_error** error) BEGIN_API_CALL
+{
+    auto block = std::make_shared<librealsense::syncer_process_unit>(nullptr, true, librealsense::sync_engine::lock_free);
+
+    return new rs2_processing_block{ block };
+}
+NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
+
 void rs2_start_processing(rs2_processing_block* block, rs2_frame_callback* on_frame, rs2_error** error) BEGIN_API_CALL
 {
     // Take ownership of the callback ASAP or else memory leaks could result if we throw! (the caller usually does a
@@ -2748,7 +2984,7 @@ void rs2_start_processing(rs2_processing_block* block, rs2_frame_callback* on_fr
 
     VALIDATE_NOT_NULL(block);
 
-    block->block->set_output_callback( callback_ptr );
+    block->block->set_output_callback( traced_user_callback( callback_ptr ) );
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, block, on_frame)
 
@@ -2757,7 +2993,7 @@ void rs2_start_processing_fptr(rs2_processing_block* block, rs2_frame_callback_p
     VALIDATE_NOT_NULL(block);
     VALIDATE_NOT_NULL(on_frame);
 
-    auto callback = make_user_frame_callback( on_frame, user );
+    auto callback = traced_user_callback( make_user_frame_callback( on_frame, user ) );
     block->block->set_output_callback( std::move( callback ) );
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, block, on_frame, user)
@@ -2776,6 +3012,7 @@ void rs2_process_frame(rs2_processing_block* block, rs2_frame* frame, rs2_error*
     VALIDATE_NOT_NULL(block);
     VALIDATE_NOT_NULL(frame);
 
+    latency_tracer::on_forwarded();
     block->block->invoke(frame_holder((frame_interface*)frame));
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, block, frame)
@@ -3020,6 +3257,31 @@ rs2_processing_block* rs2_create_hole_filling_filter_block(rs2_error** error) BE
 }
 NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
 
+rs2_processing_block* rs2_create_depth_pipeline_block(rs2_processing_block* decimation, rs2_processing_block* spatial,
+                                                      rs2_processing_block* temporal, rs2_error** error) BEGIN_API_CALL
+{
+    // Stages left null are skipped; the others share ownership of the user's blocks
+    std::shared_ptr<librealsense::decimation_filter> decimation_block;
+    if (decimation)
+        decimation_block = std::shared_ptr<librealsense::decimation_filter>(decimation->block,
+            VALIDATE_INTERFACE((processing_block_interface*)decimation->block.get(), librealsense::decimation_filter));
+
+    std::shared_ptr<librealsense::spatial_filter> spatial_block;
+    if (spatial)
+        spatial_block = std::shared_ptr<librealsense::spatial_filter>(spatial->block,
+            VALIDATE_INTERFACE((processing_block_interface*)spatial->block.get(), librealsense::spatial_filter));
+
+    std::shared_ptr<librealsense::temporal_filter> temporal_block;
+    if (temporal)
+        temporal_block = std::shared_ptr<librealsense::temporal_filter>(temporal->block,
+            VALIDATE_INTERFACE((processing_block_interface*)temporal->block.get(), librealsense::temporal_filter));
+
+    auto block = std::make_shared<librealsense::depth_pipeline>(decimation_block, spatial_block, temporal_block);
+
+    return new rs2_processing_block{ block };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, decimation, spatial, temporal)
+
 rs2_processing_block* rs2_create_rates_printer_block(rs2_error** error) BEGIN_API_CALL
 {
     auto block = std::make_shared<librealsense::rates_printer>();
@@ -3200,6 +3462,50 @@ rs2_time_t rs2_get_time(rs2_error** error) BEGIN_API_CALL
 }
 NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(0)
 
+rs2_raw_data_buffer* rs2_get_timer_service_stats(rs2_error** error) BEGIN_API_CALL
+{
+    typedef std::chrono::duration< double, std::milli > ms;
+
+    json j = json::object();
+    json tasks = json::array();
+    size_t n_threads = 0;
+    if( auto service = rsutils::concurrency::timer_service::existing_instance() )
+    {
+        n_threads = service->thread_count();
+        for( auto const & t : service->get_task_stats() )
+            tasks.push_back( json::object( {
+                { "name", t.name },
+                { "interval-ms", ms( t.interval ).count() },
+                { "active", t.active },
+                { "runs", t.runs },
+                { "average-ms", t.runs ? ms( t.total_run_time ).count() / t.runs : 0. },
+                { "max-ms", ms( t.max_run_time ).count() },
+                { "max-late-ms", ms( t.max_lateness ).count() } } ) );
+    }
+    j["threads"] = n_threads;
+    j["tasks"] = std::move( tasks );
+
+    auto const str = j.dump();
+    return new rs2_raw_data_buffer{ std::vector< uint8_t >( str.begin(), str.end() ) };
+}
+NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
+
+void rs2_enable_latency_tracing( int enable, const char * trace_file, rs2_error ** error ) BEGIN_API_CALL
+{
+    if( enable )
+        latency_tracer::start( trace_file ? trace_file : "" );
+    else
+        latency_tracer::stop();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, enable, trace_file)
+
+rs2_raw_data_buffer* rs2_get_stream_latency_stats(rs2_error** error) BEGIN_API_CALL
+{
+    auto const str = latency_tracer::get_stats().dump();
+    return new rs2_raw_data_buffer{ std::vector< uint8_t >( str.begin(), str.end() ) };
+}
+NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
+
 rs2_device* rs2_create_software_device(rs2_error** error) BEGIN_API_CALL
 {
     // We're not given a context...
@@ -135,6 +135,16 @@ void log_callback_end( uint32_t fps,
         return _source.set_callback(callback);
     }
 
+    void sensor_base::set_frame_allocator( std::shared_ptr< frame_allocator > const & allocator )
+    {
+        _source.set_frame_allocator( allocator );
+    }
+
+    frame_buffer_pool_stats sensor_base::get_frame_buffer_pool_stats() const
+    {
+        return _source.get_buffer_pool_stats();
+    }
+
     bool sensor_base::is_streaming() const
     {
         return _is_streaming;
@@ -406,6 +416,18 @@ void log_callback_end( uint32_t fps,
     ///////////////// Synthetic Sensor ///////////////////
     //////////////////////////////////////////////////////
 
+    // A block converting several raw streams is listed once for each
+    static frame_buffer_pool_stats
+    buffer_pool_stats_of( std::vector< std::shared_ptr< processing_block > > const & converters )
+    {
+        frame_buffer_pool_stats stats;
+        std::set< processing_block const * > counted;
+        for( auto & pb : converters )
+            if( counted.insert( pb.get() ).second )
+                stats += pb->get_buffer_pool_stats();
+        return stats;
+    }
+
     synthetic_sensor::synthetic_sensor( std::string const & name,
                                         std::shared_ptr< raw_sensor_base > const & raw_sensor,
                                         device * device,
@@ -428,6 +450,11 @@ void log_callback_end( uint32_t fps,
 
         auto& raw_fourcc_to_rs2_stream_map = _raw_sensor->get_fourcc_to_rs2_stream_map();
         raw_fourcc_to_rs2_stream_map = std::make_shared<std::map<uint32_t, rs2_stream>>(fourcc_to_rs2_stream_map);
+
+        // Zero-copy and motion batching are properties of how the raw sensor captures; expose them as is
+        for( auto option : { RS2_OPTION_ZERO_COPY, RS2_OPTION_MOTION_BATCH_WINDOW } )
+            if( _raw_sensor->supports_option( option ) )
+                sensor_base::register_option( option, _raw_sensor->get_option_handler( option ) );
     }
 
     synthetic_sensor::~synthetic_sensor()
@@ -545,12 +572,17 @@ void log_callback_end( uint32_t fps,
 
         for (auto&& opt : options)
         {
-            const auto&& already_registered_predicate = [&opt](const rs2_option& o) {return o == opt; };
-            if (std::none_of(begin(options), end(options), already_registered_predicate))
-            {
-                this->register_option(opt, std::shared_ptr<option>(const_cast<option*>(&pb.get_option(opt))));
-                _cached_processing_blocks_options.push_back(opt);
-            }
+            // The stream filters are how the formats converter routes frames through the block: not for the user
+            if (opt == RS2_OPTION_STREAM_FILTER || opt == RS2_OPTION_STREAM_FORMAT_FILTER
+                || opt == RS2_OPTION_STREAM_INDEX_FILTER)
+                continue;
+
+            // The sensor's own options, and those of blocks registered before, come first
+            if (supports_option(opt))
+                continue;
+
+            this->register_option(opt, pb.get_option_handler(opt));
+            _cached_processing_blocks_options.push_back(opt);
         }
     }
 
@@ -604,12 +636,27 @@ void log_callback_end( uint32_t fps,
 
         std::lock_guard<std::mutex> lock(_synthetic_configure_lock);
 
+        // The blocks converting the previous streams are about to be replaced: keep what they counted
+        _replaced_converters_stats += buffer_pool_stats_of( _formats_converter.get_active_converters() );
+
         _formats_converter.prepare_to_convert( requests );
 
         const auto & resolved_req = _formats_converter.get_active_source_profiles();
         std::vector< std::shared_ptr< processing_block > > active_pbs = _formats_converter.get_active_converters();
         for( auto & pb : active_pbs )
+        {
             register_processing_block_options( *pb );
+            pb->set_frame_allocator( _frame_allocator );
+        }
+
+        // Zero-copy frames are passed on to the user as they come from the raw sensor, so the number the user can
+        // hold (and therefore the number of backend buffers) follows the queue size set here
+        if( _raw_sensor->supports_option( RS2_OPTION_ZERO_COPY )
+            && _raw_sensor->get_option( RS2_OPTION_ZERO_COPY ).query() != 0 )
+        {
+            _raw_sensor->get_option( RS2_OPTION_FRAMES_QUEUE_SIZE )
+                .set( get_option( RS2_OPTION_FRAMES_QUEUE_SIZE ).query() );
+        }
 
         _raw_sensor->set_source_owner(this);
         try
@@ -689,6 +736,27 @@ void log_callback_end( uint32_t fps,
         _formats_converter.register_converters( pbfs );
     }
 
+    void synthetic_sensor::set_frame_allocator( std::shared_ptr< frame_allocator > const & allocator )
+    {
+        std::lock_guard< std::mutex > lock( _synthetic_configure_lock );
+
+        // Frames reach the user either as-is from the raw sensor, or converted by our processing blocks
+        _frame_allocator = allocator;
+        _raw_sensor->set_frame_allocator( allocator );
+        for( auto & pb : _formats_converter.get_active_converters() )
+            pb->set_frame_allocator( allocator );
+    }
+
+    frame_buffer_pool_stats synthetic_sensor::get_frame_buffer_pool_stats() const
+    {
+        std::lock_guard< std::mutex > lock( _synthetic_configure_lock );
+
+        auto stats = _raw_sensor->get_frame_buffer_pool_stats();
+        stats += _replaced_converters_stats;
+        stats += buffer_pool_stats_of( _formats_converter.get_active_converters() );
+        return stats;
+    }
+
     rs2_frame_callback_sptr synthetic_sensor::get_frames_callback() const
     {
         return _formats_converter.get_frames_callback();
@@ -72,6 +72,8 @@ namespace librealsense
         virtual std::shared_ptr<notifications_processor> get_notifications_processor() const;
         virtual rs2_frame_callback_sptr get_frames_callback() const override;
         virtual void set_frames_callback( rs2_frame_callback_sptr callback ) override;
+        void set_frame_allocator( std::shared_ptr< frame_allocator > const & allocator ) override;
+        frame_buffer_pool_stats get_frame_buffer_pool_stats() const override;
         bool is_streaming() const override;
         virtual bool is_opened() const;
         virtual void register_metadata(rs2_frame_metadata_value metadata, std::shared_ptr<md_attribute_parser_base> metadata_parser) const;
@@ -250,6 +252,8 @@ namespace librealsense
         std::shared_ptr< raw_sensor_base > const & get_raw_sensor() const { return _raw_sensor; }
         rs2_frame_callback_sptr get_frames_callback() const override;
         void set_frames_callback( rs2_frame_callback_sptr callback ) override;
+        void set_frame_allocator( std::shared_ptr< frame_allocator > const & allocator ) override;
+        frame_buffer_pool_stats get_frame_buffer_pool_stats() const override;
         void register_notifications_callback( rs2_notifications_callback_sptr callback ) override;
         int register_before_streaming_changes_callback(std::function<void(bool)> callback) override;
         void unregister_before_start_callback(int token) override;
@@ -272,12 +276,14 @@ namespace librealsense
         void register_processing_block_options(const processing_block& pb);
         void unregister_processing_block_options(const processing_block& pb);
 
-        std::mutex _synthetic_configure_lock;
+        mutable std::mutex _synthetic_configure_lock;
 
         rs2_frame_callback_sptr _post_process_callback;
         std::shared_ptr<raw_sensor_base> _raw_sensor;
         formats_converter _formats_converter;
         std::vector<rs2_option> _cached_processing_blocks_options;
+        std::shared_ptr< frame_allocator > _frame_allocator;
+        frame_buffer_pool_stats _replaced_converters_stats;  // of the blocks that converted previous streams
 
         synthetic_options_watcher _options_watcher;
     };
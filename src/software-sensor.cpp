@@ -7,6 +7,7 @@
 #include "option.h"
 #include "core/video-frame.h"
 #include "core/notification.h"
+#include "core/latency-tracer.h"
 #include "depth-sensor.h"
 #include <src/metadata-parser.h>
 
@@ -305,6 +306,12 @@ void software_sensor::invoke_new_frame( frame_holder && frame, void const * pixe
     // The frame pixels/data are stored in the continuation object!
     if( pixels )
         frame->attach_continuation( frame_continuation( on_release, pixels ) );
+    if( latency_tracer::is_enabled() )
+    {
+        // We only know when the frame got to us
+        auto const now = latency_tracer::now();
+        latency_tracer::on_new_frame( frame.frame, now, now );
+    }
     _source.invoke_callback( std::move( frame ) );
 }
 
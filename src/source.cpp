@@ -86,6 +86,7 @@ namespace librealsense
             throw std::runtime_error( rsutils::string::from() << "Failed to create archive of type " << get_string( ex ) );
 
         ret.first->second->set_sensor( _sensor );
+        ret.first->second->set_frame_allocator( _frame_allocator );
 
         return ret.first;
     }
@@ -110,6 +111,7 @@ namespace librealsense
         std::lock_guard< std::recursive_mutex > lock( _mutex );
 
         _callback.reset();
+        _released_archives_stats = get_buffer_pool_stats();
         _archive.clear();
         _metadata_parsers.reset();
     }
@@ -191,6 +193,37 @@ namespace librealsense
         }
     }
 
+    void frame_source::set_frame_allocator( std::shared_ptr< frame_allocator > const & allocator )
+    {
+        std::lock_guard< std::recursive_mutex > lock( _mutex );
+
+        _frame_allocator = allocator;
+        for( auto & a : _archive )
+        {
+            if( a.second )
+                a.second->set_frame_allocator( _frame_allocator );
+        }
+    }
+
+    std::shared_ptr< frame_allocator > frame_source::get_frame_allocator() const
+    {
+        std::lock_guard< std::recursive_mutex > lock( _mutex );
+        return _frame_allocator;
+    }
+
+    frame_buffer_pool_stats frame_source::get_buffer_pool_stats() const
+    {
+        std::lock_guard< std::recursive_mutex > lock( _mutex );
+
+        auto total = _released_archives_stats;
+        for( auto & kvp : _archive )
+        {
+            if( kvp.second )
+                total += kvp.second->get_buffer_pool_stats();
+        }
+        return total;
+    }
+
         rs2_extension frame_source::stream_to_frame_types( rs2_stream stream )
     {
         // TODO: explicitly return video_frame for relevant streams and default to an error?
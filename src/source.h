@@ -42,6 +42,13 @@ namespace librealsense
 
         void flush() const;
 
+        // Buffer recycling counters, summed over all the archives of this source, including those since reset
+        frame_buffer_pool_stats get_buffer_pool_stats() const;
+
+        // Allocate frame data through a user-supplied allocator (nullptr to go back to internal allocation)
+        void set_frame_allocator( std::shared_ptr< frame_allocator > const & allocator );
+        std::shared_ptr< frame_allocator > get_frame_allocator() const;
+
         virtual ~frame_source() { flush(); }
 
         void set_sensor( const std::weak_ptr< sensor_interface > & s );
@@ -60,7 +67,11 @@ namespace librealsense
             // We use a special index for extensions since we don't know the stream type here.
             // We can't wait with the allocation because we need the type T in the creation.
             archive_id special_index = { RS2_STREAM_COUNT, 0, ex };
-            _archive[special_index] = std::make_shared< frame_archive< T > >( &_max_publish_list_size, _metadata_parsers );
+            auto & archive = _archive[special_index];
+            if( archive )
+                _released_archives_stats += archive->get_buffer_pool_stats();
+            archive = std::make_shared< frame_archive< T > >( &_max_publish_list_size, _metadata_parsers );
+            archive->set_frame_allocator( _frame_allocator );
         }
 
         void set_max_publish_list_size( int qsize ) { _max_publish_list_size = qsize; }
@@ -81,5 +92,7 @@ namespace librealsense
         rs2_frame_callback_sptr _callback;
         std::shared_ptr< metadata_parser_map > _metadata_parsers;
         std::weak_ptr< sensor_interface > _sensor;
+        std::shared_ptr< frame_allocator > _frame_allocator;
+        frame_buffer_pool_stats _released_archives_stats;  // of archives no longer ours
     };
 }
@@ -345,19 +345,22 @@ namespace librealsense
         // If we have a Color frame but not Depth, then Depth is "missing" and needs to be
         // waited-for...
 
-        std::vector< frame_holder * > frames_arrived;
-        std::vector< librealsense::matcher * > frames_arrived_matchers;
-        std::vector< int > synced_frames;
-        std::vector< int > unsynced_frames;
-        std::vector< librealsense::matcher * > missing_streams;
+        // The scratch vectors are members, so they keep their capacity from one frame to the next and we don't
+        // allocate while syncing
+        auto & frames_arrived = _scratch.frames_arrived;
+        auto & frames_arrived_matchers = _scratch.frames_arrived_matchers;
+        auto & synced_frames = _scratch.synced_frames;
+        auto & unsynced_frames = _scratch.unsynced_frames;
+        auto & missing_streams = _scratch.missing_streams;
+        auto & match = _scratch.match;
 
         while( true )
         {
             missing_streams.clear();
             frames_arrived_matchers.clear();
             frames_arrived.clear();
+            match.clear();  // only moved-from holders left from the last frameset
 
-            std::vector< frame_holder > match;
             {
                 // We don't want to stop while syncing!
                 std::lock_guard< std::mutex > lock( _mutex );
@@ -442,8 +445,6 @@ namespace librealsense
                 if( ! release_synced_frames )
                     break;
 
-                match.reserve( synced_frames.size() );
-
                 for( auto index : synced_frames )
                 {
                     frame_holder frame;
@@ -760,10 +761,8 @@ namespace librealsense
         // Syncer have to output composite frame 
         if (!composite)
         {
-            std::vector<frame_holder> match;
-            std::ostringstream frame_string_for_logging;
-            frame_string_for_logging << f; // Saving frame holder string before moving frame
-
+            auto & match = _scratch.match;
+            match.clear();
             match.push_back(std::move(f));
             frame_holder composite = env.source->allocate_composite_frame(std::move(match));
             if (composite.frame)
@@ -775,7 +774,7 @@ namespace librealsense
             else
             {
                 LOG_ERROR( "composite_identity_matcher: "
-                           << _name << " " << frame_string_for_logging.str()
+                           << _name << " " << match[0]  // the frame is left in 'match' when allocation fails
                            << " faild to create composite_frame, user callback will not be called" );
             }
         }
@@ -131,6 +131,17 @@ namespace librealsense {
         std::map< matcher *, next_expected_t > _next_expected;
 
         std::mutex _mutex;
+
+        // Working space for sync(), kept between calls
+        struct sync_scratch
+        {
+            std::vector< frame_holder * > frames_arrived;
+            std::vector< matcher * > frames_arrived_matchers;
+            std::vector< int > synced_frames;
+            std::vector< int > unsynced_frames;
+            std::vector< matcher * > missing_streams;
+            std::vector< frame_holder > match;  // handed to allocate_composite_frame(), which leaves it to us
+        } _scratch;
     };
 
     // composite matcher that does not synchronize between any frames, and instead just passes them on to callback
@@ -14,6 +14,13 @@ synthetic_options_watcher::synthetic_options_watcher( const std::shared_ptr< raw
 {
 }
 
+synthetic_options_watcher::~synthetic_options_watcher()
+{
+    // Our update_options() must not run once we're gone, even while the base is still being destroyed
+    _destructing = true;
+    stop();
+}
+
 synthetic_options_watcher::options_and_values synthetic_options_watcher::update_options()
 {
     options_and_values updated_options;
@@ -15,6 +15,7 @@ class synthetic_options_watcher : public options_watcher
 {
 public:
     synthetic_options_watcher( const std::shared_ptr< raw_sensor_base > & raw_sensor );
+    ~synthetic_options_watcher();
 
 protected:
     options_and_values update_options() override;
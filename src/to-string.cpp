@@ -422,6 +422,8 @@ const char * get_string( rs2_extension value )
     CASE( INFERENCE_SENSOR )
     CASE( OBJECT_DETECTION_SENSOR )
     CASE( INFERENCE_PROFILE )
+    CASE( DMABUF_FRAME )
+    CASE( DEPTH_PIPELINE )
     default:
         assert( ! is_valid( value ) );
         return UNKNOWN_VALUE;
@@ -445,6 +447,35 @@ const char * get_string( rs2_playback_status value )
 #undef CASE
 }
 
+const char * get_string( rs2_record_overflow_policy value )
+{
+#define CASE( X ) STRCASE( RECORD_OVERFLOW, X )
+    switch( value )
+    {
+    CASE( DROP_NEWEST )
+    CASE( DROP_OLDEST )
+    CASE( BLOCK )
+    default:
+        assert( ! is_valid( value ) );
+        return UNKNOWN_VALUE;
+    }
+#undef CASE
+}
+
+const char * get_string( rs2_record_stream_codec value )
+{
+#define CASE( X ) STRCASE( RECORD_STREAM_CODEC, X )
+    switch( value )
+    {
+    CASE( DEFAULT )
+    CASE( DEPTH_LOSSLESS )
+    default:
+        assert( ! is_valid( value ) );
+        return UNKNOWN_VALUE;
+    }
+#undef CASE
+}
+
 const char * get_string( rs2_log_severity value )
 {
 #define CASE( X ) STRCASE( LOG_SEVERITY, X )
@@ -579,6 +610,9 @@ std::string const & get_string_( rs2_option value )
         CASE( DISPARITY_SHIFT )
         CASE( THRESHOLD )
         CASE( DOWNSCALE_RATIO )
+        CASE( ZERO_COPY )
+        CASE( MOTION_BATCH_WINDOW )
+        CASE( PROCESSING_THREADS )
 #undef CASE
         return arr;
     }();
@@ -1019,6 +1053,8 @@ const char * rs2_sr300_visual_preset_to_string( rs2_sr300_visual_preset preset )
 const char * rs2_log_severity_to_string( rs2_log_severity severity ) { return librealsense::get_string( severity ); }
 const char * rs2_exception_type_to_string( rs2_exception_type type ) { return librealsense::get_string( type ); }
 const char * rs2_playback_status_to_string( rs2_playback_status status ) { return librealsense::get_string( status ); }
+const char * rs2_record_overflow_policy_to_string( rs2_record_overflow_policy policy ) { return librealsense::get_string( policy ); }
+const char * rs2_record_stream_codec_to_string( rs2_record_stream_codec codec ) { return librealsense::get_string( codec ); }
 const char * rs2_extension_type_to_string( rs2_extension type ) { return librealsense::get_string( type ); }
 const char * rs2_matchers_to_string( rs2_matchers matcher ) { return librealsense::get_string( matcher ); }
 const char * rs2_frame_metadata_to_string( rs2_frame_metadata_value metadata ) { return librealsense::get_string( metadata ).c_str(); }
@@ -12,6 +12,7 @@
 #include "platform/stream-profile-impl.h"
 #include <src/metadata-parser.h>
 #include <src/core/time-service.h>
+#include <src/core/latency-tracer.h>
 
 
 namespace librealsense {
@@ -35,11 +36,49 @@ uvc_sensor::uvc_sensor( std::string const & name,
     , _timestamp_reader( std::move( timestamp_reader ) )
     , _gyro_counter(0)
     , _accel_counter(0)
+    , _zero_copy_mode( ZERO_COPY_OFF )
 {
     register_metadata( RS2_FRAME_METADATA_BACKEND_TIMESTAMP,
                        make_additional_data_parser( &frame_additional_data::backend_timestamp ) );
     register_metadata( RS2_FRAME_METADATA_RAW_FRAME_SIZE,
                        make_additional_data_parser( &frame_additional_data::raw_size ) );
+
+    if( _device->supports_zero_copy() )
+    {
+        auto zero_copy = std::make_shared< ptr_option< int > >(
+            ZERO_COPY_OFF,
+            ZERO_COPY_MODE_COUNT - 1,
+            1,
+            ZERO_COPY_OFF,
+            &_zero_copy_mode,
+            "Hand backend frame buffers to frames directly instead of copying them; takes effect on the next stream "
+            "start",
+            std::map< float, std::string >{ { float( ZERO_COPY_OFF ), "Off" },
+                                            { float( ZERO_COPY_ELSE_COPY ), "Copy when buffers run out" },
+                                            { float( ZERO_COPY_ELSE_DROP ), "Drop when buffers run out" } } );
+        register_option( RS2_OPTION_ZERO_COPY, zero_copy );
+    }
+}
+
+
+// The backend keeps this many buffers to itself, so that capture never stalls no matter how many zero-copy frames
+// the user holds
+static constexpr int ZERO_COPY_RESERVED_BUFFERS = 2;
+// The most zero-copy frames the user may hold per stream, used when the frame queue size is unlimited (0)
+static constexpr int MAX_ZERO_COPY_FRAMES = 32;
+
+
+int uvc_sensor::get_kernel_buffers_count() const
+{
+    if( _zero_copy_mode == ZERO_COPY_OFF )
+        return DEFAULT_V4L2_FRAME_BUFFERS;
+
+    // With zero-copy, every frame the user holds keeps a backend buffer: follow the frame queue size, which bounds
+    // the number of frames the user can hold, plus a few buffers the backend can keep capturing into
+    auto queue_size = static_cast< int >( get_option( RS2_OPTION_FRAMES_QUEUE_SIZE ).query() );
+    if( queue_size <= 0 || queue_size > MAX_ZERO_COPY_FRAMES )
+        queue_size = MAX_ZERO_COPY_FRAMES;
+    return std::max( int( DEFAULT_V4L2_FRAME_BUFFERS ), queue_size + ZERO_COPY_RESERVED_BUFFERS );
 }
 
 
@@ -113,6 +152,21 @@ void uvc_sensor::open( const stream_profiles & requests )
 
     verify_supported_requests( requests );
 
+    int const zero_copy_mode = _zero_copy_mode;
+    int const kernel_buffers = get_kernel_buffers_count();
+    platform::capture_memory memory;
+    if( zero_copy_mode != ZERO_COPY_OFF )
+    {
+        LOG_DEBUG( "Zero-copy streaming with " << kernel_buffers << " backend buffers per stream" );
+        // Zero-copy frames are the capture buffers themselves: with a frame allocator, capture straight into the
+        // user's memory; otherwise export the buffers so the frames can be handed on as DMABUFs
+        if( auto allocator = _source.get_frame_allocator() )
+            memory.allocate = [allocator]( size_t size ) { return allocator->allocate( size ); };
+        else
+            memory.export_dmabuf = true;
+    }
+    _device->set_capture_memory( memory );
+
     for( auto && req_profile : requests )
     {
         auto && req_profile_base = std::dynamic_pointer_cast< stream_profile_base >( req_profile );
@@ -120,14 +174,19 @@ void uvc_sensor::open( const stream_profiles & requests )
         {
             unsigned long long last_frame_number = 0;
             rs2_time_t last_timestamp = 0;
+            // Number of this stream's backend buffers currently held by zero-copy frames; shared with the frames,
+            // which may outlive the sensor
+            auto zero_copy_frames = std::make_shared< std::atomic< int > >( 0 );
             _device->probe_and_commit(
                 req_profile_base->get_backend_profile(),
-                [this, req_profile_base, req_profile, last_frame_number, last_timestamp](
+                [this, req_profile_base, req_profile, last_frame_number, last_timestamp, zero_copy_mode,
+                 kernel_buffers, zero_copy_frames](
                     platform::stream_profile p,
                     platform::frame_object f,
                     std::function< void() > continuation ) mutable
                 {
                     const auto system_time = time_service::get_time();  // time frame was received from the backend
+                    const auto arrival_ns = latency_tracer::is_enabled() ? latency_tracer::now() : 0;
 
                     if( ! this->is_streaming() )
                     {
@@ -200,21 +259,58 @@ void uvc_sensor::open( const stream_profiles & requests )
                     // Compressed and inference streams carry variable-length payloads; copy the data as received.
                     if( val_in_range( req_profile_base->get_format(), { RS2_FORMAT_MJPEG } ) || is_inference )
                         expected_size = f.frame_size;
+
+                    // Zero-copy applies only when the frame is the backend buffer as-is (no realignment or padding
+                    // fixes below); the frame then holds on to the buffer and re-queues it once released
+                    bool zero_copy = zero_copy_mode != ZERO_COPY_OFF && vsp && ! msp
+                                  && ( ( width * bpp >> 3 ) % 64 == 0 || f.frame_size <= expected_size )
+                                  && req_profile_base->get_format() != RS2_FORMAT_Y12I
+                                  && expected_size <= f.frame_size;
+                    if( zero_copy
+                        && zero_copy_frames->load() >= kernel_buffers - ZERO_COPY_RESERVED_BUFFERS )
+                    {
+                        // The user is holding on to too many frames; don't starve the backend of buffers
+                        if( zero_copy_mode == ZERO_COPY_ELSE_DROP )
+                        {
+                            LOG_DEBUG( "Dropped frame. User holds " << zero_copy_frames->load()
+                                                                    << " zero-copy frames" );
+                            continuation();
+                            return;
+                        }
+                        zero_copy = false;
+                    }
+
                     frame_holder fh = _source.alloc_frame(
                         { req_profile_base->get_stream_type(), req_profile_base->get_stream_index(), extension },
                         expected_size,
                         std::move( fr->additional_data ),
-                        true );
+                        ! zero_copy );
+                    const auto allocated_ns = arrival_ns ? latency_tracer::now() : 0;
                     auto diff = time_service::get_time() - system_time;
                     if( diff > 10 )
                         LOG_DEBUG( "!! Frame allocation took " << diff << " msec" );
 
+                    auto zero_copy_frame = zero_copy ? dynamic_cast< frame * >( fh.frame ) : nullptr;
                     if( fh.frame )
                     {
+                        if( zero_copy_frame )
+                        {
+                            // The last release of the frame re-queues the buffer
+                            zero_copy_frames->fetch_add( 1 );
+                            zero_copy_frame->allocated_data = std::shared_ptr< uint8_t >(
+                                (uint8_t *)f.pixels,
+                                [continuation, zero_copy_frames]( uint8_t * )
+                                {
+                                    zero_copy_frames->fetch_sub( 1 );
+                                    continuation();
+                                } );
+                            zero_copy_frame->allocated_data_size = expected_size;
+                            zero_copy_frame->dmabuf_fd = f.dmabuf_fd;
+                        }
                         // method should be limited to use of MIPI - not for USB
                         // the aim is to grab the data from a bigger buffer, which is aligned to 64 bytes,
                         // when the resolution's width is not aligned to 64
-                        if( ( width * bpp >> 3 ) % 64 != 0 && f.frame_size > expected_size )
+                        else if( ( width * bpp >> 3 ) % 64 != 0 && f.frame_size > expected_size )
                         {
                             std::vector< uint8_t > pixels = align_width_to_64( width, height, bpp, (uint8_t *)f.pixels );
                             assert( expected_size == sizeof( uint8_t ) * pixels.size() );
@@ -242,6 +338,8 @@ void uvc_sensor::open( const stream_profiles & requests )
 
                         fh->set_timestamp_domain( timestamp_domain );
                         fh->set_stream( req_profile_base );
+                        if( arrival_ns )
+                            latency_tracer::on_new_frame( fh.frame, arrival_ns, allocated_ns );
 
                         diff = time_service::get_time() - system_time;
                         if (diff > 10)
@@ -250,7 +348,8 @@ void uvc_sensor::open( const stream_profiles & requests )
 
                     // calling the continuation method, and releasing the backend frame buffer
                     // since the content of the OS frame buffer has been copied, it can released ASAP
-                    continuation();
+                    if( ! zero_copy_frame )
+                        continuation();
 
                     if (!fh.frame)
                     {
@@ -273,7 +372,8 @@ void uvc_sensor::open( const stream_profiles & requests )
                         // Log callback ended
                         log_callback_end( fps, callback_start_time, time_service::get_time(), stream_type, frame_number );
                     }
-                } );
+                },
+                kernel_buffers );
         }
         catch( ... )
         {
@@ -75,6 +75,7 @@ private:
     void acquire_power();
     void release_power();
     void reset_streaming();
+    int get_kernel_buffers_count() const;
     std::atomic<int64_t> _gyro_counter;
     std::atomic<int64_t> _accel_counter;
 
@@ -118,6 +119,16 @@ private:
     std::vector< platform::extension_unit > _xus;
     std::unique_ptr< power > _power;
     std::unique_ptr< frame_timestamp_reader > _timestamp_reader;
+
+    // RS2_OPTION_ZERO_COPY values
+    enum zero_copy_mode
+    {
+        ZERO_COPY_OFF,
+        ZERO_COPY_ELSE_COPY,  // once the user holds too many backend buffers, copy frames as usual
+        ZERO_COPY_ELSE_DROP,  // once the user holds too many backend buffers, drop frames
+        ZERO_COPY_MODE_COUNT
+    };
+    int _zero_copy_mode;
 };
 
 
@@ -24,6 +24,7 @@ namespace realdds {
 // Forward declaration
 namespace topics {
 class flexible_msg;
+class binary_metadata;
 class device_info;
 namespace raw {
 class device_info;
@@ -90,6 +91,8 @@ public:
 
     void publish_notification( topics::flexible_msg && );
     void publish_metadata( rsutils::json && );
+    // Preferred for streams with a metadata schema: sent as-is to clients that support it, and as JSON to others
+    void publish_metadata( topics::binary_metadata const & );
 
     bool has_metadata_readers() const;
 
@@ -117,6 +120,7 @@ private:
     void on_query_filter(control_sample const&, rsutils::json& reply);
 
     rsutils::json query_option( std::shared_ptr< dds_option > const & ) const;
+    std::shared_ptr< dds_topic_writer > create_metadata_writer( char const * topic_name ) const;
 
     std::shared_ptr< dds_publisher > _publisher;
     std::shared_ptr< dds_subscriber > _subscriber;
@@ -126,6 +130,7 @@ private:
     std::shared_ptr< dds_notification_server > _notification_server;
     std::shared_ptr< dds_topic_reader > _control_reader;
     std::shared_ptr< dds_topic_writer > _metadata_writer;
+    std::shared_ptr< dds_topic_writer > _binary_metadata_writer;
     std::shared_ptr< dds_device_broadcaster > _broadcaster;
     dispatcher _control_dispatcher;
 
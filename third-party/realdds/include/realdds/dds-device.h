@@ -18,6 +18,7 @@ namespace realdds {
 
 namespace topics {
 class device_info;
+class binary_metadata;
 }  // namespace topics
 
 
@@ -99,6 +100,13 @@ public:
     typedef std::function< void( std::shared_ptr< const rsutils::json > const & md ) > on_metadata_available_callback;
     rsutils::subscription on_metadata_available( on_metadata_available_callback && );
 
+    // When the server supplies a schema with its streams, metadata is received in binary form (see binary-metadata.h)
+    // and can be handled as such; on_metadata_available() then gets it converted back to JSON
+    bool supports_binary_metadata() const;
+    typedef std::function< void( std::shared_ptr< const topics::binary_metadata > const & md ) >
+        on_binary_metadata_available_callback;
+    rsutils::subscription on_binary_metadata_available( on_binary_metadata_available_callback && );
+
     typedef std::function< void(
         dds_nsec timestamp, char type, std::string const & text, rsutils::json const & data ) >
         on_device_log_callback;
@@ -33,6 +33,7 @@ protected:
     dds_options _options;
     dds_embedded_filters _embedded_filters;
     bool _metadata_enabled = false;
+    std::vector< std::string > _metadata_schema;
     bool _compressed = false;
 
     dds_stream_base( std::string const & stream_name, std::string const & sensor_name );
@@ -42,6 +43,8 @@ public:
 
     // Init functions can only be called once!
     void enable_metadata(); // Must call before init_profiles
+    // Same, but metadata can also be sent in binary form: the schema lists the fields, in the order they're packed
+    void enable_metadata( std::vector< std::string > schema );
     void init_profiles( dds_stream_profiles const & profiles, size_t default_profile_index = 0 );
     void init_options( dds_options const & options );
     void init_embedded_filters( dds_embedded_filters const & embedded_filters );
@@ -53,6 +56,8 @@ public:
     dds_options const & options() const { return _options; }
     dds_embedded_filters const & embedded_filters() const { return _embedded_filters; }
     bool metadata_enabled() const { return _metadata_enabled; }
+    std::vector< std::string > const & metadata_schema() const { return _metadata_schema; }  // empty if JSON-only
+    bool is_compressed() const { return _compressed; }  // sent as compressed images, per the profiles' encoding
 
     std::shared_ptr< dds_stream_profile > default_profile() const
     {
@@ -30,8 +30,8 @@ namespace realdds {
 // converted to a string. It must be '<= size' characters long, and we actually store the terminating null for
 // convenience.
 // 
-// Currently, the longest format we need is "yuv422_yuy2" so 10 characters are enough to fit our needs given their ROS
-// encodings. We round it up to 16 (including the terminating null) for alignment and some flexibility.
+// Currently, the longest format we need is "16UC1; rs-depth" (see depth_codec()), which takes all 15 characters. With
+// the terminating null, that's 16 for alignment.
 //
 struct dds_video_encoding
 {
@@ -54,6 +54,11 @@ struct dds_video_encoding
 
     static dds_video_encoding from_rs2( int rs2_format );
     int to_rs2() const;
+
+    // Z16 compressed losslessly with rsutils::codec::depth_encode(). Like "jpeg", it's sent as compressed images, with
+    // this as their format: the ROS convention of "<raw encoding>; <compression>". It translates to Z16 in rs2 terms,
+    // as the client decodes it on arrival.
+    static dds_video_encoding depth_codec() { return dds_video_encoding( "16UC1; rs-depth" ); }
 };
 
 
@@ -16,6 +16,7 @@
 namespace realdds {
 namespace topics {
 class image_msg;
+class compressed_image_msg;
 class imu_msg;
 class string_msg;
 }
@@ -94,6 +95,8 @@ public:
     image_header const & get_image_header() const { return _image_header; }
 
     virtual void publish_image( topics::image_msg & );
+    // For compressed streams (see is_compressed()), which publish compressed images only
+    virtual void publish_image( topics::compressed_image_msg & );
 
 private:
     void check_profile( std::shared_ptr< dds_stream_profile > const & ) const override;
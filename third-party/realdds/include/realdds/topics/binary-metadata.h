@@ -0,0 +1,82 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+#pragma once
+
+#include <realdds/dds-defines.h>
+
+#include <rsutils/json-fwd.h>
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+namespace realdds {
+namespace topics {
+
+
+class flexible_msg;
+
+
+// Frame metadata in a fixed, compact layout. This is the same information as the JSON metadata message (see
+// doc/metadata.md), but the field names are not repeated in each message: they're sent once per stream, in the stream
+// header, as the metadata "schema". Each message then only carries which fields are present and their values, in
+// schema order.
+//
+// Sent as CUSTOM flexible messages on the binary metadata topic. Clients that find a schema in the stream header
+// subscribe there; older clients read the JSON metadata topic as before, which the server keeps writing to as long as
+// someone reads it.
+//
+class binary_metadata
+{
+public:
+    typedef std::vector< std::string > schema_type;
+
+    // The flexible_msg version, for the layout to be able to evolve
+    static const uint32_t version;
+
+    std::string stream_name;
+    dds_nsec timestamp = 0;
+    int32_t timestamp_domain = -1;  // negative if unknown
+    float depth_units = 0.f;        // zero if not a depth stream
+
+    // Clears all fields, for a schema of the given size
+    void reset( size_t n_fields );
+
+    // The frame number is optional; any value, zero included, is a valid frame number once set
+    bool has_frame_number() const { return _has_frame_number; }
+    uint64_t get_frame_number() const { return _frame_number; }  // zero if unknown
+    void set_frame_number( uint64_t frame_number )
+    {
+        _frame_number = frame_number;
+        _has_frame_number = true;
+    }
+
+    size_t size() const { return _values.size(); }
+    bool has( size_t field ) const { return ( _present[field / 64] >> ( field % 64 ) ) & 1; }
+    int64_t get( size_t field ) const { return _values[field]; }
+    void set( size_t field, int64_t value )
+    {
+        _present[field / 64] |= uint64_t( 1 ) << ( field % 64 );
+        _values[field] = value;
+    }
+
+    // Pack into a message ready to be written; throws if the stream name is over 255 characters
+    flexible_msg to_msg() const;
+
+    // Unpack a message; returns false if it isn't a valid binary metadata message
+    bool from_msg( flexible_msg const & );
+
+    // The equivalent JSON metadata message, given the stream's schema
+    rsutils::json to_json( schema_type const & ) const;
+
+private:
+    uint64_t _frame_number = 0;
+    bool _has_frame_number = false;
+    std::vector< uint64_t > _present;  // a bit per field
+    std::vector< int64_t > _values;    // per field; zero when not present
+};
+
+
+}  // namespace topics
+}  // namespace realdds
@@ -26,6 +26,7 @@ namespace realdds {
 class dds_participant;
 class dds_topic;
 class dds_topic_reader;
+class dds_topic_writer;
 
 
 namespace topics {
@@ -73,6 +74,9 @@ public:
     static std::shared_ptr< dds_topic > create_topic( std::shared_ptr< dds_participant > const & participant,
                                                       char const * topic_name );
 
+    // Write to the topic. The writer's topic must be from create_topic().
+    void write_to( dds_topic_writer & ) const;
+
     // This helper method will take the next sample from a reader. 
     // 
     // Returns true if successful. Make sure you still check is_valid() in case the sample info isn't!
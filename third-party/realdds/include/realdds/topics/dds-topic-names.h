@@ -23,6 +23,7 @@ constexpr char const * DEVICE_INFO_TOPIC_NAME = "realsense/device-info";
 constexpr char const * NOTIFICATION_TOPIC_NAME = "/notification";
 constexpr char const * CONTROL_TOPIC_NAME = "/control";
 constexpr char const * METADATA_TOPIC_NAME = "/metadata";
+constexpr char const * BINARY_METADATA_TOPIC_NAME = "/metadata/binary";  // see binary-metadata.h
 constexpr char const * DFU_TOPIC_NAME = "/dfu";
 
 
@@ -75,6 +76,7 @@ namespace notification {
             extern std::string const profiles;
             extern std::string const default_profile_index;
             extern std::string const metadata_enabled;
+            extern std::string const metadata_schema;
         }
     }
     namespace stream_options {
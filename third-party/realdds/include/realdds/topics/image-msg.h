@@ -25,6 +25,7 @@ namespace realdds {
 class dds_participant;
 class dds_topic;
 class dds_topic_reader;
+class dds_topic_writer;
 
 
 namespace topics {
@@ -33,6 +34,8 @@ namespace topics {
 class image_msg
 {
     sensor_msgs::msg::Image _raw;
+    uint8_t const * _data_view = nullptr;  // when set, used instead of _raw.data()
+    size_t _data_view_size = 0;
 
 public:
     using type = sensor_msgs::msg::ImagePubSubType;
@@ -49,8 +52,12 @@ public:
     image_msg & operator=( image_msg && ) = default;
     image_msg & operator=( sensor_msgs::msg::Image && );
 
-    bool is_valid() const { return ! _raw.data().empty(); }
-    void invalidate() { _raw.data().clear(); }
+    bool is_valid() const { return data_size() > 0; }
+    void invalidate()
+    {
+        _raw.data().clear();
+        set_data_view( nullptr, 0 );
+    }
 
     sensor_msgs::msg::Image & raw() { return _raw; }
     sensor_msgs::msg::Image const & raw() const { return _raw; }
@@ -62,6 +69,16 @@ public:
     auto step() const { return _raw.step(); }
     void set_step( uint32_t step ) { _raw.step( step ); }
 
+    // Use someone else's buffer (e.g., a librealsense frame) rather than raw().data(), to save copying it in: the
+    // pixels are serialized straight from it when written. The buffer must stay valid until write_to() returns.
+    void set_data_view( uint8_t const * data, size_t size )
+    {
+        _data_view = data;
+        _data_view_size = size;
+    }
+    uint8_t const * data() const { return _data_view ? _data_view : _raw.data().data(); }
+    size_t data_size() const { return _data_view ? _data_view_size : _raw.data().size(); }
+
     std::string const & frame_id() const { return _raw.header().frame_id(); }
     void set_frame_id( std::string new_id ) { _raw.header().frame_id( std::move( new_id ) ); }
 
@@ -81,6 +98,9 @@ public:
     static std::shared_ptr< dds_topic > create_topic( std::shared_ptr< dds_participant > const & participant,
                                                       char const * topic_name );
 
+    // Write to the topic, from the data view if there is one. The writer's topic must be from create_topic().
+    void write_to( dds_topic_writer & ) const;
+
     // This helper method will take the next sample from a reader. 
     // 
     // Returns true if successful. Make sure you still check is_valid() in case the sample info isn't!
@@ -11,6 +11,7 @@
 #include <realdds/topics/imu-msg.h>
 #include <realdds/topics/string-msg.h>
 #include <realdds/topics/blob-msg.h>
+#include <realdds/topics/binary-metadata.h>
 #include <realdds/topics/ros2/participant-entities-info-msg.h>
 #include <realdds/topics/blob/blobPubSubTypes.h>
 #include <realdds/topics/ros2/sensor_msgs/msg/CompressedImagePubSubTypes.h>
@@ -669,7 +670,7 @@ PYBIND11_MODULE(NAME, m) {
         .def_static( "create_topic", &image_msg::create_topic )
         .def_property(
             "data",
-            []( image_msg const & self ) { return py::memoryview::from_memory( self.raw().data().data(), self.raw().data().size() ); },
+            []( image_msg const & self ) { return py::memoryview::from_memory( self.data(), self.data_size() ); },
             []( image_msg & self, std::vector< uint8_t > bytes ) { self.raw().data( std::move( bytes ) ); } )
         .def_property( "width", &image_msg::width, &image_msg::set_width )
         .def_property( "height", &image_msg::height, &image_msg::set_height )
@@ -695,8 +696,8 @@ PYBIND11_MODULE(NAME, m) {
                           os << " STEP 0";
                       else if( self.step() % self.width() )
                           os << " STEP " << self.step();
-                      else if( self.raw().data().size() % self.step() )
-                          os << " SIZE " << self.raw().data().size();
+                      else if( self.data_size() % self.step() )
+                          os << " SIZE " << self.data_size();
                       //else
                       //    os << ' ' << ( self.raw().data().size() / ( self.width() * self.height() ) ) << " Bpp";
                       if( self.is_bigendian() )
@@ -721,7 +722,31 @@ PYBIND11_MODULE(NAME, m) {
             py::arg( "reader" ),
             py::arg( "sample" ) = nullptr,
             py::call_guard< py::gil_scoped_release >() )
-        /*.def("write_to", &image_msg::write_to, py::call_guard< py::gil_scoped_release >())*/;
+        .def( "write_to", &image_msg::write_to, py::call_guard< py::gil_scoped_release >() )
+        .def(
+            "write_to",
+            []( image_msg & self, dds_topic_writer & writer, py::buffer view )
+            {
+                // Written from the view, as a librealsense frame would be, rather than from the data property
+                auto info = view.request();
+                if( info.ndim != 1 || info.strides[0] != info.itemsize )
+                    throw std::runtime_error( "data view must be contiguous" );
+                struct viewing
+                {
+                    image_msg & image;
+                    viewing( image_msg & image, py::buffer_info const & info )
+                        : image( image )
+                    {
+                        image.set_data_view( static_cast< uint8_t const * >( info.ptr ),
+                                             size_t( info.size * info.itemsize ) );
+                    }
+                    ~viewing() { image.set_data_view( nullptr, 0 ); }
+                } scope( self, info );
+                py::gil_scoped_release nogil;
+                self.write_to( writer );
+            },
+            py::arg( "writer" ),
+            py::arg( "view" ) );
 
     using compressed_image_msg = realdds::topics::compressed_image_msg;
     py::class_< compressed_image_msg, std::shared_ptr< compressed_image_msg > >( message, "compressed_image" )
@@ -768,6 +793,31 @@ PYBIND11_MODULE(NAME, m) {
             py::call_guard< py::gil_scoped_release >() )
         /*.def("write_to", &compressed_image_msg::write_to, py::call_guard< py::gil_scoped_release >())*/;
 
+    using binary_metadata = realdds::topics::binary_metadata;
+    py::class_< binary_metadata, std::shared_ptr< binary_metadata > >( message, "binary_metadata" )
+        .def( py::init<>() )
+        .def_readwrite( "stream_name", &binary_metadata::stream_name )
+        .def_property(
+            "frame_number",
+            []( binary_metadata const & self ) -> py::object
+            {
+                if( ! self.has_frame_number() )
+                    return py::none();
+                return py::int_( self.get_frame_number() );
+            },
+            &binary_metadata::set_frame_number )
+        .def_readwrite( "timestamp", &binary_metadata::timestamp )
+        .def_readwrite( "timestamp_domain", &binary_metadata::timestamp_domain )
+        .def_readwrite( "depth_units", &binary_metadata::depth_units )
+        .def( "reset", &binary_metadata::reset )
+        .def( "__len__", &binary_metadata::size )
+        .def( "has", &binary_metadata::has )
+        .def( "get", &binary_metadata::get )
+        .def( "set", &binary_metadata::set )
+        .def( "to_json",
+              []( binary_metadata const & self, binary_metadata::schema_type const & schema )
+              { return json_to_py( self.to_json( schema ) ); } );
+
     using participant_entities_info_msg = realdds::topics::ros2::participant_entities_info_msg;
     py::class_< participant_entities_info_msg, std::shared_ptr< participant_entities_info_msg > >( message, "participant_entities_info" )
         .def( py::init<>() )
@@ -1011,6 +1061,8 @@ PYBIND11_MODULE(NAME, m) {
     video_encoding.attr( "uyvy" ) = dds_video_encoding( "uyvy" );
     video_encoding.attr( "rgb" ) = dds_video_encoding( "rgb8" );
     video_encoding.attr( "y12i" ) = dds_video_encoding( "Y12I" );
+    video_encoding.attr( "jpeg" ) = dds_video_encoding( "jpeg" );
+    video_encoding.attr( "depth_codec" ) = dds_video_encoding::depth_codec();
 
     using realdds::dds_stream_profile;
     py::class_< dds_stream_profile, std::shared_ptr< dds_stream_profile > > stream_profile_base( m, "stream_profile" );
@@ -1053,7 +1105,11 @@ PYBIND11_MODULE(NAME, m) {
         .def( "sensor_name", &dds_stream_base::sensor_name )
         .def( "type_string", &dds_stream_base::type_string )
         .def( "profiles", &dds_stream_base::profiles )
-        .def( "enable_metadata", &dds_stream_base::enable_metadata )
+        .def( "enable_metadata", []( dds_stream_base & self ) { self.enable_metadata(); } )
+        .def( "enable_metadata",
+              []( dds_stream_base & self, std::vector< std::string > schema )
+              { self.enable_metadata( std::move( schema ) ); } )
+        .def( "metadata_schema", &dds_stream_base::metadata_schema )
         .def( "init_profiles", &dds_stream_base::init_profiles )
         .def( "init_options", &dds_stream_base::init_options )
         .def( "init_embedded_filters", &dds_stream_base::init_embedded_filters)
@@ -1090,7 +1146,10 @@ PYBIND11_MODULE(NAME, m) {
               []( dds_video_stream_server & self, dds_video_encoding encoding, int width, int height ) {
                   self.start_streaming( { encoding, height, width } );
               } )
-        .def( "publish_image", &dds_video_stream_server::publish_image );
+        .def( "publish_image",
+              py::overload_cast< realdds::topics::image_msg & >( &dds_video_stream_server::publish_image ) )
+        .def( "publish_image",
+              py::overload_cast< realdds::topics::compressed_image_msg & >( &dds_video_stream_server::publish_image ) );
 
     using realdds::dds_depth_stream_server;
     py::class_< dds_depth_stream_server, std::shared_ptr< dds_depth_stream_server > >( m, "depth_stream_server", video_stream_server_base )
@@ -1164,7 +1223,12 @@ PYBIND11_MODULE(NAME, m) {
             "publish_notification",
             []( dds_device_server & self, json const & j ) { self.publish_notification( j ); },
             py::call_guard< py::gil_scoped_release >() )
-        .def( "publish_metadata", &dds_device_server::publish_metadata, py::call_guard< py::gil_scoped_release >() )
+        .def( "publish_metadata",
+              []( dds_device_server & self, json md ) { self.publish_metadata( std::move( md ) ); },
+              py::call_guard< py::gil_scoped_release >() )
+        .def( "publish_metadata",
+              []( dds_device_server & self, binary_metadata const & md ) { self.publish_metadata( md ); },
+              py::call_guard< py::gil_scoped_release >() )
         .def( "broadcast", &dds_device_server::broadcast )
         .def( "broadcast_disconnect", &dds_device_server::broadcast_disconnect, py::arg( "ack-timeout" ) = dds_time() )
         .def( FN_FWD( dds_device_server, on_set_option,
@@ -1300,6 +1364,7 @@ PYBIND11_MODULE(NAME, m) {
                       [&self, callback]( std::shared_ptr< const json > const & pj )
                       { FN_FWD_CALL( dds_device, "on_metadata_available", callback( self, json_to_py( *pj ) ); ) } ) );
               } )
+        .def( "supports_binary_metadata", &dds_device::supports_binary_metadata )
         .def( "on_device_log",
               []( dds_device & self, std::function< void( dds_device &, dds_nsec, char, std::string const &, py::object && ) > callback )
               {
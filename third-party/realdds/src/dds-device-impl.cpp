@@ -10,6 +10,7 @@
 #include <realdds/dds-option.h>
 #include <realdds/topics/dds-topic-names.h>
 #include <realdds/topics/flexible-msg.h>
+#include <realdds/topics/binary-metadata.h>
 #include <realdds/dds-guid.h>
 #include <realdds/dds-time.h>
 
@@ -733,13 +734,16 @@ void dds_device::impl::create_notifications_reader()
     _notifications_reader->run( rqos );
 }
 
-void dds_device::impl::create_metadata_reader()
+void dds_device::impl::create_metadata_reader( bool binary )
 {
     if( _metadata_reader ) // We can be called multiple times, once per stream
         return;
 
-    auto topic = topics::flexible_msg::create_topic( _participant, _info.topic_root() + topics::METADATA_TOPIC_NAME );
+    auto topic = topics::flexible_msg::create_topic(
+        _participant,
+        _info.topic_root() + ( binary ? topics::BINARY_METADATA_TOPIC_NAME : topics::METADATA_TOPIC_NAME ) );
     _metadata_reader = std::make_shared< dds_topic_reader_thread >( topic, _subscriber );
+    _binary_metadata = binary;
     _metadata_reader->on_data_available(
         [this]()
         {
@@ -751,12 +755,17 @@ void dds_device::impl::create_metadata_reader()
             topics::flexible_msg message;
             while( topics::flexible_msg::take_next( *_metadata_reader, &message ) )
             {
-                if( message.is_valid() && _on_metadata_available.size() )
+                if( message.is_valid() && ( _on_metadata_available.size() || _on_binary_metadata_available.size() ) )
                 {
                     try
                     {
-                        auto sptr = std::make_shared< const json >( message.json_data() );
-                        _on_metadata_available.raise( sptr );
+                        if( _binary_metadata )
+                            on_binary_metadata( message );
+                        else
+                        {
+                            auto sptr = std::make_shared< const json >( message.json_data() );
+                            _on_metadata_available.raise( sptr );
+                        }
                     }
                     catch( std::exception const & e )
                     {
@@ -769,6 +778,23 @@ void dds_device::impl::create_metadata_reader()
     // NOTE: the metadata thread is only run() when we've reached the READY state
 }
 
+void dds_device::impl::on_binary_metadata( topics::flexible_msg const & message )
+{
+    auto md = std::make_shared< topics::binary_metadata >();
+    if( ! md->from_msg( message ) )
+        DDS_THROW( runtime_error, "invalid binary metadata" );
+    if( _on_binary_metadata_available.size() )
+        _on_binary_metadata_available.raise( md );
+    if( _on_metadata_available.size() )
+    {
+        // Only JSON users: convert, based on the stream schema
+        auto it = _streams.find( md->stream_name );
+        if( it == _streams.end() || ! it->second )
+            DDS_THROW( runtime_error, "metadata for unknown stream '" << md->stream_name << "'" );
+        _on_metadata_available.raise( std::make_shared< const json >( md->to_json( it->second->metadata_schema() ) ) );
+    }
+}
+
 void dds_device::impl::create_control_writer()
 {
     if( _control_writer )
@@ -890,8 +916,19 @@ void dds_device::impl::on_stream_header( json const & j, dds_sample const & samp
 
     if( j.at( topics::notification::stream_header::key::metadata_enabled ).get< bool >() )
     {
-        create_metadata_reader();
-        stream->enable_metadata();  // Call before init_profiles
+        // A schema means the server can send binary metadata; we only go back to JSON if the user asks for it
+        if( auto schema = j.nested( topics::notification::stream_header::key::metadata_schema, &json::is_array ) )
+        {
+            bool const binary
+                = _device_settings.nested( "metadata", "binary", &json::is_boolean ).default_value( true );
+            create_metadata_reader( binary );
+            stream->enable_metadata( schema.get< std::vector< std::string > >() );  // Call before init_profiles
+        }
+        else
+        {
+            create_metadata_reader( false );
+            stream->enable_metadata();  // Call before init_profiles
+        }
     }
 
     size_t default_profile_index = j.at( "default-profile-index" ).get< size_t >();
@@ -25,6 +25,9 @@ namespace realdds {
 class dds_topic_reader;
 class dds_topic_writer;
 class dds_subscriber;
+namespace topics {
+class flexible_msg;
+}  // namespace topics
 
 
 class dds_device::impl : public std::enable_shared_from_this< dds_device::impl >
@@ -66,6 +69,7 @@ public:
 
     std::shared_ptr< dds_topic_reader > _notifications_reader;
     std::shared_ptr< dds_topic_reader > _metadata_reader;
+    bool _binary_metadata = false;  // whether _metadata_reader reads the binary topic
     std::shared_ptr< dds_topic_writer > _control_writer;
 
     dds_options _options;
@@ -104,6 +108,14 @@ public:
         return _on_metadata_available.subscribe( std::move( cb ) );
     }
 
+    using on_binary_metadata_available_signal
+        = rsutils::signal< std::shared_ptr< const topics::binary_metadata > const & >;
+    using on_binary_metadata_available_callback = on_binary_metadata_available_signal::callback;
+    rsutils::subscription on_binary_metadata_available( on_binary_metadata_available_callback && cb )
+    {
+        return _on_binary_metadata_available.subscribe( std::move( cb ) );
+    }
+
     using on_device_log_signal = rsutils::signal< dds_nsec,                  // timestamp
                                                   char,                      // type
                                                   std::string const &,       // text
@@ -129,7 +141,7 @@ public:
 
 private:
     void create_notifications_reader();
-    void create_metadata_reader();
+    void create_metadata_reader( bool binary );
     void create_control_writer();
 
     // notification handlers
@@ -147,6 +159,7 @@ private:
     void on_calibration_changed( rsutils::json const &, dds_sample const & );
 
     void on_notification( rsutils::json &&, dds_sample const & );
+    void on_binary_metadata( topics::flexible_msg const & );
 
     void on_set_filter(rsutils::json const&, dds_sample const&);
     void on_query_filter(rsutils::json const&, dds_sample const&);
@@ -156,6 +169,7 @@ private:
     bool all_initialization_data_received() const;
 
     on_metadata_available_signal _on_metadata_available;
+    on_binary_metadata_available_signal _on_binary_metadata_available;
     on_device_log_signal _on_device_log;
     on_notification_signal _on_notification;
     on_calibration_changed_signal _on_calibration_changed;
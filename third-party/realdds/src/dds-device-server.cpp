@@ -15,6 +15,7 @@
 #include <realdds/topics/dds-topic-names.h>
 #include <realdds/topics/device-info-msg.h>
 #include <realdds/topics/flexible-msg.h>
+#include <realdds/topics/binary-metadata.h>
 #include <realdds/dds-topic.h>
 #include <realdds/dds-topic-writer.h>
 #include <realdds/dds-option.h>
@@ -115,6 +116,8 @@ static void on_discovery_stream_header( std::shared_ptr< dds_stream_server > con
         { topics::notification::stream_header::key::default_profile_index, stream->default_profile_index() },
         { topics::notification::stream_header::key::metadata_enabled, stream->metadata_enabled() },
     };
+    if( ! stream->metadata_schema().empty() )
+        j_stream_header[topics::notification::stream_header::key::metadata_schema] = stream->metadata_schema();
     topics::flexible_msg stream_header_message( j_stream_header );
     LOG_DEBUG( stream->name() << " stream-header " << std::setw( 4 ) << j_stream_header << " size "
                               << stream_header_message._data.size() );
@@ -214,15 +217,9 @@ void dds_device_server::init( std::vector< std::shared_ptr< dds_stream_server >
             on_discovery_stream_header( stream, *_notification_server );
 
             if( stream->metadata_enabled() && ! _metadata_writer )
-            {
-                auto topic = topics::flexible_msg::create_topic( _publisher->get_participant(),
-                                                                 _topic_root + topics::METADATA_TOPIC_NAME );
-                _metadata_writer = std::make_shared< dds_topic_writer >( topic, _publisher );
-                dds_topic_writer::qos wqos( eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS );
-                wqos.history().depth = 10;  // default is 1
-                _metadata_writer->override_qos_from_json( wqos, _subscriber->get_participant()->settings().nested( "device", "metadata" ) );
-                _metadata_writer->run( wqos );
-            }
+                _metadata_writer = create_metadata_writer( topics::METADATA_TOPIC_NAME );
+            if( ! stream->metadata_schema().empty() && ! _binary_metadata_writer )
+                _binary_metadata_writer = create_metadata_writer( topics::BINARY_METADATA_TOPIC_NAME );
         }
 
         _notification_server->run();
@@ -301,9 +298,40 @@ void dds_device_server::publish_metadata( json && md )
 }
 
 
+void dds_device_server::publish_metadata( topics::binary_metadata const & md )
+{
+    if( ! _metadata_writer )
+        DDS_THROW( runtime_error, "device '" + _topic_root + "' has no stream with enabled metadata" );
+
+    // Clients that know the schema read the binary topic; older ones only read JSON, which is built only for them
+    if( _binary_metadata_writer && _binary_metadata_writer->has_readers() )
+        md.to_msg().write_to( *_binary_metadata_writer );
+    if( _metadata_writer->has_readers() )
+    {
+        auto it = _stream_name_to_server.find( md.stream_name );
+        if( it == _stream_name_to_server.end() )
+            DDS_THROW( runtime_error, "metadata for unknown stream '" + md.stream_name + "'" );
+        publish_metadata( md.to_json( it->second->metadata_schema() ) );
+    }
+}
+
+
 bool dds_device_server::has_metadata_readers() const
 {
-    return _metadata_writer && _metadata_writer->has_readers();
+    return ( _metadata_writer && _metadata_writer->has_readers() )
+        || ( _binary_metadata_writer && _binary_metadata_writer->has_readers() );
+}
+
+
+std::shared_ptr< dds_topic_writer > dds_device_server::create_metadata_writer( char const * topic_name ) const
+{
+    auto topic = topics::flexible_msg::create_topic( _publisher->get_participant(), _topic_root + topic_name );
+    auto writer = std::make_shared< dds_topic_writer >( topic, _publisher );
+    dds_topic_writer::qos wqos( eprosima::fastdds::dds::BEST_EFFORT_RELIABILITY_QOS );
+    wqos.history().depth = 10;  // default is 1
+    writer->override_qos_from_json( wqos, _subscriber->get_participant()->settings().nested( "device", "metadata" ) );
+    writer->run( wqos );
+    return writer;
 }
 
 
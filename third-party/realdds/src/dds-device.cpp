@@ -265,6 +265,16 @@ rsutils::subscription dds_device::on_metadata_available( on_metadata_available_c
     return _impl->on_metadata_available( std::move( cb ) );
 }
 
+bool dds_device::supports_binary_metadata() const
+{
+    return _impl->_metadata_reader && _impl->_binary_metadata;
+}
+
+rsutils::subscription dds_device::on_binary_metadata_available( on_binary_metadata_available_callback && cb )
+{
+    return _impl->on_binary_metadata_available( std::move( cb ) );
+}
+
 rsutils::subscription dds_device::on_device_log( on_device_log_callback && cb )
 {
     return _impl->on_device_log( std::move( cb ) );
@@ -3,23 +3,28 @@
 
 #include <realdds/dds-metadata-syncer.h>
 #include <realdds/dds-utilities.h>
+#include <realdds/topics/binary-metadata.h>
 
 
 namespace realdds {
 
 
-const size_t dds_metadata_syncer::max_md_queue_size = 8;
-const size_t dds_metadata_syncer::max_frame_queue_size = 2;
+template< class Metadata >
+const size_t dds_metadata_syncer_t< Metadata >::max_md_queue_size = 8;
+template< class Metadata >
+const size_t dds_metadata_syncer_t< Metadata >::max_frame_queue_size = 2;
 
 
-dds_metadata_syncer::dds_metadata_syncer()
+template< class Metadata >
+dds_metadata_syncer_t< Metadata >::dds_metadata_syncer_t()
     : _is_alive( std::make_shared< bool >( true ) )
     , _on_frame_release( nullptr )
 {
 }
 
 
-dds_metadata_syncer::~dds_metadata_syncer()
+template< class Metadata >
+dds_metadata_syncer_t< Metadata >::~dds_metadata_syncer_t()
 {
     _is_alive.reset();
 
@@ -29,7 +34,8 @@ dds_metadata_syncer::~dds_metadata_syncer()
 }
 
 
-void dds_metadata_syncer::enqueue_frame( key_type id, frame_holder && frame )
+template< class Metadata >
+void dds_metadata_syncer_t< Metadata >::enqueue_frame( key_type id, frame_holder && frame )
 {
     std::weak_ptr< bool > alive = _is_alive;
     if( ! alive.lock() ) // Check if was destructed by another thread
@@ -51,7 +57,8 @@ void dds_metadata_syncer::enqueue_frame( key_type id, frame_holder && frame )
 }
 
 
-void dds_metadata_syncer::enqueue_metadata( key_type id, metadata_type const & md )
+template< class Metadata >
+void dds_metadata_syncer_t< Metadata >::enqueue_metadata( key_type id, metadata_type const & md )
 {
     std::weak_ptr< bool > alive = _is_alive;
     if( ! alive.lock() )  // Check if was destructed by another thread
@@ -73,7 +80,8 @@ void dds_metadata_syncer::enqueue_metadata( key_type id, metadata_type const & m
 }
 
 
-void dds_metadata_syncer::search_for_match( std::unique_lock< std::mutex > & lock )
+template< class Metadata >
+void dds_metadata_syncer_t< Metadata >::search_for_match( std::unique_lock< std::mutex > & lock )
 {
     // Wait for frame + metadata set
     while( ! _frame_queue.empty() && ! _metadata_queue.empty() )
@@ -103,7 +111,8 @@ void dds_metadata_syncer::search_for_match( std::unique_lock< std::mutex > & loc
 }
 
 
-bool dds_metadata_syncer::handle_match( std::unique_lock< std::mutex > & lock )
+template< class Metadata >
+bool dds_metadata_syncer_t< Metadata >::handle_match( std::unique_lock< std::mutex > & lock )
 {
     std::weak_ptr< bool > alive = _is_alive;
 
@@ -125,7 +134,8 @@ bool dds_metadata_syncer::handle_match( std::unique_lock< std::mutex > & lock )
 }
 
 
-bool dds_metadata_syncer::handle_frame_without_metadata( std::unique_lock< std::mutex > & lock )
+template< class Metadata >
+bool dds_metadata_syncer_t< Metadata >::handle_frame_without_metadata( std::unique_lock< std::mutex > & lock )
 {
     std::weak_ptr< bool > alive = _is_alive;
 
@@ -145,7 +155,8 @@ bool dds_metadata_syncer::handle_frame_without_metadata( std::unique_lock< std::
 }
 
 
-bool dds_metadata_syncer::drop_metadata( std::unique_lock< std::mutex > & lock )
+template< class Metadata >
+bool dds_metadata_syncer_t< Metadata >::drop_metadata( std::unique_lock< std::mutex > & lock )
 {
     std::weak_ptr< bool > alive = _is_alive;
 
@@ -165,4 +176,8 @@ bool dds_metadata_syncer::drop_metadata( std::unique_lock< std::mutex > & lock )
 }
 
 
+template class dds_metadata_syncer_t< rsutils::json >;
+template class dds_metadata_syncer_t< topics::binary_metadata >;
+
+
 }  // namespace realdds
@@ -200,6 +200,7 @@ dds_participant::qos::qos( std::string const & participant_name )
     // Disabling because sometimes, after improper destruction (e.g. stopping debug) the shared memory is not opened
     // correctly and the application is stuck. eProsima is working on it. Manual solution delete shared memory files,
     // C:\ProgramData\eprosima\fastrtps_interprocess on Windows, /dev/shm on Linux
+    // Can be turned back on with the 'shm' setting
     auto udp_transport = std::make_shared< eprosima::fastdds::rtps::UDPv4TransportDescriptor >();
     // Also change the receive buffers: we deal with lots of information and, without this, we'll get dropped frames and
     // unusual behavior...
@@ -15,6 +15,7 @@
 #include <fastdds/dds/domain/qos/DomainParticipantQos.hpp>
 #include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
 #include <fastdds/rtps/transport/UDPTransportDescriptor.h>
+#include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.h>
 
 #include <rsutils/string/from.h>
 #include <rsutils/string/nocase.h>
@@ -755,6 +756,25 @@ void override_participant_qos_from_json( eprosima::fastdds::dds::DomainParticipa
             }
     }
 
+    // Shared memory is off by default (see dds_participant::qos), but is much cheaper than UDP loopback when fanning
+    // images out to other processes on the same host: 'true', or an object with any of the settings below. Both sides
+    // need it on; remote participants keep using UDP.
+    auto shm_j = j.nested( "shm" );
+    if( shm_j.is_object() || shm_j.default_value( false ) )
+    {
+        auto shm = std::make_shared< eprosima::fastdds::rtps::SharedMemTransportDescriptor >();
+        // The default segment is too small to hold even a single HD frame
+        uint32_t segment_size = 64 * 1024 * 1024;
+        shm_j.nested( "segment-size" ).get_ex( segment_size );
+        shm->segment_size( segment_size );
+        uint32_t port_queue_capacity = shm->port_queue_capacity();
+        shm_j.nested( "port-queue-capacity" ).get_ex( port_queue_capacity );
+        shm->port_queue_capacity( port_queue_capacity );
+        // First, so it's preferred for local participants
+        auto & transports = qos.transport().user_transports;
+        transports.insert( transports.begin(), shm );
+    }
+
     if( auto max_bytes_j = j.nested( "max-out-message-bytes", &json::is_number_unsigned ) )
     {
         // Override maximum message size, in bytes, for SENDING messages on RTPS.
@@ -26,6 +26,13 @@ void dds_stream_base::enable_metadata()
 }
 
 
+void dds_stream_base::enable_metadata( std::vector< std::string > schema )
+{
+    enable_metadata();
+    _metadata_schema = std::move( schema );
+}
+
+
 void dds_stream_base::init_profiles( dds_stream_profiles const & profiles, size_t default_profile_index )
 {
     if( !_profiles.empty() )
@@ -87,6 +87,7 @@ int dds_video_encoding::to_rs2() const
         { "Y12I", RS2_FORMAT_Y12I },
 //      { "Y16I", RS2_FORMAT_Y16I },
         { "16UC1", RS2_FORMAT_Z16 },  // Used by depth streams; ROS2-compatible
+        { "16UC1; rs-depth", RS2_FORMAT_Z16 },  // Compressed depth streams, decoded on arrival; see depth_codec()
         { "rgb8", RS2_FORMAT_RGB8 },  // Used by color streams; ROS2-compatible
         { "RGBA", RS2_FORMAT_RGBA8 },
         { "RGB2", RS2_FORMAT_BGR8 },
@@ -209,7 +210,7 @@ dds_video_stream_profile::dds_video_stream_profile( rsutils::json const & j, int
 
 bool dds_video_stream_profile::is_compressed_encoding() const
 {
-    return _encoding.to_rs2() == RS2_FORMAT_MJPEG;
+    return _encoding == dds_video_encoding::depth_codec() || _encoding.to_rs2() == RS2_FORMAT_MJPEG;
 }
 
 
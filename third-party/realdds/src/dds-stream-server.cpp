@@ -10,6 +10,7 @@
 #include <realdds/dds-publisher.h>
 #include <realdds/dds-utilities.h>
 #include <realdds/topics/image-msg.h>
+#include <realdds/topics/compressed-image-msg.h>
 #include <realdds/topics/imu-msg.h>
 #include <realdds/topics/string-msg.h>
 #include <realdds/topics/flexible-msg.h>
@@ -92,7 +93,12 @@ void dds_video_stream_server::open( std::string const & topic_name, std::shared_
     if( profiles().empty() )
         DDS_THROW( runtime_error, "stream '" + name() + "' has no profiles" );
 
-    auto topic = topics::image_msg::create_topic( publisher->get_participant(), topic_name.c_str() );
+    // The topic type must match what the client expects, which it also deduces from the profile encodings
+    std::shared_ptr< dds_topic > topic;
+    if( _compressed )
+        topic = topics::compressed_image_msg::create_topic( publisher->get_participant(), topic_name.c_str() );
+    else
+        topic = topics::image_msg::create_topic( publisher->get_participant(), topic_name.c_str() );
     _writer = std::make_shared< dds_topic_writer >( topic, publisher );
 
 
@@ -202,6 +208,9 @@ void dds_video_stream_server::publish_image( topics::image_msg & image )
     if( ! is_streaming() )
         DDS_THROW( runtime_error, "stream '" << name() << "' cannot publish before start_streaming()" );
 
+    if( _compressed )
+        DDS_THROW( runtime_error, "stream '" << name() << "' publishes compressed images only" );
+
     if( ! image.is_valid() )
         DDS_THROW( runtime_error, "image is invalid" );
 
@@ -238,12 +247,35 @@ void dds_video_stream_server::publish_image( topics::image_msg & image )
                                       << _image_header.encoding.to_string() << ")" );
 
     if( ! image.step() )
-        image.set_step( uint32_t( image.raw().data().size() / image.height() ) );
+        image.set_step( uint32_t( image.data_size() / image.height() ) );
 
     assert( ! image.is_bigendian() );
 
     LOG_DEBUG( "publishing '" << name() << "' " << image.encoding() << " frame @ " << time_to_string( image.timestamp() ) );
-    DDS_API_CALL( _writer->get()->write( &image.raw() ) );
+    image.write_to( *_writer );
+}
+
+
+void dds_video_stream_server::publish_image( topics::compressed_image_msg & image )
+{
+    if( ! is_streaming() )
+        DDS_THROW( runtime_error, "stream '" << name() << "' cannot publish before start_streaming()" );
+
+    if( ! _compressed )
+        DDS_THROW( runtime_error, "stream '" << name() << "' does not publish compressed images" );
+
+    if( ! image.is_valid() )
+        DDS_THROW( runtime_error, "image is invalid" );
+
+    // Compressed images carry no size: the data says it all, and the profile tells what to expect
+    if( image.frame_id().empty() )
+        image.set_frame_id( sensor_name() );
+
+    if( image.format().empty() )
+        image.set_format( _image_header.encoding.to_string() );
+
+    LOG_DEBUG( "publishing '" << name() << "' " << image.format() << " frame @ " << time_to_string( image.timestamp() ) );
+    image.write_to( *_writer );
 }
 
 
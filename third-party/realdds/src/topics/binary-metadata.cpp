@@ -0,0 +1,181 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include <realdds/topics/binary-metadata.h>
+#include <realdds/topics/flexible-msg.h>
+#include <realdds/topics/dds-topic-names.h>
+#include <realdds/dds-exceptions.h>
+
+#include <rsutils/json.h>
+
+#include <algorithm>
+#include <cstring>
+
+
+namespace realdds {
+namespace topics {
+
+
+// Layout (all little-endian whatever the host, unaligned):
+//     uint8   stream-name length, followed by the name (no terminating null)
+//     uint8   flags: 1 if there's a frame-number
+//     uint64  frame-number (zero if not)
+//     int64   timestamp
+//     int32   timestamp-domain
+//     float   depth-units
+//     uint16  number of fields in the schema
+//     uint64  presence bits, 64 fields per word
+//     int64   value of each field that's present, in schema order
+//
+/*static*/ const uint32_t binary_metadata::version = 2;
+
+
+void binary_metadata::reset( size_t n_fields )
+{
+    _frame_number = 0;
+    _has_frame_number = false;
+    timestamp = 0;
+    timestamp_domain = -1;
+    depth_units = 0.f;
+    _present.assign( ( n_fields + 63 ) / 64, 0 );
+    _values.assign( n_fields, 0 );
+}
+
+
+namespace {
+
+
+uint8_t const HAS_FRAME_NUMBER = 1;  // in the flags
+
+
+// The unsigned integer type of a size, for the bytes of any value of that size
+template< size_t N > struct uint_of;
+template<> struct uint_of< 1 > { typedef uint8_t type; };
+template<> struct uint_of< 2 > { typedef uint16_t type; };
+template<> struct uint_of< 4 > { typedef uint32_t type; };
+template<> struct uint_of< 8 > { typedef uint64_t type; };
+
+
+// Values are written and read a byte at a time, least significant first, so the layout doesn't depend on the host
+template< class T >
+void put( uint8_t *& p, T const & value )
+{
+    typename uint_of< sizeof( T ) >::type bits;
+    std::memcpy( &bits, &value, sizeof( T ) );
+    for( size_t i = 0; i < sizeof( T ); ++i )
+        *p++ = uint8_t( bits >> ( 8 * i ) );
+}
+
+
+template< class T >
+bool take( uint8_t const *& p, uint8_t const * end, T & value )
+{
+    if( end - p < ptrdiff_t( sizeof( T ) ) )
+        return false;
+    typename uint_of< sizeof( T ) >::type bits = 0;
+    for( size_t i = 0; i < sizeof( T ); ++i )
+        bits |= typename uint_of< sizeof( T ) >::type( *p++ ) << ( 8 * i );
+    std::memcpy( &value, &bits, sizeof( T ) );
+    return true;
+}
+
+
+}  // namespace
+
+
+flexible_msg binary_metadata::to_msg() const
+{
+    // Not truncated: a shortened name would be taken for some other stream
+    if( stream_name.length() > 255 )
+        DDS_THROW( runtime_error, "binary metadata stream name is over 255 characters: '" << stream_name << "'" );
+    if( _values.size() > 0xFFFF )
+        DDS_THROW( runtime_error, "binary metadata has over 65535 fields" );
+    size_t const name_length = stream_name.length();
+    size_t n_present = 0;
+    for( auto word : _present )
+        for( ; word; word &= word - 1 )
+            ++n_present;
+
+    flexible_msg msg;
+    msg._data_format = flexible_msg::data_format::CUSTOM;
+    msg._version = version;
+    msg._data.resize( 1 + name_length + 1 + 8 + 8 + 4 + 4 + 2 + 8 * _present.size() + 8 * n_present );
+
+    uint8_t * p = msg._data.data();
+    put( p, uint8_t( name_length ) );
+    std::memcpy( p, stream_name.data(), name_length );
+    p += name_length;
+    put( p, uint8_t( _has_frame_number ? HAS_FRAME_NUMBER : 0 ) );
+    put( p, _frame_number );
+    put( p, timestamp );
+    put( p, timestamp_domain );
+    put( p, depth_units );
+    put( p, uint16_t( _values.size() ) );
+    for( auto word : _present )
+        put( p, word );
+    for( size_t i = 0; i < _values.size(); ++i )
+        if( has( i ) )
+            put( p, _values[i] );
+    return msg;
+}
+
+
+bool binary_metadata::from_msg( flexible_msg const & msg )
+{
+    if( msg._data_format != flexible_msg::data_format::CUSTOM || msg._version != version )
+        return false;
+
+    uint8_t const * p = msg._data.data();
+    uint8_t const * const end = p + msg._data.size();
+
+    uint8_t name_length;
+    if( ! take( p, end, name_length ) || end - p < name_length )
+        return false;
+    stream_name.assign( reinterpret_cast< char const * >( p ), name_length );
+    p += name_length;
+
+    uint8_t flags;
+    uint16_t n_fields;
+    if( ! take( p, end, flags ) || ! take( p, end, _frame_number ) || ! take( p, end, timestamp )
+        || ! take( p, end, timestamp_domain ) || ! take( p, end, depth_units ) || ! take( p, end, n_fields ) )
+        return false;
+    _has_frame_number = ( flags & HAS_FRAME_NUMBER ) != 0;
+
+    _present.resize( ( n_fields + 63 ) / 64 );
+    for( auto & word : _present )
+        if( ! take( p, end, word ) )
+            return false;
+    _values.resize( n_fields );
+    for( size_t i = 0; i < _values.size(); ++i )
+    {
+        _values[i] = 0;
+        if( has( i ) && ! take( p, end, _values[i] ) )
+            return false;
+    }
+    return p == end;
+}
+
+
+rsutils::json binary_metadata::to_json( schema_type const & schema ) const
+{
+    rsutils::json header = rsutils::json::object( { { metadata::header::key::timestamp, timestamp } } );
+    if( _has_frame_number )
+        header[metadata::header::key::frame_number] = _frame_number;
+    if( timestamp_domain >= 0 )
+        header[metadata::header::key::timestamp_domain] = timestamp_domain;
+    if( depth_units != 0.f )
+        header[metadata::header::key::depth_units] = depth_units;
+
+    rsutils::json md = rsutils::json::object();
+    for( size_t i = 0; i < _values.size() && i < schema.size(); ++i )
+        if( has( i ) )
+            md[schema[i]] = _values[i];
+
+    return rsutils::json::object( { { metadata::key::stream_name, stream_name },
+                                    { metadata::key::header, std::move( header ) },
+                                    { metadata::key::metadata, std::move( md ) } } );
+}
+
+
+}  // namespace topics
+}  // namespace realdds
@@ -6,9 +6,11 @@
 
 #include <realdds/dds-topic.h>
 #include <realdds/dds-topic-reader.h>
+#include <realdds/dds-topic-writer.h>
 #include <realdds/dds-utilities.h>
 
 #include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
 #include <fastdds/dds/topic/Topic.hpp>
 
 
@@ -38,6 +40,12 @@ compressed_image_msg::create_topic( std::shared_ptr< dds_participant > const & p
 }
 
 
+void compressed_image_msg::write_to( dds_topic_writer & writer ) const
+{
+    DDS_API_CALL( writer.get()->write( const_cast< sensor_msgs::msg::CompressedImage * >( &_raw ) ) );
+}
+
+
 /*static*/ bool
 compressed_image_msg::take_next( dds_topic_reader & reader, compressed_image_msg * output, dds_sample * sample )
 {
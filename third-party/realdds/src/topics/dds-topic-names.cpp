@@ -34,6 +34,7 @@ namespace notification {
             std::string const profiles( "profiles", 8 );
             std::string const default_profile_index( "default-profile-index", 21 );
             std::string const metadata_enabled( "metadata-enabled", 16 );
+            std::string const metadata_schema( "metadata-schema", 15 );
         }
     }
     namespace stream_options {
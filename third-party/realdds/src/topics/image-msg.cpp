@@ -6,16 +6,94 @@
 
 #include <realdds/dds-topic.h>
 #include <realdds/dds-topic-reader.h>
+#include <realdds/dds-topic-writer.h>
 #include <realdds/dds-utilities.h>
 
 #include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
 #include <fastdds/dds/topic/Topic.hpp>
+#include <fastcdr/Cdr.h>
+#include <fastcdr/FastBuffer.h>
 
 
 namespace realdds {
 namespace topics {
 
 
+namespace {
+
+
+// The image being written by this thread, if it has a data view. DataWriter::write() serializes on the calling thread
+// (even with asynchronous publishing, only the sending is deferred), so this is how we get the view to the type below
+// without changing what's passed to write(): the same Image as any other writer, so readers can't tell the difference.
+thread_local image_msg const * t_writing = nullptr;
+
+
+// Same type (and name) as the generated one, except it can serialize the pixels from an image_msg's data view. Readers
+// deserialize exactly as before.
+class image_msg_type : public image_msg::type
+{
+    typedef image_msg::type super;
+
+    static image_msg const * view_of( void * data )
+    {
+        return t_writing && data == &t_writing->raw() ? t_writing : nullptr;
+    }
+
+public:
+    bool serialize( void * data, eprosima::fastrtps::rtps::SerializedPayload_t * payload ) override
+    {
+        auto image = view_of( data );
+        if( ! image )
+            return super::serialize( data, payload );
+
+        // Same as the generated code for sensor_msgs::msg::Image, but with the data from the view
+        auto & raw = image->raw();
+        eprosima::fastcdr::FastBuffer fastbuffer( reinterpret_cast< char * >( payload->data ), payload->max_size );
+        eprosima::fastcdr::Cdr ser( fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR );
+        payload->encapsulation
+            = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+        ser.serialize_encapsulation();
+        try
+        {
+            ser << raw.header();
+            ser << raw.height();
+            ser << raw.width();
+            ser << raw.encoding().c_str();
+            ser << raw.is_bigendian();
+            ser << raw.step();
+            ser << static_cast< uint32_t >( image->data_size() );
+            ser.serializeArray( image->data(), image->data_size() );
+        }
+        catch( eprosima::fastcdr::exception::NotEnoughMemoryException & )
+        {
+            return false;
+        }
+        payload->length = static_cast< uint32_t >( ser.getSerializedDataLength() );
+        return true;
+    }
+
+    std::function< uint32_t() > getSerializedSizeProvider( void * data ) override
+    {
+        auto image = view_of( data );
+        if( ! image )
+            return super::getSerializedSizeProvider( data );
+
+        // raw.data() is empty, so adding the view's size gives the size with the pixels (they need no alignment)
+        auto & raw = image->raw();
+        size_t const size = image->data_size();
+        return [&raw, size]() -> uint32_t
+        {
+            return static_cast< uint32_t >( sensor_msgs::msg::Image::getCdrSerializedSize( raw ) + size )
+                 + 4u /*encapsulation*/;
+        };
+    }
+};
+
+
+}  // namespace
+
+
 image_msg::image_msg( sensor_msgs::msg::Image && rhs )
     : _raw( std::move( rhs ) )
 {
@@ -33,11 +111,32 @@ image_msg & image_msg::operator=( sensor_msgs::msg::Image && rhs )
 image_msg::create_topic( std::shared_ptr< dds_participant > const & participant, char const * topic_name )
 {
     return std::make_shared< dds_topic >( participant,
-                                          eprosima::fastdds::dds::TypeSupport( new image_msg::type ),
+                                          eprosima::fastdds::dds::TypeSupport( new image_msg_type ),
                                           topic_name );
 }
 
 
+void image_msg::write_to( dds_topic_writer & writer ) const
+{
+    if( ! _data_view )
+    {
+        DDS_API_CALL( writer.get()->write( const_cast< sensor_msgs::msg::Image * >( &_raw ) ) );
+        return;
+    }
+
+    // The view is only valid if raw().data() is empty: otherwise we'd be sending both...
+    if( ! _raw.data().empty() )
+        DDS_THROW( runtime_error, "image has both data and a data view" );
+
+    struct writing
+    {
+        writing( image_msg const * image ) { t_writing = image; }
+        ~writing() { t_writing = nullptr; }
+    } scope( this );
+    DDS_API_CALL( writer.get()->write( const_cast< sensor_msgs::msg::Image * >( &_raw ) ) );
+}
+
+
 /*static*/ bool
 image_msg::take_next( dds_topic_reader & reader, image_msg * output, dds_sample * sample )
 {
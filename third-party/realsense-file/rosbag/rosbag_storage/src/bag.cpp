@@ -41,6 +41,10 @@
 #include <map>
 #include <tuple>
 #include <tuple>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
 
 #include "console_bridge/console.h"
 #include <memory.h>
@@ -55,6 +59,133 @@ using rs2rosinternal::Time;
 
 namespace rosbag {
 
+// A chunk that was closed but is not in the file yet: its data is compressed on a background thread, after which
+// the writing thread appends it to the file (in the order the chunks were closed)
+struct Bag::PendingChunk
+{
+    ChunkInfo                               info;
+    map<uint32_t, multiset<IndexEntry> >    indexes;             //!< with offsets into the uncompressed data
+    vector<char>                            data;                //!< uncompressed, then compressed once done
+    uint32_t                                uncompressed_size = 0;
+    bool                                    done = false;
+    std::exception_ptr                      error;
+};
+
+// Compresses chunks with LZ4 on its own threads. Each chunk is a complete LZ4 stream, so the result is the same as
+// what LZ4Stream writes to the file when compressing inline.
+class Bag::ChunkCompressor
+{
+public:
+    explicit ChunkCompressor(uint32_t threads) {
+        for (uint32_t i = 0; i < threads; ++i)
+            threads_.emplace_back([this] { worker(); });
+    }
+
+    ~ChunkCompressor() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        work_.notify_all();
+        for (std::thread& t : threads_)
+            t.join();
+    }
+
+    uint32_t size() const { return static_cast<uint32_t>(threads_.size()); }
+
+    void submit(shared_ptr<PendingChunk> const& chunk) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.push_back(chunk);
+        }
+        work_.notify_one();
+    }
+
+    // Waits until the chunk is compressed; rethrows if compressing it failed
+    void wait(PendingChunk& chunk) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [&] { return chunk.done; });
+        if (chunk.error)
+            std::rethrow_exception(chunk.error);
+    }
+
+    // Returns a buffer for the next chunk's data; buffers are recycled, rather than allocating a fresh one per chunk
+    vector<char> getBuffer() {
+        vector<char> buffer;
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!spare_buffers_.empty()) {
+            buffer.swap(spare_buffers_.back());
+            spare_buffers_.pop_back();
+        }
+        return buffer;
+    }
+
+    void putBuffer(vector<char>& buffer) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        spare_buffers_.push_back(vector<char>());
+        spare_buffers_.back().swap(buffer);
+    }
+
+private:
+    // Compresses 'data' in place, using 'output' as scratch
+    static void compress(vector<char>& data, vector<char>& output) {
+        unsigned int const input_size = static_cast<unsigned int>(data.size());
+        if (output.size() < LZ4_compressBound(input_size) + 64u)
+            output.resize(LZ4_compressBound(input_size) + 64);
+        for (;;) {
+            unsigned int output_size = static_cast<unsigned int>(output.size());
+            // Same block size as LZ4Stream
+            int ret = roslz4_buffToBuffCompress(data.data(), input_size, output.data(), &output_size, 6);
+            switch (ret) {
+            case ROSLZ4_OK:
+                data.assign(output.begin(), output.begin() + output_size);
+                return;
+            case ROSLZ4_OUTPUT_SMALL: output.resize(output.size() * 2); break;  // block headers didn't fit the bound
+            case ROSLZ4_MEMORY_ERROR: throw BagIOException("ROSLZ4_MEMORY_ERROR: insufficient memory available");
+            case ROSLZ4_PARAM_ERROR: throw BagIOException("ROSLZ4_PARAM_ERROR: bad block size");
+            default: throw BagIOException("ROSLZ4_ERROR: compression error");
+            }
+        }
+    }
+
+    void worker() {
+        vector<char> output;
+        for (;;) {
+            shared_ptr<PendingChunk> chunk;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                work_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+                if (queue_.empty())
+                    return;
+                chunk = queue_.front();
+                queue_.pop_front();
+            }
+
+            std::exception_ptr error;
+            try {
+                compress(chunk->data, output);
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                chunk->error = error;
+                chunk->done = true;
+            }
+            done_.notify_all();
+        }
+    }
+
+    vector<std::thread>                 threads_;
+    std::mutex                          mutex_;
+    std::condition_variable             work_, done_;
+    std::deque<shared_ptr<PendingChunk> > queue_;
+    vector<vector<char> >               spare_buffers_;
+    bool                                stopping_ = false;
+};
+
 Bag::Bag() :
     mode_(bagmode::Write),
     version_(0),
@@ -173,6 +304,7 @@ void Bag::close() {
     chunks_.clear();
     connection_indexes_.clear();
     curr_chunk_connection_indexes_.clear();
+    pending_chunks_.clear();
 }
 
 void Bag::closeWrite() {
@@ -194,6 +326,21 @@ void Bag::setChunkThreshold(uint32_t chunk_threshold) {
 
 CompressionType Bag::getCompression() const { return compression_; }
 
+uint32_t Bag::getCompressionThreads() const { return compressor_ ? compressor_->size() : 0; }
+
+void Bag::setCompressionThreads(uint32_t threads) {
+    if (file_.isOpen() && chunk_open_)
+        stopWritingChunk();
+
+    if (compressor_) {
+        writePendingChunks(0);
+        compressor_.reset();
+    }
+
+    if (threads)
+        compressor_ = std::make_shared<ChunkCompressor>(threads);
+}
+
 std::tuple<std::string, uint64_t, uint64_t> Bag::getCompressionInfo() const
 {
     std::map<std::string, uint64_t> compression_counts;
@@ -292,6 +439,8 @@ void Bag::startWriting() {
 void Bag::stopWriting() {
     if (chunk_open_)
         stopWritingChunk();
+    if (compressor_)
+        writePendingChunks(0);
 
     seek(0, std::ios::end);
 
@@ -438,7 +587,9 @@ void Bag::readFileHeaderRecord() {
 }
 
 uint32_t Bag::getChunkOffset() const {
-    if (compression_ == compression::Uncompressed)
+    if (compressInBackground())
+        return outgoing_chunk_buffer_.getSize();
+    else if (compression_ == compression::Uncompressed)
         return static_cast<uint32_t>(file_.getOffset() - curr_chunk_data_pos_);
     else
         return file_.getCompressedBytesIn();
@@ -446,10 +597,18 @@ uint32_t Bag::getChunkOffset() const {
 
 void Bag::startWritingChunk(Time time) {
     // Initialize chunk info
-    curr_chunk_info_.pos        = file_.getOffset();
     curr_chunk_info_.start_time = time;
     curr_chunk_info_.end_time   = time;
 
+    if (compressInBackground()) {
+        // The chunk is assembled in outgoing_chunk_buffer_, and gets its position once written (see writeChunk)
+        curr_chunk_info_.pos = -1;
+        chunk_open_ = true;
+        return;
+    }
+
+    curr_chunk_info_.pos        = file_.getOffset();
+
     // Write the chunk header, with a place-holder for the data sizes (we'll fill in when the chunk is finished)
     writeChunkHeader(compression_, 0, 0);
 
@@ -463,6 +622,28 @@ void Bag::startWritingChunk(Time time) {
 }
 
 void Bag::stopWritingChunk() {
+    if (compressInBackground()) {
+        shared_ptr<PendingChunk> chunk = std::make_shared<PendingChunk>();
+        chunk->info = curr_chunk_info_;
+        chunk->indexes.swap(curr_chunk_connection_indexes_);
+        chunk->uncompressed_size = outgoing_chunk_buffer_.getSize();
+        chunk->data = compressor_->getBuffer();
+        char const* chunk_data = reinterpret_cast<char const*>(outgoing_chunk_buffer_.getData());
+        chunk->data.assign(chunk_data, chunk_data + chunk->uncompressed_size);
+        outgoing_chunk_buffer_.setSize(0);
+
+        curr_chunk_info_.connection_counts.clear();
+        chunk_open_ = false;
+
+        compressor_->submit(chunk);
+        pending_chunks_.push_back(chunk);
+
+        // Each pending chunk holds a copy of its data: if compression can't keep up, wait for it rather than
+        // letting them pile up
+        writePendingChunks(2 * compressor_->size());
+        return;
+    }
+
     // Add this chunk to the index
     chunks_.push_back(curr_chunk_info_);
 
@@ -479,7 +660,7 @@ void Bag::stopWritingChunk() {
 
     // Write out the indexes and clear them
     seek(end_of_chunk_pos);
-    writeIndexRecords();
+    writeIndexRecords(curr_chunk_connection_indexes_);
     curr_chunk_connection_indexes_.clear();
 
     // Clear the connection counts
@@ -489,6 +670,41 @@ void Bag::stopWritingChunk() {
     chunk_open_ = false;
 }
 
+bool Bag::compressInBackground() const {
+    return compressor_ && compression_ == compression::LZ4;
+}
+
+void Bag::writePendingChunks(size_t max_pending) {
+    while (pending_chunks_.size() > max_pending) {
+        shared_ptr<PendingChunk> chunk = pending_chunks_.front();
+        pending_chunks_.pop_front();
+        compressor_->wait(*chunk);
+        writeChunk(*chunk);
+        compressor_->putBuffer(chunk->data);
+    }
+}
+
+void Bag::writeChunk(PendingChunk& chunk) {
+    seek(0, std::ios::end);
+    chunk.info.pos = file_.getOffset();
+
+    writeChunkHeader(compression::LZ4, static_cast<uint32_t>(chunk.data.size()), chunk.uncompressed_size);
+    write(chunk.data.data(), chunk.data.size());
+    writeIndexRecords(chunk.indexes);
+    file_size_ = file_.getOffset();
+
+    // Now that the chunk has a position, its messages can be indexed
+    for (map<uint32_t, multiset<IndexEntry> >::const_iterator i = chunk.indexes.begin(); i != chunk.indexes.end(); i++) {
+        multiset<IndexEntry>& connection_index = connection_indexes_[i->first];
+        for (IndexEntry e : i->second) {
+            e.chunk_pos = chunk.info.pos;
+            connection_index.insert(connection_index.end(), e);
+        }
+    }
+
+    chunks_.push_back(chunk.info);
+}
+
 void Bag::writeChunkHeader(CompressionType compression, uint32_t compressed_size, uint32_t uncompressed_size) {
     ChunkHeader chunk_header;
     switch (compression) {
@@ -530,8 +746,8 @@ void Bag::readChunkHeader(ChunkHeader& chunk_header) const {
 
 // Index records
 
-void Bag::writeIndexRecords() {
-    for (map<uint32_t, multiset<IndexEntry> >::const_iterator i = curr_chunk_connection_indexes_.begin(); i != curr_chunk_connection_indexes_.end(); i++) {
+void Bag::writeIndexRecords(map<uint32_t, multiset<IndexEntry> > const& indexes) {
+    for (map<uint32_t, multiset<IndexEntry> >::const_iterator i = indexes.begin(); i != indexes.end(); i++) {
         uint32_t                    connection_id = i->first;
         multiset<IndexEntry> const& index         = i->second;
 
@@ -0,0 +1,50 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+#pragma once
+
+#include <cstdint>
+#include <stddef.h>
+
+
+namespace rsutils {
+namespace codec {
+
+
+// Lossless compression of 16-bit depth images (Z16).
+//
+// Each pixel is predicted from its neighbors as a plane through them (left + up - up-left; pixels outside the image
+// count as zero) and only the difference is kept. Depth is mostly smooth surfaces, so the differences are small, and
+// they are zero wherever the surface is flat or planar, and throughout invalid (zero) areas. The differences are then
+// coded as RVL does (Wilson, "Fast Lossless Depth Image Compression", 2017): runs of zeros and of non-zeros, with each
+// count and value taking as many 4-bit nibbles as it needs.
+//
+// Prediction and reconstruction are vectorized (SSE2 or NEON), and so is finding where runs end; on other CPUs the
+// same is done a pixel at a time. The output is the same either way.
+//
+// The encoded data starts with a 12-byte header: "RSD1", then the width and height as little-endian 32-bit values.
+
+
+size_t const DEPTH_HEADER_SIZE = 12;
+
+
+// The most depth_encode() may write for an image of the given size
+size_t depth_encode_bound( uint32_t width, uint32_t height );
+
+// Encodes the image into 'out', which must have room for depth_encode_bound() bytes. The stride is in bytes and must
+// be even. Returns the size written.
+size_t depth_encode( uint16_t const * pixels, uint32_t width, uint32_t height, size_t stride, uint8_t * out );
+
+// Reads the image size from encoded data; false if it is not a valid header
+bool depth_decode_header( uint8_t const * data, size_t size, uint32_t * width, uint32_t * height );
+
+// Decodes into 'pixels', which must have room for width x height values (packed: the stride is width * 2). Returns
+// false if the data is malformed or doesn't fit, in which case 'pixels' are left partially written.
+bool depth_decode( uint8_t const * data, size_t size, uint16_t * pixels, size_t pixel_count );
+
+// The same without SIMD, even where it's available, so tests can check both give the same output
+size_t depth_encode_scalar( uint16_t const * pixels, uint32_t width, uint32_t height, size_t stride, uint8_t * out );
+bool depth_decode_scalar( uint8_t const * data, size_t size, uint16_t * pixels, size_t pixel_count );
+
+
+}  // namespace codec
+}  // namespace rsutils
@@ -0,0 +1,100 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+#include <utility>
+
+
+namespace rsutils {
+namespace concurrency {
+
+
+// A bounded single-producer, single-consumer queue. All slots are allocated up front, and neither side ever locks
+// or allocates: the producer only writes the tail and the consumer only writes the head.
+//
+// Exactly one thread may push at a time, and exactly one (possibly other) thread may pop/peek at a time. Items that
+// are popped are moved out of their slot, so the slot keeps whatever a moved-from T holds.
+//
+template< class T >
+class spsc_ring
+{
+public:
+    // The capacity is rounded up to a power of 2
+    explicit spsc_ring( size_t capacity )
+        : _slots( round_up( capacity ) )
+        , _mask( _slots.size() - 1 )
+    {
+    }
+
+    spsc_ring( const spsc_ring & ) = delete;
+    spsc_ring & operator=( const spsc_ring & ) = delete;
+
+    size_t capacity() const { return _slots.size(); }
+
+    // Producer: returns false (and leaves 'item' alone) if the ring is full
+    bool try_push( T && item )
+    {
+        size_t const tail = _tail.load( std::memory_order_relaxed );
+        if( tail - _head.load( std::memory_order_acquire ) == _slots.size() )
+            return false;
+        _slots[tail & _mask] = std::move( item );
+        _tail.store( tail + 1, std::memory_order_release );
+        return true;
+    }
+
+    // Producer: whether try_push() would fail right now
+    bool full() const
+    {
+        return _tail.load( std::memory_order_relaxed ) - _head.load( std::memory_order_acquire ) == _slots.size();
+    }
+
+    // Consumer: the oldest item, or null if the ring is empty. Stays valid until it is popped.
+    T * front()
+    {
+        size_t const head = _head.load( std::memory_order_relaxed );
+        if( head == _tail.load( std::memory_order_acquire ) )
+            return nullptr;
+        return &_slots[head & _mask];
+    }
+
+    // Consumer: returns false if the ring is empty
+    bool try_pop( T & item )
+    {
+        T * const p = front();
+        if( ! p )
+            return false;
+        item = std::move( *p );
+        _head.store( _head.load( std::memory_order_relaxed ) + 1, std::memory_order_release );
+        return true;
+    }
+
+    // Either side; only a hint while the other side is active
+    bool empty() const { return _head.load( std::memory_order_acquire ) == _tail.load( std::memory_order_acquire ); }
+
+private:
+    static size_t round_up( size_t n )
+    {
+        size_t p = 1;
+        while( p < n )
+            p <<= 1;
+        return p;
+    }
+
+    std::vector< T > _slots;
+    size_t const _mask;
+
+    // Padded onto separate cache lines, so the two sides don't keep stealing each other's (padding rather than
+    // alignas, which heap allocation doesn't honor before C++17)
+    char _pad0[64];
+    std::atomic< size_t > _head{ 0 };  // next to pop
+    char _pad1[64 - sizeof( std::atomic< size_t > )];
+    std::atomic< size_t > _tail{ 0 };  // next to push
+    char _pad2[64 - sizeof( std::atomic< size_t > )];
+};
+
+
+}  // namespace concurrency
+}  // namespace rsutils
@@ -0,0 +1,126 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+
+namespace rsutils {
+namespace concurrency {
+
+
+class periodic_task;
+
+
+// Runs periodic tasks (polling a device, watching options, etc.) on a small, fixed set of threads, instead of each
+// task keeping a thread of its own that mostly sleeps. Tasks are kept in a queue ordered by when they're next due;
+// whichever thread is free runs the next one due.
+//
+// A task is rescheduled one interval after its run *ends*, same as a thread that works and then sleeps, so it never
+// overlaps itself. Tasks that block (e.g., on a hung device) hold up one thread, not the rest: when the last free
+// thread starts a run, a spare thread is started to take its place, so there is always one free to run whatever else
+// is due. Spares exit once they're not needed, so the pool is back to its size when nothing blocks.
+//
+class timer_service
+{
+public:
+    typedef std::chrono::steady_clock clock;
+
+    static const size_t DEFAULT_THREADS = 4;
+
+    struct task_stats
+    {
+        std::string name;
+        clock::duration interval;
+        bool active;
+        uint64_t runs;
+        clock::duration total_run_time;
+        clock::duration max_run_time;
+        clock::duration max_lateness;  // how much later than due a run started, at worst
+    };
+
+    explicit timer_service( size_t n_threads = DEFAULT_THREADS );
+    ~timer_service();
+
+    timer_service( const timer_service & ) = delete;
+    timer_service & operator=( const timer_service & ) = delete;
+
+    // Not counting spares
+    size_t thread_count() const { return _threads.size(); }
+
+    // One entry per periodic_task that exists, whether started or not
+    std::vector< task_stats > get_task_stats() const;
+
+    // The process-wide service, which periodic tasks use by default: created with the first task that asks for it,
+    // and destroyed (threads and all) with the last
+    static std::shared_ptr< timer_service > instance();
+
+    // The process-wide service if it exists; does not create it
+    static std::shared_ptr< timer_service > existing_instance();
+
+private:
+    friend class periodic_task;
+
+    struct task;
+    struct state;
+
+    void add( std::shared_ptr< task > const & );
+    void remove( task * );
+    void start( std::shared_ptr< task > const &, bool run_now );
+    void stop( task & );
+    bool is_active( task const & ) const;
+    void set_interval( task &, clock::duration );
+    clock::duration get_interval( task const & ) const;
+
+    static void worker( std::shared_ptr< state >, bool spare );
+
+    // Shared with the threads, which may outlive us: the last task may be destroyed from within a task run
+    std::shared_ptr< state > _state;
+    std::vector< std::thread > _threads;
+};
+
+
+// A function to call periodically on a timer_service, for as long as it is started. Can be stopped and started again
+// any number of times; the first run after start() is one interval later, unless asked to run right away.
+//
+class periodic_task
+{
+public:
+    typedef timer_service::clock clock;
+
+    periodic_task( std::string name,
+                   clock::duration interval,
+                   std::function< void() > fn,
+                   std::shared_ptr< timer_service > service = timer_service::instance() );
+    ~periodic_task();
+
+    periodic_task( const periodic_task & ) = delete;
+    periodic_task & operator=( const periodic_task & ) = delete;
+
+    void start( bool run_now = false );
+
+    // Once stop() returns, the task is not running and will not run again until start()ed. When called from within
+    // the task itself, it only cancels the next run.
+    void stop();
+
+    bool is_active() const;
+
+    // Takes effect from the next time the task is scheduled
+    void set_interval( clock::duration interval );
+    clock::duration get_interval() const;
+
+private:
+    std::shared_ptr< timer_service > _service;
+    std::shared_ptr< timer_service::task > _task;
+};
+
+
+}  // namespace concurrency
+}  // namespace rsutils
@@ -0,0 +1,74 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+#pragma once
+
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <atomic>
+#include <vector>
+#include <cstddef>
+
+
+namespace rsutils {
+namespace concurrency {
+
+
+// A fixed set of threads for splitting a job into ranges and running them in parallel. The calling thread takes
+// part in the work, so a pool of N threads starts N-1 of its own, and a pool of 1 simply runs everything inline.
+//
+// Meant for per-frame data-parallel work (e.g., row bands of an image), where starting threads for every frame
+// would cost more than it saves: the threads are started once and sleep between jobs.
+//
+class worker_pool
+{
+public:
+    // A range of indices [begin, end) to process
+    typedef std::function< void( size_t begin, size_t end ) > range_fn;
+
+    // 0 means one thread per core
+    explicit worker_pool( size_t n_threads = 0 );
+    ~worker_pool();
+
+    worker_pool( const worker_pool & ) = delete;
+    worker_pool & operator=( const worker_pool & ) = delete;
+
+    // Number of threads taking part in a job, including the caller's
+    size_t size() const { return _threads.size() + 1; }
+
+    // Split [0, count) into ranges of at least 'min_range' indices, and call 'fn' on each from the pool's threads
+    // (the caller's included). Returns once all the ranges are done; if any threw, the first exception is rethrown.
+    // One job runs at a time: concurrent callers wait their turn.
+    void parallel_for( size_t count, range_fn const & fn, size_t min_range = 1 );
+
+private:
+    struct job
+    {
+        range_fn const * fn = nullptr;
+        size_t count = 0;
+        size_t range = 0;
+        std::atomic< size_t > next{ 0 };
+        std::exception_ptr error;
+        std::mutex error_mutex;
+    };
+
+    void worker();
+    void run( job & );
+
+    std::vector< std::thread > _threads;
+
+    std::mutex _job_mutex;  // one job at a time
+
+    std::mutex _mutex;
+    std::condition_variable _wake, _done;
+    job * _job = nullptr;
+    unsigned _generation = 0;  // incremented per job, so workers don't pick up the same one twice
+    size_t _busy = 0;          // workers still on the current job
+    bool _stopping = false;
+};
+
+
+}  // namespace concurrency
+}  // namespace rsutils
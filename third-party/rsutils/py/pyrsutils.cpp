@@ -16,6 +16,7 @@
 #include <rsutils/os/special-folder.h>
 #include <rsutils/type/eth-config.h>
 #include <rsutils/type/ip-address.h>
+#include <rsutils/codec/depth-codec.h>
 
 
 #define NAME pyrsutils
@@ -188,6 +189,19 @@ PYBIND11_MODULE(NAME, m) {
         .value( "user_videos", rsutils::os::special_folder::user_videos );
     m.def( "get_special_folder", rsutils::os::get_special_folder );
 
+    // Z16 images as flat lists of width x height values, e.g. to publish compressed depth from test servers
+    m.def(
+        "depth_encode",
+        []( std::vector< uint16_t > const & pixels, uint32_t width, uint32_t height )
+        {
+            if( pixels.size() != size_t( width ) * height )
+                throw std::invalid_argument( "expecting width x height pixels" );
+            std::vector< uint8_t > out( rsutils::codec::depth_encode_bound( width, height ) );
+            out.resize( rsutils::codec::depth_encode( pixels.data(), width, height, width * 2, out.data() ) );
+            return py::bytes( reinterpret_cast< char const * >( out.data() ), out.size() );
+        },
+        py::arg( "pixels" ), py::arg( "width" ), py::arg( "height" ) );
+
     using rsutils::type::ip_address;
     py::class_< ip_address >( m, "ip_address" )
         .def( py::init<>() )
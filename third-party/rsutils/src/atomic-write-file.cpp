@@ -41,7 +41,7 @@ bool atomic_write_file( const std::string & filename, const std::string & conten
 {
     const std::string temp_filename = make_temp_filename( filename );
 
-    std::ofstream out( temp_filename.c_str() );
+    std::ofstream out( temp_filename.c_str(), std::ios::binary );
     if( ! out.is_open() )
         return false;
 
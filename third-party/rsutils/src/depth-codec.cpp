@@ -0,0 +1,409 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include <rsutils/codec/depth-codec.h>
+
+#include <algorithm>
+#include <vector>
+
+#if defined( __SSE2__ ) || defined( __SSSE3__ )
+#include <emmintrin.h>
+#define DEPTH_CODEC_SSE2
+#elif defined( __ARM_NEON )
+#include <arm_neon.h>
+#define DEPTH_CODEC_NEON
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+
+namespace rsutils {
+namespace codec {
+
+
+namespace {
+
+
+char const MAGIC[4] = { 'R', 'S', 'D', '1' };
+
+
+void put_u32( uint8_t * p, uint32_t v )
+{
+    p[0] = uint8_t( v );
+    p[1] = uint8_t( v >> 8 );
+    p[2] = uint8_t( v >> 16 );
+    p[3] = uint8_t( v >> 24 );
+}
+
+
+uint32_t get_u32( uint8_t const * p )
+{
+    return uint32_t( p[0] ) | uint32_t( p[1] ) << 8 | uint32_t( p[2] ) << 16 | uint32_t( p[3] ) << 24;
+}
+
+
+#if defined( DEPTH_CODEC_SSE2 ) || defined( DEPTH_CODEC_NEON )
+int lowest_set_bit( uint64_t v )
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64( &index, v );
+    return int( index );
+#else
+    return __builtin_ctzll( v );
+#endif
+}
+#endif
+
+
+uint16_t zigzag( uint16_t d )
+{
+    return uint16_t( ( d << 1 ) ^ uint16_t( int16_t( d ) >> 15 ) );
+}
+
+
+uint16_t unzigzag( uint16_t z )
+{
+    return uint16_t( ( z >> 1 ) ^ uint16_t( 0 - ( z & 1 ) ) );
+}
+
+
+// Zigzagged differences from a plane through the left, up and up-left neighbors. The row above the first is all
+// zeros, as is the column to the left of the first.
+template< bool simd >
+void predict_row( uint16_t const * cur, uint16_t const * up, uint32_t width, uint16_t * residuals )
+{
+    residuals[0] = zigzag( uint16_t( cur[0] - up[0] ) );
+    uint32_t x = 1;
+#if defined( DEPTH_CODEC_SSE2 )
+    for( ; simd && x + 8 <= width; x += 8 )
+    {
+        auto c = _mm_loadu_si128( reinterpret_cast< __m128i const * >( cur + x ) );
+        auto l = _mm_loadu_si128( reinterpret_cast< __m128i const * >( cur + x - 1 ) );
+        auto u = _mm_loadu_si128( reinterpret_cast< __m128i const * >( up + x ) );
+        auto ul = _mm_loadu_si128( reinterpret_cast< __m128i const * >( up + x - 1 ) );
+        auto d = _mm_add_epi16( _mm_sub_epi16( _mm_sub_epi16( c, l ), u ), ul );
+        auto z = _mm_xor_si128( _mm_slli_epi16( d, 1 ), _mm_srai_epi16( d, 15 ) );
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( residuals + x ), z );
+    }
+#elif defined( DEPTH_CODEC_NEON )
+    for( ; simd && x + 8 <= width; x += 8 )
+    {
+        auto d = vaddq_u16( vsubq_u16( vsubq_u16( vld1q_u16( cur + x ), vld1q_u16( cur + x - 1 ) ), vld1q_u16( up + x ) ),
+                            vld1q_u16( up + x - 1 ) );
+        auto sign = vreinterpretq_u16_s16( vshrq_n_s16( vreinterpretq_s16_u16( d ), 15 ) );
+        vst1q_u16( residuals + x, veorq_u16( vshlq_n_u16( d, 1 ), sign ) );
+    }
+#endif
+    for( ; x < width; ++x )
+        residuals[x] = zigzag( uint16_t( cur[x] - cur[x - 1] - up[x] + up[x - 1] ) );
+}
+
+
+// The inverse of predict_row(), in place: each pixel is the one to its left plus its difference and the slope above
+// it, which makes the row a running sum, done 8 pixels at a time
+template< bool simd >
+void reconstruct_row( uint16_t * row, uint16_t const * up, uint32_t width )
+{
+    row[0] = uint16_t( unzigzag( row[0] ) + up[0] );
+    uint32_t x = 1;
+#if defined( DEPTH_CODEC_SSE2 )
+    auto const zero = _mm_setzero_si128();
+    auto const one = _mm_set1_epi16( 1 );
+    auto carry = _mm_set1_epi16( int16_t( row[0] ) );
+    for( ; simd && x + 8 <= width; x += 8 )
+    {
+        auto z = _mm_loadu_si128( reinterpret_cast< __m128i const * >( row + x ) );
+        auto d = _mm_xor_si128( _mm_srli_epi16( z, 1 ), _mm_sub_epi16( zero, _mm_and_si128( z, one ) ) );
+        d = _mm_add_epi16( d, _mm_loadu_si128( reinterpret_cast< __m128i const * >( up + x ) ) );
+        d = _mm_sub_epi16( d, _mm_loadu_si128( reinterpret_cast< __m128i const * >( up + x - 1 ) ) );
+        d = _mm_add_epi16( d, _mm_slli_si128( d, 2 ) );
+        d = _mm_add_epi16( d, _mm_slli_si128( d, 4 ) );
+        d = _mm_add_epi16( d, _mm_slli_si128( d, 8 ) );
+        d = _mm_add_epi16( d, carry );
+        _mm_storeu_si128( reinterpret_cast< __m128i * >( row + x ), d );
+        carry = _mm_shufflehi_epi16( d, 0xFF );
+        carry = _mm_unpackhi_epi64( carry, carry );
+    }
+#elif defined( DEPTH_CODEC_NEON )
+    auto const zero = vdupq_n_u16( 0 );
+    auto const one = vdupq_n_u16( 1 );
+    auto carry = vdupq_n_u16( row[0] );
+    for( ; simd && x + 8 <= width; x += 8 )
+    {
+        auto z = vld1q_u16( row + x );
+        auto d = veorq_u16( vshrq_n_u16( z, 1 ), vsubq_u16( zero, vandq_u16( z, one ) ) );
+        d = vsubq_u16( vaddq_u16( d, vld1q_u16( up + x ) ), vld1q_u16( up + x - 1 ) );
+        d = vaddq_u16( d, vextq_u16( zero, d, 7 ) );
+        d = vaddq_u16( d, vextq_u16( zero, d, 6 ) );
+        d = vaddq_u16( d, vextq_u16( zero, d, 4 ) );
+        d = vaddq_u16( d, carry );
+        vst1q_u16( row + x, d );
+        carry = vdupq_n_u16( vgetq_lane_u16( d, 7 ) );
+    }
+#endif
+    for( ; x < width; ++x )
+        row[x] = uint16_t( row[x - 1] + unzigzag( row[x] ) + up[x] - up[x - 1] );
+}
+
+
+// How many values from the start are zero (or, if !zeros, non-zero)
+template< bool simd, bool zeros >
+size_t run_length( uint16_t const * p, size_t n )
+{
+    size_t i = 0;
+#if defined( DEPTH_CODEC_SSE2 )
+    auto const zero = _mm_setzero_si128();
+    for( ; simd && i + 8 <= n; i += 8 )
+    {
+        // Two bits per value, set where it is zero
+        uint32_t mask = _mm_movemask_epi8(
+            _mm_cmpeq_epi16( _mm_loadu_si128( reinterpret_cast< __m128i const * >( p + i ) ), zero ) );
+        if( zeros )
+            mask ^= 0xFFFF;
+        if( mask )
+            return i + lowest_set_bit( mask ) / 2;
+    }
+#elif defined( DEPTH_CODEC_NEON )
+    for( ; simd && i + 8 <= n; i += 8 )
+    {
+        // A byte per value, 0xFF where it is zero
+        uint64_t mask = vget_lane_u64( vreinterpret_u64_u8( vmovn_u16( vceqq_u16( vld1q_u16( p + i ), vdupq_n_u16( 0 ) ) ) ), 0 );
+        if( zeros )
+            mask = ~mask;
+        if( mask )
+            return i + lowest_set_bit( mask ) / 8;
+    }
+#endif
+    while( i < n && ( p[i] == 0 ) == zeros )
+        ++i;
+    return i;
+}
+
+
+// Variable-length values, 3 bits per nibble with the 4th bit set if more follow, packed most-significant nibble first
+// into little-endian 32-bit words
+class nibble_writer
+{
+    uint8_t * _out;
+    uint64_t _acc = 0;
+    int _bits = 0;  // not yet written, at the bottom of _acc
+
+    void put_bits( uint32_t code, int n )
+    {
+        _acc = ( _acc << n ) | code;
+        _bits += n;
+        if( _bits >= 32 )
+        {
+            _bits -= 32;
+            put_u32( _out, uint32_t( _acc >> _bits ) );
+            _out += 4;
+        }
+    }
+
+public:
+    explicit nibble_writer( uint8_t * out ) : _out( out ) {}
+
+    void put( uint32_t v )
+    {
+        uint32_t code = 0;
+        int n = 0;
+        while( v > 7 )
+        {
+            code = ( code << 4 ) | 8 | ( v & 7 );
+            v >>= 3;
+            if( ( n += 4 ) == 32 )
+            {
+                put_bits( code, 32 );
+                code = 0;
+                n = 0;
+            }
+        }
+        put_bits( ( code << 4 ) | v, n + 4 );
+    }
+
+    // Returns the end of the output
+    uint8_t * flush()
+    {
+        if( _bits )
+            put_bits( 0, 32 - _bits );
+        return _out;
+    }
+};
+
+
+class nibble_reader
+{
+    uint8_t const * _p;
+    uint8_t const * const _end;
+    uint32_t _word = 0;
+    int _bits = 0;  // left in _word
+    bool _overrun = false;
+
+    uint32_t nibble()
+    {
+        if( ! _bits )
+        {
+            if( _end - _p < 4 )
+            {
+                _overrun = true;
+                return 0;
+            }
+            _word = get_u32( _p );
+            _p += 4;
+            _bits = 32;
+        }
+        _bits -= 4;
+        return ( _word >> _bits ) & 0xF;
+    }
+
+public:
+    nibble_reader( uint8_t const * begin, uint8_t const * end ) : _p( begin ), _end( end ) {}
+
+    bool overrun() const { return _overrun; }
+
+    uint32_t get()
+    {
+        uint32_t v = 0;
+        for( int shift = 0; shift < 32; shift += 3 )
+        {
+            auto n = nibble();
+            v |= ( n & 7 ) << shift;
+            if( ! ( n & 8 ) )
+                return v;
+        }
+        _overrun = true;  // more nibbles than a 32-bit value can have
+        return 0;
+    }
+};
+
+
+template< bool simd >
+size_t encode( uint16_t const * pixels, uint32_t width, uint32_t height, size_t stride, uint8_t * out )
+{
+    std::copy( MAGIC, MAGIC + 4, out );
+    put_u32( out + 4, width );
+    put_u32( out + 8, height );
+    size_t const n = size_t( width ) * height;
+    if( ! n )
+        return DEPTH_HEADER_SIZE;
+
+    std::vector< uint16_t > residuals( n );
+    std::vector< uint16_t > const zero_row( width, 0 );
+    uint16_t const * up = zero_row.data();
+    for( uint32_t y = 0; y < height; ++y )
+    {
+        auto row = reinterpret_cast< uint16_t const * >( reinterpret_cast< uint8_t const * >( pixels ) + y * stride );
+        predict_row< simd >( row, up, width, residuals.data() + size_t( y ) * width );
+        up = row;
+    }
+
+    nibble_writer writer( out + DEPTH_HEADER_SIZE );
+    for( size_t i = 0; i < n; )
+    {
+        auto zeros = run_length< simd, true >( residuals.data() + i, n - i );
+        i += zeros;
+        auto nonzeros = run_length< simd, false >( residuals.data() + i, n - i );
+        writer.put( uint32_t( zeros ) );
+        writer.put( uint32_t( nonzeros ) );
+        for( auto end = i + nonzeros; i < end; ++i )
+            writer.put( residuals[i] );
+    }
+    return writer.flush() - out;
+}
+
+
+template< bool simd >
+bool decode( uint8_t const * data, size_t size, uint16_t * pixels, size_t pixel_count )
+{
+    uint32_t width, height;
+    if( ! depth_decode_header( data, size, &width, &height ) )
+        return false;
+    size_t const n = size_t( width ) * height;
+    if( n > pixel_count )
+        return false;
+    if( ! n )
+        return true;
+
+    // The residuals go straight into the output, and are then turned into pixels there
+    nibble_reader reader( data + DEPTH_HEADER_SIZE, data + size );
+    for( size_t i = 0; i < n; )
+    {
+        auto zeros = reader.get();
+        auto nonzeros = reader.get();
+        if( reader.overrun() || zeros > n - i || nonzeros > n - i - zeros || zeros + nonzeros == 0 )
+            return false;
+        std::fill_n( pixels + i, zeros, uint16_t( 0 ) );
+        i += zeros;
+        for( auto end = i + nonzeros; i < end; ++i )
+        {
+            auto v = reader.get();
+            if( v > 0xFFFF )
+                return false;
+            pixels[i] = uint16_t( v );
+        }
+        if( reader.overrun() )
+            return false;
+    }
+
+    std::vector< uint16_t > const zero_row( width, 0 );
+    uint16_t const * up = zero_row.data();
+    for( uint32_t y = 0; y < height; ++y )
+    {
+        auto row = pixels + size_t( y ) * width;
+        reconstruct_row< simd >( row, up, width );
+        up = row;
+    }
+    return true;
+}
+
+
+}  // namespace
+
+
+size_t depth_encode_bound( uint32_t width, uint32_t height )
+{
+    // Every run count needs at most as many nibbles as the pixels it counts, and values need up to 6 (17 bits), so
+    // 8 nibbles per pixel is plenty; plus the first count, which may be zero, and padding to a whole word
+    return DEPTH_HEADER_SIZE + size_t( width ) * height * 4 + 8;
+}
+
+
+bool depth_decode_header( uint8_t const * data, size_t size, uint32_t * width, uint32_t * height )
+{
+    if( size < DEPTH_HEADER_SIZE || ! std::equal( MAGIC, MAGIC + 4, data ) )
+        return false;
+    *width = get_u32( data + 4 );
+    *height = get_u32( data + 8 );
+    return true;
+}
+
+
+size_t depth_encode( uint16_t const * pixels, uint32_t width, uint32_t height, size_t stride, uint8_t * out )
+{
+    return encode< true >( pixels, width, height, stride, out );
+}
+
+
+size_t depth_encode_scalar( uint16_t const * pixels, uint32_t width, uint32_t height, size_t stride, uint8_t * out )
+{
+    return encode< false >( pixels, width, height, stride, out );
+}
+
+
+bool depth_decode( uint8_t const * data, size_t size, uint16_t * pixels, size_t pixel_count )
+{
+    return decode< true >( data, size, pixels, pixel_count );
+}
+
+
+bool depth_decode_scalar( uint8_t const * data, size_t size, uint16_t * pixels, size_t pixel_count )
+{
+    return decode< false >( data, size, pixels, pixel_count );
+}
+
+
+}  // namespace codec
+}  // namespace rsutils
@@ -0,0 +1,328 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include <rsutils/concurrency/timer-service.h>
+#include <rsutils/shared-ptr-singleton.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+
+
+namespace rsutils {
+namespace concurrency {
+
+
+// Everything but 'fn' and 'name' is guarded by the service's mutex
+struct timer_service::task
+{
+    std::string name;
+    std::function< void() > fn;
+    clock::duration interval;
+
+    bool active = false;
+    unsigned generation = 0;  // bumped by start() and stop(), so queued runs from before are skipped
+    bool running = false;
+    std::thread::id runner;
+
+    uint64_t runs = 0;
+    clock::duration total_run_time{ 0 };
+    clock::duration max_run_time{ 0 };
+    clock::duration max_lateness{ 0 };
+};
+
+
+const size_t timer_service::DEFAULT_THREADS;
+
+
+struct timer_service::state
+{
+    struct queued
+    {
+        clock::time_point due;
+        std::shared_ptr< task > t;
+        unsigned generation;
+
+        bool operator<( queued const & other ) const { return due > other.due; }  // earliest on top of the heap
+    };
+
+    std::mutex mutex;
+    std::condition_variable wake;  // workers: something new is due, or we're stopping
+    std::condition_variable idle;  // stop(): a task run has ended
+    std::vector< queued > queue;   // heap
+    std::vector< task * > tasks;   // all of them, for the statistics
+    size_t threads = 0;            // spares included
+    size_t busy = 0;               // threads in a task run
+    bool stopping = false;
+
+    void push( clock::time_point due, std::shared_ptr< task > t )
+    {
+        auto const generation = t->generation;
+        queue.push_back( { due, std::move( t ), generation } );
+        std::push_heap( queue.begin(), queue.end() );
+    }
+
+    void wait_until_idle( std::unique_lock< std::mutex > & lock, task & t )
+    {
+        // From within the task we'd wait for ourselves
+        if( t.running && t.runner != std::this_thread::get_id() )
+            idle.wait( lock, [&] { return ! t.running; } );
+    }
+};
+
+
+timer_service::timer_service( size_t n_threads )
+    : _state( std::make_shared< state >() )
+{
+    _state->threads = std::max< size_t >( 1, n_threads );
+    for( size_t i = 0; i < _state->threads; ++i )
+        _threads.emplace_back( worker, _state, false );
+}
+
+
+timer_service::~timer_service()
+{
+    {
+        std::lock_guard< std::mutex > lock( _state->mutex );
+        _state->stopping = true;
+    }
+    // Spares exit on their own: no task is running by now (other than, maybe, the one destroying us)
+    _state->wake.notify_all();
+    for( auto & t : _threads )
+    {
+        // The last task was destroyed from within a task run, taking us with it: this thread will exit on its own
+        // once the run is over
+        if( t.get_id() == std::this_thread::get_id() )
+            t.detach();
+        else
+            t.join();
+    }
+}
+
+
+static shared_ptr_singleton< timer_service > & the_instance()
+{
+    static shared_ptr_singleton< timer_service > singleton;
+    return singleton;
+}
+
+
+std::shared_ptr< timer_service > timer_service::instance()
+{
+    return the_instance().instance();
+}
+
+
+std::shared_ptr< timer_service > timer_service::existing_instance()
+{
+    return the_instance().get();
+}
+
+
+std::vector< timer_service::task_stats > timer_service::get_task_stats() const
+{
+    std::vector< task_stats > stats;
+    std::lock_guard< std::mutex > lock( _state->mutex );
+    stats.reserve( _state->tasks.size() );
+    for( auto t : _state->tasks )
+        stats.push_back(
+            { t->name, t->interval, t->active, t->runs, t->total_run_time, t->max_run_time, t->max_lateness } );
+    return stats;
+}
+
+
+void timer_service::add( std::shared_ptr< task > const & t )
+{
+    std::lock_guard< std::mutex > lock( _state->mutex );
+    _state->tasks.push_back( t.get() );
+}
+
+
+void timer_service::remove( task * t )
+{
+    std::lock_guard< std::mutex > lock( _state->mutex );
+    auto & tasks = _state->tasks;
+    tasks.erase( std::remove( tasks.begin(), tasks.end(), t ), tasks.end() );
+}
+
+
+void timer_service::start( std::shared_ptr< task > const & t, bool run_now )
+{
+    std::unique_lock< std::mutex > lock( _state->mutex );
+    if( t->active )
+        return;
+    // A run from before a stop() (from within the task) may still be going: don't overlap it
+    _state->wait_until_idle( lock, *t );
+    t->active = true;
+    ++t->generation;
+    _state->push( clock::now() + ( run_now ? clock::duration( 0 ) : t->interval ), t );
+    lock.unlock();
+    // All of them: the one waiting for the earliest task may now have to wait less
+    _state->wake.notify_all();
+}
+
+
+void timer_service::stop( task & t )
+{
+    std::unique_lock< std::mutex > lock( _state->mutex );
+    if( t.active )
+    {
+        t.active = false;
+        ++t.generation;
+        // Its queued run is left for a worker to discard when it comes due
+    }
+    _state->wait_until_idle( lock, t );
+}
+
+
+bool timer_service::is_active( task const & t ) const
+{
+    std::lock_guard< std::mutex > lock( _state->mutex );
+    return t.active;
+}
+
+
+void timer_service::set_interval( task & t, clock::duration interval )
+{
+    std::lock_guard< std::mutex > lock( _state->mutex );
+    t.interval = interval;
+}
+
+
+timer_service::clock::duration timer_service::get_interval( task const & t ) const
+{
+    std::lock_guard< std::mutex > lock( _state->mutex );
+    return t.interval;
+}
+
+
+void timer_service::worker( std::shared_ptr< state > st, bool spare )
+{
+    std::unique_lock< std::mutex > lock( st->mutex );
+    while( ! st->stopping )
+    {
+        bool const due_now = ! st->queue.empty() && clock::now() >= st->queue.front().due;
+        // A spare is only needed while it's the one free thread
+        if( spare && ! due_now && st->threads - st->busy > 1 )
+            break;
+        if( st->queue.empty() )
+        {
+            st->wake.wait( lock );
+            continue;
+        }
+        auto const due = st->queue.front().due;
+        if( ! due_now )
+        {
+            st->wake.wait_until( lock, due );
+            continue;
+        }
+
+        std::pop_heap( st->queue.begin(), st->queue.end() );
+        auto next = std::move( st->queue.back() );
+        st->queue.pop_back();
+
+        task & t = *next.t;
+        if( ! t.active || next.generation != t.generation )
+            continue;  // stopped (or restarted) since it was queued
+
+        t.running = true;
+        t.runner = std::this_thread::get_id();
+        // The run may block for as long as, e.g., a device takes to answer: make sure another thread is free
+        if( ++st->busy == st->threads )
+        {
+            try
+            {
+                std::thread( worker, st, true ).detach();
+                ++st->threads;
+            }
+            catch( ... )
+            {
+                // Out of threads: the next free one will get to it
+            }
+        }
+        lock.unlock();
+
+        auto const start = clock::now();
+        try
+        {
+            t.fn();
+        }
+        catch( ... )
+        {
+            // Tasks are expected to handle their own errors; nothing we can do here
+        }
+        auto const end = clock::now();
+
+        lock.lock();
+        --st->busy;
+        t.running = false;
+        ++t.runs;
+        t.total_run_time += end - start;
+        t.max_run_time = std::max( t.max_run_time, end - start );
+        t.max_lateness = std::max( t.max_lateness, start - due );
+        if( t.active && next.generation == t.generation )
+        {
+            st->push( end + t.interval, std::move( next.t ) );
+            // We're about to wait again ourselves, but another thread may be waiting for something later
+            st->wake.notify_one();
+        }
+        st->idle.notify_all();
+    }
+    if( spare )
+        --st->threads;
+}
+
+
+periodic_task::periodic_task( std::string name,
+                              clock::duration interval,
+                              std::function< void() > fn,
+                              std::shared_ptr< timer_service > service )
+    : _service( std::move( service ) )
+    , _task( std::make_shared< timer_service::task >() )
+{
+    _task->name = std::move( name );
+    _task->fn = std::move( fn );
+    _task->interval = interval;
+    _service->add( _task );
+}
+
+
+periodic_task::~periodic_task()
+{
+    stop();
+    _service->remove( _task.get() );
+}
+
+
+void periodic_task::start( bool run_now )
+{
+    _service->start( _task, run_now );
+}
+
+
+void periodic_task::stop()
+{
+    _service->stop( *_task );
+}
+
+
+bool periodic_task::is_active() const
+{
+    return _service->is_active( *_task );
+}
+
+
+void periodic_task::set_interval( clock::duration interval )
+{
+    _service->set_interval( *_task, interval );
+}
+
+
+periodic_task::clock::duration periodic_task::get_interval() const
+{
+    return _service->get_interval( *_task );
+}
+
+
+}  // namespace concurrency
+}  // namespace rsutils
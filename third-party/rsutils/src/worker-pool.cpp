@@ -0,0 +1,125 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include <rsutils/concurrency/worker-pool.h>
+
+#include <algorithm>
+
+
+namespace rsutils {
+namespace concurrency {
+
+
+worker_pool::worker_pool( size_t n_threads )
+{
+    if( ! n_threads )
+        n_threads = std::max( 1u, std::thread::hardware_concurrency() );
+    for( size_t i = 1; i < n_threads; ++i )
+        _threads.emplace_back( [this] { worker(); } );
+}
+
+
+worker_pool::~worker_pool()
+{
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _stopping = true;
+    }
+    _wake.notify_all();
+    for( auto & t : _threads )
+        t.join();
+}
+
+
+void worker_pool::parallel_for( size_t count, range_fn const & fn, size_t min_range )
+{
+    if( ! count )
+        return;
+
+    // A few ranges per thread, so a thread that got slow ranges doesn't hold everyone up
+    size_t const n_ranges = size() * 4;
+    size_t const range = std::max( std::max< size_t >( min_range, 1 ), ( count + n_ranges - 1 ) / n_ranges );
+    if( _threads.empty() || range >= count )
+    {
+        fn( 0, count );
+        return;
+    }
+
+    std::lock_guard< std::mutex > job_lock( _job_mutex );
+
+    job j;
+    j.fn = &fn;
+    j.count = count;
+    j.range = range;
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _job = &j;
+        ++_generation;
+        _busy = _threads.size();
+    }
+    _wake.notify_all();
+
+    run( j );
+
+    {
+        std::unique_lock< std::mutex > lock( _mutex );
+        _done.wait( lock, [this] { return ! _busy; } );
+        _job = nullptr;
+    }
+
+    if( j.error )
+        std::rethrow_exception( j.error );
+}
+
+
+void worker_pool::run( job & j )
+{
+    for( ;; )
+    {
+        size_t const begin = j.next.fetch_add( j.range );
+        if( begin >= j.count )
+            break;
+        try
+        {
+            ( *j.fn )( begin, std::min( begin + j.range, j.count ) );
+        }
+        catch( ... )
+        {
+            std::lock_guard< std::mutex > lock( j.error_mutex );
+            if( ! j.error )
+                j.error = std::current_exception();
+        }
+    }
+}
+
+
+void worker_pool::worker()
+{
+    unsigned seen = 0;
+    for( ;; )
+    {
+        job * j;
+        {
+            std::unique_lock< std::mutex > lock( _mutex );
+            _wake.wait( lock, [&] { return _stopping || _generation != seen; } );
+            if( _stopping )
+                return;
+            seen = _generation;
+            j = _job;
+        }
+
+        run( *j );
+
+        bool last;
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            last = ! --_busy;
+        }
+        if( last )
+            _done.notify_one();
+    }
+}
+
+
+}  // namespace concurrency
+}  // namespace rsutils
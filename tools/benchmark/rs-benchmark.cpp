@@ -117,6 +117,39 @@ private:
     std::string _name;
 };
 
+// The decimation -> disparity -> spatial -> temporal -> depth chain, block after block or fused into one block
+class depth_chain_test : public test
+{
+public:
+    depth_chain_test(bool fused)
+        : _to_disparity(true), _to_depth(false), _pipeline(&_decimation, &_spatial, &_temporal),
+          _name(fused ? "depth_pipeline" : "depth_chain"), _fused(fused) {}
+
+    frame process(frame f) override
+    {
+        if (_fused)
+            return _pipeline.process(f);
+
+        f = _decimation.process(f);
+        f = _to_disparity.process(f);
+        f = _spatial.process(f);
+        f = _temporal.process(f);
+        return _to_depth.process(f);
+    }
+    virtual const std::string& name() const override
+    {
+        return _name;
+    }
+private:
+    decimation_filter _decimation;
+    spatial_filter _spatial;
+    temporal_filter _temporal;
+    disparity_transform _to_disparity, _to_depth;
+    depth_pipeline _pipeline;
+    std::string _name;
+    bool _fused;
+};
+
 template<class T>
 class gl_test : public pb_test<T>
 {
@@ -177,6 +210,8 @@ public:
             REGISTER_TEST(disparity_transform);
             REGISTER_TEST(threshold_filter);
             REGISTER_TEST(decimation_filter);
+            tests.push_back(make_shared<depth_chain_test>(false));
+            tests.push_back(make_shared<depth_chain_test>(true));
         }
         if (stream.format() == RS2_FORMAT_YUYV)
         {
@@ -2,6 +2,7 @@
 // Copyright(c) 2021 RealSense, Inc. All Rights Reserved.
 
 #include <fstream>
+#include <iostream>
 #include "converter.hpp"
 
 using namespace rs2::tools::converter;
@@ -45,20 +46,28 @@ bool converter_base::frames_map_get_and_set(rs2_stream streamType, int index, fr
     return result;
 }
 
-void converter_base::wait_sub_workers()
+void converter_base::submit(std::function<void()> f)
 {
-    for_each(_subWorkers.begin(), _subWorkers.end(),
-        [](std::thread& t) {
-            t.join();
-        });
+    if (!_workQueue) {
+        f();
+        return;
+    }
 
-    _subWorkers.clear();
+    std::string name = this->name();
+    _workQueue->submit([name, f] {
+        try {
+            f();
+        }
+        catch (const std::exception& e) {
+            std::cerr << name << ": " << e.what() << std::endl;
+        }
+    });
 }
 
 void converter_base::wait()
 {
-    if (_worker.joinable()) {
-        _worker.join();
+    if (_workQueue) {
+        _workQueue->wait();
     }
 }
 
@@ -78,3 +87,73 @@ std::string converter_base::get_statistics()
     return (result.str());
 }
 
+const size_t work_queue::max_in_flight;
+
+work_queue::work_queue(size_t threads)
+    : _inFlight(0)
+    , _stopping(false)
+{
+    for (size_t i = 0; i < std::max<size_t>(threads, 1); ++i) {
+        _threads.emplace_back([this] { work(); });
+    }
+}
+
+work_queue::~work_queue()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _workAvailable.notify_all();
+
+    for_each(_threads.begin(), _threads.end(),
+        [](std::thread& t) {
+            t.join();
+        });
+}
+
+void work_queue::submit(std::function<void()> task)
+{
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _roomAvailable.wait(lock, [this] { return _inFlight < max_in_flight; });
+        ++_inFlight;
+        _tasks.push_back(std::move(task));
+    }
+    _workAvailable.notify_one();
+}
+
+void work_queue::wait()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _idle.wait(lock, [this] { return !_inFlight; });
+}
+
+void work_queue::work()
+{
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _workAvailable.wait(lock, [this] { return _stopping || !_tasks.empty(); });
+            if (_tasks.empty()) {
+                return;  // stopping, and nothing left to do
+            }
+            task = std::move(_tasks.front());
+            _tasks.pop_front();
+        }
+
+        task();
+        task = nullptr;  // let go of the frame before making room for another
+
+        bool idle;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            idle = !--_inFlight;
+        }
+        _roomAvailable.notify_one();
+        if (idle) {
+            _idle.notify_all();
+        }
+    }
+}
@@ -5,15 +5,20 @@
 #define __RS_CONVERTER_CONVERTER_H
 
 #include <map>
+#include <deque>
+#include <condition_variable>
 #include <unordered_set>
 #include <thread>
+#include <mutex>
+#include <functional>
+#include <memory>
+#include <vector>
 #include <string>
 #include <sstream>
 #include <algorithm>
 
 #include "librealsense2/rs.hpp"
 
-
 namespace rs2 {
     namespace tools {
         namespace converter {
@@ -22,32 +27,61 @@ namespace rs2 {
 
             typedef unsigned long long frame_number_t;
 
+            // Runs the converters' per-frame work on a fixed set of threads, as it comes.
+            //
+            // Every task holds on to its frame until it is done, and frames come from fixed-size pools: playback
+            // has 32, and the colorizer (PNG of depth) only 16. Running out makes librealsense drop frames, so at
+            // most 'max_in_flight' tasks are queued or running at a time: submit() waits for one to finish only
+            // when the limit is reached. This also holds back the (non-real-time) playback feeding us, so frames
+            // never pile up in memory, while reading goes on as frames are converted.
+            class work_queue {
+                std::vector<std::thread> _threads;
+                std::mutex _mutex;
+                std::condition_variable _workAvailable, _roomAvailable, _idle;
+                std::deque<std::function<void()>> _tasks;
+                size_t _inFlight;  // queued or running
+                bool _stopping;
+
+                void work();
+
+            public:
+                // Well below the smallest frame pool we take frames from
+                static const size_t max_in_flight = 8;
+
+                work_queue(size_t threads);
+                ~work_queue();
+
+                size_t threads() const { return _threads.size(); }
+
+                void submit(std::function<void()> task);
+
+                // Returns once everything submitted so far is done
+                void wait();
+            };
+
             class converter_base {
             protected:
-                std::thread _worker;
-                std::vector<std::thread> _subWorkers;
+                std::shared_ptr<work_queue> _workQueue;
                 std::map<std::pair<rs2_stream, int>, std::unordered_set<frame_number_t>> _framesMap;
 
             protected:
                 bool frames_map_get_and_set(rs2_stream streamType, int index, frame_number_t frameNumber);
-                void wait_sub_workers();
 
-                template <typename F> void start_worker(const F& f)
-                {
-                    _worker = std::thread(f);
-                }
-
-                template <typename F> void add_sub_worker(const F& f)
-                {
-                    _subWorkers.emplace_back(f);
-                }
+                // Runs f on the work queue or, without one, right away. Anything f needs must be captured by value.
+                void submit(std::function<void()> f);
 
             public:
+                void set_work_queue(std::shared_ptr<work_queue> workQueue) { _workQueue = workQueue; }
+
                 virtual void convert(rs2::frame& frame) = 0;
                 virtual std::string name() const = 0;
 
+                // Called once there are no more frames, for anything written only at the end
+                virtual void finish() {}
+
                 virtual std::string get_statistics();
 
+                // Returns once all the work submitted so far is done
                 void wait();
             };
 
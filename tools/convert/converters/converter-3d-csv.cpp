@@ -21,56 +21,51 @@ void converter_3d_csv::convert_depth(rs2::depth_frame& depthframe)
         return;
     }
 
-    start_worker(
-        [this, depthframe] {
-
-            std::stringstream filename;
-            std::stringstream filename_3d_dist;
-            filename << _filePath << "3d_dist"
-                << "_" << depthframe.get_profile().stream_name()
-                << "_" << std::setprecision(14) << std::fixed << depthframe.get_timestamp()
-                << ".csv";
-
-            std::stringstream metadata_file;
-            metadata_file << _filePath
-                << "_" << depthframe.get_profile().stream_name()
-                << "_metadata_" << std::setprecision(14) << std::fixed << depthframe.get_timestamp()
-                << ".txt";
-
-            std::string filenameS = filename.str();
-            std::string metadataS = metadata_file.str();
-
-            add_sub_worker(
-                [filenameS, metadataS, depthframe] {
-                    std::ofstream fs(filenameS, std::ios::trunc);
-
-                    if (fs) {
-                        // Write the title row
-                        fs << "i,j,x (meters),y (meters),depth (meters)\n";
-
-                        // Get the intrinsic parameters of the depth frame
-                        rs2_intrinsics intrinsics = depthframe.get_profile().as<rs2::video_stream_profile>().get_intrinsics();
-
-                        for (int y = 0; y < depthframe.get_height(); y++) {
-
-                            for (int x = 0; x < depthframe.get_width(); x++) {
-                                float distance = depthframe.get_distance(x, y);
-
-                                // Write to the 3D distance file if the distance is non-zero
-                                if (distance != 0) {
-                                    float pixel[2] = { static_cast<float>(x), static_cast<float>(y) };
-                                    float point[3];
-                                    rs2_deproject_pixel_to_point(point, &intrinsics, pixel, distance);
-                                    fs << x << "," << y << "," << point[0] << "," << point[1] << "," << point[2] << '\n';
-                                }
-                            }
-                            fs << '\n';
+    std::stringstream filename;
+    std::stringstream filename_3d_dist;
+    filename << _filePath << "3d_dist"
+        << "_" << depthframe.get_profile().stream_name()
+        << "_" << std::setprecision(14) << std::fixed << depthframe.get_timestamp()
+        << ".csv";
+
+    std::stringstream metadata_file;
+    metadata_file << _filePath
+        << "_" << depthframe.get_profile().stream_name()
+        << "_metadata_" << std::setprecision(14) << std::fixed << depthframe.get_timestamp()
+        << ".txt";
+
+    std::string filenameS = filename.str();
+    std::string metadataS = metadata_file.str();
+
+    submit(
+        [filenameS, metadataS, depthframe] {
+            std::ofstream fs(filenameS, std::ios::trunc);
+
+            if (fs) {
+                // Write the title row
+                fs << "i,j,x (meters),y (meters),depth (meters)\n";
+
+                // Get the intrinsic parameters of the depth frame
+                rs2_intrinsics intrinsics = depthframe.get_profile().as<rs2::video_stream_profile>().get_intrinsics();
+
+                for (int y = 0; y < depthframe.get_height(); y++) {
+
+                    for (int x = 0; x < depthframe.get_width(); x++) {
+                        float distance = depthframe.get_distance(x, y);
+
+                        // Write to the 3D distance file if the distance is non-zero
+                        if (distance != 0) {
+                            float pixel[2] = { static_cast<float>(x), static_cast<float>(y) };
+                            float point[3];
+                            rs2_deproject_pixel_to_point(point, &intrinsics, pixel, distance);
+                            fs << x << "," << y << "," << point[0] << "," << point[1] << "," << point[2] << '\n';
                         }
-                        fs.flush();
                     }
-                    metadata_to_txtfile(depthframe, metadataS);
-                });
-            wait_sub_workers();
+                    fs << '\n';
+                }
+                fs.flush();
+            }
+            metadata_to_txtfile(depthframe, metadataS);
         });
 }
 
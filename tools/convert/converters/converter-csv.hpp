@@ -9,7 +9,6 @@
 #include <map>
 #include <mutex>
 #include <array>
-#include <condition_variable>
 #include "../converter.hpp"
 
 
@@ -59,9 +58,6 @@ namespace rs2 {
                 rs2_stream _streamType;
                 std::string _filePath;
                 std::map<std::pair<rs2_stream, int>, std::vector<motion_pose_frame_record>> _imu_pose_collection;
-                bool _sub_workers_joined;
-                std::mutex _m;
-                std::condition_variable _cv;
 
 
             public:
@@ -69,6 +65,7 @@ namespace rs2 {
                 converter_csv(const std::string& filePath, rs2_stream streamType = rs2_stream::RS2_STREAM_ANY);
 
                 void convert(rs2::frame& frame) override;
+                void finish() override;
                 
                 std::string name() const override
                 {
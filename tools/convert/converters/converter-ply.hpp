@@ -29,37 +29,42 @@ namespace rs2 {
 
                 void convert(rs2::frame& frame) override
                 {
-                    rs2::pointcloud pc;
-                    start_worker(
-                        [this, &frame, pc]() mutable {
-                            auto frameset = frame.as<rs2::frameset>();
-                            auto frameDepth = frameset.get_depth_frame();
-                            auto frameColor = frameset.get_color_frame();
+                    auto frameset = frame.as<rs2::frameset>();
+                    auto frameDepth = frameset.get_depth_frame();
+                    auto frameColor = frameset.get_color_frame();
+
+                    if (!frameDepth || !frameColor) {
+                        return;
+                    }
 
-                            if (frameDepth && frameColor) {
-                                if (frames_map_get_and_set(rs2_stream::RS2_STREAM_ANY, frameDepth.get_profile().stream_index(), frameDepth.get_frame_number())) {
-                                    return;
-                                }
+                    if (frames_map_get_and_set(rs2_stream::RS2_STREAM_ANY, frameDepth.get_profile().stream_index(), frameDepth.get_frame_number())) {
+                        return;
+                    }
 
-                                pc.map_to(frameColor);
+                    std::stringstream filename;
+                    filename << _filePath
+                        << "_" << std::setprecision(14) << std::fixed << frameDepth.get_timestamp()
+                        << ".ply";
 
-                                auto points = pc.calculate(frameDepth);
+                    std::stringstream metadata_file;
+                    metadata_file << _filePath
+                        << "_metadata_" << std::setprecision(14) << std::fixed << frameDepth.get_timestamp()
+                        << ".txt";
 
-                                std::stringstream filename;
-                                filename << _filePath
-                                    << "_" << std::setprecision(14) << std::fixed << frameDepth.get_timestamp()
-                                    << ".ply";
+                    std::string filenameS = filename.str();
+                    std::string metadataS = metadata_file.str();
 
-                                points.export_to_ply(filename.str(), frameColor);
+                    // Each task gets its own pointcloud block, so they can run side by side
+                    rs2::pointcloud pc;
+                    submit(
+                        [filenameS, metadataS, frameDepth, frameColor, pc]() mutable {
+                            pc.map_to(frameColor);
 
-                                std::stringstream metadata_file;
-                                metadata_file << _filePath
-                                    << "_metadata_" << std::setprecision(14) << std::fixed << frameDepth.get_timestamp()
-                                    << ".txt";
+                            auto points = pc.calculate(frameDepth);
+                            points.export_to_ply(filenameS, frameColor);
 
-                                metadata_to_txtfile(frameDepth, metadata_file.str());
-                            }
-                    });
+                            metadata_to_txtfile(frameDepth, metadataS);
+                        });
                 }
             };
 
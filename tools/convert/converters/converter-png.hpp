@@ -22,10 +22,14 @@ namespace rs2 {
                 rs2::colorizer _colorizer;
 
             public:
-                converter_png(const std::string& filePath, rs2_stream streamType = rs2_stream::RS2_STREAM_ANY)
+                // compressionLevel is zlib's, 0-9; lower is faster but makes bigger files. -1 keeps the default (8).
+                converter_png(const std::string& filePath, rs2_stream streamType = rs2_stream::RS2_STREAM_ANY, int compressionLevel = -1)
                     : _filePath(filePath)
                     , _streamType(streamType)
                 {
+                    if (compressionLevel >= 0) {
+                        stbi_write_png_compression_level = compressionLevel;
+                    }
                 }
 
                 std::string name() const override
@@ -44,44 +48,38 @@ namespace rs2 {
                         return;
                     }
 
-                    start_worker(
-                        [this, &frame] {
-                            rs2::video_frame videoframe = frame.as<rs2::video_frame>();
-
-                            if (videoframe.get_profile().stream_type() == rs2_stream::RS2_STREAM_DEPTH) {
-                                videoframe = _colorizer.process(videoframe);
-                            }
-
-                            std::stringstream filename;
-                            filename << _filePath
-                                << "_" << videoframe.get_profile().stream_name()
-                                << "_" << std::setprecision(14) << std::fixed << videoframe.get_timestamp()
-                                << ".png";
-
-                            std::stringstream metadata_file;
-                            metadata_file << _filePath
-                                << "_" << videoframe.get_profile().stream_name()
-                                << "_metadata_" << std::setprecision(14) << std::fixed << videoframe.get_timestamp()
-                                << ".txt";
-
-                            std::string filenameS = filename.str();
-                            std::string metadataS = metadata_file.str();
-
-                            add_sub_worker(
-                                [filenameS, metadataS, videoframe] {
-                                    stbi_write_png(
-                                        filenameS.c_str()
-                                        , videoframe.get_width()
-                                        , videoframe.get_height()
-                                        , videoframe.get_bytes_per_pixel()
-                                        , videoframe.get_data()
-                                        , videoframe.get_stride_in_bytes()
-                                    );
-
-                                    metadata_to_txtfile(videoframe, metadataS);
-                            });
-
-                            wait_sub_workers();
+                    // The colorizer isn't shared between threads; it is quick next to PNG encoding anyway
+                    if (videoframe.get_profile().stream_type() == rs2_stream::RS2_STREAM_DEPTH) {
+                        videoframe = _colorizer.process(videoframe);
+                    }
+
+                    std::stringstream filename;
+                    filename << _filePath
+                        << "_" << videoframe.get_profile().stream_name()
+                        << "_" << std::setprecision(14) << std::fixed << videoframe.get_timestamp()
+                        << ".png";
+
+                    std::stringstream metadata_file;
+                    metadata_file << _filePath
+                        << "_" << videoframe.get_profile().stream_name()
+                        << "_metadata_" << std::setprecision(14) << std::fixed << videoframe.get_timestamp()
+                        << ".txt";
+
+                    std::string filenameS = filename.str();
+                    std::string metadataS = metadata_file.str();
+
+                    submit(
+                        [filenameS, metadataS, videoframe] {
+                            stbi_write_png(
+                                filenameS.c_str()
+                                , videoframe.get_width()
+                                , videoframe.get_height()
+                                , videoframe.get_bytes_per_pixel()
+                                , videoframe.get_data()
+                                , videoframe.get_stride_in_bytes()
+                            );
+
+                            metadata_to_txtfile(videoframe, metadataS);
                     });
                 }
             };
@@ -0,0 +1,109 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#ifndef __RS_CONVERTER_CONVERTER_RAW_STREAM_H
+#define __RS_CONVERTER_CONVERTER_RAW_STREAM_H
+
+
+#include <fstream>
+#include <iomanip>
+
+#include "../converter.hpp"
+
+
+namespace rs2 {
+    namespace tools {
+        namespace converter {
+
+            // Writes all the frames of a stream, back to back, into one raw file per stream, with an index CSV that
+            // says where each frame is. Much faster than a file per frame when there are many small frames, and
+            // easy to memory-map.
+            //
+            // Appending is cheap and has to keep the frames in order, so it is done right away rather than on the
+            // work queue.
+            class converter_raw_stream : public converter_base {
+                struct stream_files {
+                    std::ofstream data;
+                    std::ofstream index;
+                    unsigned long long offset = 0;
+                };
+
+                rs2_stream _streamType;
+                std::string _filePath;
+                std::map<std::pair<rs2_stream, int>, std::shared_ptr<stream_files>> _streams;
+
+                stream_files& get_stream_files(rs2::stream_profile const& profile)
+                {
+                    auto& files = _streams[std::make_pair(profile.stream_type(), profile.stream_index())];
+                    if (!files) {
+                        std::stringstream prefix;
+                        prefix << _filePath << "_" << profile.stream_name();
+
+                        files = std::make_shared<stream_files>();
+                        files->data.open(prefix.str() + ".raw", std::ios::binary | std::ios::trunc);
+                        files->index.open(prefix.str() + "_index.csv", std::ios::trunc);
+                        if (!files->data || !files->index) {
+                            throw std::runtime_error("cannot open " + prefix.str() + ".raw for writing");
+                        }
+
+                        files->index << "Frame Number,Timestamp (ms),Offset,Size\n";
+                    }
+                    return *files;
+                }
+
+            public:
+                converter_raw_stream(const std::string& filePath, rs2_stream streamType = rs2_stream::RS2_STREAM_ANY)
+                    : _filePath(filePath)
+                    , _streamType(streamType)
+                {
+                }
+
+                std::string name() const override
+                {
+                    return "RAW stream converter";
+                }
+
+                void convert(rs2::frame& frame) override
+                {
+                    if (!frame || frame.is<rs2::frameset>()) {
+                        return;
+                    }
+
+                    auto profile = frame.get_profile();
+                    if (!(_streamType == rs2_stream::RS2_STREAM_ANY || profile.stream_type() == _streamType)) {
+                        return;
+                    }
+
+                    if (frames_map_get_and_set(profile.stream_type(), profile.stream_index(), frame.get_frame_number())) {
+                        return;
+                    }
+
+                    auto size = frame.get_data_size();
+                    if (auto videoframe = frame.as<rs2::video_frame>()) {
+                        size = videoframe.get_stride_in_bytes() * videoframe.get_height();
+                    }
+
+                    auto& files = get_stream_files(profile);
+                    files.data.write(static_cast<const char*>(frame.get_data()), size);
+                    files.index << frame.get_frame_number()
+                        << "," << std::setprecision(14) << std::fixed << frame.get_timestamp()
+                        << "," << files.offset
+                        << "," << size << "\n";
+                    files.offset += size;
+                }
+
+                void finish() override
+                {
+                    for (auto& kvp : _streams) {
+                        kvp.second->data.close();
+                        kvp.second->index.close();
+                    }
+                }
+            };
+
+        }
+    }
+}
+
+
+#endif
@@ -2,6 +2,9 @@
 // Copyright(c) 2018-25 RealSense, Inc. All Rights Reserved.
 
 #include <iostream>
+#include <iomanip>
+#include <atomic>
+#include <chrono>
 
 #include "librealsense2/rs.hpp"
 
@@ -11,17 +14,44 @@
 #include "converters/converter-3d-csv.hpp"
 #include "converters/converter-png.hpp"
 #include "converters/converter-raw.hpp"
+#include "converters/converter-raw-stream.hpp"
 #include "converters/converter-ply.hpp"
 #include "converters/converter-bin.hpp"
 #include "converters/converter-text.hpp"
 
 #include <mutex>
+#include <condition_variable>
+#include <thread>
 
 #define SECONDS_TO_NANOSECONDS 1000000000
  
 using namespace std;
 
 
+// Overwrites the current line with how far along we are and how fast we're going, e.g.:
+//     45% 1200 frames, 240.0 fps, 8.0x real time
+static void print_progress( uint64_t position, uint64_t duration, unsigned long long frames,
+                            chrono::steady_clock::time_point start )
+{
+    double seconds = chrono::duration< double >( chrono::steady_clock::now() - start ).count();
+    cout << "\r" << static_cast< int >( position * 100. / duration ) << "% " << frames << " frames";
+    if( seconds > 0 )
+        cout << ", " << fixed << setprecision( 1 ) << frames / seconds << " fps, "
+             << position / ( seconds * SECONDS_TO_NANOSECONDS ) << "x real time";
+    cout << "    " << flush;
+}
+
+static void print_summary( uint64_t duration, unsigned long long frames, chrono::steady_clock::time_point start )
+{
+    double seconds = chrono::duration< double >( chrono::steady_clock::now() - start ).count();
+    cout << "\rConverted " << frames << " frames in " << fixed << setprecision( 1 ) << seconds << " seconds";
+    if( seconds > 0 )
+        cout << " (" << frames / seconds << " fps, " << duration / ( seconds * SECONDS_TO_NANOSECONDS )
+             << "x real time)";
+    cout << "    " << endl;
+}
+
+
 int main(int argc, char** argv) try
 {
     // Parse command line arguments
@@ -34,6 +64,7 @@ int main(int argc, char** argv) try
     cli::value<string> outputFilenameRaw('r', "output-raw", "raw-path", "", "output RAW file(s) path");
     cli::value<string> outputFilenamePly('l', "output-ply", "ply-path", "", "output PLY file(s) path");
     cli::value<string> outputFilenameBin('b', "output-bin", "bin-path", "", "output BIN (depth matrix) file(s) path");
+    cli::value<string> outputFilenameRawStream('R', "output-raw-stream", "raw-stream-path", "", "output RAW file per stream, frames back to back, with an index CSV");
     cli::flag switchDepth( 'd', "depth", "convert depth frames (default - all supported)" );
     cli::flag switchColor( 'c', "color", "convert color frames (default - all supported)" );
     cli::flag switchTextOutput( 'T', "output-text", "output text to stdout" );
@@ -42,6 +73,8 @@ int main(int argc, char** argv) try
     cli::value <string> startTime('s', "start-time", "seconds", "", "ignore frames whose timestamp is less than this value (the first frame is at time 0)");
     cli::value <string> endTime('e', "end-time", "seconds", "", "ignore frames whose timestamp is greater than this value (the first frame is at time 0)" );
     cli::value<string> outputFilenameDb3('D', "output-db3", "db3-path", "", "convert legacy .bag to .db3 format");
+    cli::value<int> threadsCount("threads", "count", 0, "number of threads converting frames (default - one per core)");
+    cli::value<int> pngCompression("png-compression", "0-9", -1, "PNG compression level, lower is faster but bigger (default - 8)");
 
     auto settings = cli( "librealsense rs-convert tool" )
                         .default_log_level( RS2_LOG_SEVERITY_WARN )
@@ -56,10 +89,13 @@ int main(int argc, char** argv) try
                         .arg( outputFilenameRaw )
                         .arg( outputFilenamePly )
                         .arg( outputFilenameBin )
+                        .arg( outputFilenameRawStream )
                         .arg( switchDepth )
                         .arg( switchColor )
                         .arg( switchTextOutput )
                         .arg( outputFilenameDb3 )
+                        .arg( threadsCount )
+                        .arg( pngCompression )
                         .process( argc, argv );
 
     // Handle .bag to .db3 conversion separately (it uses the C API, not the frame pipeline)
@@ -100,7 +136,8 @@ int main(int argc, char** argv) try
         converters.push_back(
             make_shared<rs2::tools::converter::converter_png>(
                 outputFilenamePng.getValue()
-                , streamType));
+                , streamType
+                , pngCompression.getValue()));
     }
 
     if (outputFilenameRaw.isSet())
@@ -118,6 +155,14 @@ int main(int argc, char** argv) try
                 outputFilenameBin.getValue()));
     }
 
+    if (outputFilenameRawStream.isSet())
+    {
+        converters.push_back(
+            make_shared<rs2::tools::converter::converter_raw_stream>(
+                outputFilenameRawStream.getValue()
+                , streamType));
+    }
+
     if( switchTextOutput.isSet() )
     {
         converters.push_back( make_shared< rs2::tools::converter::converter_text >() );
@@ -128,6 +173,15 @@ int main(int argc, char** argv) try
         throw runtime_error("output not defined");
     }
 
+    // The converters share a fixed pool of threads, and hand it frames as they come, only a few at a time. Playback
+    // is non-real-time, so it waits while that many are being converted, and frames never pile up in memory.
+    size_t threads = threadsCount.getValue() > 0 ? threadsCount.getValue() : thread::hardware_concurrency();
+    auto workQueue = make_shared<rs2::tools::converter::work_queue>(threads);
+    for (auto& converter : converters)
+    {
+        converter->set_work_queue(workQueue);
+    }
+
     unsigned long long first_frame = 0;
     unsigned long long last_frame = 0;
     uint64_t start_time = 0;
@@ -162,6 +216,7 @@ int main(int argc, char** argv) try
 
         plyconverter = make_shared<rs2::tools::converter::converter_ply>(
             outputFilenamePly.getValue());
+        plyconverter->set_work_queue(workQueue);
 
         rs2::config cfg;
         cfg.enable_device_from_file(inputFilename.getValue());
@@ -174,6 +229,8 @@ int main(int argc, char** argv) try
         auto duration = playback.get_duration();
         int progress = 0;
         auto frameNumber = 0ULL;
+        auto frames = 0ULL;
+        auto start = chrono::steady_clock::now();
 
         rs2::frameset frameset;
         uint64_t posCurr = playback.get_position();
@@ -186,7 +243,7 @@ int main(int argc, char** argv) try
             if (posP > progress)
             {
                 progress = posP;
-                cout << posP << "%" << "\r" << flush;
+                print_progress(posCurr, duration.count(), frames, start);
             }
 
             frameNumber = frameset[0].get_frame_number();
@@ -204,7 +261,7 @@ int main(int argc, char** argv) try
             if( process_frame )
             {
                 plyconverter->convert(frameset);
-                plyconverter->wait();
+                ++frames;
             }
 
             auto posNext = playback.get_position();
@@ -215,6 +272,10 @@ int main(int argc, char** argv) try
 
             posCurr = posNext;
         }
+
+        plyconverter->wait();
+        plyconverter->finish();
+        print_summary(duration.count(), frames, start);
     }
 
     // for every converter other than ply,
@@ -222,15 +283,29 @@ int main(int argc, char** argv) try
     // and convert them one by one
     if( ! converters.empty() )
     {
+        // At the end of the file, playback stops by itself
+        std::mutex statusMutex;
+        condition_variable statusChanged;
+        bool stopped = false;
+
         rs2::context ctx;
         auto playback = ctx.load_device(inputFilename.getValue());
         playback.set_real_time(false);
+        playback.set_status_changed_callback([&](rs2_playback_status status)
+        {
+            if (status == RS2_PLAYBACK_STATUS_STOPPED)
+            {
+                lock_guard<std::mutex> lock(statusMutex);
+                stopped = true;
+                statusChanged.notify_all();
+            }
+        });
         std::vector<rs2::sensor> sensors = playback.query_sensors();
         std::mutex mutex;
 
         auto duration = playback.get_duration();
-        int progress = 0;
-        uint64_t posCurr = playback.get_position();
+        atomic<unsigned long long> frames(0);
+        auto start = chrono::steady_clock::now();
 
         for (auto sensor : sensors)
         {
@@ -245,49 +320,40 @@ int main(int argc, char** argv) try
                 std::lock_guard<std::mutex> lock(mutex);
 
                 auto frameNumber = frame.get_frame_number();
+                // Playback is not real-time, so we're called from the thread reading the file, and the position is
+                // that of this frame
+                auto position = playback.get_position();
 
                 if (frameNumberStart.isSet() && frameNumber < first_frame)
                     return;
                 if (frameNumberEnd.isSet() && frameNumber > last_frame)
                     return;
-                if (startTime.isSet() && posCurr < start_time)
+                if (startTime.isSet() && position < start_time)
                     return;
-                if (endTime.isSet() && posCurr > end_time)
+                if (endTime.isSet() && position > end_time)
                     return;
 
                 for_each(converters.begin(), converters.end(),
                     [&frame](shared_ptr<rs2::tools::converter::converter_base>& converter) {
                     converter->convert(frame);
                 });
-
-                for_each(converters.begin(), converters.end(),
-                    [](shared_ptr<rs2::tools::converter::converter_base>& converter) {
-                    converter->wait();
-                });
+                ++frames;
             });
 
         }
 
-        //we need to clear the output of ply progress ("100%") before writing
+        //we need to clear the output of ply progress before writing
         //the progress of the other converters in the same line
-        cout << "\r    \r";
+        if( ! switchTextOutput.isSet() )
+            cout << "\r" << string(60, ' ') << "\r" << flush;
 
-        while (true)
         {
-            int posP = static_cast<int>(posCurr * 100. / duration.count());
-
-            if (posP > progress)
+            unique_lock<std::mutex> lock(statusMutex);
+            while (!statusChanged.wait_for(lock, chrono::milliseconds(500), [&] { return stopped; }))
             {
-                progress = posP;
                 if( ! switchTextOutput.isSet() )
-                    cout << posP << "%" << "\r" << flush;
+                    print_progress(playback.get_position(), duration.count(), frames, start);
             }
-
-            const uint64_t posNext = playback.get_position();
-            if (posNext < posCurr)
-                break;
-
-            posCurr = posNext;
         }
 
         for (auto sensor : sensors)
@@ -299,10 +365,16 @@ int main(int argc, char** argv) try
             sensor.stop();
             sensor.close();
         }
-    }
 
-    if( !switchTextOutput.isSet() )
-        cout << endl;
+        for (auto& converter : converters)
+        {
+            converter->wait();
+            converter->finish();
+        }
+
+        if( ! switchTextOutput.isSet() )
+            print_summary(duration.count(), frames, start);
+    }
 
     //print statistics for ply converter. 
     if (outputFilenamePly.isSet()) {
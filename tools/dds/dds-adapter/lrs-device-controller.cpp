@@ -6,10 +6,12 @@
 #include <common/metadata-helper.h>
 
 #include <realdds/topics/image-msg.h>
+#include <realdds/topics/compressed-image-msg.h>
 #include <realdds/topics/imu-msg.h>
 #include <realdds/topics/blob-msg.h>
 #include <realdds/topics/dds-topic-names.h>
 #include <realdds/topics/flexible-msg.h>
+#include <realdds/topics/binary-metadata.h>
 #include <realdds/topics/dds-topic-names.h>
 #include <realdds/dds-device-server.h>
 #include <realdds/dds-stream-server.h>
@@ -193,6 +195,21 @@ std::vector< char const * > get_option_enum_values( rs2::sensor const & sensor,
 }
 
 
+// All streams share the same schema: the librealsense metadata names, in enum order, so the index of a field in the
+// binary metadata is its rs2_frame_metadata_value
+static realdds::topics::binary_metadata::schema_type const & metadata_schema()
+{
+    static realdds::topics::binary_metadata::schema_type const schema = []()
+    {
+        realdds::topics::binary_metadata::schema_type names;
+        for( size_t i = 0; i < static_cast< size_t >( RS2_FRAME_METADATA_COUNT ); ++i )
+            names.push_back( rs2_frame_metadata_to_string( static_cast< rs2_frame_metadata_value >( i ) ) );
+        return names;
+    }();
+    return schema;
+}
+
+
 static json json_from_roi( rs2::region_of_interest const & roi )
 {
     return realdds::dds_rect_option::type{ roi.min_x, roi.min_y, roi.max_x, roi.max_y }.to_json();
@@ -206,6 +223,48 @@ static rs2::region_of_interest roi_from_json( json const & j )
 }
 
 
+rs2_stream stream_name_to_type( std::string const & type_string );
+
+
+// Replace the profiles of a stream we send compressed with their compressed equivalents: one per resolution and FPS,
+// whatever raw formats the camera has for it. A stream none of whose profiles can be compressed is left as is.
+static void compress_profiles( rs2_stream const stream_type, realdds::dds_stream_profiles & profiles, size_t * p_default )
+{
+    realdds::dds_stream_profiles compressed;
+    size_t compressed_default = 0;
+    for( size_t i = 0; i < profiles.size(); ++i )
+    {
+        auto vp = std::dynamic_pointer_cast< realdds::dds_video_stream_profile >( profiles[i] );
+        if( ! vp )
+            return;
+        auto const encoding
+            = tools::lrs_frame_compressor::compressed_encoding( stream_type, rs2_format( vp->encoding().to_rs2() ) );
+        if( ! encoding.is_valid() )
+            continue;
+        auto it = std::find_if( compressed.begin(),
+                                compressed.end(),
+                                [&]( std::shared_ptr< realdds::dds_stream_profile > const & p )
+                                {
+                                    auto cp = std::static_pointer_cast< realdds::dds_video_stream_profile >( p );
+                                    return cp->width() == vp->width() && cp->height() == vp->height()
+                                        && cp->frequency() == vp->frequency();
+                                } );
+        if( p_default && *p_default == i )
+            compressed_default = it - compressed.begin();
+        if( it == compressed.end() )
+            compressed.push_back( std::make_shared< realdds::dds_video_stream_profile >( vp->frequency(),
+                                                                                         encoding,
+                                                                                         vp->width(),
+                                                                                         vp->height() ) );
+    }
+    if( compressed.empty() )
+        return;
+    profiles = std::move( compressed );
+    if( p_default )
+        *p_default = compressed_default;
+}
+
+
 std::vector< std::shared_ptr< realdds::dds_stream_server > > lrs_device_controller::get_supported_streams()
 {
     std::map< std::string, realdds::dds_stream_profiles > stream_name_to_profiles;
@@ -290,6 +349,20 @@ std::vector< std::shared_ptr< realdds::dds_stream_server > > lrs_device_controll
 
     override_default_profiles( stream_name_to_profiles, stream_name_to_default_profile );
 
+    // Only now that the defaults are set by their raw formats
+    if( _compressor )
+    {
+        for( auto & it : stream_name_to_profiles )
+        {
+            auto default_profile_it = stream_name_to_default_profile.find( it.first );
+            compress_profiles( stream_name_to_type( it.first ),
+                               it.second,
+                               default_profile_it == stream_name_to_default_profile.end()
+                                   ? nullptr
+                                   : &default_profile_it->second );
+        }
+    }
+
     // Iterate over the mapped streams and initialize
     std::vector< std::shared_ptr< realdds::dds_stream_server > > servers;
     std::set< std::string > sensors_handled;
@@ -323,11 +396,15 @@ std::vector< std::shared_ptr< realdds::dds_stream_server > > lrs_device_controll
             // Set stream metadata support (currently if the device supports metadata all streams does)
             // Must be done before calling init_profiles()
             if( _md_enabled )
-                server->enable_metadata();
+                server->enable_metadata( metadata_schema() );
         }
 
         server->init_profiles( profiles, default_profile_index );
 
+        if( server->is_compressed() && _compressor )
+            _compressed_streams[stream_name]
+                = _compressor->add_stream( std::dynamic_pointer_cast< dds_video_stream_server >( server ) );
+
         // Get supported options and recommended filters for this stream
         for( auto & sensor : _rs_dev.query_sensors() )
         {
@@ -570,21 +647,29 @@ rs2::stream_profile get_required_profile( const rs2::sensor & sensor,
     auto const stream_type = stream_name_to_type( stream_name );
     auto const stream_index = stream_name_to_index( stream_name );
 
+    auto dds_vp = std::dynamic_pointer_cast< dds_video_stream_profile >( profile );
+    // When compressing, the camera format is whatever we can compress into the profile's encoding
+    auto matches = [&]( rs2::stream_profile const & sp, bool compressed ) {
+        auto vp = sp.as< rs2::video_stream_profile >();
+        bool video_params_match = ( vp && dds_vp )
+                                    ? vp.width() == dds_vp->width()
+                                          && vp.height() == dds_vp->height()
+                                          && ( compressed ? tools::lrs_frame_compressor::compressed_encoding(
+                                                                sp.stream_type(), vp.format() ) == dds_vp->encoding()
+                                                          : vp.format() == dds_vp->encoding().to_rs2() )
+                                    : true;
+        return sp.stream_type() == stream_type
+            && sp.stream_index() == stream_index
+            && sp.fps() == profile->frequency()
+            && video_params_match;
+    };
     auto profile_iter = std::find_if( sensor_stream_profiles.begin(),
                                       sensor_stream_profiles.end(),
-                                      [&]( rs2::stream_profile const & sp ) {
-                                          auto vp = sp.as< rs2::video_stream_profile >();
-                                          auto dds_vp = std::dynamic_pointer_cast< dds_video_stream_profile >( profile );
-                                          bool video_params_match = ( vp && dds_vp )
-                                                                      ? vp.width() == dds_vp->width()
-                                                                            && vp.height() == dds_vp->height()
-                                                                            && vp.format() == dds_vp->encoding().to_rs2()
-                                                                      : true;
-                                          return sp.stream_type() == stream_type
-                                              && sp.stream_index() == stream_index
-                                              && sp.fps() == profile->frequency()
-                                              && video_params_match;
-                                      } );
+                                      [&]( rs2::stream_profile const & sp ) { return matches( sp, false ); } );
+    if( profile_iter == sensor_stream_profiles.end() && dds_vp && dds_vp->is_compressed_encoding() )
+        profile_iter = std::find_if( sensor_stream_profiles.begin(),
+                                     sensor_stream_profiles.end(),
+                                     [&]( rs2::stream_profile const & sp ) { return matches( sp, true ); } );
     if( profile_iter == sensor_stream_profiles.end() )
     {
         throw std::runtime_error( "Could not find required profile" );
@@ -635,8 +720,11 @@ lrs_device_controller::frame_to_streaming_server( rs2::frame const & f, rs2::str
 }
 
 
-lrs_device_controller::lrs_device_controller( rs2::device dev, std::shared_ptr< realdds::dds_device_server > dds_device_server )
+lrs_device_controller::lrs_device_controller( rs2::device dev,
+                                              std::shared_ptr< realdds::dds_device_server > dds_device_server,
+                                              std::shared_ptr< lrs_frame_compressor > compressor )
     : _rs_dev( dev )
+    , _compressor( std::move( compressor ) )
     , _dds_device_server( dds_device_server )
     , _control_dispatcher( QUEUE_MAX_SIZE )
 {
@@ -704,22 +792,33 @@ lrs_device_controller::lrs_device_controller( rs2::device dev, std::shared_ptr<
                         if( ! motion )
                             return;
 
-                        auto xyz = reinterpret_cast< float const * >( f.get_data() );
-                        if( RS2_STREAM_ACCEL == stream_profile.stream_type() )
+                        // A batched frame (RS2_OPTION_MOTION_BATCH_WINDOW) is sent a sample at a time, as the
+                        // clients expect
+                        rs2::motion_frame mf( f );
+                        int n_samples = mf.get_sample_count();
+                        auto const samples = mf.get_samples();
+                        if( ! n_samples )
+                            n_samples = 1;
+                        for( int i = 0; i < n_samples; ++i )
                         {
+                            auto xyz = samples ? &samples[i].data.x : reinterpret_cast< float const * >( f.get_data() );
+                            if( RS2_STREAM_ACCEL == stream_profile.stream_type() )
+                            {
+                                std::unique_lock< std::mutex > lock( imu->mutex );
+                                imu->message.accel_data().x( xyz[0] );  // in m/s^2
+                                imu->message.accel_data().y( xyz[1] );
+                                imu->message.accel_data().z( xyz[2] );
+                                continue;  // Don't actually publish
+                            }
+                            imu->message.gyro_data().x( xyz[0] );  // rad/sec, which is what we need
+                            imu->message.gyro_data().y( xyz[1] );
+                            imu->message.gyro_data().z( xyz[2] );
+                            imu->message.timestamp(  // in sec.nsec
+                                static_cast< long double >( samples ? samples[i].timestamp : f.get_timestamp() )
+                                * MILLISEC_TO_SEC );
                             std::unique_lock< std::mutex > lock( imu->mutex );
-                            imu->message.accel_data().x( xyz[0] );  // in m/s^2
-                            imu->message.accel_data().y( xyz[1] );
-                            imu->message.accel_data().z( xyz[2] );
-                            return;  // Don't actually publish
+                            motion->publish_motion( std::move( imu->message ) );
                         }
-                        imu->message.gyro_data().x( xyz[0] );  // rad/sec, which is what we need
-                        imu->message.gyro_data().y( xyz[1] );
-                        imu->message.gyro_data().z( xyz[2] );
-                        imu->message.timestamp(  // in sec.nsec
-                            static_cast< long double >( f.get_timestamp() ) * MILLISEC_TO_SEC );
-                        std::unique_lock< std::mutex > lock( imu->mutex );
-                        motion->publish_motion( std::move( imu->message ) );
 
                         // motion streams have no metadata!
                     } );
@@ -737,13 +836,21 @@ lrs_device_controller::lrs_device_controller( rs2::device dev, std::shared_ptr<
                         dds_time const timestamp  // in sec.nsec
                             ( static_cast< long double >( f.get_timestamp() ) * MILLISEC_TO_SEC );
 
-                        realdds::topics::image_msg image;
-                        image.set_height( video->get_image_header().height );
-                        image.set_width( video->get_image_header().width );
-                        image.set_timestamp( timestamp );
-                        auto data = static_cast< const uint8_t * >( f.get_data() );
-                        image.raw().data().assign( data, data + f.get_data_size() );
-                        video->publish_image( image );
+                        if( video->is_compressed() )
+                        {
+                            if( ! publish_compressed_image( video, f, timestamp ) )
+                                return;
+                        }
+                        else
+                        {
+                            realdds::topics::image_msg image;
+                            image.set_height( video->get_image_header().height );
+                            image.set_width( video->get_image_header().width );
+                            image.set_timestamp( timestamp );
+                            // No copy: serialized straight from the frame, which is alive until we return
+                            image.set_data_view( static_cast< const uint8_t * >( f.get_data() ), f.get_data_size() );
+                            video->publish_image( image );
+                        }
 
                         publish_frame_metadata( f, timestamp );
                     } );
@@ -1090,28 +1197,52 @@ void lrs_device_controller::publish_frame_metadata( const rs2::frame & f, realdd
     if( ! _dds_device_server->has_metadata_readers() )
         return;
 
-    json md_header = json::object( {
-        { topics::metadata::header::key::frame_number, f.get_frame_number() },               // communicated; up to client to pick up
-        { topics::metadata::header::key::timestamp, timestamp.to_ns() },                     // syncer key: needs to match the image timestamp, bit-for-bit!
-        { topics::metadata::header::key::timestamp_domain, f.get_frame_timestamp_domain() }  // needed if we're dealing with different domains!
-    } );
+    topics::binary_metadata md;
+    md.reset( static_cast< size_t >( RS2_FRAME_METADATA_COUNT ) );
+    md.stream_name = stream_name_from_rs2( f.get_profile() );
+    md.set_frame_number( f.get_frame_number() );              // communicated; up to client to pick up
+    md.timestamp = timestamp.to_ns();                         // syncer key: needs to match the image timestamp, bit-for-bit!
+    md.timestamp_domain = f.get_frame_timestamp_domain();     // needed if we're dealing with different domains!
     if( f.is< rs2::depth_frame >() )
-        md_header[topics::metadata::header::key::depth_units] = f.as< rs2::depth_frame >().get_units();
+        md.depth_units = f.as< rs2::depth_frame >().get_units();
+
+    for( auto const & field : f.get_frame_metadata_all() )
+        md.set( static_cast< size_t >( field.first ), field.second );
+
+    // Sent as binary and/or JSON, depending on who's listening
+    _dds_device_server->publish_metadata( md );
+}
+
 
-    json metadata = json::object();
-    for( size_t i = 0; i < static_cast< size_t >( RS2_FRAME_METADATA_COUNT ); ++i )
+// Returns false if the frame is dropped
+bool lrs_device_controller::publish_compressed_image( std::shared_ptr< realdds::dds_video_stream_server > const & video,
+                                                      rs2::frame const & f,
+                                                      realdds::dds_time const & timestamp )
+{
+    // Already compressed by the camera: sent as is
+    if( f.get_profile().format() == RS2_FORMAT_MJPEG )
     {
-        rs2_frame_metadata_value val = static_cast< rs2_frame_metadata_value >( i );
-        if( f.supports_frame_metadata( val ) )
-            metadata[rs2_frame_metadata_to_string( val )] = f.get_frame_metadata( val );
+        realdds::topics::compressed_image_msg image;
+        auto const data = static_cast< const uint8_t * >( f.get_data() );
+        image.raw().data().assign( data, data + f.get_data_size() );
+        image.set_timestamp( timestamp );
+        video->publish_image( image );
+        return true;
     }
 
-    json md_msg = json::object( {
-        { topics::metadata::key::stream_name, stream_name_from_rs2( f.get_profile() ) },
-        { topics::metadata::key::header, std::move( md_header ) },
-        { topics::metadata::key::metadata, std::move( metadata ) },
-    } );
-    _dds_device_server->publish_metadata( std::move( md_msg ) );
+    // Anything else takes too long to compress here, holding up the next frame
+    auto it = _compressed_streams.find( video->name() );
+    if( it == _compressed_streams.end() )
+    {
+        LOG_ERROR( "no compressor for '" << video->name() << "'; dropping frame" );
+        return false;
+    }
+    if( ! _compressor->compress( it->second, f, timestamp ) )
+    {
+        LOG_DEBUG( "'" << video->name() << "' frame dropped: compression is falling behind" );
+        return false;
+    }
+    return true;
 }
 
 
@@ -2,6 +2,8 @@
 // Copyright(c) 2022-4 RealSense, Inc. All Rights Reserved.
 #pragma once
 
+#include "lrs-frame-compressor.h"
+
 #include <librealsense2/rs.hpp>  // Include RealSense Cross Platform API
 #include <realdds/dds-stream-sensor-bridge.h>
 #include <realdds/dds-stream-profile.h>
@@ -19,6 +21,7 @@ namespace realdds {
 
 class dds_device_server;
 class dds_stream_server;
+class dds_video_stream_server;
 class dds_option;
 class dds_topic_reader;
 class dds_topic_writer;
@@ -46,7 +49,10 @@ namespace tools {
 class lrs_device_controller : public std::enable_shared_from_this< lrs_device_controller >
 {
 public:
-    lrs_device_controller( rs2::device dev, std::shared_ptr< realdds::dds_device_server > dds_device_server );
+    // With a compressor, depth and color are sent compressed (see lrs_frame_compressor)
+    lrs_device_controller( rs2::device dev,
+                           std::shared_ptr< realdds::dds_device_server > dds_device_server,
+                           std::shared_ptr< lrs_frame_compressor > compressor = nullptr );
     ~lrs_device_controller();
 
     void set_option( const std::shared_ptr< realdds::dds_option > & option, rsutils::json const & new_value );
@@ -63,6 +69,9 @@ private:
     bool update_stream_trinsics( rsutils::json * p_changes = nullptr );
 
     void publish_frame_metadata( const rs2::frame & f, realdds::dds_time const & );
+    bool publish_compressed_image( std::shared_ptr< realdds::dds_video_stream_server > const &,
+                                   rs2::frame const &,
+                                   realdds::dds_time const & );
 
     bool on_control( std::string const & id, rsutils::json const & control, rsutils::json & reply );
     bool on_hardware_reset( rsutils::json const &, rsutils::json & );
@@ -97,6 +106,9 @@ private:
 
     std::map< std::string, std::shared_ptr< realdds::dds_stream_server > > _stream_name_to_server;
 
+    std::shared_ptr< lrs_frame_compressor > _compressor;
+    std::map< std::string, std::shared_ptr< lrs_frame_compressor::stream > > _compressed_streams;  // by stream name
+
     std::vector< rs2::stream_profile > get_rs2_profiles( realdds::dds_stream_profiles const & dds_profiles ) const;
 
     std::shared_ptr< realdds::dds_device_server > _dds_device_server;
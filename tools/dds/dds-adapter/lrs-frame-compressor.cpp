@@ -0,0 +1,485 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include "lrs-frame-compressor.h"
+
+#include <realdds/dds-stream-server.h>
+#include <realdds/topics/compressed-image-msg.h>
+
+#include <rsutils/codec/depth-codec.h>
+#include <rsutils/easylogging/easyloggingpp.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <map>
+#include <stdexcept>
+
+#ifdef RS2_USE_LIBJPEG_TURBO
+#include <cstdio>  // jpeglib.h needs FILE
+#include <csetjmp>
+#include <jpeglib.h>
+#if ! defined( JCS_EXTENSIONS )
+#error "BUILD_WITH_LIBJPEG_TURBO needs libjpeg-turbo, for its BGR input"
+#endif
+#else
+#define STB_IMAGE_WRITE_STATIC
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <third-party/stb_image_write.h>
+#endif
+
+
+namespace tools {
+
+
+// Frames of a stream go out in sequence: each gets a number when queued, and is held back after compression until
+// all those before it are published
+class lrs_frame_compressor::stream
+{
+public:
+    std::shared_ptr< realdds::dds_video_stream_server > const server;
+
+    std::mutex mutex;
+    uint64_t next_in = 0;   // sequence number of the next frame queued
+    uint64_t next_out = 0;  // sequence number of the next frame to publish
+    std::map< uint64_t, realdds::topics::compressed_image_msg > done;  // out of order, waiting for next_out
+
+    stream( std::shared_ptr< realdds::dds_video_stream_server > const & server_ )
+        : server( server_ )
+    {
+    }
+
+    // Publish, in order, whatever is ready; an invalid image (that failed to compress) is skipped
+    void publish( uint64_t sequence, realdds::topics::compressed_image_msg && image )
+    {
+        std::lock_guard< std::mutex > lock( mutex );
+        done.emplace( sequence, std::move( image ) );
+        while( ! done.empty() && done.begin()->first == next_out )
+        {
+            auto & ready = done.begin()->second;
+            if( ready.is_valid() && server->is_streaming() )
+            {
+                try
+                {
+                    server->publish_image( ready );
+                }
+                catch( std::exception const & e )
+                {
+                    // E.g., the stream stopped while we were compressing
+                    LOG_DEBUG( "failed to publish '" << server->name() << "' image: " << e.what() );
+                }
+            }
+            done.erase( done.begin() );
+            ++next_out;
+        }
+    }
+};
+
+
+namespace {
+
+
+#ifdef RS2_USE_LIBJPEG_TURBO
+
+// libjpeg reports errors by calling error_exit, which must not return
+struct error_handler
+{
+    jpeg_error_mgr mgr;
+    jmp_buf jump;
+};
+
+void on_error( j_common_ptr cinfo )
+{
+    longjmp( reinterpret_cast< error_handler * >( cinfo->err )->jump, 1 );
+}
+
+void on_message( j_common_ptr )
+{
+}
+
+
+// The camera's YUV is limited range (Y in [16,235], chroma in [16,240]); JPEG's is full range
+struct range_expansion
+{
+    uint8_t y[256];
+    uint8_t c[256];
+
+    range_expansion()
+    {
+        for( int i = 0; i < 256; ++i )
+        {
+            auto const luma = std::lround( ( i - 16 ) * 255.f / 219.f );
+            auto const chroma = std::lround( ( i - 128 ) * 255.f / 224.f ) + 128;
+            y[i] = uint8_t( std::min( std::max( luma, 0L ), 255L ) );
+            c[i] = uint8_t( std::min( std::max( chroma, 0L ), 255L ) );
+        }
+    }
+};
+
+
+// Split the 8 rows starting at 'top' (repeating the last row past the bottom) of a YUYV or UYVY image into the
+// planes jpeg_write_raw_data() wants, with each row padded to 'padded_width' by repeating its last pixel
+void split_rows( uint8_t const * pixels, int width, int height, size_t stride, bool uyvy, int top,
+                 JSAMPROW * y_rows, JSAMPROW * cb_rows, JSAMPROW * cr_rows, int padded_width )
+{
+    static range_expansion const lut;
+    int const luma = uyvy ? 1 : 0;
+    int const chroma = 1 - luma;
+    for( int i = 0; i < 8; ++i )
+    {
+        auto src = pixels + size_t( std::min( top + i, height - 1 ) ) * stride;
+        auto y = y_rows[i], cb = cb_rows[i], cr = cr_rows[i];
+        for( int x = 0; x < width; x += 2, src += 4 )
+        {
+            y[x] = lut.y[src[luma]];
+            y[x + 1] = lut.y[src[luma + 2]];
+            cb[x / 2] = lut.c[src[chroma]];
+            cr[x / 2] = lut.c[src[chroma + 2]];
+        }
+        std::fill( y + width, y + padded_width, y[width - 1] );
+        std::fill( cb + width / 2, cb + padded_width / 2, cb[width / 2 - 1] );
+        std::fill( cr + width / 2, cr + padded_width / 2, cr[width / 2 - 1] );
+    }
+}
+
+
+size_t planes_size( int width )
+{
+    return size_t( ( width + 15 ) & ~15 ) * 8 * 2;
+}
+
+
+// Compress into 'out', which libjpeg allocates with malloc() and must be freed (even on failure). YUYV and UYVY are
+// taken as they are, 4:2:2, without going through RGB; 'planes' must have room for planes_size() bytes for them.
+// Nothing with a destructor may live here: errors longjmp() out.
+bool encode_jpeg( uint8_t const * pixels, int width, int height, size_t stride, rs2_format format, int quality,
+                  uint8_t * planes, unsigned char ** out, unsigned long * out_size )
+{
+    jpeg_compress_struct cinfo;
+    error_handler errors;
+    cinfo.err = jpeg_std_error( &errors.mgr );
+    errors.mgr.error_exit = on_error;
+    errors.mgr.output_message = on_message;
+    if( setjmp( errors.jump ) )
+    {
+        jpeg_destroy_compress( &cinfo );
+        return false;
+    }
+
+    jpeg_create_compress( &cinfo );
+    jpeg_mem_dest( &cinfo, out, out_size );
+    cinfo.image_width = JDIMENSION( width );
+    cinfo.image_height = JDIMENSION( height );
+    cinfo.input_components = 3;
+    bool const yuv = format == RS2_FORMAT_YUYV || format == RS2_FORMAT_UYVY;
+    cinfo.in_color_space = yuv ? JCS_YCbCr : format == RS2_FORMAT_BGR8 ? JCS_EXT_BGR : JCS_RGB;
+    jpeg_set_defaults( &cinfo );
+    jpeg_set_quality( &cinfo, quality, TRUE );
+    // A restart marker at the start of every MCU row lets the client decode in parallel bands (see mjpeg_decoder)
+    cinfo.restart_in_rows = 1;
+    if( yuv )
+    {
+        cinfo.raw_data_in = TRUE;
+        cinfo.comp_info[0].h_samp_factor = 2;
+        cinfo.comp_info[0].v_samp_factor = 1;
+        for( int c = 1; c < 3; ++c )
+        {
+            cinfo.comp_info[c].h_samp_factor = 1;
+            cinfo.comp_info[c].v_samp_factor = 1;
+        }
+    }
+    jpeg_start_compress( &cinfo, TRUE );
+
+    if( yuv )
+    {
+        int const padded_width = ( width + 15 ) & ~15;
+        JSAMPROW y_rows[8], cb_rows[8], cr_rows[8];
+        for( int i = 0; i < 8; ++i )
+        {
+            y_rows[i] = planes + size_t( i ) * padded_width * 2;
+            cb_rows[i] = y_rows[i] + padded_width;
+            cr_rows[i] = cb_rows[i] + padded_width / 2;
+        }
+        JSAMPARRAY data[3] = { y_rows, cb_rows, cr_rows };
+        for( int top = 0; top < height; top += 8 )
+        {
+            split_rows( pixels, width, height, stride, format == RS2_FORMAT_UYVY, top,
+                        y_rows, cb_rows, cr_rows, padded_width );
+            jpeg_write_raw_data( &cinfo, data, 8 );
+        }
+    }
+    else
+    {
+        while( cinfo.next_scanline < cinfo.image_height )
+        {
+            JSAMPROW row = const_cast< uint8_t * >( pixels ) + cinfo.next_scanline * stride;
+            jpeg_write_scanlines( &cinfo, &row, 1 );
+        }
+    }
+
+    jpeg_finish_compress( &cinfo );
+    jpeg_destroy_compress( &cinfo );
+    return true;
+}
+
+
+void encode_color( rs2::video_frame const & f, int quality, std::vector< uint8_t > & scratch,
+                   std::vector< uint8_t > & out )
+{
+    auto const format = f.get_profile().format();
+    if( format == RS2_FORMAT_YUYV || format == RS2_FORMAT_UYVY )
+        scratch.resize( planes_size( f.get_width() ) );
+
+    unsigned char * jpeg = nullptr;
+    unsigned long jpeg_size = 0;
+    bool const ok = encode_jpeg( static_cast< uint8_t const * >( f.get_data() ),
+                                 f.get_width(),
+                                 f.get_height(),
+                                 f.get_stride_in_bytes(),
+                                 format,
+                                 quality,
+                                 scratch.data(),
+                                 &jpeg,
+                                 &jpeg_size );
+    if( ok )
+        out.assign( jpeg, jpeg + jpeg_size );
+    free( jpeg );
+    if( ! ok )
+        throw std::runtime_error( "libjpeg failed" );
+}
+
+#else
+
+inline uint8_t clamp( int x )
+{
+    return uint8_t( x < 0 ? 0 : x > 255 ? 255 : x );
+}
+
+
+// Same conversion as the client does for YUYV, on two pixels that share chroma
+inline void yuv_to_rgb( uint8_t y0, uint8_t y1, uint8_t u, uint8_t v, uint8_t * rgb )
+{
+    int const d = int( u ) - 128, e = int( v ) - 128;
+    int const r = 409 * e + 128, g = -100 * d - 208 * e + 128, b = 516 * d + 128;
+    int c = 298 * ( int( y0 ) - 16 );
+    rgb[0] = clamp( ( c + r ) >> 8 );
+    rgb[1] = clamp( ( c + g ) >> 8 );
+    rgb[2] = clamp( ( c + b ) >> 8 );
+    c = 298 * ( int( y1 ) - 16 );
+    rgb[3] = clamp( ( c + r ) >> 8 );
+    rgb[4] = clamp( ( c + g ) >> 8 );
+    rgb[5] = clamp( ( c + b ) >> 8 );
+}
+
+
+// stb writes its output a few bytes at a time
+void append( void * context, void * data, int size )
+{
+    auto & out = *static_cast< std::vector< uint8_t > * >( context );
+    auto const bytes = static_cast< uint8_t const * >( data );
+    out.insert( out.end(), bytes, bytes + size );
+}
+
+
+// stb takes only packed RGB, so anything else goes through 'scratch'
+void encode_color( rs2::video_frame const & f, int quality, std::vector< uint8_t > & scratch,
+                   std::vector< uint8_t > & out )
+{
+    auto const format = f.get_profile().format();
+    int const width = f.get_width(), height = f.get_height();
+    size_t const stride = f.get_stride_in_bytes(), row_size = size_t( width ) * 3;
+    auto const pixels = static_cast< uint8_t const * >( f.get_data() );
+
+    uint8_t const * rgb = pixels;
+    if( format != RS2_FORMAT_RGB8 || stride != row_size )
+    {
+        scratch.resize( row_size * height );
+        for( int y = 0; y < height; ++y )
+        {
+            auto src = pixels + y * stride;
+            auto dst = scratch.data() + y * row_size;
+            switch( format )
+            {
+            case RS2_FORMAT_YUYV:
+                for( int x = 0; x < width; x += 2, src += 4, dst += 6 )
+                    yuv_to_rgb( src[0], src[2], src[1], src[3], dst );
+                break;
+            case RS2_FORMAT_UYVY:
+                for( int x = 0; x < width; x += 2, src += 4, dst += 6 )
+                    yuv_to_rgb( src[1], src[3], src[0], src[2], dst );
+                break;
+            case RS2_FORMAT_BGR8:
+                for( int x = 0; x < width; ++x, src += 3, dst += 3 )
+                {
+                    dst[0] = src[2];
+                    dst[1] = src[1];
+                    dst[2] = src[0];
+                }
+                break;
+            default:
+                std::copy_n( src, row_size, dst );
+                break;
+            }
+        }
+        rgb = scratch.data();
+    }
+
+    out.clear();
+    out.reserve( row_size * height / 8 );
+    if( ! stbi_write_jpg_to_func( append, &out, width, height, 3, rgb, quality ) )
+        throw std::runtime_error( "stb failed to write JPEG" );
+}
+
+#endif
+
+
+void encode_depth( rs2::video_frame const & f, std::vector< uint8_t > & scratch, std::vector< uint8_t > & out )
+{
+    uint32_t const width = f.get_width(), height = f.get_height();
+    scratch.resize( rsutils::codec::depth_encode_bound( width, height ) );
+    auto const size = rsutils::codec::depth_encode( static_cast< uint16_t const * >( f.get_data() ),
+                                                    width,
+                                                    height,
+                                                    f.get_stride_in_bytes(),
+                                                    scratch.data() );
+    out.assign( scratch.data(), scratch.data() + size );
+}
+
+
+}  // namespace
+
+
+lrs_frame_compressor::lrs_frame_compressor( size_t n_threads, int jpeg_quality )
+    : _jpeg_quality( std::min( std::max( jpeg_quality, 1 ), 100 ) )
+    , _pool( n_threads )
+    // Enough to keep a few threads busy on a single stream, plus one waiting
+    , _max_in_flight( std::min( _pool.size(), size_t( 4 ) ) + 1 )
+{
+    _dispatcher = std::thread( [this] { dispatch(); } );
+}
+
+
+lrs_frame_compressor::~lrs_frame_compressor()
+{
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _stopping = true;
+    }
+    _wake.notify_all();
+    _dispatcher.join();
+    // Anything still queued is dropped with _jobs
+}
+
+
+/*static*/ realdds::dds_video_encoding lrs_frame_compressor::compressed_encoding( rs2_stream stream, rs2_format format )
+{
+    switch( stream )
+    {
+    case RS2_STREAM_DEPTH:
+        if( format == RS2_FORMAT_Z16 )
+            return realdds::dds_video_encoding::depth_codec();
+        break;
+    case RS2_STREAM_COLOR:
+        switch( format )
+        {
+        case RS2_FORMAT_YUYV:
+        case RS2_FORMAT_UYVY:
+        case RS2_FORMAT_RGB8:
+        case RS2_FORMAT_BGR8:
+        case RS2_FORMAT_MJPEG:  // already compressed: sent as is
+            return realdds::dds_video_encoding::from_rs2( RS2_FORMAT_MJPEG );
+        default:
+            break;
+        }
+        break;
+    default:
+        break;
+    }
+    return {};
+}
+
+
+std::shared_ptr< lrs_frame_compressor::stream >
+lrs_frame_compressor::add_stream( std::shared_ptr< realdds::dds_video_stream_server > const & server )
+{
+    if( ! server || ! server->is_compressed() )
+        throw std::runtime_error( "stream is not compressed" );
+    return std::make_shared< stream >( server );
+}
+
+
+bool lrs_frame_compressor::compress( std::shared_ptr< stream > const & target,
+                                     rs2::frame f,
+                                     realdds::dds_time const & timestamp )
+{
+    uint64_t sequence;
+    {
+        std::lock_guard< std::mutex > lock( target->mutex );
+        if( target->next_in - target->next_out >= _max_in_flight )
+            return false;
+        sequence = target->next_in++;
+    }
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _jobs.push_back( { target, sequence, std::move( f ), timestamp } );
+    }
+    _wake.notify_one();
+    return true;
+}
+
+
+void lrs_frame_compressor::dispatch()
+{
+    std::vector< job > batch;
+    while( true )
+    {
+        {
+            std::unique_lock< std::mutex > lock( _mutex );
+            _wake.wait( lock, [this] { return _stopping || ! _jobs.empty(); } );
+            if( _stopping )
+                return;
+            // One frame per thread; the rest wait for the next batch
+            while( ! _jobs.empty() && batch.size() < _pool.size() )
+            {
+                batch.push_back( std::move( _jobs.front() ) );
+                _jobs.pop_front();
+            }
+        }
+        // The dispatcher thread takes part, so a pool of 1 compresses right here
+        _pool.parallel_for( batch.size(), [&]( size_t begin, size_t end ) {
+            for( auto i = begin; i < end; ++i )
+                run( batch[i] );
+        } );
+        batch.clear();
+    }
+}
+
+
+void lrs_frame_compressor::run( job & j )
+{
+    // Reused from frame to frame, by each of the pool's threads
+    thread_local std::vector< uint8_t > scratch;
+
+    realdds::topics::compressed_image_msg image;
+    try
+    {
+        auto const video = j.frame.as< rs2::video_frame >();
+        if( j.frame.get_profile().format() == RS2_FORMAT_Z16 )
+            encode_depth( video, scratch, image.raw().data() );
+        else
+            encode_color( video, _jpeg_quality, scratch, image.raw().data() );
+        image.set_timestamp( j.timestamp );
+    }
+    catch( std::exception const & e )
+    {
+        LOG_ERROR( "failed to compress '" << j.target->server->name() << "' frame: " << e.what() );
+        image.invalidate();
+    }
+    // Give the frame back to librealsense before we (maybe) wait on the stream
+    j.frame = rs2::frame();
+
+    j.target->publish( j.sequence, std::move( image ) );
+}
+
+
+}  // namespace tools
@@ -0,0 +1,78 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+#pragma once
+
+#include <librealsense2/rs.hpp>  // Include RealSense Cross Platform API
+#include <realdds/dds-defines.h>
+#include <realdds/dds-stream-profile.h>
+#include <rsutils/concurrency/worker-pool.h>
+#include <fastdds/rtps/common/Time_t.h>
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+
+namespace realdds {
+class dds_video_stream_server;
+}  // namespace realdds
+
+
+namespace tools {
+
+
+// Compresses frames for streams that are sent compressed (see dds_stream_base::is_compressed()), and publishes them:
+//     - Depth (Z16) losslessly, with rsutils::codec (see depth_codec())
+//     - Color as JPEG
+//
+// Compression takes too long to do in the sensor callback, where it would hold up the next frame, so it is done on a
+// worker pool shared by all streams: a dispatcher thread takes whatever frames are queued, as many as there are
+// threads in the pool, and compresses them in parallel. Frames of the same stream are published in the order they
+// came in, even if they finish out of order. A stream that has too many frames in flight drops new ones, rather than
+// falling further and further behind.
+//
+class lrs_frame_compressor
+{
+public:
+    class stream;
+
+    // With 0 threads, uses as many as there are cores
+    lrs_frame_compressor( size_t n_threads, int jpeg_quality );
+    ~lrs_frame_compressor();
+
+    // The encoding we'd send frames of this type and format as, or an empty encoding if we cannot compress them
+    static realdds::dds_video_encoding compressed_encoding( rs2_stream, rs2_format );
+
+    std::shared_ptr< stream > add_stream( std::shared_ptr< realdds::dds_video_stream_server > const & );
+
+    // Queue a frame for compression and publishing. Returns false if the frame is dropped because the stream already
+    // has too many in flight.
+    bool compress( std::shared_ptr< stream > const &, rs2::frame, realdds::dds_time const & );
+
+private:
+    struct job
+    {
+        std::shared_ptr< stream > target;
+        uint64_t sequence;
+        rs2::frame frame;
+        realdds::dds_time timestamp;
+    };
+
+    void dispatch();
+    void run( job & );
+
+    int const _jpeg_quality;
+    rsutils::concurrency::worker_pool _pool;
+    size_t const _max_in_flight;  // per stream
+
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    std::deque< job > _jobs;
+    bool _stopping = false;
+    std::thread _dispatcher;
+};  // class lrs_frame_compressor
+
+
+}  // namespace tools
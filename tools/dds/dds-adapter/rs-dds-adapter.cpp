@@ -133,9 +133,16 @@ try
 {
     using cli = rs2::cli_no_dds;  // no --eth, --no-eth, --eth-only, --domain-id
     cli::value< dds_domain_id > domain_arg( "domain-id", "0-232", 0, "Select domain ID to publish on" );
+    cli::flag compress_arg( "compress", "Send depth losslessly compressed, and color as JPEG" );
+    cli::value< int > jpeg_quality_arg( "jpeg-quality", "1-100", 90, "JPEG quality of color, with --compress" );
+    cli::value< size_t > compress_threads_arg( "compress-threads", "number", 0,
+                                               "Threads to compress with, with --compress; 0 for one per core" );
     cli cmd( "librealsense rs-dds-adapter tool: use USB devices as network devices" );
     auto settings = cmd  // in order we want listed:
         .arg( domain_arg )
+        .arg( compress_arg )
+        .arg( jpeg_quality_arg )
+        .arg( compress_threads_arg )
         .process( argc, argv );
 
     // Configure the same logger as librealsense
@@ -162,6 +169,19 @@ try
 
     std::cout << "Starting RS DDS Adapter on domain " << domain << " ..." << std::endl;
 
+    // Compression happens on threads shared by all devices
+    std::shared_ptr< tools::lrs_frame_compressor > compressor;
+    if( compress_arg.isSet() )
+    {
+        auto const jpeg_quality = jpeg_quality_arg.getValue();
+        if( jpeg_quality < 1 || jpeg_quality > 100 )
+        {
+            std::cerr << "Invalid JPEG quality, enter a value in the range [1, 100]" << std::endl;
+            return EXIT_FAILURE;
+        }
+        compressor = std::make_shared< tools::lrs_frame_compressor >( compress_threads_arg.getValue(), jpeg_quality );
+    }
+
     // Create a DDS participant
     auto participant = std::make_shared< dds_participant >();
     {
@@ -258,7 +278,7 @@ try
                 = std::make_shared< realdds::dds_device_server >( participant, dev_info.topic_root() );
  
             // Create a lrs_device_manager for this device
-            auto lrs_device_controller = std::make_shared< tools::lrs_device_controller >( dev, dds_device_server );
+            auto lrs_device_controller = std::make_shared< tools::lrs_device_controller >( dev, dds_device_server, compressor );
 
             if( ! dev_info.serial_number().empty() )
                 lrs_device_controller->initialize_ros2_node_entities(
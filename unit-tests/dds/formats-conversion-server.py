@@ -84,6 +84,18 @@ def create_server():
     stream_server.init_profiles( profiles, 0 )
     stream_servers.append( stream_server )
 
+    # JPEG
+    profile = dds.video_stream_profile( 30, dds.video_encoding.jpeg, 1280, 720 )
+    stream_server = dds.color_stream_server( "JPEG-stream", "JPEG-sensor" )
+    stream_server.init_profiles( [ profile ], 0 )
+    stream_servers.append( stream_server )
+
+    # Compressed depth
+    profile = dds.video_stream_profile( 30, dds.video_encoding.depth_codec, 1280, 720 )
+    stream_server = dds.depth_stream_server( "compressed-depth-stream", "compressed-depth-sensor" )
+    stream_server.init_profiles( [ profile ], 0 )
+    stream_servers.append( stream_server )
+
     # multiple depth profiles
     profiles = []
     profiles.append( dds.video_stream_profile( 5, dds.video_encoding.z16, 1280, 720 ) )
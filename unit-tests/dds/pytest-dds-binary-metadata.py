@@ -0,0 +1,175 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+# Disabled under Linux, same as pytest-dds-metadata (see there)
+
+import pytest
+import logging
+import platform
+import threading
+from time import sleep
+import pyrealdds as dds
+from rspy import test, config_file
+import rspy.log
+import d435i
+from pytest_check import check
+
+log = logging.getLogger(__name__)
+
+pytestmark = [
+    pytest.mark.dds,
+    pytest.mark.flaky( retries=2 ),
+    pytest.mark.skipif( platform.system() == 'Linux', reason='see pytest-dds-metadata' ),
+]
+
+SCHEMA = [ 'Temperature', 'Not A Real Field', 'White Balance' ]
+
+if rspy.log.nested is not None:
+    dds.debug( log.isEnabledFor( logging.DEBUG ), rspy.log.nested )
+
+    participant = dds.participant()
+    participant.init( config_file.get_domain_from_config_file_or_default(), "server" )
+
+    device_server = dds.device_server( participant, d435i.device_info.topic_root )
+
+    depth_stream = dds.depth_stream_server( 'Depth', 'Depth Module' )
+    depth_stream.enable_metadata( SCHEMA )  # with a schema, clients will read binary metadata
+    depth_stream.init_profiles( d435i.depth_stream_profiles(), 0 )
+    depth_stream.init_options( [] )
+
+    def on_control( server, id, control, reply ):
+        return True
+
+    device_server.on_control( on_control )
+    device_server.init( [depth_stream], [], {} )
+
+    def broadcast():
+        device_server.broadcast( d435i.device_info )
+
+    def new_image( width, height, bpp ):
+        i = dds.message.image()
+        i.width = width
+        i.height = height
+        i.data = bytearray( width * height * bpp )
+        return i
+
+    def publish_image( img, timestamp ):
+        img.timestamp = timestamp
+        depth_stream.publish_image( img )
+
+    def publish_binary_metadata( timestamp_as_ns, frame_number, values, stream_name='Depth' ):
+        md = dds.message.binary_metadata()
+        md.reset( len( SCHEMA ) )
+        md.stream_name = stream_name
+        if frame_number is not None:
+            md.frame_number = frame_number
+        md.timestamp = timestamp_as_ns
+        for i, value in values.items():
+            md.set( i, value )
+        device_server.publish_metadata( md )
+
+else:
+    ###############################################################################################################
+    # The client
+    #
+    log.nested = 'C  '
+
+    @pytest.fixture(scope='module')
+    def remote_and_device():
+        with test.remote.fork( script=__file__, nested_indent='  S' ) as remote:
+            participant = dds.participant()
+            participant.init( config_file.get_domain_from_config_file_or_default(), "client" )
+
+            device_direct = dds.device( participant, d435i.device_info )
+            device_direct.wait_until_ready()
+            assert device_direct.is_ready()
+            try:
+                yield remote, device_direct
+            finally:
+                del device_direct, participant
+
+    def test_schema_in_stream_header( remote_and_device ):
+        remote, device_direct = remote_and_device
+        check.is_true( device_direct.supports_binary_metadata() )
+        for stream in device_direct.streams():
+            check.equal( stream.metadata_schema(), SCHEMA )
+
+    def test_binary_to_json( remote_and_device ):
+        remote, device_direct = remote_and_device
+
+        # JSON subscribers still get JSON, converted from the binary message using the schema
+        received = threading.Event()
+        content = []
+        def on_metadata_available( device, md ):
+            content.append( md )
+            received.set()
+        subscription = device_direct.on_metadata_available( on_metadata_available )
+
+        remote.run( 'publish_binary_metadata( 123456789, 42, { 0: 0xbaad, 1: -7 } )' )
+        assert received.wait( 1 ), 'timeout waiting for metadata'
+        check.equal( content[0], {
+            'stream-name': 'Depth',
+            'header': { 'frame-number': 42, 'timestamp': 123456789 },
+            'metadata': { 'Temperature': 0xbaad, 'Not A Real Field': -7 }
+            } )
+
+        # Without a frame number, there's none in the header either
+        received.clear()
+        remote.run( 'publish_binary_metadata( 123456790, None, {} )' )
+        assert received.wait( 1 ), 'timeout waiting for metadata'
+        check.equal( content[1]['header'], { 'timestamp': 123456790 } )
+        del subscription
+
+    def test_stream_name_too_long( remote_and_device ):
+        remote, _ = remote_and_device
+        # The name's length is a single byte: longer names can't be sent, rather than be cut short
+        with pytest.raises( test.remote.Error ):
+            remote.run( 'publish_binary_metadata( 1, 1, {}, "D" * 256 )' )
+        remote.run( 'publish_binary_metadata( 1, 1, {}, "D" * 255 )' )
+
+    def test_librs_frames( remote_and_device ):
+        remote, device_direct = remote_and_device
+        remote.run( 'broadcast()' )
+
+        from rspy import librs as rs
+        if log.isEnabledFor( logging.DEBUG ):
+            rs.log_to_console( rs.log_severity.debug )
+        context = rs.context( { 'dds': { 'enabled': True, 'domain': config_file.get_domain_from_config_file_or_default() }} )
+        device = rs.wait_for_devices( context, rs.only_sw_devices, n=1. )
+        sensor = device.sensors[0]
+        profile = rs.video_stream_profile( sensor.get_stream_profiles()[0] )
+        encoding = dds.video_encoding.from_rs2( profile.format() )
+        YUYV_BPP = 2
+        remote.run( f'img = new_image( {profile.width()}, {profile.height()}, {YUYV_BPP} )', on_fail='abort' )
+        sensor.open( [profile] )
+        queue = rs.frame_queue( 100 )
+        sensor.start( queue )
+        try:
+            remote.run( f'depth_stream.start_streaming( dds.video_encoding( "{encoding}" ), img.width, img.height )' )
+
+            # Fields are mapped by name: the unknown one is dropped, the rest land where librs expects them
+            timestamp = dds.now()
+            remote.run( f'publish_binary_metadata( {timestamp.to_ns()}, 1234, {{ 0: 0xf00d, 1: 5, 2: 6500 }} )' )
+            sleep( 0.25 )
+            check.is_false( queue.poll_for_frame() )  # no image yet
+            remote.run( f'publish_image( img, dds.time.from_ns( {timestamp.to_ns()} ))' )
+            f = queue.wait_for_frame( 1000 )
+            if check.is_true( f ) and check.equal( f.get_frame_number(), 1234 ):
+                if check.is_true( f.supports_frame_metadata( rs.frame_metadata_value.temperature ) ):
+                    check.equal( f.get_frame_metadata( rs.frame_metadata_value.temperature ), 0xf00d )
+                if check.is_true( f.supports_frame_metadata( rs.frame_metadata_value.white_balance ) ):
+                    check.equal( f.get_frame_metadata( rs.frame_metadata_value.white_balance ), 6500 )
+                check.is_false( f.supports_frame_metadata( rs.frame_metadata_value.actual_fps ) )
+
+            # Zero is a frame number like any other, not a missing one to count on from the last
+            timestamp = dds.now()
+            remote.run( f'publish_binary_metadata( {timestamp.to_ns()}, 0, {{}} )' )
+            sleep( 0.25 )
+            remote.run( f'publish_image( img, dds.time.from_ns( {timestamp.to_ns()} ))' )
+            f = queue.wait_for_frame( 1000 )
+            if check.is_true( f ):
+                check.equal( f.get_frame_number(), 0 )
+        finally:
+            remote.run( 'depth_stream.stop_streaming()', on_fail='log' )
+            sensor.stop()
+            sensor.close()
@@ -0,0 +1,139 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+# Images written from a data view (straight from someone else's buffer, as the adapter does with librealsense frames)
+# are serialized by our own code rather than the generated type's: readers must not be able to tell them apart from
+# images written from their data. And, because that's what the data view is for, the same over shared memory.
+
+import pytest
+import logging
+import platform
+import queue
+from glob import glob
+from rspy import test, config_file
+import rspy.log
+from pytest_check import check
+
+log = logging.getLogger(__name__)
+
+pytestmark = [
+    pytest.mark.dds,
+    pytest.mark.flaky( retries=2 ),
+]
+
+TOPIC = 'realsense/test-image-data-view'
+W = 640
+H = 480
+BPP = 2
+# Bigger than a UDP message, so it has to be fragmented when not over shared memory
+PIXELS = bytes( ( i * 7 + i // ( W * BPP ) ) % 256 for i in range( W * H * BPP ) )
+
+SETTINGS = [
+    {},
+    { 'shm': True },
+    { 'shm': { 'segment-size': 8 * 1024 * 1024, 'port-queue-capacity': 64 } },
+]
+
+
+def domain():
+    return config_file.get_domain_from_config_file_or_default()
+
+
+if rspy.log.nested is not None:
+    import pyrealdds as dds
+
+    dds.debug( log.isEnabledFor( logging.DEBUG ), rspy.log.nested )
+
+    participant = None
+    writer = None
+
+    def start( settings ):
+        global participant, writer
+        writer = None
+        participant = dds.participant()
+        participant.init( domain(), 'server', settings )
+        writer = dds.topic_writer( dds.message.image.create_topic( participant, TOPIC ) )
+        writer.run( dds.topic_writer.qos() )
+
+    def new_image( frame_id ):
+        image = dds.message.image()
+        image.width = W
+        image.height = H
+        image.step = W * BPP
+        image.encoding = '16UC1'
+        image.frame_id = frame_id
+        image.timestamp = dds.time.from_ns( 1234567890123 )
+        return image
+
+    def write_data():
+        image = new_image( 'data' )
+        image.data = bytearray( PIXELS )
+        image.write_to( writer )
+
+    def write_view():
+        new_image( 'view' ).write_to( writer, PIXELS )
+
+    def write_both():
+        image = new_image( 'both' )
+        image.data = bytearray( PIXELS )
+        image.write_to( writer, PIXELS )
+
+else:
+    ###############################################################################################################
+    # The client
+    #
+    import pyrealdds as dds
+
+    log.nested = 'C  '
+    dds.debug( log.isEnabledFor( logging.DEBUG ), log.nested )
+
+    @pytest.fixture(scope='module')
+    def remote():
+        with test.remote.fork( script=__file__, nested_indent='  S' ) as remote:
+            yield remote
+
+    def shm_files():
+        return set( glob( '/dev/shm/fast*' ) )
+
+    @pytest.mark.parametrize( 'settings', SETTINGS, ids=['udp', 'shm', 'shm-settings'] )
+    def test_data_view( remote, settings ):
+        shm_before = shm_files()
+        participant = dds.participant()
+        participant.init( domain(), 'client', settings )
+        if platform.system() == 'Linux':
+            # Both sides need shared memory on for it to be used: ours has to have been created
+            check.equal( bool( shm_files() - shm_before ), 'shm' in settings )
+
+        images = queue.Queue()
+        def on_data_available( reader ):
+            while True:
+                image = dds.message.image.take_next( reader )
+                if not image:
+                    break
+                images.put( image )
+        reader = dds.topic_reader( dds.message.image.create_topic( participant, TOPIC ) )
+        reader.on_data_available( on_data_available )
+        reader.run( dds.topic_reader.qos() )
+
+        remote.run( f'start( {settings!r} )' )
+        try:
+            assert reader.wait_for_writers( dds.time( 3. ) )
+            remote.run( 'assert writer.wait_for_readers( dds.time( 3. ) )' )
+
+            for frame_id in ( 'data', 'view' ):
+                remote.run( f'write_{frame_id}()' )
+                image = images.get( timeout=3 )
+                check.equal( image.frame_id, frame_id )
+                check.equal( ( image.width, image.height, image.step ), ( W, H, W * BPP ) )
+                check.equal( image.encoding, '16UC1' )
+                check.is_false( image.is_bigendian )
+                check.equal( image.timestamp.to_ns(), 1234567890123 )
+                check.equal( bytes( image.data ), PIXELS )
+
+            # Sending both would be sending the pixels twice
+            with pytest.raises( test.remote.Error ):
+                remote.run( 'write_both()' )
+            check.is_true( images.empty() )
+        finally:
+            remote.run( 'writer = participant = None', on_fail='log' )
+            del reader, participant
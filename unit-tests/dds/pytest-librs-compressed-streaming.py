@@ -0,0 +1,169 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+# Tests compressed streams end to end, as rs-dds-adapter --compress sends them:
+#   - Server publishes a depth-codec image on a depth stream, and a JPEG on a color stream
+#   - Client uses pyrealsense2 (LibRS), which decodes them as they arrive, to Z16 and RGB8
+
+import pytest
+import logging
+import struct
+import base64
+from rspy import test, config_file
+import rspy.log
+from pytest_check import check
+
+log = logging.getLogger(__name__)
+
+pytestmark = [
+    pytest.mark.dds,
+    pytest.mark.flaky( retries=2 ),
+]
+
+W = 32
+H = 24
+
+# Depth with a gradient, holes, and values over the whole 16-bit range
+depth_pixels = [0 if x % 7 == 3 else ( 1000 + 37 * x + 101 * y ) if y < H - 2 else 0xFFFF - x
+                for y in range( H ) for x in range( W )]
+
+# A 32x24 JPEG, all of it the same color (200,100,50), so it decodes to within a few levels of that everywhere
+color_rgb = ( 200, 100, 50 )
+color_jpeg = base64.b64decode(
+    '/9j/4AAQSkZJRgABAQAAAQABAAD/2wCEAAMCAgMCAgMDAwMEAwMEBQgFBQQEBQoHBwYIDAoMDAsKCwsNDhIQDQ4RDgsLEBYQERMUFRUVDA8XGBYU'
+    'GBIUFRQBAwQEBQQFCQUFCRQNCw0UFBQUFBQUFBQUFBQUFBQUFBQUFBQUFBQUFBQUFBQUFBQUFBQUFBQUFBQUFBQUFBQUFP/AABEIABgAIAMBEQAC'
+    'EQEDEQH/xAGiAAABBQEBAQEBAQAAAAAAAAAAAQIDBAUGBwgJCgsQAAIBAwMCBAMFBQQEAAABfQECAwAEEQUSITFBBhNRYQcicRQygZGhCCNCscEV'
+    'UtHwJDNicoIJChYXGBkaJSYnKCkqNDU2Nzg5OkNERUZHSElKU1RVVldYWVpjZGVmZ2hpanN0dXZ3eHl6g4SFhoeIiYqSk5SVlpeYmZqio6Slpqeo'
+    'qaqys7S1tre4ubrCw8TFxsfIycrS09TV1tfY2drh4uPk5ebn6Onq8fLz9PX29/j5+gEAAwEBAQEBAQEBAQAAAAAAAAECAwQFBgcICQoLEQACAQIE'
+    'BAMEBwUEBAABAncAAQIDEQQFITEGEkFRB2FxEyIygQgUQpGhscEJIzNS8BVictEKFiQ04SXxFxgZGiYnKCkqNTY3ODk6Q0RFRkdISUpTVFVWV1hZ'
+    'WmNkZWZnaGlqc3R1dnd4eXqCg4SFhoeIiYqSk5SVlpeYmZqio6Slpqeoqaqys7S1tre4ubrCw8TFxsfIycrS09TV1tfY2dri4+Tl5ufo6ery8/T1'
+    '9vf4+fr/2gAMAwEAAhEDEQA/AKtfh5/SAUAFABQAUAFABQAUAFABQAUAFAH/2Q==' )
+
+if rspy.log.nested is not None:
+    import pyrealdds as dds
+    import pyrsutils as rsutils
+
+    dds.debug( log.isEnabledFor( logging.DEBUG ), rspy.log.nested )
+
+    participant = dds.participant()
+    participant.init( config_file.get_domain_from_config_file_or_default(), 'server' )
+
+    device_info = dds.message.device_info.from_json( {
+        "name": "Test Compressed Device",
+        "topic-root": "realsense/test-librs-compressed-streaming",
+        "product-line": "D400"
+    } )
+
+    depth = dds.depth_stream_server( 'Depth', 'Stereo Module' )
+    depth.init_profiles( [dds.video_stream_profile( 30, dds.video_encoding.depth_codec, W, H )], 0 )
+    depth.init_options( [] )
+
+    color = dds.color_stream_server( 'Color', 'RGB Camera' )
+    color.init_profiles( [dds.video_stream_profile( 30, dds.video_encoding.jpeg, W, H )], 0 )
+    color.init_options( [] )
+
+    server = dds.device_server( participant, device_info.topic_root )
+    server.on_control( lambda srv, id, control, reply: True )  # accept open-streams and other controls
+    server.init( [depth, color], [], {} )
+
+    server.broadcast( device_info )
+
+    def start_streaming():
+        depth.start_streaming( dds.video_encoding.depth_codec, W, H )
+        color.start_streaming( dds.video_encoding.jpeg, W, H )
+
+    def stop_streaming():
+        depth.stop_streaming()
+        color.stop_streaming()
+
+    def publish( stream, data, timestamp_as_ns ):
+        image = dds.message.compressed_image()
+        image.data = data
+        image.timestamp = dds.time.from_ns( timestamp_as_ns )
+        stream.publish_image( image )
+
+    def publish_depth():
+        publish( depth, rsutils.depth_encode( depth_pixels, W, H ), 1000000 )
+
+    def publish_color():
+        publish( color, color_jpeg, 2000000 )
+
+else:
+    ###############################################################################################################
+    # The client is LibRS
+    #
+    from rspy import librs as rs
+    if log.isEnabledFor( logging.DEBUG ):
+        rs.log_to_console( rs.log_severity.debug )
+
+    @pytest.fixture(scope='module')
+    def remote_and_streaming():
+        with test.remote.fork( script=__file__, nested_indent=None ) as remote:
+            context = rs.context( {
+                'dds': {
+                    'enabled': True,
+                    'domain': config_file.get_domain_from_config_file_or_default()
+                }
+            } )
+
+            devs = rs.wait_for_devices( context, rs.only_sw_devices, n=1 )
+            dev = next( (d for d in devs if d.get_info( rs.camera_info.name ) == 'Test Compressed Device'), None )
+            assert dev is not None, 'Test Compressed Device not found among SW devices'
+            sensors = { s.get_info( rs.camera_info.name ) : s for s in dev.query_sensors() }
+
+            # Decoded on arrival: what the user sees are the plain formats
+            depth_sensor = sensors['Stereo Module']
+            depth_profile = next( p for p in depth_sensor.get_stream_profiles() if p.format() == rs.format.z16 )
+            color_sensor = sensors['RGB Camera']
+            color_profile = next( p for p in color_sensor.get_stream_profiles() if p.format() == rs.format.rgb8 )
+
+            depth_queue = rs.frame_queue( 10 )
+            depth_sensor.open( [depth_profile] )
+            depth_sensor.start( depth_queue )
+            color_queue = rs.frame_queue( 10 )
+            color_sensor.open( [color_profile] )
+            color_sensor.start( color_queue )
+
+            remote.run( 'start_streaming()' )
+
+            try:
+                yield remote, depth_queue, color_queue
+            finally:
+                remote.run( 'stop_streaming()', on_fail='log' )
+                for sensor in ( depth_sensor, color_sensor ):
+                    sensor.stop()
+                    sensor.close()
+                del depth_queue, color_queue
+                del depth_sensor, color_sensor
+                del dev
+                del context
+
+    #
+    #############################################################################################
+    #
+    def test_depth_codec(remote_and_streaming):
+        remote, depth_queue, _ = remote_and_streaming
+        remote.run( 'publish_depth()' )
+        f = depth_queue.wait_for_frame( 1000 )
+        if check.is_true( f, msg='no depth frame received' ):
+            check.equal( f.get_profile().format(), rs.format.z16 )
+            vf = f.as_video_frame()
+            check.equal( ( vf.get_width(), vf.get_height() ), ( W, H ) )
+            # Lossless: every pixel as it was sent
+            check.equal( bytes( vf.get_data() ), struct.pack( '<%dH' % len( depth_pixels ), *depth_pixels ) )
+
+    #
+    #############################################################################################
+    #
+    def test_jpeg(remote_and_streaming):
+        remote, _, color_queue = remote_and_streaming
+        remote.run( 'publish_color()' )
+        f = color_queue.wait_for_frame( 1000 )
+        if check.is_true( f, msg='no color frame received' ):
+            check.equal( f.get_profile().format(), rs.format.rgb8 )
+            vf = f.as_video_frame()
+            check.equal( ( vf.get_width(), vf.get_height() ), ( W, H ) )
+            data = bytes( vf.get_data() )
+            if check.equal( len( data ), W * H * 3 ):
+                worst = max( abs( data[i] - color_rgb[i % 3] ) for i in range( len( data ) ) )
+                check.less_equal( worst, 3 )
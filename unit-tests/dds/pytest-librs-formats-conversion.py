@@ -104,6 +104,32 @@ def test_z16_conversion(remote_and_sensors):
 #
 #############################################################################################
 #
+def test_jpeg_conversion(remote_and_sensors):
+    _, _, sensors = remote_and_sensors
+    if check.is_true( 'JPEG-sensor' in sensors ):
+        sensor = sensors.get('JPEG-sensor')
+        profiles = sensor.get_stream_profiles()
+
+        # JPEG is decoded on arrival, to any of these
+        check.equal( sorted( str( p.format() ) for p in profiles ),
+                     sorted( str( f ) for f in ( rs.format.rgb8, rs.format.bgr8, rs.format.rgba8, rs.format.y8 ) ) )
+        for p in profiles:
+            check.equal( p.stream_type(), rs.stream.color )
+#
+#############################################################################################
+#
+def test_compressed_depth_conversion(remote_and_sensors):
+    _, _, sensors = remote_and_sensors
+    if check.is_true( 'compressed-depth-sensor' in sensors ):
+        sensor = sensors.get('compressed-depth-sensor')
+        profiles = sensor.get_stream_profiles()
+
+        check.equal( len( profiles ), 1 ) # Decoded on arrival: the user sees plain Z16
+        check.equal( profiles[0].format(), rs.format.z16 )
+        check.equal( profiles[0].stream_type(), rs.stream.depth )
+#
+#############################################################################################
+#
 def test_motion_conversion(remote_and_sensors):
     _, _, sensors = remote_and_sensors
     if check.is_true( 'motion-sensor' in sensors ):
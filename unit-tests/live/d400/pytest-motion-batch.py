@@ -0,0 +1,62 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+import pytest
+import platform
+import pyrealsense2 as rs
+from pytest_check import check
+import logging
+log = logging.getLogger(__name__)
+import time
+
+pytestmark = [
+    pytest.mark.device_each("D455"),
+    pytest.mark.skipif(platform.system() != "Linux", reason="HID batching is fed by the IIO backend"),
+]
+
+
+def stream_gyro(sensor, seconds):
+    frames = []
+    profile = next(p for p in sensor.profiles if p.stream_type() == rs.stream.gyro and p.fps() == 400)
+    sensor.open(profile)
+    sensor.start(lambda f: frames.append(f.as_motion_frame()))
+    try:
+        time.sleep(seconds)
+    finally:
+        sensor.stop()
+        sensor.close()
+    return frames
+
+
+def test_motion_batch(test_device):
+    dev, _ = test_device
+    sensor = dev.first_motion_sensor()
+    if not sensor.supports(rs.option.motion_batch_window):
+        pytest.skip("motion batching not supported")
+
+    sensor.set_option(rs.option.motion_batch_window, 0)
+    single = stream_gyro(sensor, 2)
+    assert single
+    check.is_true(all(not f.get_samples() for f in single))
+
+    sensor.set_option(rs.option.motion_batch_window, 20)
+    try:
+        batches = stream_gyro(sensor, 2)
+    finally:
+        sensor.set_option(rs.option.motion_batch_window, 0)
+    assert batches
+    samples = [s for f in batches for s in f.get_samples()]
+    check.is_true(all(f.get_samples() for f in batches))
+    # Far fewer frames, but about as many samples
+    check.less(len(batches) * 3, len(single))
+    check.greater(len(samples), len(single) * 0.8)
+
+    for f in batches:
+        first_data, first_ts, first_number = f.get_samples()[0]
+        check.equal(f.get_frame_number(), first_number)
+        check.equal(f.get_timestamp(), first_ts)
+        check.equal(f.get_motion_data().x, first_data.x)
+    numbers = [n for _, _, n in samples]
+    check.equal(numbers, sorted(numbers))
+    timestamps = [ts for _, ts, _ in samples]
+    check.equal(timestamps, sorted(timestamps))
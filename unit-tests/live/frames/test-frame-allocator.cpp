@@ -0,0 +1,165 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#test:device D400*
+
+// Streams depth into memory from a user frame allocator, set on the sensor (rs2_set_frame_allocator) or on the
+// pipeline config (rs2_config_set_frame_allocator_cpp). Every block handed out has to come back, and frames still
+// arrive when the allocator has no memory to give.
+
+#include "../live-common.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+
+using namespace rs2;
+
+
+namespace {
+
+
+struct user_memory
+{
+    std::mutex mutex;
+    bool out_of_memory = false;
+    int allocations = 0;
+    int frees = 0;
+    std::map< void const *, uint8_t * > live;  // returned pointer -> block
+
+    void * allocate( int size, int alignment )
+    {
+        std::lock_guard< std::mutex > lock( mutex );
+        if( out_of_memory )
+            return nullptr;
+        ++allocations;
+        auto block = new uint8_t[size + alignment];
+        auto p = block;
+        if( alignment )
+            p += alignment - reinterpret_cast< uintptr_t >( p ) % alignment;
+        live[p] = block;
+        return p;
+    }
+
+    void free( void * data, int )
+    {
+        std::lock_guard< std::mutex > lock( mutex );
+        auto it = live.find( data );
+        if( it == live.end() )
+            return;  // caught by the allocations == frees checks
+        delete[] it->second;
+        live.erase( it );
+        ++frees;
+    }
+
+    bool owns( void const * data )
+    {
+        std::lock_guard< std::mutex > lock( mutex );
+        return live.count( data ) != 0;
+    }
+
+    static void * allocate_ptr( int size, int alignment, void * user )
+    {
+        return static_cast< user_memory * >( user )->allocate( size, alignment );
+    }
+
+    static void free_ptr( void * data, int size, void * user )
+    {
+        static_cast< user_memory * >( user )->free( data, size );
+    }
+};
+
+
+// Streams until 'n' frames arrived, and returns how many of them were in user memory
+int stream_depth( sensor & depth_sensor, stream_profile const & profile, user_memory & memory, int n = 10 )
+{
+    std::mutex m;
+    std::condition_variable cv;
+    int frames = 0, in_user_memory = 0;
+
+    depth_sensor.open( profile );
+    depth_sensor.start( [&]( frame f ) {
+        std::lock_guard< std::mutex > lock( m );
+        if( frames == n )
+            return;
+        ++frames;
+        if( memory.owns( f.get_data() ) )
+            ++in_user_memory;
+        CHECK( f.get_data_size() >= f.as< video_frame >().get_stride_in_bytes() * f.as< video_frame >().get_height() );
+        cv.notify_one();
+    } );
+    {
+        std::unique_lock< std::mutex > lock( m );
+        CHECK( cv.wait_for( lock, std::chrono::seconds( 10 ), [&] { return frames == n; } ) );
+    }
+    depth_sensor.stop();
+    depth_sensor.close();
+    return in_user_memory;
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "rs2_set_frame_allocator", "[live][frame-allocator]" )
+{
+    auto dev = find_devices_by_product_line_or_exit( RS2_PRODUCT_LINE_DEPTH )[0];
+    auto depth_sensor = dev.first< rs2::depth_sensor >();
+    auto profile = find_default_depth_profile( depth_sensor );
+
+    user_memory memory;
+    rs2_error * e = nullptr;
+    rs2_set_frame_allocator( depth_sensor.get().get(), user_memory::allocate_ptr, user_memory::free_ptr, 64, &memory, &e );
+    error::handle( e );
+
+    CHECK( stream_depth( depth_sensor, profile, memory ) == 10 );
+    CHECK( memory.allocations > 0 );
+    CHECK( memory.allocations == memory.frees );
+
+    // Nothing from the allocator: frames still arrive, in internal memory
+    memory.out_of_memory = true;
+    CHECK( stream_depth( depth_sensor, profile, memory ) == 0 );
+    memory.out_of_memory = false;
+
+    // Back to the default allocator
+    rs2_set_frame_allocator( depth_sensor.get().get(), nullptr, nullptr, 0, nullptr, &e );
+    error::handle( e );
+    auto const allocations = memory.allocations;
+    CHECK( stream_depth( depth_sensor, profile, memory ) == 0 );
+    CHECK( memory.allocations == allocations );
+    CHECK( memory.allocations == memory.frees );
+
+    // Not a power of 2
+    rs2_set_frame_allocator( depth_sensor.get().get(), user_memory::allocate_ptr, user_memory::free_ptr, 48, &memory, &e );
+    CHECK( e );
+    rs2_free_error( e );
+}
+
+TEST_CASE( "rs2_config_set_frame_allocator_cpp", "[live][frame-allocator]" )
+{
+    find_devices_by_product_line_or_exit( RS2_PRODUCT_LINE_DEPTH );
+
+    user_memory memory;
+    {
+        rs2::config cfg;
+        cfg.enable_stream( RS2_STREAM_DEPTH );
+        cfg.set_frame_allocator( [&]( int size, int alignment ) { return memory.allocate( size, alignment ); },
+                                 [&]( void * data, int size ) { memory.free( data, size ); },
+                                 64 );
+
+        rs2::pipeline pipe;
+        pipe.start( cfg );
+        for( int i = 0; i < 10; ++i )
+        {
+            auto depth = pipe.wait_for_frames().get_depth_frame();
+            REQUIRE( depth );
+            CHECK( memory.owns( depth.get_data() ) );
+            CHECK( reinterpret_cast< uintptr_t >( depth.get_data() ) % 64 == 0 );
+        }
+        pipe.stop();
+    }
+    CHECK( memory.allocations > 0 );
+    CHECK( memory.allocations == memory.frees );
+}
@@ -0,0 +1,278 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+# Records to .mcap and plays back. The file is also parsed here, independently of librealsense, to check it is
+# valid MCAP: magic, footer, summary CRC, chunk index pointing at the chunks and message indexes pointing at the
+# messages in them. And it is read with the official mcap package, as other tools would.
+
+import logging
+import struct
+import time
+import zlib
+
+import numpy as np
+import pytest
+import pyrealsense2 as rs
+import zstandard as zstd
+from mcap.reader import make_reader
+from mcap.stream_reader import StreamReader
+
+log = logging.getLogger(__name__)
+
+pytestmark = [
+    pytest.mark.device("D400*"),
+]
+
+W, H, BPP = 640, 480, 2
+NUM_FRAMES = 30
+FPS = 30
+DEPTH_DATA_TOPIC_SUFFIX = "/Depth_0/image/data"
+
+MAGIC = b"\x89MCAP0\r\n"
+OP_FOOTER, OP_SCHEMA, OP_CHANNEL, OP_MESSAGE, OP_CHUNK, OP_MESSAGE_INDEX, OP_CHUNK_INDEX, OP_STATISTICS = \
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0B
+
+
+def _make_pixel_array(frame_number):
+    rng = np.random.default_rng(seed=frame_number)
+    return rng.integers(0, 256, size=W * H * BPP, dtype=np.uint8)
+
+
+def _record_synthetic(filename, compress):
+    depth_intrinsics = rs.intrinsics()
+    depth_intrinsics.width = W
+    depth_intrinsics.height = H
+    depth_intrinsics.ppx = W / 2
+    depth_intrinsics.ppy = H / 2
+    depth_intrinsics.fx = W
+    depth_intrinsics.fy = H
+    depth_intrinsics.model = rs.distortion.brown_conrady
+    depth_intrinsics.coeffs = [0, 0, 0, 0, 0]
+
+    vs = rs.video_stream()
+    vs.type = rs.stream.depth
+    vs.index = 0
+    vs.uid = 0
+    vs.width = W
+    vs.height = H
+    vs.fps = FPS
+    vs.bpp = BPP
+    vs.fmt = rs.format.z16
+    vs.intrinsics = depth_intrinsics
+
+    sd = rs.software_device()
+    sensor = sd.add_sensor("Synthetic")
+    depth_profile = sensor.add_video_stream(vs).as_video_stream_profile()
+
+    recorder = rs.recorder(filename, sd, compress)
+    sensor.open([depth_profile])
+    sensor.start(rs.syncer())
+
+    arrays = [_make_pixel_array(i) for i in range(NUM_FRAMES)]
+    for i, pixels in enumerate(arrays):
+        frame = rs.software_video_frame()
+        frame.bpp = BPP
+        frame.stride = W * BPP
+        frame.domain = rs.timestamp_domain.hardware_clock
+        frame.profile = depth_profile
+        frame.pixels = pixels
+        frame.timestamp = 10000 + i * 1000 / FPS
+        frame.frame_number = i
+        sensor.on_video_frame(frame)
+
+    sensor.stop()
+    sensor.close()
+    recorder.pause()
+    recorder = None
+
+
+def _records(buf):
+    off = 0
+    while off < len(buf):
+        op, length = struct.unpack_from("<BQ", buf, off)
+        yield op, off, buf[off + 9:off + 9 + length]
+        off += 9 + length
+
+
+def _string(buf, off):
+    n = struct.unpack_from("<I", buf, off)[0]
+    return buf[off + 4:off + 4 + n].decode(), off + 4 + n
+
+
+def _decompress(compression, data, size):
+    if compression == "":
+        return data
+    assert compression == "zstd", f"unexpected chunk compression '{compression}'"
+    return zstd.ZstdDecompressor().decompress(data, max_output_size=size)
+
+
+def _skip_cdr_string(buf, off):
+    off = (off + 3) & ~3
+    slen = struct.unpack_from("<I", buf, off)[0]
+    return off + 4 + slen
+
+
+def _extract_image_data_from_cdr(cdr_bytes):
+    # See pytest-ros2-compression for the sensor_msgs/msg/Image CDR layout
+    off = 4 + 8
+    off = _skip_cdr_string(cdr_bytes, off)
+    off = (off + 3) & ~3
+    off += 8
+    off = _skip_cdr_string(cdr_bytes, off)
+    off += 1
+    off = (off + 3) & ~3
+    off += 4
+    off = (off + 3) & ~3
+    data_len = struct.unpack_from("<I", cdr_bytes, off)[0]
+    off += 4
+    return cdr_bytes[off:off + data_len]
+
+
+def _read_mcap(filename):
+    """Returns {topic: [payload]}, validating the file structure on the way"""
+    with open(filename, "rb") as f:
+        data = f.read()
+    assert data[:8] == MAGIC and data[-8:] == MAGIC, "bad magic"
+
+    footer = len(data) - 8 - 29
+    op, _, summary_start, summary_offset_start, summary_crc = struct.unpack_from("<BQQQI", data, footer)
+    assert op == OP_FOOTER
+    assert summary_start and summary_start < summary_offset_start <= footer
+    assert summary_crc == zlib.crc32(data[summary_start:footer + 9 + 16]), "summary CRC mismatch"
+
+    topics = {}
+    message_count = None
+    chunk_indexes = []
+    for op, _, rec in _records(data[summary_start:summary_offset_start]):
+        if op == OP_CHANNEL:
+            channel_id = struct.unpack_from("<H", rec, 0)[0]
+            topics[channel_id], _ = _string(rec, 4)
+        elif op == OP_STATISTICS:
+            message_count = struct.unpack_from("<Q", rec, 0)[0]
+        elif op == OP_CHUNK_INDEX:
+            chunk_indexes.append(rec)
+    assert chunk_indexes, "no chunk index in the summary"
+
+    messages = {}
+    total = 0
+    for rec in chunk_indexes:
+        start, end, chunk_offset, chunk_length = struct.unpack_from("<QQQQ", rec, 0)
+        map_len = struct.unpack_from("<I", rec, 32)[0]
+        index_offsets = [struct.unpack_from("<HQ", rec, 36 + i) for i in range(0, map_len, 10)]
+
+        op, length = struct.unpack_from("<BQ", data, chunk_offset)
+        assert op == OP_CHUNK and 9 + length == chunk_length
+        chunk = data[chunk_offset + 9:chunk_offset + chunk_length]
+        c_start, c_end, size, crc = struct.unpack_from("<QQQI", chunk, 0)
+        assert (c_start, c_end) == (start, end)
+        compression, off = _string(chunk, 28)
+        n = struct.unpack_from("<Q", chunk, off)[0]
+        records = _decompress(compression, chunk[off + 8:off + 8 + n], size)
+        assert len(records) == size and zlib.crc32(records) == crc, "chunk CRC mismatch"
+
+        for channel_id, index_offset in index_offsets:
+            op, length = struct.unpack_from("<BQ", data, index_offset)
+            assert op == OP_MESSAGE_INDEX
+            index = data[index_offset + 9:index_offset + 9 + length]
+            assert struct.unpack_from("<H", index, 0)[0] == channel_id
+            entries = struct.unpack_from("<I", index, 2)[0] // 16
+            for i in range(entries):
+                log_time, offset = struct.unpack_from("<QQ", index, 6 + 16 * i)
+                op, length = struct.unpack_from("<BQ", records, offset)
+                assert op == OP_MESSAGE
+                msg_channel, _, msg_time = struct.unpack_from("<HIQ", records, offset + 9)
+                assert msg_channel == channel_id and msg_time == log_time and start <= log_time <= end
+                payload = records[offset + 9 + 22:offset + 9 + length]
+                messages.setdefault(topics[channel_id], []).append(payload)
+                total += 1
+    assert total == message_count, f"{total} indexed messages, statistics say {message_count}"
+    return messages
+
+
+def _playback_depth_frames(filename, seek_to=None):
+    playback = rs.context().load_device(filename)
+    playback.set_real_time(False)
+    sensor = next(s for s in playback.query_sensors()
+                  if any(p.stream_type() == rs.stream.depth for p in s.get_stream_profiles()))
+
+    queue = rs.frame_queue(NUM_FRAMES)
+    if seek_to is not None:
+        playback.pause()  # same as pytest-playback-step: the paused seek delivers the frame at seek_to
+    sensor.open(sensor.get_stream_profiles())
+    sensor.start(queue)
+    if seek_to is not None:
+        time.sleep(0.2)
+        playback.seek(seek_to)
+        playback.resume()
+
+    frames = []
+    while True:
+        f = queue.try_wait_for_frame(1000)
+        if not f[0]:
+            break
+        frames.append((f[1].get_frame_number(), bytes(f[1].as_video_frame().get_data())))
+
+    sensor.stop()
+    sensor.close()
+    return frames
+
+
+@pytest.mark.parametrize("compress", [False, True])
+def test_mcap_file_structure(tmp_path, compress):
+    filename = str(tmp_path / "recording.mcap")
+    _record_synthetic(filename, compress)
+
+    messages = _read_mcap(filename)
+    depth = next(v for k, v in messages.items() if k.endswith(DEPTH_DATA_TOPIC_SUFFIX))
+    assert len(depth) == NUM_FRAMES
+    for i, cdr in enumerate(depth):
+        assert _extract_image_data_from_cdr(cdr) == _make_pixel_array(i).tobytes(), f"frame {i} differs"
+
+
+@pytest.mark.parametrize("compress", [False, True])
+def test_mcap_official_reader(tmp_path, compress):
+    filename = str(tmp_path / "recording.mcap")
+    _record_synthetic(filename, compress)
+
+    # Every record in file order, with the chunk and summary CRCs checked
+    with open(filename, "rb") as f:
+        records = list(StreamReader(f, validate_crcs=True).records)
+    assert records, "no records"
+
+    # Through the summary and chunk indexes, the way a seeking reader finds the messages
+    with open(filename, "rb") as f:
+        reader = make_reader(f, validate_crcs=True)
+        summary = reader.get_summary()
+        assert summary is not None and summary.chunk_indexes, "no summary"
+        messages = [(channel.topic, message) for _, channel, message in reader.iter_messages()]
+    assert len(messages) == summary.statistics.message_count
+
+    depth = [message for topic, message in messages if topic.endswith(DEPTH_DATA_TOPIC_SUFFIX)]
+    assert len(depth) == NUM_FRAMES
+    assert [m.log_time for m in depth] == sorted(m.log_time for m in depth)
+    for i, message in enumerate(depth):
+        assert _extract_image_data_from_cdr(message.data) == _make_pixel_array(i).tobytes(), f"frame {i} differs"
+
+
+@pytest.mark.parametrize("compress", [False, True])
+def test_mcap_playback(tmp_path, compress):
+    filename = str(tmp_path / "recording.mcap")
+    _record_synthetic(filename, compress)
+
+    frames = _playback_depth_frames(filename)
+    assert [n for n, _ in frames] == list(range(NUM_FRAMES))
+    for n, pixels in frames:
+        assert pixels == _make_pixel_array(n).tobytes(), f"frame {n} differs"
+
+
+def test_mcap_seek(tmp_path):
+    filename = str(tmp_path / "recording.mcap")
+    _record_synthetic(filename, True)
+
+    duration = rs.context().load_device(filename).as_playback().get_duration()
+    frames = _playback_depth_frames(filename, seek_to=duration / 2)
+    assert frames, "no frames after seek"
+    assert frames[0][0] >= NUM_FRAMES // 2 - 2, f"playback started at frame {frames[0][0]} after seeking halfway"
+    assert [n for n, _ in frames] == list(range(frames[0][0], NUM_FRAMES))
+    for n, pixels in frames:
+        assert pixels == _make_pixel_array(n).tobytes(), f"frame {n} differs"
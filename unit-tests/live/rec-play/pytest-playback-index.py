@@ -0,0 +1,113 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+# Verifies the playback index saved to the "playback-index-dir" cache, and the stream ranges it provides, using a
+# software device so no camera is needed
+
+import os
+
+import numpy as np
+import pyrealsense2 as rs
+from pytest_check import check
+
+W = 320
+H = 240
+BPP = 2
+
+
+def record(filename, n_frames):
+    intrinsics = rs.intrinsics()
+    intrinsics.width = W
+    intrinsics.height = H
+    intrinsics.ppx = W / 2
+    intrinsics.ppy = H / 2
+    intrinsics.fx = W
+    intrinsics.fy = H
+    intrinsics.model = rs.distortion.brown_conrady
+    intrinsics.coeffs = [0, 0, 0, 0, 0]
+
+    vs = rs.video_stream()
+    vs.type = rs.stream.depth
+    vs.index = 0
+    vs.uid = 0
+    vs.width = W
+    vs.height = H
+    vs.fps = 30
+    vs.bpp = BPP
+    vs.fmt = rs.format.z16
+    vs.intrinsics = intrinsics
+
+    sd = rs.software_device()
+    sensor = sd.add_sensor("Synthetic")
+    profile = sensor.add_video_stream(vs).as_video_stream_profile()
+    recorder = rs.recorder(filename, sd)
+
+    sensor.open([profile])
+    sensor.start(lambda f: None)
+    for i in range(n_frames):
+        frame = rs.software_video_frame()
+        frame.pixels = np.full(W * H * BPP, i, dtype=np.uint8)
+        frame.bpp = BPP
+        frame.stride = W * BPP
+        frame.timestamp = 10000 + i * 33
+        frame.domain = rs.timestamp_domain.hardware_clock
+        frame.frame_number = i + 1
+        frame.profile = profile
+        sensor.on_video_frame(frame)
+    sensor.stop()
+    sensor.close()
+    recorder = None
+
+
+def stream_range(filename, stream, cache_dir=None):
+    settings = {"playback-index-dir": str(cache_dir)} if cache_dir else {}
+    playback = rs.context(settings).load_device(filename).as_playback()
+    return playback.get_stream_range(stream), playback.get_duration()
+
+
+def test_no_index_without_cache_dir(tmp_path):
+    filename = str(tmp_path / "plain.bag")
+    record(filename, 10)
+
+    depth, _ = stream_range(filename, rs.stream.depth)
+    check.equal(depth.frame_count, 10)
+    check.equal(os.listdir(tmp_path), ["plain.bag"])
+
+
+def test_stream_range(tmp_path):
+    filename = str(tmp_path / "indexed.bag")
+    cache = tmp_path / "index"
+    cache.mkdir()
+    record(filename, 30)
+
+    depth, duration = stream_range(filename, rs.stream.depth, cache)
+    sidecars = os.listdir(cache)
+    check.equal(len(sidecars), 1)
+    check.is_true(sidecars[0].startswith("indexed.bag.") and sidecars[0].endswith(".rsidx"))
+    check.equal(depth.frame_count, 30)
+    check.less_equal(depth.first_frame_ns, depth.last_frame_ns)
+    check.less_equal(depth.last_frame_ns - depth.first_frame_ns, duration.total_seconds() * 1e9)
+
+    color, _ = stream_range(filename, rs.stream.color, cache)
+    check.equal(color.frame_count, 0)
+
+    # The second time around the index is read back from the cache
+    again, _ = stream_range(filename, rs.stream.depth, cache)
+    check.equal(again.frame_count, depth.frame_count)
+    check.equal(again.first_frame_ns, depth.first_frame_ns)
+    check.equal(again.last_frame_ns, depth.last_frame_ns)
+
+
+def test_stale_index_is_rebuilt(tmp_path):
+    filename = str(tmp_path / "rewritten.bag")
+    cache = tmp_path / "index"
+    cache.mkdir()
+    record(filename, 30)
+    first, _ = stream_range(filename, rs.stream.depth, cache)
+    check.equal(first.frame_count, 30)
+
+    # A new recording to the same file leaves the old index behind; it no longer matches and must not be used
+    record(filename, 10)
+    second, _ = stream_range(filename, rs.stream.depth, cache)
+    check.equal(second.frame_count, 10)
+    check.equal(len(os.listdir(cache)), 1)
@@ -0,0 +1,123 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+# Verifies the recorder's queue limit and overflow policies, using a software device so no camera is needed
+
+import numpy as np
+import pytest
+import pyrealsense2 as rs
+from pytest_check import check
+
+W = 640
+H = 480
+BPP = 2
+N_FRAMES = 60
+
+
+def prepare_depth_sensor():
+    intrinsics = rs.intrinsics()
+    intrinsics.width = W
+    intrinsics.height = H
+    intrinsics.ppx = W / 2
+    intrinsics.ppy = H / 2
+    intrinsics.fx = W
+    intrinsics.fy = H
+    intrinsics.model = rs.distortion.brown_conrady
+    intrinsics.coeffs = [0, 0, 0, 0, 0]
+
+    vs = rs.video_stream()
+    vs.type = rs.stream.depth
+    vs.index = 0
+    vs.uid = 0
+    vs.width = W
+    vs.height = H
+    vs.fps = 60
+    vs.bpp = BPP
+    vs.fmt = rs.format.z16
+    vs.intrinsics = intrinsics
+
+    sd = rs.software_device()
+    sensor = sd.add_sensor("Synthetic")
+    profile = sensor.add_video_stream(vs).as_video_stream_profile()
+    return sd, sensor, profile
+
+
+def record(filename, policy, max_bytes):
+    """Records N_FRAMES frames under the given queue limit, and returns the recorder's statistics"""
+    sd, sensor, profile = prepare_depth_sensor()
+    recorder = rs.recorder(filename, sd, True)
+    recorder.set_queue_limit(max_bytes, policy)
+
+    sensor.open([profile])
+    sensor.start(lambda f: None)
+
+    for i in range(N_FRAMES):
+        frame = rs.software_video_frame()
+        frame.pixels = np.full(W * H * BPP, i, dtype=np.uint8)
+        frame.bpp = BPP
+        frame.stride = W * BPP
+        frame.timestamp = 10000 + i * 16
+        frame.domain = rs.timestamp_domain.hardware_clock
+        frame.frame_number = i + 1
+        frame.profile = profile
+        sensor.on_video_frame(frame)
+
+    sensor.stop()
+    sensor.close()
+    recorder.pause()  # waits for everything queued to be written
+    stats = recorder.get_statistics()
+    recorder = None
+    return stats
+
+
+def count_played_frames(filename):
+    ctx = rs.context()
+    player_dev = ctx.load_device(filename)
+    player_dev.set_real_time(False)
+    player_sync = rs.syncer()
+    s = player_dev.query_sensors()[0]
+    s.open(s.get_stream_profiles())
+    s.start(player_sync)
+
+    frame_numbers = []
+    success, fset = player_sync.try_wait_for_frames()
+    while success:
+        depth = fset.first_or_default(rs.stream.depth)
+        if depth:
+            frame_numbers.append(depth.get_frame_number())
+        success, fset = player_sync.try_wait_for_frames()
+
+    s.stop()
+    s.close()
+    return frame_numbers
+
+
+def test_block_policy_writes_every_frame(tmp_path):
+    filename = str(tmp_path / "blocked.bag")
+    # Room for only two frames at a time: the sensor has to wait for the writer
+    stats = record(filename, rs.record_overflow_policy.block, 2 * W * H * BPP)
+
+    check.equal(stats.frames_received, N_FRAMES)
+    check.equal(stats.frames_written, N_FRAMES)
+    check.equal(stats.frames_dropped, 0)
+    check.equal(stats.queued_bytes, 0)
+    check.less_equal(stats.max_queued_bytes, 2 * W * H * BPP)
+
+    frame_numbers = count_played_frames(filename)
+    check.equal(frame_numbers, list(range(1, N_FRAMES + 1)))
+
+
+@pytest.mark.parametrize("policy", [rs.record_overflow_policy.drop_newest, rs.record_overflow_policy.drop_oldest])
+def test_drop_policies_account_for_every_frame(tmp_path, policy):
+    filename = str(tmp_path / "dropped.bag")
+    # Room for a single frame: whatever can't be written right away is dropped
+    stats = record(filename, policy, W * H * BPP)
+
+    check.equal(stats.frames_received, N_FRAMES)
+    check.equal(stats.frames_written + stats.frames_dropped, N_FRAMES)
+    check.equal(stats.queued_bytes, 0)
+    check.equal(stats.blocked_ns, 0)
+
+    frame_numbers = count_played_frames(filename)
+    check.equal(len(frame_numbers), stats.frames_written)
+    check.equal(frame_numbers, sorted(frame_numbers))
@@ -64,3 +64,25 @@ def test_jpeg_streaming_conversion(module_device_setup):
             log.debug(frames)
     finally:
         pipeline.stop()
+
+
+@pytest.mark.parametrize("target_format, bpp", [(rs.format.bgr8, 3), (rs.format.rgba8, 4), (rs.format.y8, 1)])
+def test_jpeg_streaming_conversion_formats(module_device_setup, target_format, bpp):
+    """JPEG color is decoded straight into BGR8, RGBA8 and Y8 frames too."""
+    if not _module_state.get('jpeg_ok'):
+        pytest.skip("prerequisite test_jpeg_format_support failed")
+    pipeline = rs.pipeline()
+    config = rs.config()
+    if isinstance(module_device_setup, str):
+        config.enable_device(module_device_setup)
+    vp = _jpeg_profile.as_video_stream_profile()
+    config.enable_stream(rs.stream.color, vp.stream_index(), vp.width(), vp.height(), target_format, vp.fps())
+    pipeline.start(config)
+    try:
+        for i in range(10):
+            frame = pipeline.wait_for_frames().get_color_frame()
+            assert frame.get_profile().format() == target_format
+            assert frame.get_bytes_per_pixel() == bpp
+            assert frame.get_data_size() == vp.width() * vp.height() * bpp
+    finally:
+        pipeline.stop()
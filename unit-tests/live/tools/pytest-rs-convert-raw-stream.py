@@ -0,0 +1,69 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+# Converts a recording with rs-convert -R (one raw file per stream, with an index CSV), and checks every frame in it
+# is the same as when played back.
+
+import subprocess, os, tempfile, shutil, csv
+import logging
+import pyrealsense2 as rs
+from rspy import repo
+
+log = logging.getLogger(__name__)
+
+
+def collect_frames( filename ):
+    pipe = rs.pipeline()
+    cfg = rs.config()
+    cfg.enable_all_streams()
+    cfg.enable_device_from_file( filename, repeat_playback=False )
+    pipe.start( cfg ).get_device().as_playback().set_real_time( False )
+    frames = {}
+    try:
+        while True:
+            ok, fset = pipe.try_wait_for_frames( 1000 )
+            if not ok:
+                break
+            for f in fset:
+                frames[( f.get_profile().stream_name(), f.get_frame_number() )] = bytes( f.get_data() )
+    finally:
+        pipe.stop()
+    return frames
+
+
+def read_raw_stream( prefix, stream_name ):
+    frames = {}
+    with open( f'{prefix}_{stream_name}.raw', 'rb' ) as raw, open( f'{prefix}_{stream_name}_index.csv' ) as index:
+        data = raw.read()
+        for row in csv.DictReader( index ):
+            offset, size = int( row['Offset'] ), int( row['Size'] )
+            frames[( stream_name, int( row['Frame Number'] ) )] = data[offset:offset + size]
+    return frames
+
+
+def test_rs_convert_raw_stream():
+    rs_convert = repo.find_built_exe( 'tools/convert', 'rs-convert' )
+    assert rs_convert, "rs-convert not found"
+
+    bag_file = os.path.join( repo.build, 'unit-tests', 'recordings', 'single_depth_color_640x480.bag' )
+    temp_dir = tempfile.mkdtemp( prefix='raw_stream_' )
+    prefix = os.path.join( temp_dir, 'out' )
+    try:
+        # Few threads, so the pool is always full and holds back the playback
+        p = subprocess.run( [rs_convert, '-i', bag_file, '-R', prefix, '--threads', '2'],
+                            capture_output=True, text=True, timeout=60 )
+        assert p.returncode == 0, p.stderr
+        assert 'Converted' in p.stdout
+
+        played = collect_frames( bag_file )
+        assert len( played ) > 0
+        converted = {}
+        for stream_name in { name for name, _ in played }:
+            converted.update( read_raw_stream( prefix, stream_name ) )
+
+        for key, data in played.items():
+            assert key in converted, f'frame {key} played back but missing in the raw stream'
+            assert data == converted[key], f'frame {key} data differs after conversion'
+        log.debug( '%s frames compared', len( played ) )
+    finally:
+        shutil.rmtree( temp_dir, ignore_errors=True )
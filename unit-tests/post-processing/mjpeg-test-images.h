@@ -0,0 +1,226 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+// Baseline JPEGs with restart markers, as cameras send, for test-mjpeg-bands.cpp. Made with libjpeg, quality 50, of
+// a gradient with a sine wave through it.
+
+// 128x80, 4:2:0, a restart marker at every MCU row
+unsigned char const jpeg_420_row_restarts[] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+    0xff, 0xdb, 0x00, 0x43, 0x00, 0x10, 0x0b, 0x0c, 0x0e, 0x0c, 0x0a, 0x10, 0x0e, 0x0d, 0x0e, 0x12, 0x11, 0x10, 0x13, 0x18,
+    0x28, 0x1a, 0x18, 0x16, 0x16, 0x18, 0x31, 0x23, 0x25, 0x1d, 0x28, 0x3a, 0x33, 0x3d, 0x3c, 0x39, 0x33, 0x38, 0x37, 0x40,
+    0x48, 0x5c, 0x4e, 0x40, 0x44, 0x57, 0x45, 0x37, 0x38, 0x50, 0x6d, 0x51, 0x57, 0x5f, 0x62, 0x67, 0x68, 0x67, 0x3e, 0x4d,
+    0x71, 0x79, 0x70, 0x64, 0x78, 0x5c, 0x65, 0x67, 0x63, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x11, 0x12, 0x12, 0x18, 0x15, 0x18,
+    0x2f, 0x1a, 0x1a, 0x2f, 0x63, 0x42, 0x38, 0x42, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0xff, 0xc0,
+    0x00, 0x11, 0x08, 0x00, 0x50, 0x00, 0x80, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xc4, 0x00,
+    0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03,
+    0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+    0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15,
+    0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29,
+    0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56,
+    0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4,
+    0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6,
+    0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7,
+    0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00, 0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07,
+    0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51,
+    0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+    0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x35,
+    0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+    0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84,
+    0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8,
+    0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea,
+    0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xdd, 0x00, 0x04, 0x00, 0x08, 0xff, 0xda, 0x00, 0x0c, 0x03,
+    0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xab, 0x6d, 0x16, 0x00, 0xad, 0x04, 0x5c, 0x0a, 0x8a, 0x08, 0xf0,
+    0x2a, 0xc1, 0xe0, 0x57, 0x85, 0x35, 0x76, 0x7c, 0xdb, 0x77, 0x64, 0x52, 0x1c, 0x0a, 0xa1, 0x70, 0xfd, 0x6a, 0xd4, 0xef,
+    0x81, 0x59, 0x97, 0x0f, 0xd6, 0xb5, 0xa5, 0x4a, 0xe7, 0xa1, 0x86, 0xa7, 0x72, 0xac, 0xef, 0x93, 0x55, 0x4f, 0x26, 0xa4,
+    0x90, 0xe4, 0xd3, 0x51, 0x72, 0x6b, 0xbe, 0x34, 0xec, 0x8f, 0x7a, 0x94, 0x6c, 0x89, 0x61, 0x4c, 0x9a, 0xd5, 0xb5, 0x8b,
+    0xa7, 0x15, 0x52, 0xda, 0x2c, 0x91, 0x5b, 0x36, 0xb1, 0x74, 0xae, 0x5a, 0xc4, 0xd5, 0x9d, 0x8b, 0x56, 0xd1, 0xe0, 0x0a,
+    0xba, 0xab, 0x81, 0x4c, 0x85, 0x30, 0x2a, 0x56, 0xe0, 0x57, 0x97, 0x38, 0xdd, 0x9c, 0x17, 0xbb, 0x22, 0x95, 0xb0, 0x2b,
+    0x3a, 0xe1, 0xfa, 0xd5, 0xb9, 0xdf, 0x83, 0x59, 0x77, 0x0f, 0xd6, 0xb6, 0xa5, 0x44, 0xf4, 0xf0, 0xd4, 0xca, 0xb3, 0x36,
+    0x4d, 0x57, 0xc6, 0x4d, 0x48, 0xe7, 0x26, 0x88, 0xd7, 0x26, 0xbb, 0x94, 0x2c, 0x8f, 0x76, 0x9c, 0x6c, 0x89, 0xa0, 0x8f,
+    0x26, 0xaf, 0xb3, 0x7d, 0x9e, 0xd8, 0xb8, 0xfb, 0xc7, 0x85, 0xfa, 0xd3, 0x2d, 0x62, 0xe9, 0x4d, 0xb9, 0x6f, 0x36, 0xe3,
+    0x60, 0xfb, 0xb1, 0xf1, 0xf8, 0xf7, 0xff, 0x00, 0x3e, 0xd5, 0x84, 0xa1, 0xcd, 0x2b, 0x1e, 0x6e, 0x69, 0x8b, 0xf6, 0x14,
+    0x5b, 0x5b, 0xbd, 0x11, 0xff, 0xd0, 0xb0, 0x8b, 0x81, 0x49, 0x21, 0xc0, 0xa9, 0x3a, 0x0a, 0xad, 0x3b, 0xe0, 0x57, 0x99,
+    0x1a, 0x77, 0x67, 0xce, 0x52, 0x8d, 0xd9, 0x56, 0xe1, 0xfa, 0xd6, 0x5c, 0xef, 0x93, 0x56, 0xee, 0x1f, 0xad, 0x67, 0xc8,
+    0x72, 0x6b, 0xbe, 0x95, 0x23, 0xde, 0xc3, 0x53, 0xb1, 0x11, 0xe4, 0xd4, 0xf0, 0xa6, 0x4d, 0x46, 0x8b, 0x93, 0x57, 0xed,
+    0xa2, 0xc9, 0x15, 0xac, 0xd5, 0x91, 0xe8, 0xb7, 0x64, 0x5b, 0xb5, 0x8b, 0xa5, 0x6b, 0xdb, 0x47, 0x80, 0x2a, 0xad, 0xac,
+    0x5d, 0x2b, 0x56, 0x14, 0xc0, 0xaf, 0x2a, 0xb6, 0xa7, 0x9f, 0x56, 0x77, 0x63, 0xd5, 0x70, 0x2a, 0x39, 0x5b, 0x02, 0xa6,
+    0x6e, 0x05, 0x53, 0x9d, 0xf0, 0x2b, 0x9a, 0x34, 0xee, 0xc2, 0x8c, 0x6e, 0xca, 0xb7, 0x2f, 0xd6, 0xb3, 0x26, 0x6c, 0x9a,
+    0xb5, 0x70, 0xfd, 0x6a, 0x83, 0x9c, 0x9a, 0xf4, 0x29, 0x52, 0xb1, 0xef, 0xe1, 0xa9, 0xd9, 0x0c, 0xc6, 0x4d, 0x5a, 0x82,
+    0x3c, 0x9a, 0x86, 0x35, 0xc9, 0xad, 0x1b, 0x58, 0xba, 0x55, 0xd4, 0x56, 0x47, 0x74, 0x9d, 0x91, 0x23, 0x37, 0xd9, 0xed,
+    0xcb, 0x8f, 0xbc, 0x78, 0x5f, 0xad, 0x57, 0xb7, 0x8f, 0x00, 0x53, 0xae, 0x5b, 0xcd, 0xb8, 0xd8, 0x3e, 0xec, 0x7c, 0x7e,
+    0x3d, 0xff, 0x00, 0xcf, 0xb5, 0x4f, 0x12, 0x60, 0x56, 0x1c, 0x96, 0x8f, 0xa9, 0xf0, 0x99, 0xb6, 0x2f, 0xdb, 0xd7, 0x69,
+    0x6d, 0x1d, 0x3f, 0xcc, 0xff, 0xd1, 0xb5, 0x21, 0xc0, 0xac, 0xfb, 0x87, 0xeb, 0x56, 0xe7, 0x7c, 0x0a, 0xcc, 0xb8, 0x7e,
+    0xb5, 0x34, 0xa9, 0x5c, 0xf1, 0xf0, 0xd4, 0xee, 0x54, 0x9d, 0xf2, 0x6a, 0xa9, 0xe4, 0xd4, 0xb2, 0x1c, 0x9a, 0x6a, 0x2e,
+    0x4d, 0x7a, 0x11, 0xa7, 0x64, 0x7b, 0xf4, 0xa3, 0x64, 0x49, 0x0a, 0x64, 0xd6, 0xad, 0xac, 0x5d, 0x2a, 0xad, 0xb4, 0x59,
+    0x22, 0xb6, 0x2d, 0x62, 0xe9, 0x5c, 0x95, 0x88, 0xab, 0x3b, 0x16, 0xad, 0xa3, 0xc0, 0x15, 0x79, 0x57, 0x02, 0xa3, 0x85,
+    0x30, 0x2a, 0x56, 0xe0, 0x57, 0x97, 0x38, 0xdd, 0x9c, 0x17, 0xbb, 0x22, 0x95, 0xb0, 0x2b, 0x3a, 0xe1, 0xfa, 0xd5, 0xb9,
+    0xdf, 0xad, 0x66, 0x5c, 0x3f, 0x5a, 0xda, 0x95, 0x13, 0xd3, 0xc3, 0x53, 0x2a, 0x4c, 0xd9, 0x35, 0x06, 0x32, 0x69, 0xee,
+    0x72, 0x69, 0x63, 0x5c, 0x9a, 0xef, 0x50, 0xb2, 0x3d, 0xda, 0x71, 0xb2, 0x25, 0x82, 0x3c, 0x9a, 0xd0, 0x66, 0xfb, 0x3d,
+    0xb1, 0x71, 0xf7, 0x8f, 0x0b, 0xf5, 0xa8, 0xed, 0x62, 0xe9, 0x4d, 0xb9, 0x6f, 0x36, 0xe3, 0x60, 0xfb, 0xb1, 0xf1, 0xf8,
+    0xf7, 0xff, 0x00, 0x3e, 0xd5, 0xcf, 0x28, 0x73, 0x4a, 0xc7, 0x9b, 0x9a, 0x62, 0xfd, 0x85, 0x16, 0xd6, 0xef, 0x44, 0x36,
+    0xde, 0x3c, 0x01, 0x56, 0xc0, 0xc0, 0xa6, 0xc4, 0x98, 0x14, 0xe7, 0x38, 0x15, 0x12, 0x8d, 0xd9, 0xf0, 0x7f, 0x13, 0x3f,
+    0xff, 0xd2, 0x65, 0xc3, 0xf5, 0xac, 0xc9, 0xdf, 0x26, 0xad, 0x5c, 0x3f, 0x5a, 0xcf, 0x90, 0xe4, 0xd7, 0xa7, 0x4a, 0x91,
+    0xcf, 0x86, 0xa7, 0x62, 0x33, 0xc9, 0xa9, 0xe1, 0x8f, 0x26, 0xa3, 0x45, 0xc9, 0xab, 0xf6, 0xd1, 0x64, 0x8a, 0xd6, 0x6a,
+    0xc8, 0xf4, 0x1b, 0xb2, 0x2d, 0x5a, 0xc5, 0xd2, 0xb6, 0x2d, 0xa3, 0xc0, 0x15, 0x56, 0xd6, 0x2e, 0x95, 0xa9, 0x0a, 0x60,
+    0x57, 0x95, 0x5b, 0x53, 0x82, 0xac, 0xee, 0xc7, 0xaa, 0xe0, 0x53, 0x25, 0x6c, 0x0a, 0x95, 0xb8, 0x15, 0x52, 0x77, 0xc0,
+    0xae, 0x68, 0xd3, 0xbb, 0x15, 0x18, 0xdd, 0x95, 0x2e, 0x5f, 0xad, 0x66, 0x4c, 0xd9, 0x35, 0x6a, 0xe1, 0xfa, 0xd5, 0x17,
+    0x39, 0x35, 0xe8, 0x52, 0xa5, 0x63, 0xdf, 0xc3, 0x53, 0xb2, 0x19, 0x8c, 0x9a, 0xb3, 0x04, 0x79, 0x35, 0x14, 0x6b, 0x93,
+    0x5a, 0x36, 0xb1, 0x74, 0xab, 0xa8, 0xac, 0x8e, 0xf9, 0x3b, 0x21, 0xec, 0xdf, 0x67, 0xb6, 0x2e, 0x3e, 0xf1, 0xe1, 0x7e,
+    0xb5, 0x5e, 0xde, 0x3c, 0x01, 0x4f, 0xb9, 0x6f, 0x36, 0xe3, 0x60, 0xfb, 0xb1, 0xf1, 0xf8, 0xf7, 0xff, 0x00, 0x3e, 0xd5,
+    0x34, 0x49, 0x81, 0x58, 0x72, 0x5a, 0x3e, 0xa7, 0xc1, 0xe6, 0xd8, 0xbf, 0x6f, 0x5d, 0xa5, 0xb4, 0x74, 0xff, 0x00, 0x31,
+    0xe0, 0x60, 0x54, 0x33, 0x36, 0x05, 0x4c, 0xe7, 0x02, 0xa9, 0x5c, 0x3f, 0x5a, 0x50, 0xa7, 0x76, 0x70, 0x51, 0x85, 0xd9,
+    0xff, 0xd3, 0xcb, 0x9d, 0xf2, 0x6a, 0xb1, 0xe4, 0xd4, 0x92, 0x1c, 0x9a, 0x6a, 0x2e, 0x4d, 0x7d, 0x24, 0x69, 0xd9, 0x17,
+    0x4a, 0x36, 0x44, 0xb0, 0xa6, 0x4d, 0x6a, 0xda, 0xc5, 0xd2, 0xaa, 0x5b, 0x45, 0x92, 0x2b, 0x66, 0xd6, 0x2e, 0x95, 0xcb,
+    0x58, 0x9a, 0xb3, 0xb1, 0x6a, 0xda, 0x3c, 0x01, 0x57, 0x55, 0x70, 0x29, 0x90, 0xa6, 0x05, 0x4a, 0xdc, 0x0a, 0xf2, 0xe7,
+    0x1b, 0xb3, 0x82, 0xf7, 0x64, 0x52, 0xb6, 0x05, 0x67, 0x5c, 0x3f, 0x5a, 0xb7, 0x3b, 0xf0, 0x6b, 0x2e, 0xe1, 0xfa, 0xd6,
+    0xd4, 0xa8, 0x9e, 0x9e, 0x1a, 0x99, 0x56, 0x66, 0xc9, 0xaa, 0xf8, 0xc9, 0xa9, 0x1c, 0xe4, 0xd1, 0x1a, 0xe4, 0xd7, 0x7a,
+    0x85, 0x91, 0xee, 0xd3, 0x8d, 0x91, 0x34, 0x11, 0xe4, 0x8a, 0xbe, 0xcd, 0xf6, 0x7b, 0x62, 0xe3, 0xef, 0x1e, 0x17, 0xeb,
+    0x4c, 0xb5, 0x8b, 0xa5, 0x36, 0xe5, 0xbc, 0xdb, 0x8d, 0x83, 0xee, 0xc7, 0xc7, 0xe3, 0xdf, 0xfc, 0xfb, 0x57, 0x3c, 0xa1,
+    0xcd, 0x2b, 0x1e, 0x6e, 0x69, 0x8b, 0xf6, 0x14, 0x5b, 0x5b, 0xbd, 0x10, 0xcb, 0x78, 0xf0, 0x05, 0x5b, 0x03, 0x02, 0x9b,
+    0x12, 0x60, 0x53, 0xdc, 0xe0, 0x56, 0x72, 0x8d, 0xd9, 0xf0, 0x5f, 0x13, 0x20, 0x99, 0xb0, 0x2b, 0x36, 0xe5, 0xfa, 0xd5,
+    0xcb, 0x87, 0xeb, 0x59, 0x77, 0x0f, 0xd6, 0xba, 0x69, 0x51, 0x3d, 0x5c, 0x2d, 0x33, 0xff, 0xd9,
+};
+
+// 96x160, 4:2:2, a restart marker every 5 MCUs (of 6 per row), so bands can only start every 5 MCU rows
+unsigned char const jpeg_422_unaligned_restarts[] = {
+    0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+    0xff, 0xdb, 0x00, 0x43, 0x00, 0x10, 0x0b, 0x0c, 0x0e, 0x0c, 0x0a, 0x10, 0x0e, 0x0d, 0x0e, 0x12, 0x11, 0x10, 0x13, 0x18,
+    0x28, 0x1a, 0x18, 0x16, 0x16, 0x18, 0x31, 0x23, 0x25, 0x1d, 0x28, 0x3a, 0x33, 0x3d, 0x3c, 0x39, 0x33, 0x38, 0x37, 0x40,
+    0x48, 0x5c, 0x4e, 0x40, 0x44, 0x57, 0x45, 0x37, 0x38, 0x50, 0x6d, 0x51, 0x57, 0x5f, 0x62, 0x67, 0x68, 0x67, 0x3e, 0x4d,
+    0x71, 0x79, 0x70, 0x64, 0x78, 0x5c, 0x65, 0x67, 0x63, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x11, 0x12, 0x12, 0x18, 0x15, 0x18,
+    0x2f, 0x1a, 0x1a, 0x2f, 0x63, 0x42, 0x38, 0x42, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0xff, 0xc0,
+    0x00, 0x11, 0x08, 0x00, 0xa0, 0x00, 0x60, 0x03, 0x01, 0x21, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xc4, 0x00,
+    0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03,
+    0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+    0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15,
+    0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29,
+    0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56,
+    0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4,
+    0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6,
+    0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7,
+    0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00, 0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07,
+    0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51,
+    0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+    0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x35,
+    0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+    0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84,
+    0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+    0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8,
+    0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea,
+    0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xdd, 0x00, 0x04, 0x00, 0x05, 0xff, 0xda, 0x00, 0x0c, 0x03,
+    0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xab, 0x6d, 0x16, 0x00, 0xad, 0x04, 0x5c, 0x0a, 0xf0, 0x6a, 0x6a,
+    0xcf, 0x9c, 0x9b, 0xbb, 0x1b, 0x21, 0xc0, 0xaa, 0x17, 0x0f, 0xd6, 0x9d, 0x38, 0x6a, 0x75, 0xe1, 0xa3, 0xa9, 0x99, 0x3b,
+    0xe4, 0xd5, 0x53, 0xc9, 0xaf, 0x46, 0x11, 0xb2, 0x3e, 0x82, 0x8a, 0xb2, 0x27, 0x85, 0x32, 0x6b, 0x56, 0xd6, 0x2e, 0x9c,
+    0x56, 0x15, 0xb6, 0x2e, 0xab, 0xd0, 0xd8, 0xb6, 0x8f, 0x00, 0x55, 0xd5, 0x5c, 0x0a, 0xf2, 0x6a, 0x2b, 0xb3, 0xce, 0x93,
+    0xbb, 0x3f, 0xff, 0xd0, 0xd6, 0x95, 0xb0, 0x2b, 0x3a, 0xe1, 0xfa, 0xd7, 0xcc, 0xd2, 0x81, 0xd1, 0x86, 0x8e, 0xa4, 0x70,
+    0x47, 0x81, 0x56, 0x0f, 0x02, 0xba, 0xe4, 0xae, 0xcf, 0x92, 0xdd, 0x95, 0x67, 0x7c, 0x0a, 0xcc, 0xb8, 0x7e, 0xb5, 0xd1,
+    0x4a, 0x07, 0xab, 0x85, 0x89, 0x9f, 0x21, 0xc9, 0xa6, 0xa2, 0xe4, 0xd7, 0x72, 0x8d, 0x91, 0xee, 0x53, 0x56, 0x45, 0xfb,
+    0x68, 0xb2, 0x45, 0x6c, 0xda, 0xc5, 0xd2, 0xb8, 0x6b, 0x98, 0x56, 0x91, 0xff, 0xd1, 0xd6, 0x85, 0x30, 0x2a, 0x56, 0xe0,
+    0x57, 0xcc, 0xb5, 0x76, 0x60, 0xb5, 0x65, 0x49, 0xdf, 0x83, 0x59, 0x77, 0x0f, 0xd6, 0xba, 0xa8, 0xc0, 0xf5, 0xf0, 0xb1,
+    0x2e, 0x22, 0xe0, 0x52, 0x48, 0x70, 0x2b, 0x5e, 0x5b, 0xb3, 0xe2, 0xa0, 0xae, 0xca, 0x17, 0x0f, 0xd6, 0xb2, 0xe7, 0x7c,
+    0x9a, 0xee, 0xa5, 0x03, 0xdc, 0xc2, 0xc4, 0xaa, 0x79, 0x35, 0x3c, 0x29, 0x93, 0x5d, 0x32, 0x56, 0x47, 0xad, 0xb2, 0x3f,
+    0xff, 0xd2, 0xad, 0x6b, 0x17, 0x4a, 0xd7, 0xb6, 0x8f, 0x00, 0x57, 0x97, 0x5c, 0x55, 0xa4, 0x5e, 0x55, 0xc0, 0xa8, 0xe5,
+    0x6c, 0x0a, 0xe3, 0x51, 0xbb, 0x32, 0xa6, 0xae, 0xcc, 0xfb, 0x97, 0xeb, 0x59, 0x93, 0x36, 0x4d, 0x77, 0xd2, 0x81, 0xef,
+    0x61, 0x62, 0x6b, 0x74, 0x15, 0x5a, 0x77, 0xc0, 0xa7, 0x08, 0xdd, 0x9f, 0x0d, 0x45, 0x5d, 0x99, 0x97, 0x0f, 0xd6, 0xb3,
+    0xe4, 0x39, 0x35, 0xe8, 0xd2, 0x86, 0x87, 0xd0, 0x61, 0xa3, 0xa1, 0xff, 0xd3, 0xe7, 0x11, 0x72, 0x6a, 0xfd, 0xb4, 0x59,
+    0x22, 0xae, 0xa6, 0x88, 0xeb, 0x9b, 0xb2, 0x36, 0x2d, 0x62, 0xe9, 0x5a, 0xb0, 0xa6, 0x05, 0x79, 0x15, 0xb7, 0x3c, 0xea,
+    0x8e, 0xec, 0x95, 0xb8, 0x15, 0x4e, 0x77, 0xc0, 0xac, 0xa1, 0x1d, 0x4d, 0x28, 0x2b, 0xb3, 0x32, 0xe1, 0xfa, 0xd5, 0x07,
+    0x39, 0x35, 0xe8, 0xd3, 0x86, 0x87, 0xd0, 0xe1, 0xe3, 0xa1, 0xb5, 0x21, 0xc0, 0xac, 0xfb, 0x87, 0xeb, 0x4e, 0x9c, 0x35,
+    0x3e, 0x17, 0x0f, 0x1d, 0x4f, 0xff, 0xd4, 0xc6, 0x9d, 0xf2, 0x6a, 0xa9, 0xe4, 0xd7, 0x54, 0x23, 0x64, 0x6b, 0x45, 0x59,
+    0x13, 0xc2, 0x99, 0x35, 0xab, 0x6b, 0x17, 0x4a, 0xc6, 0xb6, 0xc5, 0x55, 0x7a, 0x1b, 0x16, 0xd1, 0xe0, 0x0a, 0xbc, 0xab,
+    0x81, 0x5e, 0x45, 0x45, 0x76, 0x79, 0xd2, 0x77, 0x64, 0x72, 0xb6, 0x05, 0x67, 0x5c, 0x3f, 0x5a, 0xba, 0x50, 0x3b, 0xb0,
+    0xd1, 0xd4, 0xcc, 0x99, 0xb2, 0x6a, 0x0c, 0x64, 0xd7, 0xa3, 0x18, 0xd9, 0x1f, 0x41, 0x45, 0x59, 0x1f, 0xff, 0xd5, 0x96,
+    0x77, 0xc0, 0xac, 0xcb, 0x87, 0xeb, 0x57, 0x4a, 0x07, 0x97, 0x85, 0x89, 0x9f, 0x21, 0xc9, 0xa6, 0xa2, 0xe4, 0xd7, 0x72,
+    0x8d, 0x91, 0xee, 0x53, 0x56, 0x45, 0xfb, 0x68, 0xb2, 0x45, 0x6c, 0x5a, 0xc5, 0xd2, 0xb8, 0x6b, 0x98, 0x56, 0x91, 0xa9,
+    0x0a, 0x60, 0x54, 0xad, 0xc0, 0xaf, 0x35, 0xab, 0xb3, 0x8d, 0x6a, 0xca, 0x93, 0xbf, 0x5a, 0xcc, 0xb8, 0x7e, 0xb5, 0xd5,
+    0x46, 0x07, 0xaf, 0x85, 0x89, 0xff, 0xd6, 0xa4, 0xe7, 0x26, 0x96, 0x35, 0xc9, 0xad, 0xed, 0x64, 0x7d, 0x3c, 0x34, 0x45,
+    0x9b, 0x87, 0xeb, 0x59, 0x93, 0xbe, 0x4d, 0x6f, 0x4a, 0x07, 0xc6, 0x61, 0x62, 0x55, 0x3c, 0x9a, 0x9e, 0x18, 0xf2, 0x6b,
+    0xa2, 0x4a, 0xc8, 0xf5, 0x76, 0x46, 0xad, 0xac, 0x5d, 0x2b, 0x62, 0xda, 0x3c, 0x01, 0x5e, 0x65, 0x73, 0x86, 0xb4, 0x8b,
+    0xaa, 0xb8, 0x14, 0xc9, 0x5b, 0x02, 0xb8, 0x94, 0x6e, 0xcc, 0xa9, 0xab, 0xb3, 0xff, 0xd7, 0xbb, 0x72, 0xfd, 0x6b, 0x32,
+    0x66, 0xc9, 0xad, 0x69, 0x40, 0xf5, 0x30, 0xb1, 0x20, 0xc6, 0x4d, 0x59, 0x82, 0x3c, 0x9a, 0xde, 0x6a, 0xc8, 0xf4, 0xde,
+    0x88, 0xaf, 0x70, 0xfd, 0x6b, 0x3e, 0x43, 0x93, 0x5d, 0x94, 0xa1, 0xa1, 0xf2, 0x78, 0x68, 0xe8, 0x22, 0x2e, 0x4d, 0x5f,
+    0xb6, 0x8b, 0x24, 0x53, 0xa9, 0xa2, 0x3b, 0x26, 0xec, 0x8d, 0x8b, 0x58, 0xba, 0x56, 0xa4, 0x29, 0x81, 0x5e, 0x4d, 0x6d,
+    0xcf, 0x3a, 0xa3, 0xd4, 0xff, 0xd0, 0xe8, 0xdb, 0x81, 0x55, 0x27, 0x7c, 0x0a, 0x98, 0x47, 0x53, 0x1a, 0x0a, 0xec, 0xcb,
+    0xb8, 0x7e, 0xb5, 0x45, 0xce, 0x4d, 0x7a, 0x34, 0xe1, 0xa1, 0xf4, 0x38, 0x78, 0xd9, 0x0b, 0x1a, 0xe4, 0xd6, 0x8d, 0xac,
+    0x5d, 0x29, 0x55, 0xd8, 0xe9, 0x9b, 0xb2, 0x30, 0xe7, 0x7c, 0x9a, 0xac, 0x79, 0x35, 0xe9, 0xc2, 0x36, 0x47, 0xce, 0x51,
+    0x56, 0x44, 0xf0, 0xa6, 0x4d, 0x6a, 0xda, 0xc5, 0xd2, 0xb0, 0xad, 0xb1, 0x55, 0x5e, 0x87, 0xff, 0xd1, 0xd7, 0xb6, 0x8f,
+    0x00, 0x55, 0xd5, 0x5c, 0x0a, 0xd2, 0xa2, 0xbb, 0x38, 0x64, 0xee, 0xc6, 0x4a, 0xd8, 0x15, 0x9d, 0x70, 0xfd, 0x6a, 0xe9,
+    0x40, 0xef, 0xc3, 0x47, 0x53, 0x32, 0x66, 0xc9, 0xaa, 0xf8, 0xc9, 0xaf, 0x42, 0x31, 0xb2, 0x3d, 0xfa, 0x2a, 0xc8, 0xb5,
+    0x04, 0x79, 0x22, 0xaf, 0xb3, 0x7d, 0x9e, 0xd8, 0xb8, 0xfb, 0xc7, 0x85, 0xfa, 0xd6, 0x15, 0x15, 0xdd, 0x8c, 0x71, 0x95,
+    0x7d, 0x95, 0x29, 0x4f, 0xb2, 0x39, 0x89, 0x0e, 0x4d, 0x35, 0x17, 0x26, 0xbd, 0x85, 0x1b, 0x23, 0xca, 0xa6, 0xac, 0x8f,
+    0xff, 0xd2, 0xa7, 0x6d, 0x16, 0x48, 0xad, 0x9b, 0x58, 0xba, 0x57, 0xb5, 0x5c, 0x9a, 0xd2, 0x35, 0x21, 0x4c, 0x0a, 0x95,
+    0xb8, 0x15, 0xe6, 0x35, 0x76, 0x71, 0x2d, 0x59, 0x52, 0x77, 0xe0, 0xd6, 0x5d, 0xc3, 0xf5, 0xae, 0xaa, 0x30, 0x3d, 0x7c,
+    0x2c, 0x4a, 0x2e, 0x72, 0x68, 0x8d, 0x72, 0x6b, 0xb6, 0xd6, 0x47, 0xb7, 0x0d, 0x11, 0xa5, 0x6b, 0x17, 0x4a, 0x6d, 0xcb,
+    0x79, 0xb7, 0x1b, 0x07, 0xdd, 0x8f, 0x8f, 0xc7, 0xbf, 0xf9, 0xf6, 0xae, 0x6b, 0x5e, 0x57, 0x3c, 0x1c, 0xf2, 0xb7, 0x2d,
+    0x0e, 0x5e, 0xef, 0xfe, 0x09, 0xff, 0xd3, 0xc1, 0x33, 0x46, 0x4f, 0xde, 0xfd, 0x2a, 0x78, 0x5e, 0x32, 0x7e, 0xf7, 0xe9,
+    0x5e, 0xf4, 0xb3, 0x1c, 0x2a, 0x5f, 0x17, 0xe0, 0xff, 0x00, 0xc8, 0xe8, 0xe4, 0x92, 0x46, 0xad, 0xa9, 0x8f, 0x8e, 0x7f,
+    0x4a, 0xd8, 0xb6, 0x68, 0xc0, 0x1c, 0xfe, 0x95, 0xe5, 0xd7, 0xcc, 0xb0, 0xbf, 0xcd, 0xf8, 0x3f, 0xf2, 0x38, 0x6b, 0x29,
+    0x17, 0x56, 0x58, 0xc0, 0xfb, 0xdf, 0xa5, 0x32, 0x5b, 0x88, 0xc0, 0xfb, 0xdf, 0xa5, 0x71, 0xac, 0xc3, 0x0a, 0xdf, 0xc5,
+    0xf8, 0x3f, 0xf2, 0x32, 0xa7, 0x4e, 0x4d, 0x99, 0xd7, 0x17, 0x51, 0xf3, 0xf3, 0x7e, 0x95, 0x99, 0x35, 0xcc, 0x64, 0xfd,
+    0xef, 0xd2, 0xbb, 0xe9, 0x63, 0xf0, 0xbf, 0xcd, 0xf8, 0x3f, 0xf2, 0x3d, 0xec, 0x2d, 0x29, 0x15, 0xfc, 0xe8, 0xc9, 0xfb,
+    0xdf, 0xa5, 0x5a, 0x81, 0xa3, 0x24, 0x7c, 0xdf, 0xa5, 0x6d, 0x3c, 0xc7, 0x0a, 0x97, 0xc5, 0xf8, 0x3f, 0xf2, 0x3d, 0x3e,
+    0x49, 0x24, 0x7f, 0xff, 0xd4, 0xba, 0xd7, 0x11, 0xdb, 0xdb, 0x97, 0x0d, 0xf3, 0x1e, 0x17, 0x8e, 0xf5, 0x5e, 0xdd, 0xa3,
+    0x00, 0x7c, 0xdf, 0xa5, 0x75, 0xc7, 0x31, 0xc2, 0xd9, 0xbe, 0x6f, 0xc1, 0xff, 0x00, 0x91, 0xc5, 0x9e, 0xca, 0x52, 0xab,
+    0x18, 0x76, 0x5f, 0x99, 0xc9, 0xa2, 0xe4, 0xd6, 0x85, 0xb4, 0x59, 0xc5, 0x78, 0xf5, 0x34, 0x47, 0xb7, 0x37, 0x64, 0x6c,
+    0x5a, 0xc5, 0xd2, 0xb5, 0x21, 0x4c, 0x0a, 0xf2, 0x6b, 0x6e, 0x79, 0xb5, 0x1e, 0xa4, 0xad, 0xc0, 0xaa, 0x93, 0xbe, 0x05,
+    0x65, 0x08, 0xea, 0x6b, 0x41, 0x5d, 0x99, 0x77, 0x0f, 0xd6, 0xa8, 0xb9, 0xc9, 0xaf, 0x46, 0x9c, 0x34, 0x3e, 0x83, 0x0f,
+    0x1b, 0x23, 0xff, 0xd5, 0xcc, 0x8d, 0x72, 0x6b, 0x4a, 0xd6, 0x2e, 0x95, 0xe3, 0xd5, 0xd8, 0xfa, 0xa9, 0xbb, 0x21, 0xb7,
+    0x2d, 0xe6, 0xdc, 0x6c, 0x1f, 0x76, 0x3e, 0x3f, 0x1e, 0xff, 0x00, 0xe7, 0xda, 0xa6, 0x89, 0x30, 0x2b, 0x27, 0x1b, 0x45,
+    0x23, 0xf3, 0xbc, 0x7d, 0x5f, 0x6b, 0x88, 0x9c, 0xbc, 0xff, 0x00, 0x2d, 0x0e, 0x76, 0x14, 0xc9, 0xad, 0x5b, 0x58, 0xba,
+    0x57, 0xa3, 0x5b, 0x63, 0xe9, 0x2a, 0xbd, 0x0d, 0x8b, 0x68, 0xf0, 0x05, 0x5d, 0x55, 0xc0, 0xaf, 0x26, 0xa2, 0xbb, 0x3c,
+    0xe9, 0x3b, 0xb1, 0x92, 0xb6, 0x05, 0x67, 0x5c, 0x3f, 0x5a, 0xba, 0x50, 0x3b, 0xb0, 0xd1, 0xd4, 0xff, 0xd6, 0xa7, 0x33,
+    0x64, 0xd5, 0x7c, 0x64, 0xd7, 0x0c, 0x63, 0x64, 0x7d, 0x35, 0x15, 0x64, 0x5a, 0x82, 0x3c, 0x91, 0x57, 0xd9, 0xbe, 0xcf,
+    0x6e, 0x5c, 0x7d, 0xe3, 0xc2, 0xfd, 0x6b, 0x0a, 0x8a, 0xee, 0xc6, 0x38, 0xca, 0xbe, 0xca, 0x94, 0xa7, 0xd9, 0x15, 0xed,
+    0xe3, 0xc0, 0x15, 0x6c, 0x0c, 0x0a, 0x89, 0xab, 0xb3, 0xf3, 0x97, 0xab, 0x30, 0xad, 0xa2, 0xc9, 0x15, 0xb3, 0x6b, 0x17,
+    0x4a, 0xec, 0xae, 0x7d, 0x55, 0x69, 0x1a, 0x90, 0xa6, 0x05, 0x4a, 0xdc, 0x0a, 0xf3, 0x5a, 0xbb, 0x38, 0x96, 0xac, 0xff,
+    0xd7, 0xd2, 0x9d, 0xeb, 0x2e, 0xe1, 0xfa, 0xd7, 0x97, 0x46, 0x07, 0x76, 0x16, 0x25, 0x07, 0x39, 0x34, 0xb1, 0xae, 0x4d,
+    0x76, 0x5a, 0xc8, 0xf6, 0xe1, 0xa2, 0x34, 0x6d, 0x62, 0xe9, 0x49, 0x72, 0xde, 0x6d, 0xc6, 0xc1, 0xf7, 0x63, 0xe3, 0xf1,
+    0xef, 0xfe, 0x7d, 0xab, 0x9a, 0xd7, 0x95, 0xcf, 0x07, 0x3c, 0xad, 0xcb, 0x43, 0x97, 0xbb, 0xff, 0x00, 0x82, 0x4d, 0x12,
+    0x60, 0x53, 0xdc, 0xe0, 0x54, 0x35, 0x76, 0x7c, 0x6c, 0x75, 0x66, 0x75, 0xac, 0x5d, 0x2b, 0x62, 0xda, 0x3c, 0x01, 0x5d,
+    0x15, 0xcf, 0xa5, 0xad, 0x23, 0xff, 0xd0, 0xde, 0x55, 0xc0, 0xa8, 0xe5, 0x6c, 0x0a, 0xf1, 0x94, 0x6e, 0xcc, 0x29, 0xab,
+    0xb3, 0x3a, 0xe5, 0xfa, 0xd6, 0x6c, 0xcd, 0x93, 0x5d, 0xf4, 0xa0, 0x7b, 0xb8, 0x58, 0x95, 0xf1, 0x93, 0x56, 0x60, 0x8f,
+    0x24, 0x56, 0xf3, 0x56, 0x47, 0xa6, 0xf4, 0x46, 0x83, 0x37, 0xd9, 0xed, 0x8b, 0x8f, 0xbc, 0x78, 0x5f, 0xad, 0x57, 0xb7,
+    0x8f, 0x00, 0x57, 0x34, 0x56, 0x8d, 0x9f, 0x19, 0x9e, 0xd5, 0xe6, 0xab, 0x18, 0x76, 0x5f, 0x99, 0x6c, 0x0c, 0x0a, 0x86,
+    0x66, 0xc0, 0xa9, 0x8c, 0x6e, 0xcf, 0x12, 0x92, 0xbb, 0x3f, 0xff, 0xd1, 0x9a, 0xd6, 0x2e, 0x95, 0xa9, 0x0a, 0x60, 0x57,
+    0x1d, 0x6d, 0xcc, 0x2a, 0x3d, 0x49, 0x9b, 0x81, 0x54, 0xe7, 0x7c, 0x03, 0x59, 0x42, 0x3a, 0x9a, 0x50, 0x57, 0x66, 0x65,
+    0xc3, 0xf5, 0xaa, 0x0e, 0x72, 0x6b, 0xd1, 0xa7, 0x0d, 0x0f, 0xa0, 0xc3, 0xc7, 0x41, 0x63, 0x5c, 0x9a, 0xd1, 0xb5, 0x8b,
+    0xa5, 0x2a, 0xbb, 0x1d, 0x53, 0x76, 0x43, 0x6e, 0x5b, 0xcd, 0xb8, 0xd8, 0x3e, 0xec, 0x7c, 0x7e, 0x3d, 0xff, 0x00, 0xcf,
+    0xb5, 0x4f, 0x12, 0x60, 0x56, 0x2e, 0x36, 0x8a, 0x47, 0xe7, 0x58, 0xfa, 0xbe, 0xd7, 0x11, 0x39, 0x79, 0xfe, 0x5a, 0x1f,
+    0xff, 0xd2, 0xb6, 0xe7, 0x02, 0xa9, 0x5c, 0x3f, 0x5a, 0xc6, 0x9c, 0x75, 0x3e, 0x7f, 0x0f, 0x1b, 0xb3, 0x56, 0xda, 0x3c,
+    0x01, 0x57, 0x95, 0x70, 0x2b, 0x2a, 0x8a, 0xec, 0xf5, 0x64, 0xee, 0xc8, 0xe5, 0x6c, 0x0a, 0xce, 0xb8, 0x7e, 0xb5, 0x74,
+    0xa0, 0x77, 0x61, 0xa3, 0xa9, 0x99, 0x33, 0x64, 0xd4, 0x18, 0xc9, 0xaf, 0x42, 0x31, 0xb2, 0x3e, 0x82, 0x8a, 0xb2, 0x2c,
+    0xc1, 0x1e, 0x4d, 0x5f, 0x66, 0xfb, 0x3d, 0xb9, 0x71, 0xf7, 0x8f, 0x0b, 0xf5, 0xac, 0x2a, 0x2b, 0xbb, 0x18, 0x63, 0x2a,
+    0xfb, 0x2a, 0x52, 0x9f, 0x64, 0x7f, 0xff, 0xd3, 0x75, 0xbc, 0x78, 0x02, 0xae, 0x01, 0x81, 0x4a, 0x6a, 0xec, 0xf9, 0x56,
+    0xee, 0xc8, 0x66, 0x6c, 0x0a, 0xcd, 0xb9, 0x7e, 0xb5, 0xad, 0x28, 0x1e, 0x8e, 0x1a, 0x27, 0x4f, 0x0a, 0x60, 0x54, 0xad,
+    0xc0, 0xae, 0x36, 0xae, 0xce, 0xd5, 0xab, 0x2a, 0x4e, 0xfc, 0x56, 0x5d, 0xc3, 0xf5, 0xae, 0xaa, 0x30, 0x3d, 0x7c, 0x2c,
+    0x4a, 0x2e, 0x72, 0x69, 0x63, 0x5c, 0x9a, 0xed, 0xb5, 0x91, 0xed, 0xc3, 0x44, 0x7f, 0xff, 0xd4, 0x9e, 0xd6, 0x2e, 0x94,
+    0xdb, 0x96, 0xf3, 0x6e, 0x36, 0x0f, 0xbb, 0x1f, 0x1f, 0x8f, 0x7f, 0xf3, 0xed, 0x5b, 0x5a, 0xf2, 0xb9, 0xd1, 0x9e, 0x56,
+    0xe5, 0xa1, 0xcb, 0xdd, 0xff, 0x00, 0xc1, 0x26, 0x89, 0x30, 0x29, 0xee, 0x70, 0x2b, 0x36, 0xae, 0xcf, 0x8c, 0x8e, 0xac,
+    0xa5, 0x70, 0xfd, 0x6b, 0x2e, 0xe1, 0xfa, 0xd7, 0x65, 0x18, 0x1e, 0xd6, 0x16, 0x27, 0x6c, 0xab, 0x81, 0x4c, 0x95, 0xb0,
+    0x2b, 0xcf, 0x51, 0xbb, 0x36, 0xa6, 0xae, 0xcc, 0xeb, 0x87, 0xeb, 0x59, 0x93, 0x36, 0x4d, 0x77, 0xd2, 0x81, 0xef, 0x61,
+    0x62, 0x7f, 0xff, 0xd5, 0xa7, 0x8c, 0x9a, 0xb5, 0x04, 0x79, 0x35, 0xe9, 0xcd, 0x59, 0x1f, 0x4c, 0xf4, 0x45, 0xf6, 0x6f,
+    0xb3, 0xdb, 0x17, 0x1f, 0x78, 0xf0, 0xbf, 0x5a, 0xaf, 0x6f, 0x1e, 0x00, 0xae, 0x78, 0xad, 0x1b, 0x3e, 0x33, 0x3d, 0xab,
+    0xcd, 0x56, 0x30, 0xec, 0xbf, 0x32, 0xd8, 0x18, 0x15, 0x0c, 0xcd, 0x81, 0x51, 0x18, 0xdd, 0x9e, 0x25, 0x25, 0x76, 0x66,
+    0xdc, 0xbf, 0x5a, 0xce, 0x99, 0xb2, 0x6b, 0xd0, 0xa5, 0x03, 0xde, 0xc3, 0x44, 0xef, 0x9b, 0x81, 0x55, 0x27, 0x7c, 0x03,
+    0x5e, 0x64, 0x23, 0xa9, 0x74, 0x15, 0xd9, 0xff, 0xd6, 0x9a, 0xe1, 0xfa, 0xd5, 0x17, 0x39, 0x35, 0xeb, 0x53, 0x86, 0x87,
+    0xb5, 0x87, 0x8e, 0x81, 0x1a, 0xe4, 0xd6, 0x95, 0xac, 0x5d, 0x29, 0x55, 0xd8, 0xe9, 0x9b, 0xb2, 0x1b, 0x72, 0xde, 0x6d,
+    0xc6, 0xc1, 0xf7, 0x63, 0xe3, 0xf1, 0xef, 0xfe, 0x7d, 0xaa, 0x68, 0x93, 0x02, 0xb2, 0x71, 0xb4, 0x52, 0x3f, 0x3b, 0xc7,
+    0xd5, 0xf6, 0xb8, 0x89, 0xcb, 0xcf, 0xf2, 0xd0, 0x7b, 0x9c, 0x0a, 0xa5, 0x70, 0xfd, 0x68, 0xa7, 0x1d, 0x48, 0xc3, 0xc6,
+    0xec, 0xcb, 0xb8, 0x7e, 0xb5, 0x49, 0x8e, 0x4d, 0x7a, 0x54, 0xe3, 0xa1, 0xf4, 0x34, 0x23, 0x64, 0x7f, 0xff, 0xd9,
+};
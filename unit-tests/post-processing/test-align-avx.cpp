@@ -0,0 +1,186 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+// The AVX2 and AVX-512 align kernels do the generic align's math one operation at a time, in the same order: the
+// aligned frames have to be exactly the same, pixel for pixel, on any depth and with any of the distortion models.
+
+#include <src/proc/align.h>
+#include <src/proc/avx/avx-align.h>
+#include <src/core/frame-callback.h>
+#include <src/core/frame-holder.h>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include "../catch.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+// Not a multiple of 8 or 16, so every row ends with a partial batch
+int const W = 83;
+int const H = 37;
+
+
+// Depth and color on a software device, with random depth (zero in places, and over the whole 16-bit range) and a
+// random color image
+struct scene
+{
+    rs2::software_device dev;
+    rs2::software_sensor depth_sensor, color_sensor;
+    rs2::stream_profile depth, color;
+    std::vector< uint16_t > depth_pixels;
+    std::vector< uint8_t > color_pixels;
+    rs2::syncer sync;
+    int n = 0;
+
+    scene( rs2_distortion color_model, unsigned seed )
+        : depth_sensor( dev.add_sensor( "Depth" ) )
+        , color_sensor( dev.add_sensor( "Color" ) )
+        , depth_pixels( W * H )
+        , color_pixels( W * H * 3 )
+    {
+        std::mt19937 rng( seed );
+        std::uniform_real_distribution< float > u( -1, 1 );
+        rs2_intrinsics depth_intrin{ W, H, W / 2.f + u( rng ), H / 2.f + u( rng ), 60.f + u( rng ), 60.f + u( rng ),
+                                     RS2_DISTORTION_BROWN_CONRADY,
+                                     { 0.1f * u( rng ), 0.05f * u( rng ), 0.001f * u( rng ), 0.001f * u( rng ), 0.01f * u( rng ) } };
+        rs2_intrinsics color_intrin{ W, H, W / 2.f + 2 * u( rng ), H / 2.f + 2 * u( rng ), 70.f + 5 * u( rng ),
+                                     70.f + 5 * u( rng ), color_model,
+                                     { 0.1f * u( rng ), 0.05f * u( rng ), 0.001f * u( rng ), 0.001f * u( rng ), 0.01f * u( rng ) } };
+        depth = depth_sensor.add_video_stream( { RS2_STREAM_DEPTH, 0, 0, W, H, 30, 2, RS2_FORMAT_Z16, depth_intrin } );
+        color = color_sensor.add_video_stream( { RS2_STREAM_COLOR, 0, 1, W, H, 30, 3, RS2_FORMAT_RGB8, color_intrin } );
+        float const a = 0.02f * u( rng );
+        depth.register_extrinsics_to( color, { { std::cos( a ), 0.001f * u( rng ), -std::sin( a ), 0.001f * u( rng ), 1,
+                                                 0.001f * u( rng ), std::sin( a ), 0.001f * u( rng ), std::cos( a ) },
+                                               { 0.015f + 0.01f * u( rng ), 0.001f * u( rng ), 0.001f * u( rng ) } } );
+        dev.create_matcher( RS2_MATCHER_DEFAULT );
+
+        std::uniform_int_distribution< int > any( 0, 0xFFFF );
+        for( auto & d : depth_pixels )
+            d = any( rng ) % 5 ? uint16_t( any( rng ) % 3 ? 200 + any( rng ) % 3000 : any( rng ) ) : 0;
+        for( auto & c : color_pixels )
+            c = uint8_t( any( rng ) );
+
+        depth_sensor.open( depth );
+        depth_sensor.start( sync );
+        color_sensor.open( color );
+        color_sensor.start( sync );
+    }
+
+    ~scene()
+    {
+        for( auto * s : { &depth_sensor, &color_sensor } )
+        {
+            s->stop();
+            s->close();
+        }
+    }
+
+    rs2::frameset frames()
+    {
+        ++n;
+        depth_sensor.on_video_frame( { depth_pixels.data(), []( void * ) {}, W * 2, 2, n * 33.,
+                                       RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, n, depth.get(), 0.001f } );
+        color_sensor.on_video_frame( { color_pixels.data(), []( void * ) {}, W * 3, 3, n * 33.,
+                                       RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, n, color.get() } );
+        rs2::frameset fs;
+        REQUIRE( sync.try_wait_for_frames( &fs ) );
+        REQUIRE( fs.size() == 2 );
+        return fs;
+    }
+};
+
+
+// Runs one of the align implementations on a frameset, and gives the bytes of the aligned frame
+template< class T >
+class test_align : public T
+{
+public:
+    template< class... Args >
+    test_align( Args... args )
+        : T( args... )
+    {
+        this->set_output_callback( make_frame_callback( [this]( frame_interface * f ) {
+            _out = frame_holder( f );
+        } ) );
+    }
+
+    std::vector< uint8_t > align( rs2::frameset const & fs )
+    {
+        auto f = (frame_interface *)fs.get();
+        f->acquire();
+        this->invoke( frame_holder( f ) );
+        REQUIRE( _out );
+        auto out = rs2::frameset( rs2::frame( (rs2_frame *)_out.frame ) );
+        _out.frame->acquire();  // for the rs2::frame
+        _out = {};
+        auto aligned = this->_to_stream_type == RS2_STREAM_DEPTH ? out.get_color_frame().as< rs2::video_frame >()
+                                                                 : out.get_depth_frame().as< rs2::video_frame >();
+        REQUIRE( aligned );
+        auto data = static_cast< uint8_t const * >( aligned.get_data() );
+        return std::vector< uint8_t >( data, data + aligned.get_stride_in_bytes() * aligned.get_height() );
+    }
+
+private:
+    frame_holder _out;
+};
+
+
+// align_avx with the kernels picked by the test rather than by the CPU
+class avx_kernels : public align_avx
+{
+public:
+    avx_kernels( rs2_stream to, bool avx512 )
+        : align_avx( to, avx512 )
+    {
+    }
+};
+
+
+void check_same_as_generic( bool avx512 )
+{
+    unsigned seed = 0;
+    for( auto model : { RS2_DISTORTION_NONE, RS2_DISTORTION_MODIFIED_BROWN_CONRADY, RS2_DISTORTION_INVERSE_BROWN_CONRADY,
+                        RS2_DISTORTION_BROWN_CONRADY } )
+    {
+        for( int i = 0; i < 3; ++i )
+        {
+            scene sc( model, ++seed );
+            for( auto to : { RS2_STREAM_COLOR, RS2_STREAM_DEPTH } )
+            {
+                CAPTURE( model, seed, to );
+                test_align< align > generic( to );
+                test_align< avx_kernels > avx( to, avx512 );
+                auto const fs = sc.frames();
+                auto const expected = generic.align( fs );
+                REQUIRE( avx.align( fs ) == expected );
+            }
+        }
+    }
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "AVX2 align is the same as the generic align", "[align]" )
+{
+    if( ! align_avx::is_supported() )
+        return;
+    check_same_as_generic( false );
+}
+
+TEST_CASE( "AVX-512 align is the same as the generic align", "[align]" )
+{
+    if( ! align_avx::use_avx512() )
+        return;
+    check_same_as_generic( true );
+}
@@ -0,0 +1,265 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+// Align keeps what it can precompute from the calibration between frames, for each pair of streams it aligns. When the
+// device reports a new calibration, that has to be dropped for the pairs of streams actually aligned, and the output
+// must be what a fresh align gives.
+
+#include <src/proc/align.h>
+#include <src/proc/sse/sse-align.h>
+#include <src/proc/avx/avx-align.h>
+#include <src/core/frame-callback.h>
+#include <src/core/frame-holder.h>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include "../catch.h"
+
+#include <cstring>
+#include <utility>
+#include <vector>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+int const W = 64;
+int const H = 48;
+
+
+// Depth and color (and optionally infrared) on a software device, with depth sloping across the image and a color
+// gradient, so that any change in where pixels land shows in the output
+struct scene
+{
+    rs2::software_device dev;
+    rs2::software_sensor depth_sensor, color_sensor;
+    rs2::stream_profile depth, color, ir;
+    std::vector< uint16_t > depth_pixels;
+    std::vector< uint8_t > color_pixels;
+    rs2::syncer sync;
+    bool const with_ir;
+
+    explicit scene( bool with_ir_ = false )
+        : depth_sensor( dev.add_sensor( "Depth" ) )
+        , color_sensor( dev.add_sensor( "Color" ) )
+        , depth_pixels( W * H )
+        , color_pixels( W * H * 3 )
+        , with_ir( with_ir_ )
+    {
+        rs2_intrinsics depth_intrin{ W, H, W / 2.f, H / 2.f, 50.f, 50.f, RS2_DISTORTION_BROWN_CONRADY, { 0, 0, 0, 0, 0 } };
+        rs2_intrinsics color_intrin{ W, H, W / 2.f + 1, H / 2.f - 1, 55.f, 55.f, RS2_DISTORTION_INVERSE_BROWN_CONRADY,
+                                     { 0, 0, 0, 0, 0 } };
+        depth = depth_sensor.add_video_stream( { RS2_STREAM_DEPTH, 0, 0, W, H, 30, 2, RS2_FORMAT_Z16, depth_intrin } );
+        color = color_sensor.add_video_stream( { RS2_STREAM_COLOR, 0, 1, W, H, 30, 3, RS2_FORMAT_RGB8, color_intrin } );
+        set_extrinsics( { { 1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 0.015f, 0, 0 } } );
+        if( with_ir )
+        {
+            // The left imager: the same intrinsics as depth, and a slight turn from it
+            ir = depth_sensor.add_video_stream( { RS2_STREAM_INFRARED, 1, 2, W, H, 30, 1, RS2_FORMAT_Y8, depth_intrin } );
+            depth.register_extrinsics_to( ir, { { 0.9999f, 0, -0.01f, 0, 1, 0, 0.01f, 0, 0.9999f }, { 0, 0, 0 } } );
+        }
+        dev.create_matcher( RS2_MATCHER_DEFAULT );
+
+        for( int y = 0; y < H; ++y )
+            for( int x = 0; x < W; ++x )
+            {
+                depth_pixels[y * W + x] = uint16_t( x % 9 == 4 ? 0 : 400 + 10 * x + 3 * y );
+                auto rgb = &color_pixels[( y * W + x ) * 3];
+                rgb[0] = uint8_t( x * 4 );
+                rgb[1] = uint8_t( y * 5 );
+                rgb[2] = uint8_t( x ^ y );
+            }
+
+        if( with_ir )
+            depth_sensor.open( { depth, ir } );
+        else
+            depth_sensor.open( depth );
+        depth_sensor.start( sync );
+        color_sensor.open( color );
+        color_sensor.start( sync );
+    }
+
+    ~scene()
+    {
+        for( auto * s : { &depth_sensor, &color_sensor } )
+        {
+            s->stop();
+            s->close();
+        }
+    }
+
+    // What a calibration of the device changes
+    void set_extrinsics( rs2_extrinsics const & depth_to_color ) { depth.register_extrinsics_to( color, depth_to_color ); }
+
+    rs2::frameset frames( int n )
+    {
+        depth_sensor.on_video_frame( { depth_pixels.data(), []( void * ) {}, W * 2, 2, n * 33.,
+                                       RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, n, depth.get(), 0.001f } );
+        color_sensor.on_video_frame( { color_pixels.data(), []( void * ) {}, W * 3, 3, n * 33.,
+                                       RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, n, color.get() } );
+        if( with_ir )
+            depth_sensor.on_video_frame( { color_pixels.data(), []( void * ) {}, W, 1, n * 33.,
+                                           RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, n, ir.get() } );
+        rs2::frameset fs;
+        REQUIRE( sync.try_wait_for_frames( &fs ) );
+        REQUIRE( fs.size() == ( with_ir ? 3 : 2 ) );
+        return fs;
+    }
+};
+
+
+// Keeps track of what caches get reset, and lets us tell it the calibration changed
+template< class T >
+class test_align : public T
+{
+public:
+    std::vector< std::pair< rs2_stream, rs2_stream > > resets;
+
+    test_align( rs2_stream to )
+        : T( to )
+    {
+        this->set_output_callback( make_frame_callback( [this]( frame_interface * f ) {
+            _out = frame_holder( f );
+        } ) );
+    }
+
+    void calibration_changed() { this->on_calibration_change(); }
+
+    // Whether aligning depth and the other stream would have to compute the rays between them again
+    bool computes_rays( rs2::stream_profile const & depth, rs2::stream_profile const & other )
+    {
+        bool computed = false;
+        this->pre_compute_rays( depth,
+                                other,
+                                depth.as< rs2::video_stream_profile >().get_intrinsics(),
+                                depth.get_extrinsics_to( other ),
+                                &computed );
+        return computed;
+    }
+
+    // The bytes of the aligned frame
+    std::vector< uint8_t > align( rs2::frameset const & fs )
+    {
+        auto f = (frame_interface *)fs.get();
+        f->acquire();
+        this->invoke( frame_holder( f ) );
+        REQUIRE( _out );
+        auto out = rs2::frameset( rs2::frame( (rs2_frame *)_out.frame ) );
+        _out.frame->acquire();  // for the rs2::frame
+        _out = {};
+        auto aligned = this->_to_stream_type == RS2_STREAM_DEPTH ? out.get_color_frame().as< rs2::video_frame >()
+                                                                 : out.get_depth_frame().as< rs2::video_frame >();
+        REQUIRE( aligned );
+        auto data = static_cast< uint8_t const * >( aligned.get_data() );
+        return std::vector< uint8_t >( data, data + aligned.get_stride_in_bytes() * aligned.get_height() );
+    }
+
+protected:
+    void reset_cache( rs2_stream from, rs2_stream to ) override
+    {
+        resets.emplace_back( from, to );
+        T::reset_cache( from, to );
+    }
+
+private:
+    frame_holder _out;
+};
+
+
+template< class T >
+void check_calibration_change( rs2_stream to )
+{
+    scene sc;
+    test_align< T > aligner( to );
+    auto const before = aligner.align( sc.frames( 1 ) );
+    CHECK( aligner.align( sc.frames( 2 ) ) == before );
+
+    // A new calibration: a slight turn, and a different baseline
+    sc.set_extrinsics( { { 0.9998f, 0, -0.02f, 0, 1, 0, 0.02f, 0, 0.9998f }, { 0.04f, 0.002f, 0 } } );
+    aligner.resets.clear();
+    aligner.calibration_changed();
+    auto const fs = sc.frames( 3 );
+    auto const after = aligner.align( fs );
+
+    std::pair< rs2_stream, rs2_stream > const pair
+        = to == RS2_STREAM_DEPTH ? std::make_pair( RS2_STREAM_COLOR, RS2_STREAM_DEPTH )
+                                 : std::make_pair( RS2_STREAM_DEPTH, RS2_STREAM_COLOR );
+    REQUIRE( aligner.resets.size() == 1 );
+    CHECK( aligner.resets[0] == pair );
+
+    CHECK( after != before );
+    test_align< T > fresh( to );
+    CHECK( fresh.align( fs ) == after );
+}
+
+
+template< class T >
+void check_rays_kept_per_pair()
+{
+    scene sc( true );
+    test_align< T > aligner( RS2_STREAM_DEPTH );
+    test_align< align > generic( RS2_STREAM_DEPTH );
+
+    // Color and infrared take turns in each frameset: neither pushes out the other's rays
+    for( int n = 1; n <= 3; ++n )
+    {
+        auto const fs = sc.frames( n );
+        CHECK( aligner.align( fs ) == generic.align( fs ) );
+    }
+    CHECK( ! aligner.computes_rays( sc.depth, sc.color ) );
+    CHECK( ! aligner.computes_rays( sc.depth, sc.ir ) );
+
+    // Both are dropped on a new calibration, and computed again from it
+    aligner.resets.clear();
+    aligner.calibration_changed();
+    sc.set_extrinsics( { { 0.9998f, 0, -0.02f, 0, 1, 0, 0.02f, 0, 0.9998f }, { 0.04f, 0.002f, 0 } } );
+    auto const fs = sc.frames( 4 );
+    auto const after = aligner.align( fs );
+    CHECK( aligner.resets.size() == 2 );
+    CHECK( ! aligner.computes_rays( sc.depth, sc.color ) );
+    CHECK( ! aligner.computes_rays( sc.depth, sc.ir ) );
+    test_align< align > fresh( RS2_STREAM_DEPTH );
+    CHECK( fresh.align( fs ) == after );
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "generic align follows a calibration change", "[align]" )
+{
+    check_calibration_change< align >( RS2_STREAM_COLOR );
+    check_calibration_change< align >( RS2_STREAM_DEPTH );
+}
+
+#if defined( __SSSE3__ )
+TEST_CASE( "SSE align follows a calibration change", "[align]" )
+{
+    check_calibration_change< align_sse >( RS2_STREAM_COLOR );
+    check_calibration_change< align_sse >( RS2_STREAM_DEPTH );
+}
+#endif
+
+TEST_CASE( "AVX align follows a calibration change", "[align]" )
+{
+    if( ! align_avx::is_supported() )
+        return;
+    check_calibration_change< align_avx >( RS2_STREAM_COLOR );
+    check_calibration_change< align_avx >( RS2_STREAM_DEPTH );
+}
+
+
+TEST_CASE( "generic align keeps the rays of each pair of streams", "[align]" )
+{
+    check_rays_kept_per_pair< align >();
+}
+
+TEST_CASE( "AVX align keeps the rays of each pair of streams", "[align]" )
+{
+    if( ! align_avx::is_supported() )
+        return;
+    check_rays_kept_per_pair< align_avx >();
+}
@@ -0,0 +1,140 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+// The colorizer colors Z16 depth through a per-value table, and builds the histogram in bands across threads. Check
+// that it gives exactly what coloring each pixel separately did, with one thread and with several.
+
+#include <src/proc/synthetic-stream.h>
+#include <src/proc/colorizer.h>
+#include <src/core/options-container.h>
+
+#include "../catch.h"
+
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+int const W = 640;
+int const H = 480;
+
+
+class test_colorizer : public colorizer
+{
+public:
+    test_colorizer( int threads, bool equalize )
+        : colorizer( "Test Colorizer" )
+    {
+        get_option( RS2_OPTION_PROCESSING_THREADS ).set( float( threads ) );
+        _equalize = equalize;
+        _min = 0.3f;
+        _max = 4.f;
+        _depth_units = 0.001f;
+        _workers.update();
+    }
+
+    void select_map( int index ) { _map_index = index; }
+
+    std::vector< uint8_t > colorize( std::vector< uint16_t > const & depth )
+    {
+        std::vector< uint8_t > rgb( depth.size() * 3, 0xAB );
+        if( _equalize )
+            make_equalized_z16( depth.data(), rgb.data(), W, H );
+        else
+            make_value_cropped_z16( depth.data(), rgb.data(), W, H );
+        return rgb;
+    }
+
+    // How the colorizer used to do it: every pixel through the color map
+    std::vector< uint8_t > colorize_per_pixel( std::vector< uint16_t > const & depth )
+    {
+        std::vector< uint8_t > rgb( depth.size() * 3, 0xAB );
+        if( _equalize )
+        {
+            update_histogram( _hist_data, depth.data(), W, H );
+            auto coloring_function = [this]( float data ) {
+                auto hist_data = _hist_data[(int)data];
+                auto pixels = (float)_hist_data[MAX_DEPTH - 1];
+                return ( hist_data / pixels );
+            };
+            make_rgb_data< uint16_t >( depth.data(), rgb.data(), W, H, coloring_function );
+        }
+        else
+        {
+            auto min = _min;
+            auto max = _max;
+            auto coloring_function = [&, this]( float data ) {
+                if( min >= max )
+                    return 0.f;
+                return ( data * _depth_units - min ) / ( max - min );
+            };
+            make_rgb_data< uint16_t >( depth.data(), rgb.data(), W, H, coloring_function );
+        }
+        return rgb;
+    }
+};
+
+
+// Random depth over the whole Z16 range, with holes, and a band of near values like a real scene
+std::vector< uint16_t > make_depth( unsigned seed )
+{
+    std::mt19937 rng( seed );
+    std::uniform_int_distribution< int > any( 0, 0xFFFF );
+    std::uniform_int_distribution< int > near( 300, 4000 );
+    std::vector< uint16_t > depth( W * H );
+    for( size_t i = 0; i < depth.size(); ++i )
+    {
+        auto r = rng() % 10;
+        depth[i] = r == 0 ? 0 : r == 1 ? uint16_t( any( rng ) ) : uint16_t( near( rng ) );
+    }
+    depth[0] = 0xFFFF;
+    depth[1] = 1;
+    return depth;
+}
+
+
+void check_same_as_per_pixel( int threads, bool equalize )
+{
+    test_colorizer colorizer( threads, equalize );
+    for( unsigned frame = 0; frame < 3; ++frame )
+    {
+        // The table is kept between frames with a fixed range; make sure it's refreshed when the map changes
+        colorizer.select_map( frame );
+        auto depth = make_depth( frame );
+        auto expected = colorizer.colorize_per_pixel( depth );
+        auto actual = colorizer.colorize( depth );
+        REQUIRE( actual == expected );
+    }
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "Z16 equalized, one thread", "[colorizer]" )
+{
+    check_same_as_per_pixel( 1, true );
+}
+
+TEST_CASE( "Z16 equalized, several threads", "[colorizer]" )
+{
+    check_same_as_per_pixel( 4, true );
+    check_same_as_per_pixel( 0, true );  // one per core
+}
+
+TEST_CASE( "Z16 fixed range, one thread", "[colorizer]" )
+{
+    check_same_as_per_pixel( 1, false );
+}
+
+TEST_CASE( "Z16 fixed range, several threads", "[colorizer]" )
+{
+    check_same_as_per_pixel( 4, false );
+    check_same_as_per_pixel( 0, false );
+}
@@ -0,0 +1,183 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+// The 2x2 and 3x3 decimation medians are taken 8 output pixels at a time with SSSE3 or NEON, and the rest of each row
+// with the scalar opt_med* code. Either way, the output must be the median of the valid (non-zero) pixels of each
+// patch, the lower one for an even count, whatever the number of threads the rows are split across.
+
+#include <src/proc/decimation-filter.h>
+#include <src/core/frame-callback.h>
+#include <src/core/frame-holder.h>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include "../catch.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+// A depth sensor on a software device
+struct depth_source
+{
+    int const width, height;
+    rs2::software_device dev;
+    rs2::software_sensor sensor;
+    rs2::stream_profile depth;
+    rs2::frame_queue queue;
+    int n = 0;
+
+    depth_source( int w, int h )
+        : width( w )
+        , height( h )
+        , sensor( dev.add_sensor( "Depth" ) )
+    {
+        rs2_intrinsics intrin{ w, h, w / 2.f, h / 2.f, 100.f, 100.f, RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+        depth = sensor.add_video_stream( { RS2_STREAM_DEPTH, 0, 0, w, h, 30, 2, RS2_FORMAT_Z16, intrin } );
+        sensor.open( depth );
+        sensor.start( queue );
+    }
+
+    ~depth_source()
+    {
+        sensor.stop();
+        sensor.close();
+    }
+
+    rs2::frame frame( std::vector< uint16_t > & pixels )
+    {
+        ++n;
+        sensor.on_video_frame( { pixels.data(), []( void * ) {}, width * 2, 2, n * 33.,
+                                 RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, n, depth.get(), 0.001f } );
+        rs2::frame f;
+        REQUIRE( queue.try_wait_for_frame( &f ) );
+        return f;
+    }
+};
+
+
+// Random depth: anywhere from no holes to all holes, so that patches have any number of valid pixels, and values
+// over the whole 16-bit range, including ones that would be negative as int16_t
+std::vector< uint16_t > random_depth( int w, int h, int holes_percent, std::mt19937 & rng )
+{
+    std::uniform_int_distribution< int > percent( 0, 99 );
+    std::uniform_int_distribution< int > value( 1, 0xFFFF );
+    std::uniform_int_distribution< int > near( 1000, 1010 );
+    std::vector< uint16_t > depth( size_t( w ) * h );
+    for( auto & d : depth )
+        d = percent( rng ) < holes_percent ? 0 : uint16_t( percent( rng ) < 50 ? near( rng ) : value( rng ) );
+    return depth;
+}
+
+
+// What the decimation has to give: the lower median of the valid pixels of each patch for 2x2 and 3x3, or their mean
+// for bigger patches, zero-padded to a multiple of 4
+std::vector< uint16_t > expected_decimation( std::vector< uint16_t > const & depth, int w, int h, int scale )
+{
+    int const real_w = w / scale, real_h = h / scale;
+    int const padded_w = ( real_w + 3 ) / 4 * 4, padded_h = ( real_h + 3 ) / 4 * 4;
+    std::vector< uint16_t > out( size_t( padded_w ) * padded_h, 0 );
+    std::vector< uint16_t > valid;
+    for( int y = 0; y < real_h; ++y )
+        for( int x = 0; x < real_w; ++x )
+        {
+            valid.clear();
+            for( int dy = 0; dy < scale; ++dy )
+                for( int dx = 0; dx < scale; ++dx )
+                    if( auto d = depth[size_t( y * scale + dy ) * w + x * scale + dx] )
+                        valid.push_back( d );
+            if( valid.empty() )
+                continue;
+            auto & d = out[size_t( y ) * padded_w + x];
+            if( scale > 3 )
+                d = uint16_t( std::accumulate( valid.begin(), valid.end(), 0 ) / int( valid.size() ) );
+            else
+            {
+                std::sort( valid.begin(), valid.end() );
+                d = valid[( valid.size() - 1 ) / 2];
+            }
+        }
+    return out;
+}
+
+
+class test_decimation : public decimation_filter
+{
+public:
+    test_decimation( int scale, int threads )
+    {
+        get_option( RS2_OPTION_FILTER_MAGNITUDE ).set( float( scale ) );
+        get_option( RS2_OPTION_PROCESSING_THREADS ).set( float( threads ) );
+        set_output_callback( make_frame_callback( [this]( frame_interface * f ) { _out = frame_holder( f ); } ) );
+    }
+
+    std::vector< uint16_t > decimate( rs2::frame const & f )
+    {
+        auto fi = (frame_interface *)f.get();
+        fi->acquire();
+        invoke( frame_holder( fi ) );
+        REQUIRE( _out );
+        _out.frame->acquire();  // for the rs2::frame
+        auto out = rs2::frame( (rs2_frame *)_out.frame ).as< rs2::video_frame >();
+        _out = {};
+        REQUIRE( out );
+        auto data = static_cast< uint16_t const * >( out.get_data() );
+        return std::vector< uint16_t >( data, data + out.get_width() * out.get_height() );
+    }
+
+private:
+    frame_holder _out;
+};
+
+
+}  // namespace
+
+
+TEST_CASE( "decimation medians are the same with and without SIMD", "[decimation]" )
+{
+    std::mt19937 rng( 1 );
+    // Widths that leave 0 to 7 output pixels of each row to the scalar code, for both scales
+    for( auto size : { std::make_pair( 96, 24 ), std::make_pair( 100, 31 ), std::make_pair( 157, 40 ),
+                       std::make_pair( 848, 480 ) } )
+    {
+        depth_source source( size.first, size.second );
+        for( int scale : { 2, 3 } )
+            for( int threads : { 1, 4 } )
+            {
+                test_decimation decimation( scale, threads );
+                for( int holes : { 0, 10, 50, 90, 100 } )
+                {
+                    CAPTURE( size.first, size.second, scale, threads, holes );
+                    auto depth = random_depth( size.first, size.second, holes, rng );
+                    auto const expected = expected_decimation( depth, size.first, size.second, scale );
+                    CHECK( decimation.decimate( source.frame( depth ) ) == expected );
+                }
+            }
+    }
+}
+
+TEST_CASE( "decimation means do not depend on the threads", "[decimation]" )
+{
+    std::mt19937 rng( 2 );
+    depth_source source( 157, 83 );
+    for( int scale = 4; scale <= 8; ++scale )
+        for( int threads : { 1, 3, 0 } )
+        {
+            test_decimation decimation( scale, threads );
+            for( int holes : { 0, 50, 100 } )
+            {
+                CAPTURE( scale, threads, holes );
+                auto depth = random_depth( 157, 83, holes, rng );
+                auto const expected = expected_decimation( depth, 157, 83, scale );
+                CHECK( decimation.decimate( source.frame( depth ) ) == expected );
+            }
+        }
+}
@@ -0,0 +1,128 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+// When the decimation block has no frame to decimate into, it lets the frame through as is, and the blocks after it
+// in the chain work on that. The depth pipeline has to do the same: go on with the frame undecimated, rather than drop
+// it.
+
+#include <src/proc/depth-pipeline.h>
+#include <src/core/frame-callback.h>
+#include <src/core/frame-holder.h>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include "../catch.h"
+
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+int const W = 64;
+int const H = 48;
+
+
+// A depth sensor on a software device
+struct depth_source
+{
+    rs2::software_device dev;
+    rs2::software_sensor sensor;
+    rs2::stream_profile depth;
+    rs2::frame_queue queue;
+    int n = 0;
+
+    depth_source()
+        : sensor( dev.add_sensor( "Depth" ) )
+    {
+        rs2_intrinsics intrin{ W, H, W / 2.f, H / 2.f, 50.f, 50.f, RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+        depth = sensor.add_video_stream( { RS2_STREAM_DEPTH, 0, 0, W, H, 30, 2, RS2_FORMAT_Z16, intrin } );
+        sensor.open( depth );
+        sensor.start( queue );
+    }
+
+    ~depth_source()
+    {
+        sensor.stop();
+        sensor.close();
+    }
+
+    rs2::frame frame( std::vector< uint16_t > & pixels )
+    {
+        ++n;
+        sensor.on_video_frame( { pixels.data(), []( void * ) {}, W * 2, 2, n * 33.,
+                                 RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, n, depth.get(), 0.001f } );
+        rs2::frame f;
+        REQUIRE( queue.try_wait_for_frame( &f ) );
+        return f;
+    }
+};
+
+
+// A decimation block that never gets a frame to decimate into
+class no_frame_decimation : public decimation_filter
+{
+protected:
+    rs2::frame prepare_target_frame( const rs2::frame &, const rs2::frame_source &, rs2_extension ) override
+    {
+        return {};
+    }
+};
+
+
+class test_pipeline : public depth_pipeline
+{
+public:
+    test_pipeline( std::shared_ptr< decimation_filter > decimation )
+        : depth_pipeline( decimation, std::make_shared< spatial_filter >(), std::make_shared< temporal_filter >() )
+    {
+        set_output_callback( make_frame_callback( [this]( frame_interface * f ) { _out = frame_holder( f ); } ) );
+    }
+
+    std::vector< uint16_t > filter( rs2::frame const & f )
+    {
+        auto fi = (frame_interface *)f.get();
+        fi->acquire();
+        invoke( frame_holder( fi ) );
+        REQUIRE( _out );
+        _out.frame->acquire();  // for the rs2::frame
+        auto out = rs2::frame( (rs2_frame *)_out.frame ).as< rs2::depth_frame >();
+        _out = {};
+        REQUIRE( out );
+        CHECK( out.get() != f.get() );
+        REQUIRE( out.get_width() == W );
+        REQUIRE( out.get_height() == H );
+        auto data = static_cast< uint16_t const * >( out.get_data() );
+        return std::vector< uint16_t >( data, data + W * H );
+    }
+
+private:
+    frame_holder _out;
+};
+
+
+}  // namespace
+
+
+TEST_CASE( "depth pipeline goes on without decimation when the decimation lets the frame through", "[depth-pipeline]" )
+{
+    depth_source source;
+    test_pipeline undecimated( std::make_shared< no_frame_decimation >() );
+    test_pipeline without_decimation( nullptr );
+
+    std::mt19937 rng( 1 );
+    std::uniform_int_distribution< int > any( 0, 99 );
+    std::vector< uint16_t > depth( W * H );
+    for( int i = 0; i < 4; ++i )
+    {
+        for( auto & d : depth )
+            d = any( rng ) < 10 ? 0 : uint16_t( 1000 + any( rng ) );
+        auto const f = source.frame( depth );
+        CAPTURE( i );
+        CHECK( undecimated.filter( f ) == without_decimation.filter( f ) );
+    }
+}
@@ -140,6 +140,7 @@ class post_proccesing_filters:
         self.spatial_filter = rs.spatial_filter()
         self.temporal_filter = rs.temporal_filter()
         self.hole_filling_filter = rs.hole_filling_filter()
+        self.depth_pipeline = None
 
     def configure(self,filters_cfg):
         #Reconfigure the post-processing according to the test spec
@@ -183,6 +184,19 @@ class post_proccesing_filters:
 
         return processed
 
+    def process_fused(self, frame_input):
+        # The same chain, run by the fused depth pipeline over the same (configured) filters
+        if not self.depth_pipeline:
+            self.depth_pipeline = rs.depth_pipeline(self.decimation_filter if self.use_decimation else None,
+                                                    self.spatial_filter if self.use_spatial else None,
+                                                    self.temporal_filter if self.use_temporal else None)
+        processed = self.depth_pipeline.process(frame_input)
+
+        if self.use_holes:
+            processed = self.hole_filling_filter.process(processed)
+
+        return processed
+
 class ppf_test_config:
     def __init__(self):
         self.name = ""
@@ -492,6 +506,50 @@ with test.closure("Post-Processing Filters sequence validation"):
         depth_sensor.stop()
         depth_sensor.close()
 ################################################################################################
+with test.closure("Fused depth pipeline matches the chained filters"):
+    test_cfg = ppf_test_config()
+    for first_element, second_element in ppf_test_cases:
+        if not load_test_configuration(first_element, test_cfg):
+            continue
+
+        # Each keeps its own temporal history
+        chained = post_proccesing_filters()
+        chained.configure(test_cfg)
+        fused = post_proccesing_filters()
+        fused.configure(test_cfg)
+
+        sw_dev = rs.software_device()
+        depth_sensor = sw_dev.add_sensor("Depth")
+
+        depth_intrinsics = create_depth_intrinsics(test_cfg)
+
+        vs = create_video_stream(test_cfg, depth_intrinsics)
+        depth_stream_profile = depth_sensor.add_video_stream(vs)
+        depth_sensor.add_read_only_option(rs.option.depth_units, test_cfg.depth_units)
+        depth_sensor.add_read_only_option(rs.option.stereo_baseline, test_cfg.stereo_baseline_mm)
+
+        sw_dev.create_matcher(rs.matchers.dlr_c)
+        sync = rs.syncer()
+
+        depth_sensor.open(depth_stream_profile)
+        depth_sensor.start(sync)
+
+        frames = test_cfg.frames_sequence_size if test_cfg.frames_sequence_size > 1 else 1
+        for i in range(frames):
+            frame = create_frame(test_cfg, depth_stream_profile, i)
+            depth_sensor.on_video_frame(frame)
+
+            fset = sync.wait_for_frames()
+            depth = fset.first_or_default(rs.stream.depth)
+
+            chained_depth = chained.process(depth)
+            fused_depth = fused.process_fused(depth)
+            validate_ppf_results(fused_depth, test_cfg, i)
+            test.check_equal(bytearray(fused_depth.get_data()), bytearray(chained_depth.get_data()))
+
+        depth_sensor.stop()
+        depth_sensor.close()
+################################################################################################
 with test.closure("Post-Processing Filters metadata validation"):
     test_cfg = ppf_test_config()
     for first_element, second_element in ppf_test_cases:
@@ -0,0 +1,91 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+// The MJPEG decoder cuts frames with restart markers into bands and decodes them in parallel. The output has to be
+// exactly what decoding the whole frame in one pass gives.
+
+#include <src/proc/mjpeg-decoder.h>
+#include <rsutils/concurrency/worker-pool.h>
+
+#include "mjpeg-test-images.h"
+#include "../catch.h"
+
+#include <vector>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+struct test_image
+{
+    uint8_t const * data;
+    size_t size;
+    int width, height;
+};
+
+test_image const images[] = {
+    { jpeg_420_row_restarts, sizeof( jpeg_420_row_restarts ), 128, 80 },
+    { jpeg_422_unaligned_restarts, sizeof( jpeg_422_unaligned_restarts ), 96, 160 },
+};
+
+rs2_format const formats[] = { RS2_FORMAT_RGB8, RS2_FORMAT_BGR8, RS2_FORMAT_RGBA8, RS2_FORMAT_Y8 };
+
+int bytes_per_pixel( rs2_format format )
+{
+    return format == RS2_FORMAT_Y8 ? 1 : format == RS2_FORMAT_RGBA8 ? 4 : 3;
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "band decode is the same as a single pass", "[mjpeg]" )
+{
+    rsutils::concurrency::worker_pool pool2( 2 ), pool3( 3 ), pool4( 4 );
+    for( auto const & image : images )
+    {
+        // Padding after the EOI, as UVC buffers have, must not be mistaken for data
+        std::vector< uint8_t > jpeg( image.data, image.data + image.size );
+        jpeg.resize( jpeg.size() + 256, 0 );
+
+        for( auto format : formats )
+        {
+            size_t const frame_size = size_t( image.width ) * image.height * bytes_per_pixel( format );
+
+            mjpeg_decoder decoder;
+            std::vector< uint8_t > single_pass( frame_size, 0xAB );
+            REQUIRE( decoder.decode( jpeg.data(), jpeg.size(), format, single_pass.data(), image.width, image.height,
+                                     nullptr ) );
+            CHECK( decoder.last_bands() == 1 );
+
+            for( auto pool : { &pool2, &pool3, &pool4 } )
+            {
+                std::vector< uint8_t > bands( frame_size, 0xCD );
+                REQUIRE( decoder.decode( jpeg.data(), jpeg.size(), format, bands.data(), image.width, image.height,
+                                         pool ) );
+                CHECK( decoder.last_bands() > 1 );
+                REQUIRE( bands == single_pass );
+            }
+        }
+    }
+}
+
+TEST_CASE( "truncated frames are not read past their end", "[mjpeg]" )
+{
+    rsutils::concurrency::worker_pool pool( 4 );
+    for( auto const & image : images )
+    {
+        std::vector< uint8_t > frame( size_t( image.width ) * image.height * 3 );
+        for( size_t size : { image.size / 2, image.size - 2, size_t( 100 ) } )
+        {
+            // A buffer of exactly 'size', so anything reading past it shows up under a sanitizer
+            std::vector< uint8_t > jpeg( image.data, image.data + size );
+            mjpeg_decoder decoder;
+            decoder.decode( jpeg.data(), jpeg.size(), RS2_FORMAT_RGB8, frame.data(), image.width, image.height, &pool );
+        }
+    }
+}
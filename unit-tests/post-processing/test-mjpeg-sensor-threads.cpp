@@ -0,0 +1,195 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+// A sensor exposes the options of the processing blocks converting its streams while they are open: that's how the
+// user gets to set RS2_OPTION_PROCESSING_THREADS for MJPEG decoding. The block's stream filters stay out of it.
+
+#include <src/sensor.h>
+#include <src/stream.h>
+#include <src/api.h>
+#include <src/proc/color-formats-converter.h>
+#include <src/proc/mjpeg-decoder.h>
+#include <src/core/frame-callback.h>
+#include <src/core/frame-holder.h>
+#include <src/core/video-frame.h>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include "mjpeg-test-images.h"
+#include "../catch.h"
+
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+int const W = 128;
+int const H = 80;
+
+
+// A raw sensor with a single MJPEG color profile, sending whatever it's given
+class mjpeg_camera : public raw_sensor_base
+{
+    std::shared_ptr< stream_profile_interface > _active;
+
+public:
+    explicit mjpeg_camera( device * owner )
+        : raw_sensor_base( "MJPEG Camera", owner )
+    {
+    }
+
+    stream_profiles init_stream_profiles() override
+    {
+        auto profile = std::make_shared< video_stream_profile >();
+        profile->set_stream_type( RS2_STREAM_COLOR );
+        profile->set_stream_index( 0 );
+        profile->set_format( RS2_FORMAT_MJPEG );
+        profile->set_framerate( 30 );
+        profile->set_dims( W, H );
+        return { profile };
+    }
+
+    void open( stream_profiles const & requests ) override
+    {
+        _source.init( _metadata_parsers );
+        _source.set_sensor( _source_owner->shared_from_this() );
+        _active = requests.front();
+        set_active_streams( requests );
+        _is_opened = true;
+    }
+
+    void close() override
+    {
+        _is_opened = false;
+        set_active_streams( {} );
+        _active.reset();
+    }
+
+    void start( rs2_frame_callback_sptr callback ) override
+    {
+        _source.set_callback( callback );
+        _is_streaming = true;
+    }
+
+    void stop() override
+    {
+        _is_streaming = false;
+        _source.flush();
+    }
+
+    void send( uint8_t const * jpeg, size_t size, int number )
+    {
+        frame_additional_data data;
+        data.timestamp = number * 33.;
+        data.frame_number = number;
+        frame_holder fh = _source.alloc_frame( { RS2_STREAM_COLOR, 0, RS2_EXTENSION_VIDEO_FRAME },
+                                               size,
+                                               std::move( data ),
+                                               true );
+        REQUIRE( fh );
+        std::memcpy( (void *)fh->get_frame_data(), jpeg, size );
+        dynamic_cast< video_frame * >( fh.frame )->assign( W, H, W * 2, 16 );
+        fh->set_stream( _active );
+        _source.invoke_callback( std::move( fh ) );
+    }
+};
+
+
+// What the user gets from a color sensor converting MJPEG to RGB8
+struct color_sensor
+{
+    rs2::software_device dev;
+    std::shared_ptr< mjpeg_camera > raw;
+    std::shared_ptr< synthetic_sensor > sensor;
+    std::shared_ptr< stream_profile_interface > rgb;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector< std::vector< uint8_t > > frames;
+
+    color_sensor()
+    {
+        auto owner = std::dynamic_pointer_cast< device >( dev.get()->device );
+        REQUIRE( owner );
+        raw = std::make_shared< mjpeg_camera >( owner.get() );
+        sensor = std::make_shared< synthetic_sensor >( "RGB Camera", raw, owner.get() );
+        sensor->register_processing_block( processing_block_factory::create_pbf_vector< mjpeg_converter >(
+            RS2_FORMAT_MJPEG, { RS2_FORMAT_RGB8 }, RS2_STREAM_COLOR ) );
+        for( auto & profile : sensor->get_stream_profiles() )
+            if( profile->get_format() == RS2_FORMAT_RGB8 )
+                rgb = profile;
+        REQUIRE( rgb );
+    }
+
+    void start()
+    {
+        sensor->start( make_frame_callback(
+            [this]( frame_holder f )
+            {
+                auto data = static_cast< uint8_t const * >( f->get_frame_data() );
+                std::lock_guard< std::mutex > lock( mutex );
+                frames.emplace_back( data, data + f->get_frame_data_size() );
+                cv.notify_all();
+            } ) );
+    }
+
+    std::vector< uint8_t > next()
+    {
+        std::unique_lock< std::mutex > lock( mutex );
+        REQUIRE( cv.wait_for( lock, std::chrono::seconds( 2 ), [this] { return ! frames.empty(); } ) );
+        auto f = std::move( frames.front() );
+        frames.erase( frames.begin() );
+        return f;
+    }
+};
+
+
+}  // namespace
+
+
+TEST_CASE( "processing threads set through the sensor", "[mjpeg]" )
+{
+    color_sensor color;
+
+    // Not until there's a stream to convert
+    CHECK_FALSE( color.sensor->supports_option( RS2_OPTION_PROCESSING_THREADS ) );
+
+    color.sensor->open( { color.rgb } );
+    REQUIRE( color.sensor->supports_option( RS2_OPTION_PROCESSING_THREADS ) );
+    CHECK_FALSE( color.sensor->supports_option( RS2_OPTION_STREAM_FILTER ) );
+    CHECK_FALSE( color.sensor->supports_option( RS2_OPTION_STREAM_FORMAT_FILTER ) );
+    CHECK_FALSE( color.sensor->supports_option( RS2_OPTION_STREAM_INDEX_FILTER ) );
+
+    auto & threads = color.sensor->get_option( RS2_OPTION_PROCESSING_THREADS );
+    CHECK( threads.query() == 1 );
+    threads.set( 4 );
+    CHECK( threads.query() == 4 );
+
+    // Decoded in bands across the threads, it has to come out as it does in one pass
+    std::vector< uint8_t > single_pass( W * H * 3 );
+    mjpeg_decoder decoder;
+    REQUIRE( decoder.decode( jpeg_420_row_restarts, sizeof( jpeg_420_row_restarts ), RS2_FORMAT_RGB8,
+                             single_pass.data(), W, H, nullptr ) );
+
+    color.start();
+    for( int i = 0; i < 3; ++i )
+    {
+        color.raw->send( jpeg_420_row_restarts, sizeof( jpeg_420_row_restarts ), i );
+        CHECK( color.next() == single_pass );
+    }
+    color.sensor->stop();
+
+    // Gone with the stream, and back with the next
+    color.sensor->close();
+    CHECK_FALSE( color.sensor->supports_option( RS2_OPTION_PROCESSING_THREADS ) );
+    color.sensor->open( { color.rgb } );
+    CHECK( color.sensor->supports_option( RS2_OPTION_PROCESSING_THREADS ) );
+    color.sensor->close();
+}
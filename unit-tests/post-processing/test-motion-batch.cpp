@@ -0,0 +1,141 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+// A batched motion frame (RS2_OPTION_MOTION_BATCH_WINDOW) is converted all at once: the raw values are scaled by
+// convert_batch(), then the alignment and correction are applied together as one transform. Check this gives what
+// converting each sample and correcting it on its own does.
+
+#include <src/proc/synthetic-stream.h>
+#include <src/float3.h>
+#include <src/proc/motion-transform.h>
+#include <src/platform/hid-data.h>
+#include <src/option.h>
+
+#include "../catch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+size_t const N = 300;  // more than a batch ever holds
+
+
+template< class T >
+class batch_checker : public T
+{
+public:
+    template< class... Args >
+    batch_checker( bool correct, Args... args )
+        : T( nullptr,
+             correct ? std::make_shared< enable_motion_correction >( nullptr, option_range{ 0, 1, 1, 1 } ) : nullptr,
+             args... )
+    {
+        // A rotation, as an IMU mounted at an angle has, and a calibration that is not the identity
+        this->_imu2depth_cs_alignment_matrix = { { 0, 0, -1 }, { -1, 0, 0 }, { 0, 1, 0 } };
+        this->_accel_sensitivity = { { 1.01f, 0.002f, -0.003f }, { 0.001f, 0.99f, 0.004f }, { -0.002f, 0.003f, 1.02f } };
+        this->_accel_bias = { 0.05f, -0.12f, 0.08f };
+        this->_gyro_sensitivity = { { 0.98f, -0.001f, 0.002f }, { 0.003f, 1.03f, -0.001f }, { 0.001f, 0.002f, 0.97f } };
+        this->_gyro_bias = { -0.004f, 0.002f, 0.001f };
+    }
+
+    std::vector< rs2_motion_sample > convert_per_sample( std::vector< hid_batch_sample > const & raw, rs2_stream stream )
+    {
+        std::vector< rs2_motion_sample > out( raw.size() );
+        for( size_t i = 0; i < raw.size(); ++i )
+        {
+            float3 xyz;
+            uint8_t * const dest[] = { reinterpret_cast< uint8_t * >( &xyz ) };
+            this->_converter->convert( dest, reinterpret_cast< uint8_t const * >( &raw[i].data ) );
+            this->correct_motion_helper( &xyz, stream );  // what correct_motion() does to the frame data
+            out[i].data.x = xyz.x;
+            out[i].data.y = xyz.y;
+            out[i].data.z = xyz.z;
+            out[i].timestamp = raw[i].timestamp;
+            out[i].frame_number = raw[i].frame_number;
+        }
+        return out;
+    }
+
+    std::vector< rs2_motion_sample > convert_batch( std::vector< hid_batch_sample > const & raw, rs2_stream stream )
+    {
+        std::vector< rs2_motion_sample > out( raw.size() );
+        this->process_batch( out.data(), raw.data(), raw.size(), stream );
+        return out;
+    }
+};
+
+
+// Raw samples as the backend gives them; 16-bit sensors only fill the low bits of each field
+std::vector< hid_batch_sample > make_samples( bool high_accuracy, unsigned seed )
+{
+    std::mt19937 rng( seed );
+    std::uniform_int_distribution< int32_t > any;
+    std::uniform_int_distribution< int32_t > wide( -( 1 << 20 ), 1 << 20 );
+    std::vector< hid_batch_sample > samples( N );
+    for( size_t i = 0; i < N; ++i )
+    {
+        auto & s = samples[i];
+        auto & gen = high_accuracy ? wide : any;
+        s.data = { gen( rng ), gen( rng ), gen( rng ) };
+        s.timestamp = 1000. + i * 2.5;
+        s.frame_number = 100 + i;
+    }
+    // Extremes
+    samples[0].data = { 0, 0, 0 };
+    samples[1].data = high_accuracy ? hid_data{ -( 1 << 20 ), 1 << 20, 0 } : hid_data{ 0x7FFF, -0x8000, 0xFFFF };
+    return samples;
+}
+
+
+// The batch folds the calibration into the alignment, so the float rounding may differ in the last bits
+void check_same( std::vector< rs2_motion_sample > const & batch, std::vector< rs2_motion_sample > const & per_sample )
+{
+    REQUIRE( batch.size() == per_sample.size() );
+    for( size_t i = 0; i < batch.size(); ++i )
+    {
+        auto const & a = batch[i];
+        auto const & e = per_sample[i];
+        auto const tolerance
+            = 1e-5f * std::max( { 1.f, std::abs( e.data.x ), std::abs( e.data.y ), std::abs( e.data.z ) } );
+        CHECK( std::abs( a.data.x - e.data.x ) <= tolerance );
+        CHECK( std::abs( a.data.y - e.data.y ) <= tolerance );
+        CHECK( std::abs( a.data.z - e.data.z ) <= tolerance );
+        CHECK( a.timestamp == e.timestamp );
+        CHECK( a.frame_number == e.frame_number );
+    }
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "accel batch is the same as per-sample conversion", "[motion]" )
+{
+    for( bool high_accuracy : { false, true } )
+        for( bool correct : { false, true } )
+        {
+            batch_checker< acceleration_transform > accel( correct, high_accuracy );
+            auto raw = make_samples( high_accuracy, 1 );
+            check_same( accel.convert_batch( raw, RS2_STREAM_ACCEL ), accel.convert_per_sample( raw, RS2_STREAM_ACCEL ) );
+        }
+}
+
+TEST_CASE( "gyro batch is the same as per-sample conversion", "[motion]" )
+{
+    for( bool high_accuracy : { false, true } )
+        for( bool correct : { false, true } )
+        {
+            batch_checker< gyroscope_transform > gyro( correct, 0.1, high_accuracy );
+            auto raw = make_samples( high_accuracy, 2 );
+            check_same( gyro.convert_batch( raw, RS2_STREAM_GYRO ), gyro.convert_per_sample( raw, RS2_STREAM_GYRO ) );
+        }
+}
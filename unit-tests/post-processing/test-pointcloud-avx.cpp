@@ -0,0 +1,229 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+// The AVX2 pointcloud does the generic pointcloud's math one operation at a time, in the same order: the vertices and
+// texture coordinates have to be exactly the same, on random depth (with holes) and with any distortion model, up
+// to the last pixel of a row that doesn't fill a whole batch. The SSE pointcloud does the math in another order, and
+// only has to be close.
+
+#include <src/proc/pointcloud.h>
+#include <src/proc/sse/sse-pointcloud.h>
+#include <src/proc/avx/avx-pointcloud.h>
+#include <src/proc/occlusion-filter.h>
+#include <src/core/frame-callback.h>
+#include <src/core/frame-holder.h>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include "../catch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+// Depth and color on a software device, with random depth (zero in places, and over the whole 16-bit range)
+struct scene
+{
+    int const width, height;
+    rs2::software_device dev;
+    rs2::software_sensor depth_sensor, color_sensor;
+    rs2::stream_profile depth, color;
+    std::vector< uint16_t > depth_pixels;
+    std::vector< uint8_t > color_pixels;
+    rs2::syncer sync;
+    int n = 0;
+
+    scene( int w, int h, rs2_distortion depth_model, rs2_distortion color_model, unsigned seed )
+        : width( w )
+        , height( h )
+        , depth_sensor( dev.add_sensor( "Depth" ) )
+        , color_sensor( dev.add_sensor( "Color" ) )
+        , depth_pixels( w * h )
+        , color_pixels( w * h * 3 )
+    {
+        std::mt19937 rng( seed );
+        std::uniform_real_distribution< float > u( -1, 1 );
+        rs2_intrinsics depth_intrin{ w, h, w / 2.f + u( rng ), h / 2.f + u( rng ), 60.f + u( rng ), 60.f + u( rng ),
+                                     depth_model,
+                                     { 0.1f * u( rng ), 0.05f * u( rng ), 0.001f * u( rng ), 0.001f * u( rng ), 0.01f * u( rng ) } };
+        rs2_intrinsics color_intrin{ w, h, w / 2.f + 2 * u( rng ), h / 2.f + 2 * u( rng ), 70.f + 5 * u( rng ),
+                                     70.f + 5 * u( rng ), color_model,
+                                     { 0.1f * u( rng ), 0.05f * u( rng ), 0.001f * u( rng ), 0.001f * u( rng ), 0.01f * u( rng ) } };
+        depth = depth_sensor.add_video_stream( { RS2_STREAM_DEPTH, 0, 0, w, h, 30, 2, RS2_FORMAT_Z16, depth_intrin } );
+        color = color_sensor.add_video_stream( { RS2_STREAM_COLOR, 0, 1, w, h, 30, 3, RS2_FORMAT_RGB8, color_intrin } );
+        float const a = 0.02f * u( rng );
+        depth.register_extrinsics_to( color, { { std::cos( a ), 0.001f * u( rng ), -std::sin( a ), 0.001f * u( rng ), 1,
+                                                 0.001f * u( rng ), std::sin( a ), 0.001f * u( rng ), std::cos( a ) },
+                                               { 0.015f + 0.01f * u( rng ), 0.001f * u( rng ), 0.001f * u( rng ) } } );
+        dev.create_matcher( RS2_MATCHER_DEFAULT );
+
+        std::uniform_int_distribution< int > any( 0, 0xFFFF );
+        for( auto & d : depth_pixels )
+            d = any( rng ) % 5 ? uint16_t( any( rng ) % 3 ? 200 + any( rng ) % 3000 : any( rng ) ) : 0;
+        // The first and last pixels of the frame, with and without depth
+        depth_pixels.front() = 0;
+        depth_pixels.back() = 0xFFFF;
+        depth_pixels[w - 1] = 1;
+        depth_pixels[size_t( w ) * ( h - 1 )] = 0;
+
+        depth_sensor.open( depth );
+        depth_sensor.start( sync );
+        color_sensor.open( color );
+        color_sensor.start( sync );
+    }
+
+    ~scene()
+    {
+        for( auto * s : { &depth_sensor, &color_sensor } )
+        {
+            s->stop();
+            s->close();
+        }
+    }
+
+    rs2::frameset frames()
+    {
+        ++n;
+        depth_sensor.on_video_frame( { depth_pixels.data(), []( void * ) {}, width * 2, 2, n * 33.,
+                                       RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, n, depth.get(), 0.001f } );
+        color_sensor.on_video_frame( { color_pixels.data(), []( void * ) {}, width * 3, 3, n * 33.,
+                                       RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, n, color.get() } );
+        rs2::frameset fs;
+        REQUIRE( sync.try_wait_for_frames( &fs ) );
+        REQUIRE( fs.size() == 2 );
+        return fs;
+    }
+};
+
+
+struct cloud
+{
+    std::vector< float > vertices;
+    std::vector< float > texture;
+};
+
+
+// Runs one of the pointcloud implementations on a frameset, mapping the points to its color frame
+template< class T >
+class test_pointcloud : public T
+{
+public:
+    test_pointcloud( bool occlusion = true )
+    {
+        this->get_option( RS2_OPTION_STREAM_FILTER ).set( float( RS2_STREAM_COLOR ) );
+        this->get_option( RS2_OPTION_STREAM_FORMAT_FILTER ).set( float( RS2_FORMAT_RGB8 ) );
+        if( ! occlusion )
+            this->get_option( RS2_OPTION_FILTER_MAGNITUDE ).set( float( occlusion_none ) );
+        this->set_output_callback( make_frame_callback( [this]( frame_interface * f ) {
+            _out = frame_holder( f );
+        } ) );
+    }
+
+    cloud calculate( rs2::frameset const & fs )
+    {
+        auto f = (frame_interface *)fs.get();
+        f->acquire();
+        this->invoke( frame_holder( f ) );
+        REQUIRE( _out );
+        _out.frame->acquire();  // for the rs2::points
+        auto points = rs2::frame( (rs2_frame *)_out.frame ).as< rs2::points >();
+        _out = {};
+        REQUIRE( points );
+        auto vertices = reinterpret_cast< float const * >( points.get_vertices() );
+        auto texture = reinterpret_cast< float const * >( points.get_texture_coordinates() );
+        return { { vertices, vertices + points.size() * 3 }, { texture, texture + points.size() * 2 } };
+    }
+
+private:
+    frame_holder _out;
+};
+
+
+// Bit for bit, so that a NaN or a -0 shows up too
+bool same( std::vector< float > const & a, std::vector< float > const & b )
+{
+    return a.size() == b.size() && ! std::memcmp( a.data(), b.data(), a.size() * sizeof( float ) );
+}
+
+
+void check_close( std::vector< float > const & a, std::vector< float > const & expected )
+{
+    REQUIRE( a.size() == expected.size() );
+    for( size_t i = 0; i < a.size(); ++i )
+        if( std::abs( a[i] - expected[i] ) > 1e-4f * std::max( 1.f, std::abs( expected[i] ) ) )
+        {
+            CAPTURE( i, a[i], expected[i] );
+            CHECK( std::abs( a[i] - expected[i] ) <= 1e-4f * std::max( 1.f, std::abs( expected[i] ) ) );
+            return;
+        }
+}
+
+
+rs2_distortion const projected_models[] = { RS2_DISTORTION_NONE, RS2_DISTORTION_MODIFIED_BROWN_CONRADY,
+                                            RS2_DISTORTION_INVERSE_BROWN_CONRADY, RS2_DISTORTION_BROWN_CONRADY };
+
+
+}  // namespace
+
+
+TEST_CASE( "AVX2 pointcloud is the same as the generic pointcloud", "[pointcloud]" )
+{
+    if( ! pointcloud_avx2::is_supported() )
+        return;
+
+    unsigned seed = 0;
+    for( auto depth_model : { RS2_DISTORTION_NONE, RS2_DISTORTION_BROWN_CONRADY } )
+        // The fisheye model goes through the generic code, and must come out the same too
+        for( auto color_model : { RS2_DISTORTION_NONE, RS2_DISTORTION_MODIFIED_BROWN_CONRADY,
+                                  RS2_DISTORTION_INVERSE_BROWN_CONRADY, RS2_DISTORTION_BROWN_CONRADY,
+                                  RS2_DISTORTION_KANNALA_BRANDT4 } )
+            // Frames that are not a whole number of 8-point batches, and some that are
+            for( auto size : { std::make_pair( 83, 37 ), std::make_pair( 64, 48 ), std::make_pair( 7, 3 ) } )
+            {
+                scene sc( size.first, size.second, depth_model, color_model, ++seed );
+                CAPTURE( depth_model, color_model, size.first, size.second, seed );
+                test_pointcloud< pointcloud > generic;
+                test_pointcloud< pointcloud_avx2 > avx;
+                for( int i = 0; i < 2; ++i )
+                {
+                    auto const fs = sc.frames();
+                    auto const expected = generic.calculate( fs );
+                    auto const actual = avx.calculate( fs );
+                    CHECK( same( actual.vertices, expected.vertices ) );
+                    CHECK( same( actual.texture, expected.texture ) );
+                }
+            }
+}
+
+#if defined( __SSSE3__ )
+TEST_CASE( "AVX2 pointcloud is close to the SSE pointcloud", "[pointcloud]" )
+{
+    if( ! pointcloud_avx2::is_supported() )
+        return;
+
+    // The SSE pointcloud only works on whole batches of 8 points, and only undistorts inverse Brown-Conrady depth
+    unsigned seed = 100;
+    for( auto color_model : projected_models )
+    {
+        scene sc( 64, 48, RS2_DISTORTION_NONE, color_model, ++seed );
+        CAPTURE( color_model, seed );
+        // Without occlusion removal, which would make small differences in the projection big
+        test_pointcloud< pointcloud_sse > sse( false );
+        test_pointcloud< pointcloud_avx2 > avx( false );
+        auto const fs = sc.frames();
+        auto const expected = sse.calculate( fs );
+        auto const actual = avx.calculate( fs );
+        CHECK( same( actual.vertices, expected.vertices ) );
+        check_close( actual.texture, expected.texture );
+    }
+}
+#endif
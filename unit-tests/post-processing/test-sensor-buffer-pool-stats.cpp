@@ -0,0 +1,180 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+// A sensor counts how the frame data buffers of its streams are recycled, those of the raw frames and of the blocks
+// converting them alike (see rs2_get_frame_buffer_pool_stats). The counts add up across stop and start, even though
+// the sensor starts every stream with new frame archives, and every open with new converters.
+
+#include <src/sensor.h>
+#include <src/stream.h>
+#include <src/api.h>
+#include <src/proc/color-formats-converter.h>
+#include <src/core/frame-callback.h>
+#include <src/core/frame-holder.h>
+#include <src/core/video-frame.h>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include "../catch.h"
+
+#include <condition_variable>
+#include <mutex>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+int const W = 64;
+int const H = 48;
+int const FRAMES = 10;
+
+
+// A raw sensor with a single YUYV color profile; its frames, like a UVC sensor's, get their memory from the source
+class yuyv_camera : public raw_sensor_base
+{
+    std::shared_ptr< stream_profile_interface > _active;
+
+public:
+    explicit yuyv_camera( device * owner )
+        : raw_sensor_base( "YUYV Camera", owner )
+    {
+    }
+
+    stream_profiles init_stream_profiles() override
+    {
+        auto profile = std::make_shared< video_stream_profile >();
+        profile->set_stream_type( RS2_STREAM_COLOR );
+        profile->set_stream_index( 0 );
+        profile->set_format( RS2_FORMAT_YUYV );
+        profile->set_framerate( 30 );
+        profile->set_dims( W, H );
+        return { profile };
+    }
+
+    void open( stream_profiles const & requests ) override
+    {
+        _source.init( _metadata_parsers );
+        _source.set_sensor( _source_owner->shared_from_this() );
+        _active = requests.front();
+        set_active_streams( requests );
+        _is_opened = true;
+    }
+
+    void close() override
+    {
+        _is_opened = false;
+        set_active_streams( {} );
+        _active.reset();
+    }
+
+    void start( rs2_frame_callback_sptr callback ) override
+    {
+        _source.set_callback( callback );
+        _is_streaming = true;
+    }
+
+    // As the UVC sensor does, the archives are dropped when the stream stops
+    void stop() override
+    {
+        _is_streaming = false;
+        _source.flush();
+        _source.reset();
+    }
+
+    void send( int number )
+    {
+        frame_additional_data data;
+        data.timestamp = number * 33.;
+        data.frame_number = number;
+        frame_holder fh = _source.alloc_frame( { RS2_STREAM_COLOR, 0, RS2_EXTENSION_VIDEO_FRAME },
+                                               W * H * 2,
+                                               std::move( data ),
+                                               true );
+        REQUIRE( fh );
+        dynamic_cast< video_frame * >( fh.frame )->assign( W, H, W * 2, 16 );
+        fh->set_stream( _active );
+        _source.invoke_callback( std::move( fh ) );
+    }
+};
+
+
+// What the user gets from a color sensor converting YUYV to RGB8
+struct color_sensor
+{
+    rs2::software_device dev;
+    std::shared_ptr< yuyv_camera > raw;
+    std::shared_ptr< synthetic_sensor > sensor;
+    std::shared_ptr< stream_profile_interface > rgb;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    int received = 0;
+
+    color_sensor()
+    {
+        auto owner = std::dynamic_pointer_cast< device >( dev.get()->device );
+        REQUIRE( owner );
+        raw = std::make_shared< yuyv_camera >( owner.get() );
+        sensor = std::make_shared< synthetic_sensor >( "RGB Camera", raw, owner.get() );
+        sensor->register_processing_block( processing_block_factory::create_pbf_vector< yuy2_converter >(
+            RS2_FORMAT_YUYV, { RS2_FORMAT_RGB8 }, RS2_STREAM_COLOR ) );
+        for( auto & profile : sensor->get_stream_profiles() )
+            if( profile->get_format() == RS2_FORMAT_RGB8 )
+                rgb = profile;
+        REQUIRE( rgb );
+    }
+
+    // Each frame is released before the next is sent, so its buffers can go to the next
+    void stream( int frames )
+    {
+        sensor->open( { rgb } );
+        sensor->start( make_frame_callback(
+            [this]( frame_holder )
+            {
+                std::lock_guard< std::mutex > lock( mutex );
+                ++received;
+                cv.notify_all();
+            } ) );
+        for( int i = 0; i < frames; ++i )
+        {
+            int const expected = received + 1;
+            raw->send( i );
+            std::unique_lock< std::mutex > lock( mutex );
+            REQUIRE( cv.wait_for( lock, std::chrono::seconds( 2 ), [&] { return received >= expected; } ) );
+        }
+        sensor->stop();
+        sensor->close();
+    }
+};
+
+
+}  // namespace
+
+
+TEST_CASE( "sensor buffer pool counters", "[frame-buffer-pool]" )
+{
+    color_sensor color;
+
+    auto stats = color.sensor->get_frame_buffer_pool_stats();
+    CHECK( stats.hits == 0 );
+    CHECK( stats.misses == 0 );
+    CHECK( stats.evictions == 0 );
+
+    // Every frame, raw and converted, takes a buffer: the first of each is new, and after that they're recycled
+    color.stream( FRAMES );
+    stats = color.sensor->get_frame_buffer_pool_stats();
+    CHECK( stats.hits + stats.misses == 2 * FRAMES );
+    CHECK( stats.misses >= 2 );
+    CHECK( stats.hits > 0 );
+
+    // Nothing is lost with the archives and converters of the first run
+    color.stream( FRAMES );
+    auto const after = color.sensor->get_frame_buffer_pool_stats();
+    CHECK( after.hits + after.misses == 4 * FRAMES );
+    CHECK( after.hits > stats.hits );
+    CHECK( after.misses > stats.misses );
+    CHECK( after.evictions >= stats.evictions );
+}
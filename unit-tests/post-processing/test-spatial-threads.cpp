@@ -0,0 +1,104 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+// The spatial filter splits its passes into bands of rows or columns across RS2_OPTION_PROCESSING_THREADS workers.
+// Every band is filtered the same way whatever thread it runs on, so the output must not depend on the number of
+// threads: depth or disparity, with holes filling on or off.
+
+#include <src/proc/synthetic-stream.h>
+#include <src/proc/spatial-filter.h>
+
+#include "../catch.h"
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+// Not a whole number of bands of any size, so the last band of each pass is a partial one
+size_t const W = 161;
+size_t const H = 97;
+
+
+// Surfaces at a few depths, with noise, and holes both scattered and in blocks
+std::vector< uint16_t > make_depth( unsigned seed )
+{
+    std::mt19937 rng( seed );
+    std::uniform_int_distribution< int > noise( -15, 15 );
+    std::uniform_int_distribution< int > percent( 0, 99 );
+    std::vector< uint16_t > depth( W * H );
+    for( size_t y = 0; y < H; ++y )
+        for( size_t x = 0; x < W; ++x )
+        {
+            int const surface = x < W / 3 ? 800 : y < H / 2 ? 1500 : 3000 + int( x );
+            depth[y * W + x] = percent( rng ) < 10 ? 0 : uint16_t( surface + noise( rng ) );
+        }
+    for( size_t y = 20; y < 30; ++y )
+        for( size_t x = 40; x < 70; ++x )
+            depth[y * W + x] = 0;
+    return depth;
+}
+
+
+std::vector< float > to_disparity( std::vector< uint16_t > const & depth )
+{
+    std::vector< float > disparity( depth.size() );
+    for( size_t i = 0; i < depth.size(); ++i )
+        disparity[i] = depth[i] ? 50000.f / depth[i] : 0.f;
+    return disparity;
+}
+
+
+template< class T >
+std::vector< T > filtered( spatial_filter & filter, std::vector< T > image, int threads )
+{
+    filter.get_option( RS2_OPTION_PROCESSING_THREADS ).set( float( threads ) );
+    filter.filter_in_place( image.data(), W, H, std::is_floating_point< T >::value );
+    return image;
+}
+
+
+template< class T >
+void check_same_with_any_threads( std::vector< T > const & image )
+{
+    for( int holes = 0; holes <= 5; ++holes )
+    {
+        spatial_filter filter;
+        filter.get_option( RS2_OPTION_HOLES_FILL ).set( float( holes ) );
+        filter.get_option( RS2_OPTION_FILTER_MAGNITUDE ).set( 3.f );
+
+        auto const expected = filtered( filter, image, 1 );
+        CHECK( expected != image );
+        for( int threads : { 2, 3, 4, 8, 0 } )
+        {
+            CAPTURE( holes, threads );
+            auto const actual = filtered( filter, image, threads );
+            // Bit for bit, so that differences in float rounding show up too
+            REQUIRE( actual.size() == expected.size() );
+            CHECK( ! std::memcmp( actual.data(), expected.data(), actual.size() * sizeof( T ) ) );
+        }
+    }
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "spatial filter on depth does not depend on the threads", "[spatial]" )
+{
+    for( unsigned seed : { 1u, 2u, 3u } )
+        check_same_with_any_threads( make_depth( seed ) );
+}
+
+TEST_CASE( "spatial filter on disparity does not depend on the threads", "[spatial]" )
+{
+    for( unsigned seed : { 4u, 5u, 6u } )
+        check_same_with_any_threads( to_disparity( make_depth( seed ) ) );
+}
@@ -0,0 +1,325 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake:dependencies rsutils
+//#cmake:add-file ../../../third-party/realsense-file/lz4/lz4.c
+//#cmake:add-file ../../../third-party/realsense-file/rosbag2/zstd/zstd.c
+
+#include <unit-tests/test.h>
+#include <rsutils/codec/depth-codec.h>
+#include <third-party/realsense-file/lz4/lz4.h>
+#include <third-party/realsense-file/rosbag2/zstd/zstd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace rsutils::codec;
+
+
+namespace {
+
+
+// Something like what a D400 sees: a tilted wall and a floor, a few balls, noise that grows with distance, holes
+// here and there, and the invalid band on the left
+std::vector< uint16_t > make_depth( uint32_t w, uint32_t h, unsigned seed )
+{
+    std::mt19937 rng( seed );
+    std::normal_distribution< float > noise( 0.f, 1.f );
+    std::uniform_real_distribution< float > uniform( 0.f, 1.f );
+
+    struct ball { float x, y, r, z; };
+    std::vector< ball > balls;
+    for( int i = 0; i < 4; ++i )
+        balls.push_back( { uniform( rng ) * w, uniform( rng ) * h, 20 + uniform( rng ) * 60, 900 + uniform( rng ) * 800 } );
+
+    std::vector< uint16_t > depth( size_t( w ) * h );
+    for( uint32_t y = 0; y < h; ++y )
+        for( uint32_t x = 0; x < w; ++x )
+        {
+            float z = 2500.f + 1.2f * x - 0.4f * y;                // wall
+            if( y > h * 2 / 3 )
+                z = std::min( z, 600.f * h / ( y - h * 2 / 3.f ) );  // floor
+            for( auto & b : balls )
+            {
+                float dx = x - b.x, dy = y - b.y;
+                if( dx * dx + dy * dy < b.r * b.r )
+                    z = std::min( z, b.z - std::sqrt( b.r * b.r - dx * dx - dy * dy ) );
+            }
+            z += noise( rng ) * z * z * 2e-7f;  // ~1mm at 2m, more at range
+            depth[size_t( y ) * w + x] = uint16_t( std::max( 0.f, std::round( z ) ) );
+        }
+
+    for( uint32_t y = 0; y < h; ++y )
+        std::fill_n( depth.begin() + size_t( y ) * w, std::min( w, 40u ), uint16_t( 0 ) );
+    for( int i = 0; i < 30; ++i )
+    {
+        auto hx = uint32_t( uniform( rng ) * w ), hy = uint32_t( uniform( rng ) * h );
+        auto hw = uint32_t( 4 + uniform( rng ) * 30 ), hh = uint32_t( 4 + uniform( rng ) * 20 );
+        for( auto y = hy; y < std::min( h, hy + hh ); ++y )
+            for( auto x = hx; x < std::min( w, hx + hw ); ++x )
+                depth[size_t( y ) * w + x] = 0;
+    }
+    return depth;
+}
+
+
+std::vector< uint16_t > round_trip( std::vector< uint16_t > const & depth, uint32_t w, uint32_t h, size_t stride )
+{
+    std::vector< uint8_t > encoded( depth_encode_bound( w, h ) );
+    auto size = depth_encode( depth.data(), w, h, stride, encoded.data() );
+    REQUIRE( size <= encoded.size() );
+
+    uint32_t dw, dh;
+    REQUIRE( depth_decode_header( encoded.data(), size, &dw, &dh ) );
+    CHECK( dw == w );
+    CHECK( dh == h );
+    std::vector< uint16_t > decoded( size_t( w ) * h );
+    REQUIRE( depth_decode( encoded.data(), size, decoded.data(), decoded.size() ) );
+    return decoded;
+}
+
+
+// Encodes with both the SIMD and the scalar code, which must give the same bytes, then decodes each with the other
+void check_scalar_same_as_simd( std::vector< uint16_t > const & depth, uint32_t w, uint32_t h, size_t stride )
+{
+    std::vector< uint8_t > simd( depth_encode_bound( w, h ) ), scalar( simd.size() );
+    simd.resize( depth_encode( depth.data(), w, h, stride, simd.data() ) );
+    scalar.resize( depth_encode_scalar( depth.data(), w, h, stride, scalar.data() ) );
+    CHECK( scalar == simd );
+
+    std::vector< uint16_t > packed( size_t( w ) * h );
+    for( uint32_t y = 0; y < h; ++y )
+        std::copy_n( depth.begin() + y * ( stride / 2 ), w, packed.begin() + size_t( y ) * w );
+    std::vector< uint16_t > decoded( packed.size() );
+    REQUIRE( depth_decode( scalar.data(), scalar.size(), decoded.data(), decoded.size() ) );
+    CHECK( decoded == packed );
+    std::fill( decoded.begin(), decoded.end(), uint16_t( 0xABCD ) );
+    REQUIRE( depth_decode_scalar( simd.data(), simd.size(), decoded.data(), decoded.size() ) );
+    CHECK( decoded == packed );
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "depth round trip" )
+{
+    SECTION( "synthetic depth" )
+    {
+        auto depth = make_depth( 640, 480, 1 );
+        CHECK( round_trip( depth, 640, 480, 640 * 2 ) == depth );
+    }
+    SECTION( "widths that aren't a multiple of the vector size" )
+    {
+        for( uint32_t w : { 1, 2, 7, 8, 9, 15, 17, 63 } )
+        {
+            INFO( w );
+            auto depth = make_depth( w, 5, w );
+            CHECK( round_trip( depth, w, 5, w * 2 ) == depth );
+        }
+    }
+    SECTION( "extremes" )
+    {
+        // Values far apart wrap around when predicted; nothing may be lost
+        std::vector< uint16_t > depth( 16 * 16 );
+        for( size_t i = 0; i < depth.size(); ++i )
+            depth[i] = ( i * 7 ) % 3 ? 0xFFFF : 0;
+        CHECK( round_trip( depth, 16, 16, 32 ) == depth );
+
+        std::mt19937 rng( 2 );
+        for( auto & d : depth )
+            d = uint16_t( rng() );
+        CHECK( round_trip( depth, 16, 16, 32 ) == depth );
+
+        std::fill( depth.begin(), depth.end(), uint16_t( 0 ) );
+        CHECK( round_trip( depth, 16, 16, 32 ) == depth );
+    }
+    SECTION( "stride" )
+    {
+        uint32_t const w = 100, h = 20;
+        auto depth = make_depth( w, h, 3 );
+        std::vector< uint16_t > padded( ( w + 12 ) * h, 0xABCD );
+        for( uint32_t y = 0; y < h; ++y )
+            std::copy_n( depth.begin() + y * w, w, padded.begin() + y * ( w + 12 ) );
+        CHECK( round_trip( padded, w, h, ( w + 12 ) * 2 ) == depth );
+    }
+    SECTION( "empty" )
+    {
+        std::vector< uint16_t > depth;
+        CHECK( round_trip( depth, 0, 0, 0 ).empty() );
+    }
+}
+
+
+TEST_CASE( "malformed depth data" )
+{
+    uint32_t const w = 64, h = 48;
+    auto depth = make_depth( w, h, 4 );
+    std::vector< uint8_t > encoded( depth_encode_bound( w, h ) );
+    encoded.resize( depth_encode( depth.data(), w, h, w * 2, encoded.data() ) );
+    std::vector< uint16_t > decoded( w * h );
+
+    CHECK_FALSE( depth_decode( encoded.data(), 8, decoded.data(), decoded.size() ) );
+    CHECK_FALSE( depth_decode( encoded.data(), encoded.size() - 4, decoded.data(), decoded.size() ) );
+    CHECK_FALSE( depth_decode( encoded.data(), encoded.size(), decoded.data(), decoded.size() - 1 ) );
+
+    auto bad_magic = encoded;
+    bad_magic[0] = 'X';
+    CHECK_FALSE( depth_decode( bad_magic.data(), bad_magic.size(), decoded.data(), decoded.size() ) );
+
+    // Garbage must never run past the buffers (run under a sanitizer to be sure)
+    std::mt19937 rng( 5 );
+    for( int i = 0; i < 1000; ++i )
+    {
+        auto garbage = encoded;
+        for( size_t j = DEPTH_HEADER_SIZE; j < garbage.size(); ++j )
+            if( rng() % 8 == 0 )
+                garbage[j] = uint8_t( rng() );
+        depth_decode( garbage.data(), garbage.size(), decoded.data(), decoded.size() );
+    }
+}
+
+
+TEST_CASE( "scalar and SIMD depth codecs are the same" )
+{
+    SECTION( "synthetic depth" )
+    {
+        auto depth = make_depth( 848, 480, 6 );
+        check_scalar_same_as_simd( depth, 848, 480, 848 * 2 );
+    }
+    SECTION( "widths that leave some of each row to the scalar code" )
+    {
+        for( uint32_t w = 1; w <= 41; ++w )
+        {
+            INFO( w );
+            auto depth = make_depth( w, 7, w );
+            check_scalar_same_as_simd( depth, w, 7, w * 2 );
+        }
+    }
+    SECTION( "extremes" )
+    {
+        std::vector< uint16_t > depth( 37 * 19 );
+        for( size_t i = 0; i < depth.size(); ++i )
+            depth[i] = ( i * 7 ) % 3 ? 0xFFFF : 0;
+        check_scalar_same_as_simd( depth, 37, 19, 37 * 2 );
+
+        std::mt19937 rng( 7 );
+        for( auto & d : depth )
+            d = uint16_t( rng() );
+        check_scalar_same_as_simd( depth, 37, 19, 37 * 2 );
+
+        // Runs of every length, zero and not, ending anywhere in a vector
+        for( size_t i = 0; i < depth.size(); ++i )
+            depth[i] = uint16_t( ( i / ( 1 + i % 11 ) ) % 2 ? 1000 : 0 );
+        check_scalar_same_as_simd( depth, 37, 19, 37 * 2 );
+    }
+    SECTION( "stride" )
+    {
+        uint32_t const w = 100, h = 20;
+        auto depth = make_depth( w + 12, h, 8 );
+        check_scalar_same_as_simd( depth, w, h, ( w + 12 ) * 2 );
+    }
+    SECTION( "malformed" )
+    {
+        // Whatever the SIMD code makes of garbage, so must the scalar code
+        uint32_t const w = 64, h = 48;
+        auto depth = make_depth( w, h, 9 );
+        std::vector< uint8_t > encoded( depth_encode_bound( w, h ) );
+        encoded.resize( depth_encode( depth.data(), w, h, w * 2, encoded.data() ) );
+        std::vector< uint16_t > simd( w * h ), scalar( w * h );
+        std::mt19937 rng( 10 );
+        for( int i = 0; i < 200; ++i )
+        {
+            auto garbage = encoded;
+            for( size_t j = DEPTH_HEADER_SIZE; j < garbage.size(); ++j )
+                if( rng() % 16 == 0 )
+                    garbage[j] = uint8_t( rng() );
+            std::fill( simd.begin(), simd.end(), uint16_t( 0 ) );
+            std::fill( scalar.begin(), scalar.end(), uint16_t( 0 ) );
+            INFO( i );
+            CHECK( depth_decode_scalar( garbage.data(), garbage.size(), scalar.data(), scalar.size() )
+                   == depth_decode( garbage.data(), garbage.size(), simd.data(), simd.size() ) );
+            CHECK( scalar == simd );
+        }
+    }
+}
+
+
+// Not a pass/fail benchmark: how the codec compares with the zstd (level 1, used by the ros2 writer) and LZ4 (used
+// by rosbag1) that recordings use otherwise, in ratio and speed, on synthetic depth
+TEST_CASE( "depth codec vs zstd and lz4" )
+{
+    uint32_t const w = 848, h = 480;
+    size_t const raw_size = size_t( w ) * h * 2;
+    int const n_frames = 30;
+    std::vector< std::vector< uint16_t > > frames;
+    for( int i = 0; i < n_frames; ++i )
+        frames.push_back( make_depth( w, h, 100 + i ) );
+
+    std::vector< uint8_t > encoded( std::max( { depth_encode_bound( w, h ),
+                                                ZSTD_compressBound( raw_size ),
+                                                size_t( LZ4_compressBound( int( raw_size ) ) ) } ) );
+    std::vector< uint16_t > decoded( size_t( w ) * h );
+
+    struct result { size_t bytes = 0; double encode_ms = 0, decode_ms = 0; };
+    auto measure = [&]( std::function< size_t( uint16_t const * ) > const & encode,
+                        std::function< bool( size_t ) > const & decode )
+    {
+        result r;
+        for( auto & f : frames )
+        {
+            auto t0 = std::chrono::high_resolution_clock::now();
+            auto size = encode( f.data() );
+            auto t1 = std::chrono::high_resolution_clock::now();
+            REQUIRE( decode( size ) );
+            auto t2 = std::chrono::high_resolution_clock::now();
+            REQUIRE( decoded == f );
+            r.bytes += size;
+            r.encode_ms += std::chrono::duration< double, std::milli >( t1 - t0 ).count();
+            r.decode_ms += std::chrono::duration< double, std::milli >( t2 - t1 ).count();
+        }
+        return r;
+    };
+
+    auto depth = measure(
+        [&]( uint16_t const * f ) { return depth_encode( f, w, h, w * 2, encoded.data() ); },
+        [&]( size_t size ) { return depth_decode( encoded.data(), size, decoded.data(), decoded.size() ); } );
+    auto zstd = measure(
+        [&]( uint16_t const * f ) { return ZSTD_compress( encoded.data(), encoded.size(), f, raw_size, 1 ); },
+        [&]( size_t size ) { return ZSTD_decompress( decoded.data(), raw_size, encoded.data(), size ) == raw_size; } );
+    auto lz4 = measure(
+        [&]( uint16_t const * f ) {
+            return size_t( LZ4_compress_default( reinterpret_cast< char const * >( f ),
+                                                 reinterpret_cast< char * >( encoded.data() ),
+                                                 int( raw_size ),
+                                                 int( encoded.size() ) ) );
+        },
+        [&]( size_t size ) {
+            return LZ4_decompress_safe( reinterpret_cast< char const * >( encoded.data() ),
+                                        reinterpret_cast< char * >( decoded.data() ),
+                                        int( size ),
+                                        int( raw_size ) )
+                == int( raw_size );
+        } );
+
+    auto report = [&]( char const * name, result const & r )
+    {
+        double const mb = raw_size * n_frames / 1e6;
+        std::cout << std::setw( 6 ) << name << ": ratio " << std::fixed << std::setprecision( 2 )
+                  << double( raw_size ) * n_frames / r.bytes << ", encode " << std::setprecision( 0 )
+                  << mb / r.encode_ms * 1000 << " MB/s, decode " << mb / r.decode_ms * 1000 << " MB/s" << std::endl;
+    };
+    std::cout << n_frames << " frames of " << w << "x" << h << " Z16:" << std::endl;
+    report( "depth", depth );
+    report( "zstd-1", zstd );
+    report( "lz4", lz4 );
+
+    CHECK( depth.bytes < zstd.bytes );
+    CHECK( depth.bytes < lz4.bytes );
+}
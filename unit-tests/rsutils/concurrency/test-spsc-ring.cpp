@@ -0,0 +1,92 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake:dependencies rsutils
+
+#include <unit-tests/test.h>
+#include <rsutils/concurrency/spsc-ring.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+using rsutils::concurrency::spsc_ring;
+
+
+TEST_CASE( "capacity is a power of 2" )
+{
+    CHECK( spsc_ring< int >( 1 ).capacity() == 1 );
+    CHECK( spsc_ring< int >( 5 ).capacity() == 8 );
+    CHECK( spsc_ring< int >( 16 ).capacity() == 16 );
+}
+
+TEST_CASE( "fifo up to capacity" )
+{
+    spsc_ring< int > ring( 4 );
+    CHECK( ring.empty() );
+    CHECK( ! ring.front() );
+
+    for( int i = 0; i < 4; ++i )
+        REQUIRE( ring.try_push( int( i ) ) );
+    int extra = 4;
+    CHECK_FALSE( ring.try_push( std::move( extra ) ) );
+    CHECK( extra == 4 );
+
+    REQUIRE( ring.front() );
+    CHECK( *ring.front() == 0 );
+    int x = -1;
+    for( int i = 0; i < 4; ++i )
+    {
+        REQUIRE( ring.try_pop( x ) );
+        CHECK( x == i );
+    }
+    CHECK_FALSE( ring.try_pop( x ) );
+    CHECK( ring.empty() );
+
+    // Wrap around
+    for( int i = 0; i < 10; ++i )
+    {
+        REQUIRE( ring.try_push( int( i ) ) );
+        REQUIRE( ring.try_pop( x ) );
+        CHECK( x == i );
+    }
+}
+
+TEST_CASE( "full ring does not take the item" )
+{
+    spsc_ring< std::unique_ptr< int > > ring( 1 );
+    REQUIRE( ring.try_push( std::unique_ptr< int >( new int( 1 ) ) ) );
+    std::unique_ptr< int > p( new int( 2 ) );
+    CHECK_FALSE( ring.try_push( std::move( p ) ) );
+    REQUIRE( p );
+    CHECK( *p == 2 );
+}
+
+TEST_CASE( "producer and consumer threads" )
+{
+    spsc_ring< size_t > ring( 16 );
+    size_t const n = 1000000;
+
+    std::thread producer( [&]() {
+        for( size_t i = 0; i < n; ++i )
+            while( ! ring.try_push( size_t( i ) ) )
+                std::this_thread::yield();
+    } );
+
+    // Catch is not thread-safe: only check results back on this thread
+    size_t next = 0, out_of_order = 0, x;
+    while( next < n )
+    {
+        if( ! ring.try_pop( x ) )
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        if( x != next )
+            ++out_of_order;
+        ++next;
+    }
+    producer.join();
+    CHECK( out_of_order == 0 );
+    CHECK( ring.empty() );
+}
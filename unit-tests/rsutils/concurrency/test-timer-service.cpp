@@ -0,0 +1,188 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake:dependencies rsutils
+
+#include <unit-tests/test.h>
+#include <rsutils/concurrency/timer-service.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace rsutils::concurrency;
+using namespace std::chrono;
+
+
+TEST_CASE( "runs at the interval" )
+{
+    auto service = std::make_shared< timer_service >( 2 );
+    CHECK( service->thread_count() == 2 );
+
+    std::atomic< int > runs( 0 );
+    periodic_task task( "count", milliseconds( 20 ), [&]() { ++runs; }, service );
+    std::this_thread::sleep_for( milliseconds( 100 ) );
+    CHECK( runs == 0 );  // not started
+
+    task.start();
+    CHECK( task.is_active() );
+    std::this_thread::sleep_for( milliseconds( 210 ) );
+    task.stop();
+    CHECK_FALSE( task.is_active() );
+    int const n = runs;
+    CHECK( n >= 5 );
+    CHECK( n <= 11 );
+
+    std::this_thread::sleep_for( milliseconds( 100 ) );
+    CHECK( runs == n );  // stopped
+}
+
+TEST_CASE( "run now" )
+{
+    auto service = std::make_shared< timer_service >( 1 );
+    std::atomic< int > runs( 0 );
+    periodic_task task( "now", seconds( 10 ), [&]() { ++runs; }, service );
+    task.start( true );
+    std::this_thread::sleep_for( milliseconds( 100 ) );
+    CHECK( runs == 1 );
+}
+
+TEST_CASE( "stop waits for the run to end" )
+{
+    auto service = std::make_shared< timer_service >( 2 );
+    std::atomic< bool > in_run( false ), ran( false );
+    periodic_task task( "slow", milliseconds( 1 ),
+                        [&]() {
+                            in_run = true;
+                            std::this_thread::sleep_for( milliseconds( 100 ) );
+                            ran = true;
+                            in_run = false;
+                        },
+                        service );
+    task.start( true );
+    while( ! in_run )
+        std::this_thread::yield();
+    task.stop();
+    CHECK( ran );
+    CHECK_FALSE( in_run );
+}
+
+TEST_CASE( "stop from within the task" )
+{
+    auto service = std::make_shared< timer_service >( 1 );
+    std::atomic< int > runs( 0 );
+    std::unique_ptr< periodic_task > task;
+    task.reset( new periodic_task( "once", milliseconds( 1 ),
+                                   [&]() {
+                                       ++runs;
+                                       task->stop();
+                                   },
+                                   service ) );
+    task->start( true );
+    std::this_thread::sleep_for( milliseconds( 100 ) );
+    CHECK( runs == 1 );
+    CHECK_FALSE( task->is_active() );
+
+    // And can be started again
+    task->start( true );
+    std::this_thread::sleep_for( milliseconds( 100 ) );
+    CHECK( runs == 2 );
+}
+
+TEST_CASE( "a blocking task does not hold up the others" )
+{
+    auto service = std::make_shared< timer_service >( 2 );
+    std::atomic< bool > release( false );
+    std::atomic< int > runs( 0 );
+    periodic_task blocking( "blocking", milliseconds( 1 ),
+                            [&]() {
+                                while( ! release )
+                                    std::this_thread::sleep_for( milliseconds( 1 ) );
+                            },
+                            service );
+    periodic_task other( "other", milliseconds( 10 ), [&]() { ++runs; }, service );
+    blocking.start( true );
+    other.start();
+    std::this_thread::sleep_for( milliseconds( 200 ) );
+    release = true;
+    CHECK( runs >= 5 );
+}
+
+TEST_CASE( "tasks blocking all the threads do not hold up the others" )
+{
+    // E.g., devices that hang while they're polled, as many as there are threads
+    auto service = std::make_shared< timer_service >( 2 );
+    std::atomic< bool > release( false );
+    std::atomic< int > blocked( 0 ), runs( 0 );
+    auto block = [&]() {
+        ++blocked;
+        while( ! release )
+            std::this_thread::sleep_for( milliseconds( 1 ) );
+    };
+    periodic_task blocking1( "blocking1", milliseconds( 1 ), block, service );
+    periodic_task blocking2( "blocking2", milliseconds( 1 ), block, service );
+    periodic_task other( "other", milliseconds( 10 ), [&]() { ++runs; }, service );
+    blocking1.start( true );
+    blocking2.start( true );
+    other.start();
+    std::this_thread::sleep_for( milliseconds( 200 ) );
+    CHECK( blocked == 2 );
+    release = true;
+    CHECK( runs >= 5 );
+    CHECK( service->thread_count() == 2 );
+}
+
+TEST_CASE( "many tasks on few threads" )
+{
+    auto service = std::make_shared< timer_service >( 2 );
+    std::vector< std::unique_ptr< periodic_task > > tasks;
+    std::vector< std::unique_ptr< std::atomic< int > > > runs;
+    for( int i = 0; i < 20; ++i )
+    {
+        runs.emplace_back( new std::atomic< int >( 0 ) );
+        auto & n = *runs.back();
+        tasks.emplace_back( new periodic_task( "task", milliseconds( 10 ), [&n]() { ++n; }, service ) );
+        tasks.back()->start();
+    }
+    std::this_thread::sleep_for( milliseconds( 200 ) );
+    for( auto & t : tasks )
+        t->stop();
+    for( auto & n : runs )
+        CHECK( *n >= 5 );
+    CHECK( service->get_task_stats().size() == 20 );
+    tasks.clear();
+    CHECK( service->get_task_stats().empty() );
+}
+
+TEST_CASE( "statistics" )
+{
+    auto service = std::make_shared< timer_service >( 1 );
+    periodic_task task( "stats", milliseconds( 10 ), []() { std::this_thread::sleep_for( milliseconds( 5 ) ); },
+                        service );
+    task.start( true );
+    std::this_thread::sleep_for( milliseconds( 100 ) );
+    task.stop();
+
+    auto stats = service->get_task_stats();
+    REQUIRE( stats.size() == 1 );
+    CHECK( stats[0].name == "stats" );
+    CHECK( stats[0].interval == milliseconds( 10 ) );
+    CHECK_FALSE( stats[0].active );
+    CHECK( stats[0].runs >= 3 );
+    CHECK( stats[0].max_run_time >= milliseconds( 5 ) );
+    CHECK( stats[0].total_run_time >= stats[0].max_run_time );
+}
+
+TEST_CASE( "shared instance lives as long as its tasks" )
+{
+    CHECK_FALSE( timer_service::existing_instance() );
+    {
+        periodic_task task( "shared", milliseconds( 10 ), []() {} );
+        auto service = timer_service::existing_instance();
+        REQUIRE( service );
+        CHECK( service->thread_count() == timer_service::DEFAULT_THREADS );
+    }
+    CHECK_FALSE( timer_service::existing_instance() );
+}
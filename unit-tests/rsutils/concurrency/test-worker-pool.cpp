@@ -0,0 +1,73 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake:dependencies rsutils
+
+#include <unit-tests/test.h>
+#include <rsutils/concurrency/worker-pool.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using rsutils::concurrency::worker_pool;
+
+
+TEST_CASE( "every index is visited once" )
+{
+    for( size_t threads : { 1, 2, 5 } )
+    {
+        worker_pool pool( threads );
+        CHECK( pool.size() == threads );
+
+        for( size_t count : { 1, 7, 1000 } )
+        {
+            // Catch is not thread-safe: only check results back on this thread
+            std::vector< std::atomic< int > > visits( count );
+            for( auto & v : visits )
+                v = 0;
+            std::atomic< bool > empty_range( false );
+            pool.parallel_for( count, [&]( size_t begin, size_t end ) {
+                if( begin >= end )
+                    empty_range = true;
+                for( auto i = begin; i < end; ++i )
+                    ++visits[i];
+            } );
+            CHECK_FALSE( empty_range );
+            for( auto & v : visits )
+                CHECK( v == 1 );
+        }
+    }
+}
+
+TEST_CASE( "minimum range is respected" )
+{
+    worker_pool pool( 4 );
+    std::atomic< int > ranges( 0 );
+    std::atomic< int > short_ranges( 0 );
+    pool.parallel_for(
+        100,
+        [&]( size_t begin, size_t end ) {
+            ++ranges;
+            if( end != 100 && end - begin != 40 )
+                ++short_ranges;
+        },
+        40 );
+    CHECK( ranges == 3 );
+    CHECK( short_ranges == 0 );
+}
+
+TEST_CASE( "exceptions reach the caller" )
+{
+    worker_pool pool( 3 );
+    CHECK_THROWS_AS( pool.parallel_for( 100, []( size_t begin, size_t ) {
+                         if( begin == 0 )
+                             throw std::runtime_error( "range failed" );
+                     } ),
+                     std::runtime_error );
+
+    // The pool is still usable afterwards
+    std::atomic< size_t > total( 0 );
+    pool.parallel_for( 100, [&]( size_t begin, size_t end ) { total += end - begin; } );
+    CHECK( total == 100 );
+}
@@ -166,3 +166,24 @@ def test_two_sensors_intermixed_frames():
             assert not d3.supports_frame_metadata( rs.frame_metadata_value.sharpness )
 #
 #############################################################################################
+#
+def test_get_all_matches_one_by_one():
+    with sw.sensor( "Stereo Module" ) as sensor:
+        depth = sensor.video_stream( "Depth", rs.stream.depth, rs.format.z16 )
+        sensor.start( depth )
+
+        sensor.set( rs.frame_metadata_value.white_balance, 0xbaad )
+        sensor.set( rs.frame_metadata_value.saturation, 0x1eaf )
+        f = sensor.publish( depth.frame() )
+
+        all_md = f.get_frame_metadata_all()
+        assert all_md[rs.frame_metadata_value.white_balance] == 0xbaad
+        assert all_md[rs.frame_metadata_value.saturation] == 0x1eaf
+        for md in frame_metadata_values():
+            if md in all_md:
+                check.is_true( f.supports_frame_metadata( md ))
+                check.equal( f.get_frame_metadata( md ), all_md[md] )
+            else:
+                check.is_false( f.supports_frame_metadata( md ))
+#
+#############################################################################################
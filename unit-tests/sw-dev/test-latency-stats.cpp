@@ -0,0 +1,258 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include <unit-tests/test.h>
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+#include <rsutils/json.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+using namespace rs2;
+
+
+namespace {
+
+
+int const W = 64;
+int const H = 48;
+int const FPS = 30;
+
+
+struct sw_depth_and_ir
+{
+    software_device dev;
+    software_sensor sensor;
+    stream_profile depth, ir;
+    std::vector< uint8_t > pixels;
+
+    explicit sw_depth_and_ir( std::string const & serial = "1" )
+        : sensor( dev.add_sensor( "Stereo" ) )
+        , pixels( W * H * 2, 0 )
+    {
+        dev.register_info( RS2_CAMERA_INFO_SERIAL_NUMBER, serial );
+        rs2_intrinsics intrinsics{ W, H, 0, 0, 0, 0, RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+        depth = sensor.add_video_stream( { RS2_STREAM_DEPTH, 0, 0, W, H, FPS, 2, RS2_FORMAT_Z16, intrinsics } );
+        ir = sensor.add_video_stream( { RS2_STREAM_INFRARED, 1, 1, W, H, FPS, 1, RS2_FORMAT_Y8, intrinsics } );
+        dev.create_matcher( RS2_MATCHER_DEFAULT );
+    }
+
+    void generate( stream_profile const & profile, int frame_number )
+    {
+        int const bpp = profile == depth ? 2 : 1;
+        sensor.on_video_frame( { pixels.data(),
+                                 []( void * ) {},
+                                 W * bpp,
+                                 bpp,
+                                 frame_number * 1000. / FPS,
+                                 RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK,
+                                 frame_number,
+                                 profile.get() } );
+    }
+};
+
+
+}  // namespace
+
+
+TEST_CASE( "latency stats are empty while tracing is off" )
+{
+    enable_latency_tracing( false );
+    sw_depth_and_ir sw;
+    sw.sensor.open( sw.depth );
+    sw.sensor.start( []( frame ) {} );
+    for( int i = 0; i < 5; ++i )
+        sw.generate( sw.depth, i );
+    sw.sensor.stop();
+    sw.sensor.close();
+
+    auto stats = rsutils::json::parse( get_stream_latency_stats() );
+    CHECK( stats["enabled"] == false );
+    CHECK( stats["devices"].empty() );
+}
+
+
+TEST_CASE( "per-stream latency through a syncer" )
+{
+    std::string const trace_file = "test-latency-stats.trace";
+    enable_latency_tracing( true, trace_file );
+
+    sw_depth_and_ir sw;
+    syncer sync;
+    sw.sensor.open( { sw.depth, sw.ir } );
+    sw.sensor.start( sync );
+    int const n_frames = 20;
+    int n_framesets = 0;
+    for( int i = 0; i < n_frames; ++i )
+    {
+        sw.generate( sw.depth, i );
+        sw.generate( sw.ir, i );
+        frameset fs;
+        while( sync.poll_for_frames( &fs ) )
+            ++n_framesets;
+    }
+    sw.sensor.stop();
+    sw.sensor.close();
+    CHECK( n_framesets > 0 );
+
+    auto stats = rsutils::json::parse( get_stream_latency_stats() );
+    enable_latency_tracing( false );
+
+    CHECK( stats["enabled"] == true );
+    REQUIRE( stats["devices"].size() == 1 );
+    auto & streams = stats["devices"]["1"];
+    for( auto name : { "Depth", "Infrared 1" } )
+    {
+        INFO( name );
+        REQUIRE( streams.contains( name ) );
+        auto & s = streams[name];
+        CHECK( s["frames"] == n_frames );
+        CHECK( s["unpacked"]["count"] == n_frames );
+        // The syncer is handed frames like a user callback, but they're only delivered when we get them out of it
+        REQUIRE( s.contains( "delivered" ) );
+        CHECK( s["delivered"]["count"] == n_frames );
+        CHECK( ! s.contains( "user-callback" ) );
+        CHECK( s["delivered"]["p50"].get< double >() <= s["delivered"]["p99"].get< double >() );
+        CHECK( s["delivered"]["p99"].get< double >() <= s["delivered"]["max"].get< double >() );
+        CHECK( s["synced"]["count"] > 0 );
+        CHECK( ! s["processing-blocks"].empty() );
+    }
+
+    // Stopping closed (and flushed) the trace file
+    std::ifstream f( trace_file, std::ios::binary );
+    REQUIRE( f );
+    char header[16] = {};
+    f.read( header, sizeof( header ) );
+    CHECK( std::strcmp( header, "rs2-latency" ) == 0 );
+    CHECK( header[12] == 1 );
+    f.seekg( 0, std::ios::end );
+    auto const size = size_t( f.tellg() );
+    CHECK( size > 16 + 2 * n_frames * 3 * 32 );  // arrival, allocated and unpacked records, at least
+    CHECK( ( size - 16 ) % 32 == 0 );
+    f.close();
+    std::remove( trace_file.c_str() );
+}
+
+
+TEST_CASE( "user callbacks are timed" )
+{
+    enable_latency_tracing( true );
+
+    sw_depth_and_ir sw;
+    sw.sensor.open( sw.depth );
+    sw.sensor.start( []( frame ) { std::this_thread::sleep_for( std::chrono::milliseconds( 2 ) ); } );
+    for( int i = 0; i < 5; ++i )
+        sw.generate( sw.depth, i );
+    sw.sensor.stop();
+    sw.sensor.close();
+
+    auto stats = rsutils::json::parse( get_stream_latency_stats() );
+    enable_latency_tracing( false );
+
+    auto & depth = stats["devices"]["1"]["Depth"];
+    CHECK( depth["frames"] == 5 );
+    CHECK( depth["delivered"]["count"] == 5 );
+    REQUIRE( depth.contains( "user-callback" ) );
+    CHECK( depth["user-callback"]["count"] == 5 );
+    CHECK( depth["user-callback"]["p50"].get< double >() >= 1.5 );
+    CHECK( ! stats["devices"]["1"].contains( "Infrared 1" ) );  // cleared when we started again
+}
+
+
+TEST_CASE( "processing blocks are timed without their output callback" )
+{
+    enable_latency_tracing( true );
+
+    sw_depth_and_ir sw;
+    processing_block block( []( frame f, frame_source & src ) { src.frame_ready( f ); } );
+    block.start( []( frame ) { std::this_thread::sleep_for( std::chrono::milliseconds( 5 ) ); } );
+    sw.sensor.open( sw.depth );
+    sw.sensor.start( [&]( frame f ) { block.invoke( f ); } );
+    for( int i = 0; i < 5; ++i )
+        sw.generate( sw.depth, i );
+    sw.sensor.stop();
+    sw.sensor.close();
+
+    auto stats = rsutils::json::parse( get_stream_latency_stats() );
+    enable_latency_tracing( false );
+
+    auto & depth = stats["devices"]["1"]["Depth"];
+    CHECK( depth["delivered"]["count"] == 5 );  // by the block, not by the sensor's callback that invoked it
+    CHECK( depth["user-callback"]["count"] == 5 );
+    CHECK( depth["user-callback"]["p50"].get< double >() >= 4.5 );
+    REQUIRE( depth.contains( "processing-blocks" ) );
+    for( auto & b : depth["processing-blocks"] )
+    {
+        CHECK( b["count"] == 5 );
+        CHECK( b["max"].get< double >() < 4.5 );
+    }
+}
+
+
+TEST_CASE( "the same stream of two devices is kept apart" )
+{
+    enable_latency_tracing( true );
+
+    // Same stream types, indices and even profile unique IDs: only the devices tell them apart
+    sw_depth_and_ir a( "A" ), b( "B" );
+    a.sensor.open( a.depth );
+    b.sensor.open( b.depth );
+    a.sensor.start( []( frame ) {} );
+    b.sensor.start( []( frame ) { std::this_thread::sleep_for( std::chrono::milliseconds( 2 ) ); } );
+    for( int i = 0; i < 5; ++i )
+        a.generate( a.depth, i );
+    for( int i = 0; i < 3; ++i )
+        b.generate( b.depth, i );
+    for( auto sw : { &a, &b } )
+    {
+        sw->sensor.stop();
+        sw->sensor.close();
+    }
+
+    auto stats = rsutils::json::parse( get_stream_latency_stats() );
+    enable_latency_tracing( false );
+
+    auto & devices = stats["devices"];
+    CHECK( devices.size() == 2 );
+    REQUIRE( devices.contains( "A" ) );
+    REQUIRE( devices.contains( "B" ) );
+    CHECK( devices["A"].size() == 1 );
+    CHECK( devices["A"]["Depth"]["frames"] == 5 );
+    CHECK( devices["A"]["Depth"]["user-callback"]["p50"].get< double >() < 1.5 );
+    CHECK( devices["B"].size() == 1 );
+    CHECK( devices["B"]["Depth"]["frames"] == 3 );
+    CHECK( devices["B"]["Depth"]["user-callback"]["p50"].get< double >() >= 1.5 );
+}
+
+
+TEST_CASE( "devices by the same serial number are numbered" )
+{
+    enable_latency_tracing( true );
+
+    sw_depth_and_ir a( "X" ), b( "X" );
+    for( auto sw : { &a, &b } )
+    {
+        sw->sensor.open( sw->ir );
+        sw->sensor.start( []( frame ) {} );
+        sw->generate( sw->ir, 0 );
+        sw->sensor.stop();
+        sw->sensor.close();
+    }
+
+    auto stats = rsutils::json::parse( get_stream_latency_stats() );
+    enable_latency_tracing( false );
+
+    auto & devices = stats["devices"];
+    CHECK( devices.size() == 2 );
+    for( auto name : { "X", "X #2" } )
+    {
+        INFO( name );
+        REQUIRE( devices.contains( name ) );
+        CHECK( devices[name]["Infrared 1"]["frames"] == 1 );
+    }
+}
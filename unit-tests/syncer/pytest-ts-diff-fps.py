@@ -16,8 +16,10 @@ log = logging.getLogger(__name__)
 # the first test in this file, the tests run at the `yield` point, and the code
 # after `yield` runs once after the last test. autouse=True wires it into every
 # test in the module without needing to declare it as a parameter.
-@pytest.fixture(scope="module", autouse=True)
-def _sw_session():
+# The whole module runs once per sync engine: both must release the same framesets.
+@pytest.fixture(scope="module", autouse=True, params=[False, True], ids=["locking", "lock-free"])
+def _sw_session( request ):
+    sw.lock_free = request.param
     sw.fps_d = 100
     sw.fps_c =  10
     sw.init()
@@ -25,6 +27,7 @@ def _sw_session():
     yield  # tests in this module run here
     sw.stop()
     sw.reset()
+    sw.lock_free = False
 
 
 #############################################################################################
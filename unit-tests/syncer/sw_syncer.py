@@ -19,6 +19,7 @@ fps_c = fps_d = 60
 w = 640
 h = 480
 bpp = 2  # bytes
+lock_free = False  # use the lock-free sync engine (the framesets should be the same)
 #
 # Set by init() or playback() -- don't set these unless you know what you're doing!
 #
@@ -91,7 +92,7 @@ def init( syncer_matcher = rs.matchers.default ):
     # We don't want to lose any frames so use a big queue size (default is 1)
     global syncer
     if syncer_matcher is not None:
-        syncer = rs.syncer( 100 )  
+        syncer = rs.syncer( 100, lock_free )
     else:
         syncer = rs.frame_queue( 100 )
     #
@@ -140,7 +141,7 @@ def playback( filename, use_syncer = True ):
     #
     global syncer
     if use_syncer:
-        syncer = rs.syncer( 100 )  # We don't want to lose any frames so uses a big queue size (default is 1)
+        syncer = rs.syncer( 100, lock_free )  # We don't want to lose any frames so uses a big queue size (default is 1)
     else:
         syncer = rs.frame_queue( 100 )
     #
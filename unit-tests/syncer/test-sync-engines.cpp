@@ -0,0 +1,385 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include <unit-tests/test.h>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace rs2;
+
+
+namespace {
+
+
+int const W = 64;
+int const H = 48;
+int const FPS = 30;
+
+
+// One software sensor per stream, so each can be fed from a thread of its own
+struct sw_streams
+{
+    software_device dev;
+    std::vector< software_sensor > sensors;
+    std::vector< stream_profile > profiles;
+    std::vector< uint8_t > pixels;
+
+    sw_streams( rs2_matchers matcher )
+        : pixels( W * H * 2, 0 )
+    {
+        rs2_intrinsics intrinsics{ W, H, 0, 0, 0, 0, RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+        add( "Depth", { RS2_STREAM_DEPTH, 0, 0, W, H, FPS, 2, RS2_FORMAT_Z16, intrinsics } );
+        add( "IR", { RS2_STREAM_INFRARED, 1, 1, W, H, FPS, 1, RS2_FORMAT_Y8, intrinsics } );
+        add( "Color", { RS2_STREAM_COLOR, 0, 2, W, H, FPS, 2, RS2_FORMAT_YUYV, intrinsics } );
+        dev.create_matcher( matcher );
+    }
+
+    void add( char const * name, rs2_video_stream const & stream )
+    {
+        sensors.push_back( dev.add_sensor( name ) );
+        profiles.push_back( sensors.back().add_video_stream( stream ) );
+    }
+
+    template< class T >
+    void start( T const & callback )
+    {
+        for( size_t i = 0; i < sensors.size(); ++i )
+        {
+            sensors[i].open( profiles[i] );
+            sensors[i].start( callback );
+        }
+    }
+
+    void stop()
+    {
+        for( auto & s : sensors )
+        {
+            s.stop();
+            s.close();
+        }
+    }
+
+    void generate( size_t stream, int frame_number, double timestamp )
+    {
+        auto const & vsp = profiles[stream].as< video_stream_profile >();
+        int const bpp = stream == 1 ? 1 : 2;
+        sensors[stream].on_video_frame( { pixels.data(),
+                                          []( void * ) {},
+                                          vsp.width() * bpp,
+                                          bpp,
+                                          timestamp,
+                                          RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK,
+                                          frame_number,
+                                          profiles[stream] } );
+    }
+};
+
+
+// Each frameset as a list of (stream, frame number)
+typedef std::vector< std::vector< std::pair< rs2_stream, int > > > framesets;
+
+void add_frameset( framesets & out, frame const & f )
+{
+    std::vector< std::pair< rs2_stream, int > > set;
+    if( auto fs = f.as< frameset >() )
+        for( auto sf : fs )
+            set.emplace_back( sf.get_profile().stream_type(), int( sf.get_frame_number() ) );
+    else
+        set.emplace_back( f.get_profile().stream_type(), int( f.get_frame_number() ) );
+    out.push_back( std::move( set ) );
+}
+
+
+// Feeds the same sequence, with drops and streams arriving late, from a single thread
+framesets run_script( rs2_matchers matcher, bool lock_free )
+{
+    sw_streams streams( matcher );
+    syncer sync( 1000, lock_free );
+    streams.start( sync );
+
+    double const gap = 1000. / FPS;
+    for( int i = 0; i < 60; ++i )
+    {
+        if( i % 7 != 3 )
+            streams.generate( 0, i, i * gap );
+        if( i % 11 != 5 && i > 2 )
+            streams.generate( 1, i, i * gap );
+        if( i % 4 == 0 )
+        {
+            // Color arrives a couple of frames late, and goes away for a while
+            if( i < 30 || i > 45 )
+                streams.generate( 2, i, ( i - 2 ) * gap );
+        }
+    }
+
+    framesets out;
+    frameset fs;
+    while( sync.poll_for_frames( &fs ) )
+        add_frameset( out, fs );
+    streams.stop();
+    return out;
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "both sync engines release the same framesets" )
+{
+    for( auto matcher : { RS2_MATCHER_DEFAULT, RS2_MATCHER_DI_C } )
+    {
+        auto locking = run_script( matcher, false );
+        auto lock_free = run_script( matcher, true );
+        CHECK( ! locking.empty() );
+        CHECK( locking == lock_free );
+    }
+}
+
+
+// Not a pass/fail benchmark: three streams are pushed as fast as their threads can go, and the time it takes is
+// printed for each engine. Along the way, framesets must only ever pair up frames of the same index, and no frame may
+// come out twice or out of order.
+TEST_CASE( "sync engines under stress" )
+{
+    size_t const n_frames = 20000;
+    double const gap = 1000. / FPS;
+
+    for( auto matcher : { RS2_MATCHER_DEFAULT, RS2_MATCHER_DI_C } )
+    {
+        for( bool lock_free : { false, true } )
+        {
+            sw_streams streams( matcher );
+            asynchronous_syncer sync( lock_free );
+
+            // The syncer never calls us from more than one thread at a time
+            size_t n_framesets = 0, n_frames_out = 0, mismatched = 0, out_of_order = 0;
+            std::map< rs2_stream, int > last;
+            sync.start( [&]( frame f ) {
+                framesets fs;
+                add_frameset( fs, f );
+                ++n_framesets;
+                for( auto & sf : fs[0] )
+                {
+                    ++n_frames_out;
+                    if( sf.second != fs[0][0].second )
+                        ++mismatched;
+                    auto it = last.find( sf.first );
+                    if( it != last.end() && sf.second <= it->second )
+                        ++out_of_order;
+                    last[sf.first] = sf.second;
+                }
+            } );
+            streams.start( [&]( frame f ) { sync.invoke( f ); } );
+
+            auto const start = std::chrono::high_resolution_clock::now();
+            std::vector< std::thread > threads;
+            for( size_t s = 0; s < streams.profiles.size(); ++s )
+                threads.emplace_back( [&, s]() {
+                    for( size_t i = 0; i < n_frames; ++i )
+                        streams.generate( s, int( i ), i * gap );
+                } );
+            for( auto & t : threads )
+                t.join();
+            auto const ms = std::chrono::duration< double, std::milli >( std::chrono::high_resolution_clock::now() - start ).count();
+
+            streams.stop();
+
+            std::cout << rs2_matchers_to_string( matcher ) << ( lock_free ? " lock-free: " : " locking:   " ) << ms
+                      << " ms for " << n_frames * streams.profiles.size() << " frames -> " << n_framesets
+                      << " framesets of " << n_frames_out << " frames" << std::endl;
+
+            CHECK( n_framesets > 0 );
+            CHECK( n_frames_out <= n_frames * streams.profiles.size() );
+            CHECK( mismatched == 0 );
+            CHECK( out_of_order == 0 );
+        }
+    }
+}
+
+
+// A frame waiting for room in its stream's queue keeps its place: frames of other streams that come after it must not
+// overtake it. Each stream is on a device of its own, so frames are passed through as they arrive.
+TEST_CASE( "lock-free engine keeps the order of arrival across producers" )
+{
+    double const gap = 1000. / FPS;
+    char const * const names[] = { "Depth", "IR", "Color" };
+    rs2_intrinsics intrinsics{ W, H, 0, 0, 0, 0, RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+    rs2_video_stream const streams[] = { { RS2_STREAM_DEPTH, 0, 0, W, H, FPS, 2, RS2_FORMAT_Z16, intrinsics },
+                                         { RS2_STREAM_INFRARED, 1, 1, W, H, FPS, 1, RS2_FORMAT_Y8, intrinsics },
+                                         { RS2_STREAM_COLOR, 0, 2, W, H, FPS, 2, RS2_FORMAT_YUYV, intrinsics } };
+    std::vector< uint8_t > pixels( W * H * 2, 0 );
+    std::vector< software_device > devices( 3 );
+    std::vector< software_sensor > sensors;
+    std::vector< stream_profile > profiles;
+    for( size_t i = 0; i < devices.size(); ++i )
+    {
+        sensors.push_back( devices[i].add_sensor( names[i] ) );
+        profiles.push_back( sensors.back().add_video_stream( streams[i] ) );
+        devices[i].create_matcher( RS2_MATCHER_DEFAULT );
+    }
+    // IR holds more frames than the syncer can queue for it: they must not be dropped before they get there
+    sensors[1].set_option( RS2_OPTION_FRAMES_QUEUE_SIZE, 32 );
+
+    auto generate = [&]( size_t stream, int frame_number ) {
+        int const bpp = stream == 1 ? 1 : 2;
+        sensors[stream].on_video_frame( { pixels.data(),
+                                          []( void * ) {},
+                                          W * bpp,
+                                          bpp,
+                                          frame_number * gap,
+                                          RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK,
+                                          frame_number,
+                                          profiles[stream] } );
+    };
+
+    std::mutex m;
+    std::condition_variable cv;
+    bool in_callback = false, gate_open = false;
+    framesets out;
+    asynchronous_syncer sync( true );
+    sync.start( [&]( frame f ) {
+        std::unique_lock< std::mutex > lock( m );
+        add_frameset( out, f );
+        if( ! in_callback )
+        {
+            // Hold up the first frame, and with it the dispatching, until the queues have filled
+            in_callback = true;
+            cv.notify_all();
+            cv.wait( lock, [&] { return gate_open; } );
+        }
+    } );
+    for( size_t i = 0; i < sensors.size(); ++i )
+    {
+        sensors[i].open( profiles[i] );
+        sensors[i].start( [&]( frame f ) { sync.invoke( f ); } );
+    }
+
+    // Depth dispatches its frame, and is stuck in our callback
+    std::thread depth( [&] { generate( 0, 0 ); } );
+    {
+        std::unique_lock< std::mutex > lock( m );
+        REQUIRE( cv.wait_for( lock, std::chrono::seconds( 5 ), [&] { return in_callback; } ) );
+    }
+
+    // IR fills its queue, then waits for room for one more
+    int const n_ir = 17;
+    std::atomic< int > ir_sent{ 0 };
+    std::thread ir( [&] {
+        for( int i = 0; i < n_ir; ++i )
+        {
+            ++ir_sent;
+            generate( 1, i );
+        }
+    } );
+    while( ir_sent < n_ir )
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
+
+    // Color arrives after all of them; it has room, but has to wait its turn
+    std::thread color( [&] { generate( 2, 0 ); } );
+    std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
+
+    {
+        std::lock_guard< std::mutex > lock( m );
+        gate_open = true;
+        cv.notify_all();
+    }
+    depth.join();
+    ir.join();
+    color.join();
+    for( auto & s : sensors )
+    {
+        s.stop();
+        s.close();
+    }
+
+    framesets expected;
+    expected.push_back( { { RS2_STREAM_DEPTH, 0 } } );
+    for( int i = 0; i < n_ir; ++i )
+        expected.push_back( { { RS2_STREAM_INFRARED, i } } );
+    expected.push_back( { { RS2_STREAM_COLOR, 0 } } );
+    std::lock_guard< std::mutex > lock( m );
+    CHECK( out == expected );
+}
+
+
+// Streams come and go: many more than the lock-free engine has queues for, a few at a time, each from a thread of its
+// own. The queues of streams that went away are taken over by new ones, and no frame may be lost, duplicated or
+// reordered along the way. Each stream is on a device of its own, so frames are passed through as they arrive.
+TEST_CASE( "lock-free engine with streams coming and going" )
+{
+    int const n_streams = 40;
+    int const at_a_time = 4;
+    int const n_frames = 200;
+    double const gap = 1000. / FPS;
+    rs2_intrinsics intrinsics{ W, H, 0, 0, 0, 0, RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+    std::vector< uint8_t > pixels( W * H * 2, 0 );
+    std::vector< software_device > devices( n_streams );
+    std::vector< software_sensor > sensors;
+    std::vector< stream_profile > profiles;
+    for( int i = 0; i < n_streams; ++i )
+    {
+        sensors.push_back( devices[i].add_sensor( "Depth" ) );
+        profiles.push_back(
+            sensors.back().add_video_stream( { RS2_STREAM_DEPTH, 0, i, W, H, FPS, 2, RS2_FORMAT_Z16, intrinsics } ) );
+        devices[i].create_matcher( RS2_MATCHER_DEFAULT );
+        // Room for a full queue in the syncer, and then some
+        sensors.back().set_option( RS2_OPTION_FRAMES_QUEUE_SIZE, 32 );
+    }
+
+    std::mutex m;
+    std::map< int, std::vector< int > > out;  // stream uid -> frame numbers
+    asynchronous_syncer sync( true );
+    sync.start( [&]( frame f ) {
+        std::lock_guard< std::mutex > lock( m );
+        out[f.get_profile().unique_id()].push_back( int( f.get_frame_number() ) );
+    } );
+    for( int i = 0; i < n_streams; ++i )
+    {
+        sensors[i].open( profiles[i] );
+        sensors[i].start( [&]( frame f ) { sync.invoke( f ); } );
+    }
+
+    for( int first = 0; first < n_streams; first += at_a_time )
+    {
+        std::vector< std::thread > threads;
+        for( int s = first; s < first + at_a_time; ++s )
+            threads.emplace_back( [&, s] {
+                for( int i = 0; i < n_frames; ++i )
+                    sensors[s].on_video_frame( { pixels.data(),
+                                                 []( void * ) {},
+                                                 W * 2,
+                                                 2,
+                                                 i * gap,
+                                                 RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK,
+                                                 i,
+                                                 profiles[s] } );
+            } );
+        for( auto & t : threads )
+            t.join();
+    }
+    for( auto & s : sensors )
+    {
+        s.stop();
+        s.close();
+    }
+
+    std::vector< int > all( n_frames );
+    for( int i = 0; i < n_frames; ++i )
+        all[i] = i;
+    std::lock_guard< std::mutex > lock( m );
+    CHECK( out.size() == size_t( n_streams ) );
+    for( auto & stream : out )
+    {
+        CAPTURE( stream.first );
+        CHECK( stream.second == all );
+    }
+}
@@ -0,0 +1,190 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+// Frames from a source with a user frame allocator are written into the user's memory, and that memory goes back to
+// the user as soon as the frame is released. If the user cannot supply it, frames fall back to internal memory.
+
+#include <src/source.h>
+#include <src/frame-allocator.h>
+#include <src/core/frame-holder.h>
+#include <librealsense2/hpp/rs_sensor.hpp>
+
+#include "../catch.h"
+
+#include <map>
+#include <stdexcept>
+
+using namespace librealsense;
+
+
+namespace {
+
+
+size_t const SIZE = 64 * 48 * 2;
+frame_source::archive_id const DEPTH = { RS2_STREAM_DEPTH, 0, RS2_EXTENSION_DEPTH_FRAME };
+
+
+// Hands out aligned blocks and keeps track of which are live
+struct user_memory
+{
+    enum mode_t { normal, out_of_memory, misaligned, throws };
+    mode_t mode = normal;
+    int allocations = 0;
+    int frees = 0;
+    std::map< uint8_t const *, uint8_t * > live;  // returned pointer -> block
+
+    void * allocate( int size, int alignment )
+    {
+        if( mode == out_of_memory )
+            return nullptr;
+        if( mode == throws )
+            throw std::runtime_error( "no memory for you" );
+        ++allocations;
+        auto block = new uint8_t[size + alignment + 1];
+        auto p = block;
+        if( alignment )
+            p += alignment - reinterpret_cast< uintptr_t >( p ) % alignment;
+        if( mode == misaligned )
+            ++p;
+        live[p] = block;
+        return p;
+    }
+
+    void free( void * data, int )
+    {
+        auto it = live.find( static_cast< uint8_t * >( data ) );
+        REQUIRE( it != live.end() );
+        delete[] it->second;
+        live.erase( it );
+        ++frees;
+    }
+
+    bool owns( void const * data ) const { return live.count( static_cast< uint8_t const * >( data ) ) != 0; }
+
+    // The way rs2_set_frame_allocator_cpp wraps what the sensor::set_frame_allocator() wrapper gives it
+    std::shared_ptr< frame_allocator > make_allocator( int alignment )
+    {
+        auto allocate = [this]( int size, int alignment ) { return this->allocate( size, alignment ); };
+        auto free = [this]( void * data, int size ) { this->free( data, size ); };
+        rs2_frame_allocator_sptr allocator( new rs2::frame_allocator< decltype( allocate ), decltype( free ) >( allocate,
+                                                                                                             free ),
+                                            []( rs2_frame_allocator * p ) { p->release(); } );
+        return std::make_shared< frame_allocator >( allocator, alignment );
+    }
+};
+
+
+struct test_source : frame_source
+{
+    test_source() { init( std::make_shared< metadata_parser_map >() ); }
+
+    frame_holder alloc( frame_source::archive_id id = DEPTH, size_t size = SIZE )
+    {
+        frame_holder f( alloc_frame( id, size, frame_additional_data(), true ) );
+        REQUIRE( f );
+        return f;
+    }
+};
+
+
+}  // namespace
+
+
+TEST_CASE( "frames are allocated from user memory and released to it", "[frame-allocator]" )
+{
+    user_memory memory;
+    test_source source;
+    source.set_frame_allocator( memory.make_allocator( 64 ) );
+
+    // Frames come from, and go back to, the archive's fixed heap
+    for( int i = 0; i < 40; ++i )
+    {
+        auto f = source.alloc();
+        CHECK( memory.owns( f->get_frame_data() ) );
+        CHECK( reinterpret_cast< uintptr_t >( f->get_frame_data() ) % 64 == 0 );
+        CHECK( f->get_frame_data_size() == SIZE );
+    }
+    CHECK( memory.allocations == 40 );
+    CHECK( memory.frees == 40 );
+
+    {
+        std::vector< frame_holder > held;
+        for( int i = 0; i < 16; ++i )
+            held.push_back( source.alloc() );
+        CHECK( memory.live.size() == 16 );
+
+        // The user holds on to too many frames: the next one is dropped, and its memory with it
+        CHECK( ! source.alloc_frame( DEPTH, SIZE, frame_additional_data(), true ) );
+        CHECK( memory.live.size() == 16 );
+    }
+    // Released with the source still alive: nothing may be kept until the archive is destroyed
+    CHECK( memory.live.empty() );
+
+    // Without a limit, frames are allocated on the heap instead
+    source.set_max_publish_list_size( 0 );
+    {
+        std::vector< frame_holder > held;
+        for( int i = 0; i < 20; ++i )
+            held.push_back( source.alloc() );
+        CHECK( memory.live.size() == 20 );
+    }
+    CHECK( memory.live.empty() );
+}
+
+TEST_CASE( "frames held past an allocator change go back to their own allocator", "[frame-allocator]" )
+{
+    user_memory first, second;
+    test_source source;
+    source.set_frame_allocator( first.make_allocator( 0 ) );
+    auto f = source.alloc();
+    CHECK( first.owns( f->get_frame_data() ) );
+
+    source.set_frame_allocator( second.make_allocator( 0 ) );
+    auto g = source.alloc();
+    CHECK( second.owns( g->get_frame_data() ) );
+
+    f = {};
+    CHECK( first.live.empty() );
+    CHECK( second.live.size() == 1 );
+    g = {};
+    CHECK( second.live.empty() );
+}
+
+TEST_CASE( "frames fall back to the default allocator", "[frame-allocator]" )
+{
+    user_memory memory;
+    test_source source;
+    source.set_frame_allocator( memory.make_allocator( 32 ) );
+
+    for( auto mode : { user_memory::out_of_memory, user_memory::misaligned, user_memory::throws } )
+    {
+        memory.mode = mode;
+        auto f = source.alloc();
+        REQUIRE( f->get_frame_data() );
+        CHECK( ! memory.owns( f->get_frame_data() ) );
+        CHECK( f->get_frame_data_size() == SIZE );
+        // Misaligned memory is given back right away
+        CHECK( memory.live.empty() );
+    }
+    CHECK( memory.allocations == memory.frees );
+
+    // Only video frames are written into user memory
+    memory.mode = user_memory::normal;
+    {
+        auto f = source.alloc( { RS2_STREAM_GYRO, 0, RS2_EXTENSION_MOTION_FRAME }, 12 );
+        CHECK( ! memory.owns( f->get_frame_data() ) );
+    }
+    CHECK( memory.allocations == 1 );  // the misaligned one
+
+    // Resetting the allocator goes back to internal memory
+    source.set_frame_allocator( nullptr );
+    {
+        auto f = source.alloc();
+        REQUIRE( f->get_frame_data() );
+        CHECK( f->get_frame_data_size() == SIZE );
+    }
+    CHECK( memory.allocations == 1 );
+    CHECK( memory.live.empty() );
+}
@@ -0,0 +1,71 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#include <src/frame-buffer-pool.h>
+
+#include "../catch.h"
+
+using namespace librealsense;
+
+
+TEST_CASE( "buffer is recycled by exact size", "[types]" )
+{
+    frame_buffer_pool pool;
+    std::vector< uint8_t > buffer;
+    REQUIRE_FALSE( pool.acquire( 100, 0., buffer ) );
+
+    buffer.resize( 100, 7 );
+    auto const data = buffer.data();
+    pool.release( std::move( buffer ), 0. );
+
+    std::vector< uint8_t > other;
+    REQUIRE_FALSE( pool.acquire( 200, 10., other ) );
+    REQUIRE( pool.acquire( 100, 10., other ) );
+    CHECK( other.size() == 100 );
+    CHECK( other.data() == data );
+    CHECK( other[99] == 7 );  // not zero-filled
+    REQUIRE_FALSE( pool.acquire( 100, 10., buffer ) );
+
+    auto stats = pool.get_stats();
+    CHECK( stats.hits == 1 );
+    CHECK( stats.misses == 3 );
+    CHECK( stats.evictions == 0 );
+}
+
+TEST_CASE( "stale buffers are evicted", "[types]" )
+{
+    frame_buffer_pool pool;
+    pool.release( std::vector< uint8_t >( 100 ), 0. );
+    pool.release( std::vector< uint8_t >( 100 ), 900. );
+
+    std::vector< uint8_t > buffer;
+    REQUIRE( pool.acquire( 100, 1500., buffer ) );  // the first is stale, the second is fine
+    REQUIRE_FALSE( pool.acquire( 100, 1500., buffer ) );
+
+    auto stats = pool.get_stats();
+    CHECK( stats.hits == 1 );
+    CHECK( stats.evictions == 1 );
+}
+
+TEST_CASE( "full pool drops buffers", "[types]" )
+{
+    frame_buffer_pool pool;
+    for( int i = 0; i < frame_buffer_pool::SLOTS + 1; ++i )
+        pool.release( std::vector< uint8_t >( 10 ), 0. );
+    CHECK( pool.get_stats().evictions == 1 );
+
+    // Sizes beyond the number of buckets have nowhere to go
+    for( size_t size = 1; size <= frame_buffer_pool::BUCKETS; ++size )
+        pool.release( std::vector< uint8_t >( size ), 0. );
+    CHECK( pool.get_stats().evictions == 2 );
+
+    // Once a bucket is emptied, it can be reused for another size
+    std::vector< uint8_t > buffer;
+    REQUIRE( pool.acquire( 1, 0., buffer ) );
+    pool.release( std::vector< uint8_t >( 1000 ), 0. );
+    CHECK( pool.get_stats().evictions == 2 );
+    REQUIRE( pool.acquire( 1000, 0., buffer ) );
+
+    pool.clear();
+    REQUIRE_FALSE( pool.acquire( 10, 0., buffer ) );
+}
@@ -0,0 +1,217 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+// Where the V4L2 backend captures into, per uvc_device::set_capture_memory(): its own memory-mapped buffers, each
+// exported as a DMABUF that maps to the same pixels as the frame, even on devices that otherwise capture into user
+// pointers; or memory from the user's allocator (USERPTR), which goes back to the user when the stream is closed, or
+// the backend's own if the allocator can't give any. Runs on vivid (see vivid.h).
+
+#include "../catch.h"
+
+#if defined( RS2_USE_V4L2_BACKEND )
+
+#include "vivid.h"
+
+#include <map>
+#include <set>
+#include <vector>
+
+
+namespace {
+
+
+int const buffers = 4;
+
+
+std::string white_vivid()
+{
+    auto node = vivid::find_capture_node();
+    if( node.empty() )
+        WARN( "vivid is not loaded" );
+    else
+    {
+        vivid::set_menu( node, "OSD Text Mode", "None" );
+        vivid::set_menu( node, "Test Pattern", "100% White" );
+    }
+    return node;
+}
+
+
+// Hands out blocks and keeps track of which are live
+struct user_memory
+{
+    bool out_of_memory = false;
+    std::mutex mutex;
+    std::map< uint8_t const *, size_t > live;  // block -> size
+    int allocations = 0;
+
+    librealsense::platform::capture_memory capture_memory()
+    {
+        librealsense::platform::capture_memory memory;
+        memory.allocate = [this]( size_t size ) -> std::shared_ptr< uint8_t >
+        {
+            if( out_of_memory )
+                return {};
+            std::lock_guard< std::mutex > lock( mutex );
+            ++allocations;
+            auto block = new uint8_t[size];
+            live[block] = size;
+            return std::shared_ptr< uint8_t >( block,
+                                               [this]( uint8_t * block )
+                                               {
+                                                   std::lock_guard< std::mutex > lock( mutex );
+                                                   live.erase( block );
+                                                   delete[] block;
+                                               } );
+        };
+        return memory;
+    }
+
+    bool owns( vivid::frame const & f )
+    {
+        std::lock_guard< std::mutex > lock( mutex );
+        for( auto & block : live )
+            if( f.pixels >= block.first && f.pixels + f.size <= block.first + block.second )
+                return true;
+        return false;
+    }
+};
+
+
+void check_exported( std::string const & node, bool use_memory_map )
+{
+    vivid::capture capture( node, use_memory_map );
+    librealsense::platform::capture_memory memory;
+    memory.export_dmabuf = true;
+    capture.device().set_capture_memory( memory );
+    capture.start( buffers );
+
+    std::vector< vivid::frame > held;
+    std::set< int > fds;
+    for( int i = 0; i < buffers; ++i )
+    {
+        held.push_back( capture.next() );
+        auto & f = held.back();
+        REQUIRE( f );
+        CHECK( f.is_white() );
+        REQUIRE( f.dmabuf_fd >= 0 );
+        fds.insert( f.dmabuf_fd );
+
+        // Mapped by whoever gets the descriptor, it's the same memory as the frame's
+        auto mapped = ::mmap( nullptr, f.size, PROT_READ, MAP_SHARED, f.dmabuf_fd, 0 );
+        REQUIRE( mapped != MAP_FAILED );
+        CHECK( ! std::memcmp( mapped, f.pixels, f.size ) );
+        ::munmap( mapped, f.size );
+    }
+    // One per buffer, for as long as the stream is open
+    CHECK( fds.size() == size_t( buffers ) );
+    for( auto & f : held )
+        f.release();
+    auto f = capture.next();
+    REQUIRE( f );
+    CHECK( fds.count( f.dmabuf_fd ) );
+    f.release();
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "capture buffers exported as DMABUFs", "[v4l2]" )
+{
+    auto const node = white_vivid();
+    if( node.empty() )
+        return;
+
+    check_exported( node, true );
+}
+
+TEST_CASE( "capture buffers exported as DMABUFs on user-pointer devices", "[v4l2]" )
+{
+    auto const node = white_vivid();
+    if( node.empty() )
+        return;
+
+    // As USB devices are: the buffers are memory-mapped anyway, or there would be nothing to export
+    check_exported( node, false );
+
+    // Not asked to export, the device keeps to user pointers
+    vivid::capture capture( node, false );
+    capture.start( buffers );
+    auto f = capture.next();
+    REQUIRE( f );
+    CHECK( f.is_white() );
+    CHECK( f.dmabuf_fd == -1 );
+    f.release();
+}
+
+TEST_CASE( "capture buffers are not exported unless asked to", "[v4l2]" )
+{
+    auto const node = white_vivid();
+    if( node.empty() )
+        return;
+
+    vivid::capture capture( node );
+    capture.start( buffers );
+    auto f = capture.next();
+    REQUIRE( f );
+    CHECK( f.is_white() );
+    CHECK( f.dmabuf_fd == -1 );
+    f.release();
+}
+
+TEST_CASE( "capture into user memory", "[v4l2]" )
+{
+    auto const node = white_vivid();
+    if( node.empty() )
+        return;
+
+    user_memory memory;
+    {
+        vivid::capture capture( node );
+        capture.device().set_capture_memory( memory.capture_memory() );
+        capture.start( buffers );
+        CHECK( memory.allocations == buffers );
+
+        std::set< uint8_t const * > pixels;
+        for( int i = 0; i < 3 * buffers; ++i )
+        {
+            auto f = capture.next();
+            REQUIRE( f );
+            // Straight into the user's memory: no copy, and so no DMABUF either
+            CHECK( memory.owns( f ) );
+            CHECK( f.is_white() );
+            CHECK( f.dmabuf_fd == -1 );
+            pixels.insert( f.pixels );
+            f.release();
+        }
+        CHECK( pixels.size() <= size_t( buffers ) );
+    }
+    // All back to the user once the stream is closed
+    CHECK( memory.live.empty() );
+}
+
+TEST_CASE( "capture into internal memory when the user has none", "[v4l2]" )
+{
+    auto const node = white_vivid();
+    if( node.empty() )
+        return;
+
+    user_memory memory;
+    memory.out_of_memory = true;
+    vivid::capture capture( node );
+    capture.device().set_capture_memory( memory.capture_memory() );
+    capture.start( buffers );
+    for( int i = 0; i < buffers; ++i )
+    {
+        auto f = capture.next();
+        REQUIRE( f );
+        CHECK( f.is_white() );
+        f.release();
+    }
+    CHECK( memory.allocations == 0 );
+}
+
+#endif
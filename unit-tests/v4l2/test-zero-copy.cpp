@@ -0,0 +1,146 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+//#cmake: static!
+
+// With zero-copy, a frame wraps the V4L2 buffer it was captured into, and the buffer goes back to the driver (is
+// re-queued) only when the frame is released: until then nothing can be captured into it, and its contents are those
+// of the frame. Frames can be held past the stream, too. Runs on vivid (see vivid.h).
+
+#include "../catch.h"
+
+#if defined( RS2_USE_V4L2_BACKEND )
+
+#include "vivid.h"
+
+#include <set>
+#include <vector>
+
+
+TEST_CASE( "zero-copy frames keep their buffers until released", "[v4l2]" )
+{
+    auto const node = vivid::find_capture_node();
+    if( node.empty() )
+    {
+        WARN( "vivid is not loaded" );
+        return;
+    }
+    vivid::set_menu( node, "OSD Text Mode", "None" );
+    vivid::set_menu( node, "Test Pattern", "100% White" );
+
+    vivid::capture capture( node );
+    REQUIRE( capture.device().supports_zero_copy() );
+    size_t const buffers = 4;
+    capture.start( int( buffers ) );
+
+    std::vector< vivid::frame > held;
+    std::set< uint8_t const * > pixels;
+    for( size_t i = 0; i < buffers; ++i )
+    {
+        held.push_back( capture.next() );
+        REQUIRE( held.back() );
+        CHECK( held.back().is_white() );
+        pixels.insert( held.back().pixels );
+    }
+    // Each in its own buffer: with all of them held, the driver has nothing to capture into
+    CHECK( pixels.size() == buffers );
+    CHECK( ! capture.next( std::chrono::milliseconds( 500 ) ) );
+
+    // Once released, a buffer is captured into again, while the ones still held keep their frames
+    vivid::set_menu( node, "Test Pattern", "100% Black" );
+    held[0].release();
+    auto f = capture.next();
+    REQUIRE( f );
+    CHECK( f.pixels == held[0].pixels );
+    CHECK( f.is_black() );
+    for( size_t i = 1; i < buffers; ++i )
+        CHECK( held[i].is_white() );
+    CHECK( ! capture.next( std::chrono::milliseconds( 500 ) ) );
+    f.release();
+
+    // And frames keep coming, in the same buffers, as long as they're released
+    for( size_t i = 1; i < buffers; ++i )
+        held[i].release();
+    for( size_t i = 0; i < 3 * buffers; ++i )
+    {
+        f = capture.next();
+        REQUIRE( f );
+        CHECK( pixels.count( f.pixels ) );
+        CHECK( f.is_black() );
+        f.release();
+    }
+}
+
+TEST_CASE( "zero-copy frames held across stop, close and restart", "[v4l2]" )
+{
+    auto const node = vivid::find_capture_node();
+    if( node.empty() )
+    {
+        WARN( "vivid is not loaded" );
+        return;
+    }
+    vivid::set_menu( node, "OSD Text Mode", "None" );
+    vivid::set_menu( node, "Test Pattern", "100% White" );
+    int const buffers = 4;
+
+    {
+        vivid::capture capture( node );
+        capture.start( buffers );
+        auto held = capture.next();
+        REQUIRE( held );
+        CHECK( held.is_white() );
+
+        // Closing frees the kernel buffers, or the next run couldn't get any; the frame keeps its pixels
+        capture.stop();
+        CHECK( held.is_white() );
+
+        vivid::set_menu( node, "Test Pattern", "100% Black" );
+        capture.start( buffers );
+        std::vector< vivid::frame > frames;
+        for( int i = 0; i < buffers; ++i )
+        {
+            frames.push_back( capture.next() );
+            REQUIRE( frames.back() );
+            CHECK( frames.back().is_black() );
+        }
+        CHECK( held.is_white() );
+
+        // Released late, the frame must not re-queue its buffer (by index) into this run: that would be one of
+        // those held, which would be captured into
+        held.release();
+        CHECK( ! capture.next( std::chrono::milliseconds( 500 ) ) );
+        for( auto & f : frames )
+            CHECK( f.is_black() );
+
+        for( auto & f : frames )
+            f.release();
+        auto f = capture.next();
+        REQUIRE( f );
+        CHECK( f.is_black() );
+        f.release();
+    }
+
+    // Held past the device, too: the release has nothing left to re-queue into
+    vivid::frame orphan;
+    {
+        vivid::capture capture( node );
+        capture.start( buffers );
+        orphan = capture.next();
+        REQUIRE( orphan );
+    }
+    CHECK( orphan.is_black() );
+    orphan.release();
+
+    // And the node streams again as usual
+    vivid::capture capture( node );
+    capture.start( buffers );
+    for( int i = 0; i < 2 * buffers; ++i )
+    {
+        auto f = capture.next();
+        REQUIRE( f );
+        CHECK( f.is_black() );
+        f.release();
+    }
+}
+
+#endif
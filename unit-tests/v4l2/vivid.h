@@ -0,0 +1,188 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2026 RealSense, Inc. All Rights Reserved.
+
+#pragma once
+
+// vivid, the Virtual Video Test Driver ('sudo modprobe vivid'), has video capture nodes with the same videobuf2 queues
+// as uvcvideo, and a test pattern we can choose: enough to stream through the V4L2 backend without a camera. Tests
+// that use it pass without checking anything when it is not loaded.
+
+#include <src/linux/backend-v4l2.h>
+#include <rsutils/type/fourcc.h>
+
+#include "../catch.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+
+namespace vivid {
+
+
+using namespace librealsense::platform;
+
+
+// The first vivid video capture node, or empty if vivid is not loaded
+inline std::string find_capture_node()
+{
+    for( int i = 0; i < 64; ++i )
+    {
+        std::string const node = "/dev/video" + std::to_string( i );
+        int const fd = ::open( node.c_str(), O_RDWR | O_NONBLOCK );
+        if( fd < 0 )
+            continue;
+        v4l2_capability cap = {};
+        bool const found = ::ioctl( fd, VIDIOC_QUERYCAP, &cap ) == 0
+                        && ! strcmp( reinterpret_cast< char const * >( cap.driver ), "vivid" )
+                        && ( cap.device_caps & V4L2_CAP_VIDEO_CAPTURE ) && ( cap.device_caps & V4L2_CAP_STREAMING )
+                        && ! ( cap.device_caps & V4L2_CAP_TOUCH );
+        ::close( fd );
+        if( found )
+            return node;
+    }
+    return {};
+}
+
+
+// Sets a menu control, e.g. "Test Pattern", to one of its items, e.g. "100% White", by the names vivid gives them
+inline void set_menu( std::string const & node, char const * control, char const * item )
+{
+    int const fd = ::open( node.c_str(), O_RDWR | O_NONBLOCK );
+    REQUIRE( fd >= 0 );
+    bool set = false;
+    v4l2_queryctrl query = {};
+    query.id = V4L2_CTRL_FLAG_NEXT_CTRL;
+    while( ! set && ::ioctl( fd, VIDIOC_QUERYCTRL, &query ) == 0 )
+    {
+        if( query.type == V4L2_CTRL_TYPE_MENU && ! strcmp( reinterpret_cast< char const * >( query.name ), control ) )
+        {
+            for( auto i = query.minimum; i <= query.maximum && ! set; ++i )
+            {
+                v4l2_querymenu menu = {};
+                menu.id = query.id;
+                menu.index = uint32_t( i );
+                if( ::ioctl( fd, VIDIOC_QUERYMENU, &menu ) == 0
+                    && ! strcmp( reinterpret_cast< char const * >( menu.name ), item ) )
+                {
+                    v4l2_control value = { query.id, i };
+                    set = ::ioctl( fd, VIDIOC_S_CTRL, &value ) == 0;
+                }
+            }
+        }
+        query.id |= V4L2_CTRL_FLAG_NEXT_CTRL;
+    }
+    ::close( fd );
+    CAPTURE( node, control, item );
+    REQUIRE( set );
+}
+
+
+// A frame as the backend hands it over: it keeps its buffer until released
+struct frame
+{
+    uint8_t const * pixels = nullptr;
+    size_t size = 0;
+    int dmabuf_fd = -1;
+    std::function< void() > release;  // the continuation, which re-queues the buffer
+
+    explicit operator bool() const { return pixels != nullptr; }
+
+    // YUYV: every luma byte in [low, high]
+    bool luma_within( uint8_t low, uint8_t high ) const
+    {
+        for( size_t i = 0; i < size; i += 2 )
+            if( pixels[i] < low || pixels[i] > high )
+                return false;
+        return size > 0;
+    }
+    bool is_white() const { return luma_within( 200, 255 ); }
+    bool is_black() const { return luma_within( 0, 50 ); }
+};
+
+
+// Streams YUYV from a vivid node through the V4L2 backend, and queues up the frames as they arrive without releasing
+// any. Buffers are memory-mapped as for MIPI devices, unless 'use_memory_map' is off as for USB ones.
+class capture
+{
+    v4l_uvc_device _dev;
+    stream_profile _profile = {};
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::deque< frame > _frames;
+
+    static uvc_device_info info_of( std::string const & node )
+    {
+        uvc_device_info info;
+        info.id = node;
+        info.device_path = node;
+        return info;
+    }
+
+public:
+    capture( std::string const & node, bool use_memory_map = true )
+        : _dev( info_of( node ), use_memory_map )
+    {
+        _dev.set_power_state( D0 );
+        // The smallest YUYV frames, at the highest rate, so the test doesn't take long
+        rsutils::type::fourcc const yuyv( 'Y', 'U', 'Y', 'V' );
+        for( auto & p : _dev.get_profiles() )
+            if( p.format == yuyv
+                && ( ! _profile.format || p.width * p.height < _profile.width * _profile.height
+                     || ( p.width * p.height == _profile.width * _profile.height && p.fps > _profile.fps ) ) )
+                _profile = p;
+        REQUIRE( _profile.format );
+    }
+
+    ~capture()
+    {
+        stop();
+        _dev.set_power_state( D3 );
+    }
+
+    uvc_device & device() { return _dev; }
+
+    void start( int buffers )
+    {
+        _dev.probe_and_commit(
+            _profile,
+            [this]( stream_profile, frame_object fo, std::function< void() > continuation )
+            {
+                std::lock_guard< std::mutex > lock( _mutex );
+                _frames.push_back( { static_cast< uint8_t const * >( fo.pixels ), fo.frame_size, fo.dmabuf_fd,
+                                     std::move( continuation ) } );
+                _cv.notify_all();
+            },
+            buffers );
+        _dev.stream_on( []( librealsense::notification const & ) {} );
+        _dev.start_callbacks();
+    }
+
+    // The next frame, or an empty one if none arrives in time
+    frame next( std::chrono::milliseconds timeout = std::chrono::seconds( 2 ) )
+    {
+        std::unique_lock< std::mutex > lock( _mutex );
+        if( ! _cv.wait_for( lock, timeout, [this] { return ! _frames.empty(); } ) )
+            return {};
+        auto f = std::move( _frames.front() );
+        _frames.pop_front();
+        return f;
+    }
+
+    // Frames still held by the test keep their pixels, and can be released any time after
+    void stop()
+    {
+        _dev.stop_callbacks();
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            for( auto & f : _frames )
+                f.release();
+            _frames.clear();
+        }
+        _dev.close( _profile );
+    }
+};
+
+
+}  // namespace vivid
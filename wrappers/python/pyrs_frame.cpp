@@ -144,6 +144,7 @@ void init_frame(py::module &m) {
         .def_property_readonly("frame_timestamp_domain", &rs2::frame::get_frame_timestamp_domain, "The timestamp domain. Identical to calling get_frame_timestamp_domain.")
         .def("get_frame_metadata", &rs2::frame::get_frame_metadata, "Retrieve the current value of a single frame_metadata.", "frame_metadata"_a)
         .def("supports_frame_metadata", &rs2::frame::supports_frame_metadata, "Determine if the device allows a specific metadata to be queried.", "frame_metadata"_a)
+        .def("get_frame_metadata_all", &rs2::frame::get_frame_metadata_all, "Retrieve all the supported frame_metadata values at once, as a dict.")
         .def("get_frame_number", &rs2::frame::get_frame_number, "Retrieve the frame number.")
         .def_property_readonly("frame_number", &rs2::frame::get_frame_number, "The frame number. Identical to calling get_frame_number.")
         .def("get_data_size", &rs2::frame::get_data_size, "Retrieve data size from frame handle.")
@@ -309,7 +310,15 @@ void init_frame(py::module &m) {
     motion_frame.def(py::init<rs2::frame>())
         .def("get_motion_data", &rs2::motion_frame::get_motion_data, "Retrieve motion data from a GYRO/ACCEL sensor")
         .def("get_combined_motion_data", &rs2::motion_frame::get_combined_motion_data, "Retrieve motion data from a MOTION sensor")
-        .def_property_readonly("motion_data", &rs2::motion_frame::get_motion_data, "Motion data from IMU sensor. Identical to calling get_motion_data.");
+        .def_property_readonly("motion_data", &rs2::motion_frame::get_motion_data, "Motion data from IMU sensor. Identical to calling get_motion_data.")
+        .def("get_samples", [](const rs2::motion_frame& self) {
+            py::list samples;
+            auto p = self.get_samples();
+            for (int i = 0, n = self.get_sample_count(); i < n; ++i)
+                samples.append(py::make_tuple(p[i].data, p[i].timestamp, p[i].frame_number));
+            return samples;
+        }, "Retrieve the samples of a frame batched by option.motion_batch_window, oldest first, as (motion data, "
+           "timestamp, frame number) tuples; empty if the frame is not a batch");
 
     py::class_<rs2::pose_frame, rs2::frame> pose_frame(m, "pose_frame", "Extends the frame class with additional pose related attributes and functions.");
     pose_frame.def(py::init<rs2::frame>())
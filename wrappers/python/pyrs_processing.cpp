@@ -71,6 +71,7 @@ void init_processing(py::module &m) {
         .def( BIND_DOWNCAST( filter, rotation_filter ) )
         .def(BIND_DOWNCAST(filter, disparity_transform))
         .def(BIND_DOWNCAST(filter, hole_filling_filter))
+        .def(BIND_DOWNCAST(filter, depth_pipeline))
         .def(BIND_DOWNCAST(filter, spatial_filter))
         .def(BIND_DOWNCAST(filter, temporal_filter))
         .def(BIND_DOWNCAST(filter, threshold_filter))
@@ -128,7 +129,7 @@ void init_processing(py::module &m) {
         auto success = self.try_wait_for_frames( &fs, timeout_ms );
         return std::make_tuple( success, fs );
     };
-    syncer.def( py::init< int >(), "queue_size"_a = 1 )
+    syncer.def( py::init< int, bool >(), "queue_size"_a = 1, "lock_free"_a = false )
         .def( "wait_for_frames",
               &rs2::syncer::wait_for_frames,
               "Wait until a coherent set of frames becomes available",
@@ -211,6 +212,12 @@ void init_processing(py::module &m) {
              "1 - farest_from_around - Use the value from the neighboring pixel which is furthest away from the sensor\n"
              "2 - nearest_from_around - -Use the value from the neighboring pixel closest to the sensor", "mode"_a);
 
+    py::class_<rs2::depth_pipeline, rs2::filter> depth_pipeline(m, "depth_pipeline", "Runs decimation, depth to disparity, spatial, temporal and "
+                                                                "disparity to depth in a single pass over each frame, with the same output as the "
+                                                                "chained blocks. The stages keep their own options; pass None to leave one out.");
+    depth_pipeline.def(py::init<const rs2::decimation_filter*, const rs2::spatial_filter*, const rs2::temporal_filter*>(),
+                       "decimation"_a, "spatial"_a, "temporal"_a);
+
     py::class_<rs2::hdr_merge, rs2::filter> hdr_merge(m, "hdr_merge", "Merges depth frames with different sequence ID");
     hdr_merge.def(py::init<>());
 
@@ -8,6 +8,12 @@ void init_record_playback(py::module &m) {
     /** rs_record_playback.hpp **/
 // Not binding status_changed_callback, templated
 
+    py::class_<rs2_playback_stream_range> playback_stream_range(m, "playback_stream_range", "What a playback file holds of one stream.");
+    playback_stream_range.def(py::init<>())
+        .def_readonly("frame_count", &rs2_playback_stream_range::frame_count, "Frames of the stream in the file")
+        .def_readonly("first_frame_ns", &rs2_playback_stream_range::first_frame_ns, "File time of the first frame, in nanoseconds")
+        .def_readonly("last_frame_ns", &rs2_playback_stream_range::last_frame_ns, "File time of the last frame, in nanoseconds");
+
     py::class_<rs2::playback, rs2::device, py_holder<rs2::playback>> playback(m, "playback"); // No docstring in C++
     playback.def(py::init<rs2::device>(), "device"_a)
         .def("pause", &rs2::playback::pause, "Pauses the playback. Calling pause() in \"Paused\" status does nothing. If "
@@ -18,6 +24,8 @@ void init_record_playback(py::module &m) {
         .def("file_name", &rs2::playback::file_name, "The name of the playback file.")
         .def("get_position", &rs2::playback::get_position, "Retrieves the current position of the playback in the file in terms of time. Units are expressed in nanoseconds.")
         .def("get_duration", &rs2::playback::get_duration, "Retrieves the total duration of the file.")
+        .def("get_stream_range", &rs2::playback::get_stream_range, "Retrieves how many frames of a stream the file holds, and the "
+             "file times of the first and last of them, without reading through the file.", "stream"_a, "index"_a = 0)
         .def("seek", &rs2::playback::seek, "Sets the playback to a specified time point of the played data.", "time"_a,
              py::call_guard<py::gil_scoped_release>())
         .def("is_real_time", &rs2::playback::is_real_time, "Indicates if playback is in real time mode or non real time.")
@@ -35,11 +43,25 @@ void init_record_playback(py::module &m) {
         .def("current_status", &rs2::playback::current_status, "Returns the current state of the playback device");
     // Stop?
 
+    py::class_<rs2_record_statistics> record_statistics(m, "record_statistics", "Counters describing how well a recorder keeps up with its sensors.");
+    record_statistics.def(py::init<>())
+        .def_readonly("frames_received", &rs2_record_statistics::frames_received, "Frames the sensors handed to the recorder")
+        .def_readonly("frames_written", &rs2_record_statistics::frames_written, "Frames written to the file")
+        .def_readonly("frames_dropped", &rs2_record_statistics::frames_dropped, "Frames dropped by the overflow policy")
+        .def_readonly("queued_bytes", &rs2_record_statistics::queued_bytes, "Frame data currently waiting to be written")
+        .def_readonly("max_queued_bytes", &rs2_record_statistics::max_queued_bytes, "The most frame data that was waiting to be written at once")
+        .def_readonly("blocked_ns", &rs2_record_statistics::blocked_ns, "Total time sensors waited for room, with the block policy");
+
     py::class_<rs2::recorder, rs2::device, py_holder<rs2::recorder>> recorder(m, "recorder", "Records the given device and saves it to the given file as rosbag format.");
     recorder.def(py::init<const std::string&, rs2::device>())
         .def(py::init<const std::string&, rs2::device, bool>())
         .def("pause", &rs2::recorder::pause, "Pause the recording device without stopping the actual device from streaming.")
-        .def("resume", &rs2::recorder::resume, "Unpauses the recording device, making it resume recording.");
+        .def("resume", &rs2::recorder::resume, "Unpauses the recording device, making it resume recording.")
+        .def("set_queue_limit", &rs2::recorder::set_queue_limit, "Limits how much frame data the recorder may hold while "
+             "waiting to write it to file, and sets what happens to frames that do not fit.", "max_bytes"_a, "policy"_a)
+        .def("get_statistics", &rs2::recorder::get_statistics, "Gets the recorder's frame counters.")
+        .def("set_stream_codec", &rs2::recorder::set_stream_codec, "Sets how the recorder compresses the frames of one "
+             "stream, from the next frame on.", "stream"_a, "index"_a, "codec"_a);
     // filename?
     /** end rs_record_playback.hpp **/
 }